@@ -0,0 +1,77 @@
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Data/RealtimeMeshCollisionCookScheduler.h"
+#include "RealtimeMeshCore.h"
+
+namespace RealtimeMesh
+{
+	TOptional<FRealtimeMeshCollisionCookScheduler::FTicket> FRealtimeMeshCollisionCookScheduler::Request(int32 Version, int32 MaxConsecutiveCancels)
+	{
+		FScopeLock ScopeLock(&Lock);
+
+		if (!InFlightCook.IsSet())
+		{
+			FTicket& Ticket = InFlightCook.Emplace();
+			Ticket.Version = Version;
+			bHasPendingRequest = false;
+
+			FRealtimeMeshStatCounters::Get().CollisionCooksStarted++;
+			return Ticket;
+		}
+
+		if (bHasPendingRequest)
+		{
+			FRealtimeMeshStatCounters::Get().CollisionCooksCoalesced++;
+		}
+		bHasPendingRequest = true;
+
+		if (!InFlightCook->CancellationToken.IsCancelled() && NumConsecutiveCancels < MaxConsecutiveCancels)
+		{
+			InFlightCook->CancellationToken.Cancel();
+			NumConsecutiveCancels++;
+		}
+
+		return TOptional<FTicket>();
+	}
+
+	bool FRealtimeMeshCollisionCookScheduler::Finish(int32 Version, bool bWasCancelled)
+	{
+		FScopeLock ScopeLock(&Lock);
+
+		if (!InFlightCook.IsSet() || InFlightCook->Version != Version)
+		{
+			return false;
+		}
+
+		InFlightCook.Reset();
+
+		if (bWasCancelled)
+		{
+			FRealtimeMeshStatCounters::Get().CollisionCooksCancelled++;
+		}
+		else
+		{
+			NumConsecutiveCancels = 0;
+		}
+
+		return bHasPendingRequest;
+	}
+
+	bool FRealtimeMeshCollisionCookScheduler::IsCookInFlight() const
+	{
+		FScopeLock ScopeLock(&Lock);
+		return InFlightCook.IsSet();
+	}
+
+	bool FRealtimeMeshCollisionCookScheduler::HasPendingRequest() const
+	{
+		FScopeLock ScopeLock(&Lock);
+		return bHasPendingRequest;
+	}
+
+	int32 FRealtimeMeshCollisionCookScheduler::GetNumConsecutiveCancels() const
+	{
+		FScopeLock ScopeLock(&Lock);
+		return NumConsecutiveCancels;
+	}
+}
@@ -5,6 +5,7 @@
 #include "RealtimeMesh.h"
 #include "RealtimeMeshSceneViewExtension.h"
 #include "RealtimeMeshSubsystem.h"
+#include "RealtimeMeshCollisionLibrary.h"
 #include "Core/RealtimeMeshFuture.h"
 #include "Data/RealtimeMeshLOD.h"
 #include "Data/RealtimeMeshSectionGroup.h"
@@ -13,9 +14,15 @@
 #include "RenderProxy/RealtimeMeshProxy.h"
 #include "RenderProxy/RealtimeMeshProxyCommandBatch.h"
 #include "Logging/MessageLog.h"
+#include "Async/ParallelFor.h"
 
 #define LOCTEXT_NAMESPACE "RealtimeMesh"
 
+static TAutoConsoleVariable<int32> CVarRealtimeMeshCollisionMaxCookConcurrency(
+	TEXT("RealtimeMesh.Collision.MaxCookConcurrency"),
+	0,
+	TEXT("Maximum number of convex hulls and complex meshes of a single collision update cooked at once. 0 uses every available worker thread"));
+
 namespace RealtimeMesh
 {
 	FRealtimeMesh::FRealtimeMesh(const FRealtimeMeshSharedResourcesRef& InSharedResources)
@@ -65,28 +72,23 @@ namespace RealtimeMesh
 	}
 
 	TFuture<ERealtimeMeshCollisionUpdateResult> FRealtimeMesh::UpdateCollision(FRealtimeMeshCollisionInfo&& InCollisionData, int32 NewCollisionKey)
+	{
+		return UpdateCollision(MoveTemp(InCollisionData), NewCollisionKey, FRealtimeMeshCancellationToken());
+	}
+
+	TFuture<ERealtimeMeshCollisionUpdateResult> FRealtimeMesh::UpdateCollision(FRealtimeMeshCollisionInfo&& InCollisionData, int32 NewCollisionKey, const FRealtimeMeshCancellationToken& CancellationToken)
 	{
 		// TODO: We can skip cook based on simpleascomplex or complexassimple
-		TArray<int32> MeshesNeedingCook = InCollisionData.ComplexGeometry.GetMeshIDsNeedingCook();
-		TArray<int32> ConvexObjectsNeedingCook = InCollisionData.SimpleGeometry.GetMeshIDsNeedingCook();
-		const bool bNeedsCookAnything = MeshesNeedingCook.Num() > 0 || ConvexObjectsNeedingCook.Num() > 0;
+		const TMap<int32, uint32> TopologyHashes = RefitDeformableCollision(InCollisionData);
 
-		// Cook all meshes/convex's that need to be cooked.
-		if (bNeedsCookAnything)
+		// Partially cooked data can't be applied
+		if (!URealtimeMeshCollisionTools::CookCollisionInfo(InCollisionData, CVarRealtimeMeshCollisionMaxCookConcurrency.GetValueOnAnyThread(), CancellationToken))
 		{
-			ParallelForTemplate(MeshesNeedingCook.Num() + ConvexObjectsNeedingCook.Num(), [&InCollisionData, &MeshesNeedingCook, &ConvexObjectsNeedingCook](int32 Index)
-			{
-				if (Index < MeshesNeedingCook.Num())
-				{
-					URealtimeMeshCollisionTools::CookComplexMesh(InCollisionData.ComplexGeometry.GetByIndex(MeshesNeedingCook[Index]));
-				}
-				else
-				{
-					URealtimeMeshCollisionTools::CookConvexHull(InCollisionData.SimpleGeometry.ConvexHulls.GetByIndex(ConvexObjectsNeedingCook[Index - MeshesNeedingCook.Num()]));
-				}
-			});
+			return MakeFulfilledPromise<ERealtimeMeshCollisionUpdateResult>(ERealtimeMeshCollisionUpdateResult::Ignored).GetFuture();
 		}
 
+		CacheDeformableCollision(InCollisionData, TopologyHashes);
+
 		return DoOnGameThread([ThisWeak = this->AsWeak(), CollisionData = MoveTemp(InCollisionData), NewCollisionKey]() mutable
 		{
 			check(IsInGameThread());
@@ -108,6 +110,64 @@ namespace RealtimeMesh
 		});
 	}
 
+	TMap<int32, uint32> FRealtimeMesh::RefitDeformableCollision(FRealtimeMeshCollisionInfo& CollisionData)
+	{
+		TMap<int32, uint32> TopologyHashes;
+		if (!CollisionData.Configuration.bDeformableMesh)
+		{
+			return TopologyHashes;
+		}
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMesh::RefitDeformableCollision);
+
+		const TArray<int32> MeshIDs = CollisionData.ComplexGeometry.GetMeshIDsNeedingCook();
+		TArray<TSharedPtr<FRealtimeMeshCookedTriMeshData>> PreviousCooks;
+		PreviousCooks.SetNum(MeshIDs.Num());
+
+		TopologyHashes.Reserve(MeshIDs.Num());
+		{
+			FScopeLock Lock(&DeformableCollisionCacheLock);
+			for (int32 Index = 0; Index < MeshIDs.Num(); Index++)
+			{
+				const uint32 TopologyHash = URealtimeMeshCollisionTools::GetComplexMeshTopologyHash(CollisionData.ComplexGeometry.GetByIndex(MeshIDs[Index]), CollisionData.Configuration);
+				TopologyHashes.Add(MeshIDs[Index], TopologyHash);
+
+				const FDeformableCollisionCacheEntry* Entry = DeformableCollisionCache.Find(MeshIDs[Index]);
+				if (Entry && Entry->TopologyHash == TopologyHash)
+				{
+					PreviousCooks[Index] = Entry->Cooked;
+				}
+			}
+		}
+
+		// Anything that can't be refit is left for the regular cook
+		ParallelFor(MeshIDs.Num(), [&](int32 Index)
+		{
+			if (PreviousCooks[Index].IsValid())
+			{
+				URealtimeMeshCollisionTools::RefitComplexMesh(CollisionData.ComplexGeometry.GetByIndex(MeshIDs[Index]), *PreviousCooks[Index]);
+			}
+		});
+
+		return TopologyHashes;
+	}
+
+	void FRealtimeMesh::CacheDeformableCollision(const FRealtimeMeshCollisionInfo& CollisionData, const TMap<int32, uint32>& TopologyHashes)
+	{
+		FScopeLock Lock(&DeformableCollisionCacheLock);
+
+		// Rebuilt from scratch every cook so meshes that went away don't keep their cooked data alive
+		DeformableCollisionCache.Reset();
+		for (const TPair<int32, uint32>& MeshHash : TopologyHashes)
+		{
+			const FRealtimeMeshCollisionMesh& CollisionMesh = CollisionData.ComplexGeometry.GetByIndex(MeshHash.Key);
+			if (CollisionMesh.HasCookedMesh())
+			{
+				DeformableCollisionCache.Add(MeshHash.Key, { CollisionMesh.GetCooked(), MeshHash.Value });
+			}
+		}
+	}
+
 	void FRealtimeMesh::MarkForEndOfFrameUpdate() const
 	{
 		FRealtimeMeshEndOfFrameUpdateManager::Get().MarkComponentForUpdate(ConstCastWeakPtr<FRealtimeMesh>(this->AsWeak()));
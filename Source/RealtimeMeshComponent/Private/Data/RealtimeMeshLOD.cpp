@@ -48,6 +48,7 @@ namespace RealtimeMesh
 
 		Config = FRealtimeMeshLODConfig();
 		SectionGroups.Empty();
+		SectionGroupSlots.Empty();
 		Bounds.Reset();
 
 		InitializeProxy(UpdateContext);
@@ -75,14 +76,11 @@ namespace RealtimeMesh
 	{
 		if (!SectionGroups.Contains(SectionGroupKey))
 		{
-			SectionGroups.Add(SharedResources->CreateSectionGroup(SectionGroupKey));
+			const auto SectionGroup = AddSectionGroup(SectionGroupKey);
 
 			if (auto ProxyBuilder = UpdateContext.GetProxyBuilder())
 			{
-				ProxyBuilder->AddLODTask(Key, [SectionGroupKey](FRHICommandListBase& RHICmdList, FRealtimeMeshLODProxy& Proxy)
-				{
-					Proxy.CreateSectionGroupIfNotExists(SectionGroupKey);
-				});
+				ProxyBuilder->AddCreateSectionGroupCommand(SectionGroupKey, SectionGroup->Handle);
 			}
 		}
 
@@ -92,18 +90,27 @@ namespace RealtimeMesh
 
 	void FRealtimeMeshLOD::RemoveSectionGroup(FRealtimeMeshUpdateContext& UpdateContext, const FRealtimeMeshSectionGroupKey& SectionGroupKey)
 	{
-		if (SectionGroups.Remove(SectionGroupKey))
+		if (const FRealtimeMeshSectionGroupRef* SectionGroup = SectionGroups.Find(SectionGroupKey))
 		{
+			const FRealtimeMeshHandle SectionGroupHandle = (*SectionGroup)->Handle;
+			SectionGroups.Remove(SectionGroupKey);
+			SectionGroupSlots.Remove(SectionGroupHandle);
+
 			if (auto ProxyBuilder = UpdateContext.GetProxyBuilder())
 			{
-				ProxyBuilder->AddLODTask(Key, [SectionGroupKey](FRHICommandListBase& RHICmdList, FRealtimeMeshLODProxy& Proxy)
-				{
-					Proxy.RemoveSectionGroup(SectionGroupKey);
-				}, ShouldRecreateProxyOnChange(UpdateContext));
+				ProxyBuilder->AddRemoveSectionGroupCommand(SectionGroupKey, SectionGroupHandle, ShouldRecreateProxyOnChange(UpdateContext));
 			}
 		}
 	}
 
+	FRealtimeMeshSectionGroupRef FRealtimeMeshLOD::AddSectionGroup(const FRealtimeMeshSectionGroupKey& SectionGroupKey)
+	{
+		const FRealtimeMeshSectionGroupRef SectionGroup = SharedResources->CreateSectionGroup(SectionGroupKey);
+		SectionGroup->Handle = SectionGroupSlots.Add(SectionGroupKey);
+		SectionGroups.Add(SectionGroup);
+		return SectionGroup;
+	}
+
 
 	bool FRealtimeMeshLOD::Serialize(FArchive& Ar)
 	{
@@ -113,29 +120,27 @@ namespace RealtimeMesh
 		if (Ar.CustomVer(RealtimeMesh::FRealtimeMeshVersion::GUID) < FRealtimeMeshVersion::DataRestructure)
 		{
 			SectionGroups.Empty();
+			SectionGroupSlots.Empty();
 			for (int32 Index = 0; Index < NumSectionGroups; Index++)
 			{
 				int32 SectionGroupIndex;
 				Ar << SectionGroupIndex;
 
 				FRealtimeMeshSectionGroupKey SectionGroupKey = FRealtimeMeshSectionGroupKey::Create(Key, SectionGroupIndex);
-				auto SectionGroup = SharedResources->CreateSectionGroup(SectionGroupKey);
-				SectionGroup->Serialize(Ar);
-				SectionGroups.Add(SectionGroup);
+				AddSectionGroup(SectionGroupKey)->Serialize(Ar);
 			}
 		}
 		else if (Ar.IsLoading())
 		{
 			SectionGroups.Empty();
+			SectionGroupSlots.Empty();
 			for (int32 Index = 0; Index < NumSectionGroups; Index++)
 			{
 				FName SectionGroupName;
 				Ar << SectionGroupName;
 
 				FRealtimeMeshSectionGroupKey SectionGroupKey = FRealtimeMeshSectionGroupKey::Create(Key, SectionGroupName);
-				auto SectionGroup = SharedResources->CreateSectionGroup(SectionGroupKey);
-				SectionGroup->Serialize(Ar);
-				SectionGroups.Add(SectionGroup);
+				AddSectionGroup(SectionGroupKey)->Serialize(Ar);
 			}
 		}
 		else
@@ -164,10 +169,7 @@ namespace RealtimeMesh
 		
 			for (const auto& SectionGroup : SectionGroups)
 			{
-				ProxyBuilder->AddLODTask(Key, [SectionGroupKey = SectionGroup->GetKey(UpdateContext)](FRHICommandListBase& RHICmdList, FRealtimeMeshLODProxy& Proxy)
-				{
-					Proxy.CreateSectionGroupIfNotExists(SectionGroupKey);
-				}, ShouldRecreateProxyOnChange(UpdateContext));
+				ProxyBuilder->AddCreateSectionGroupCommand(SectionGroup->GetKey(UpdateContext), SectionGroup->GetHandle(UpdateContext), ShouldRecreateProxyOnChange(UpdateContext));
 
 				SectionGroup->InitializeProxy(UpdateContext);
 			}
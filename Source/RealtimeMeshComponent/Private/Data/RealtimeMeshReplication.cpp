@@ -0,0 +1,747 @@
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Data/RealtimeMeshReplication.h"
+#include "RealtimeMeshComponentModule.h"
+#include "RealtimeMeshCore.h"
+#include "RealtimeMeshSimple.h"
+#include "Data/RealtimeMeshUpdateBuilder.h"
+#include "Async/ParallelFor.h"
+#include "Misc/Compression.h"
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshReplicationKBPerSecond(
+	TEXT("RealtimeMesh.Replication.KBPerSecond"),
+	64,
+	TEXT("Kilobytes of mesh stream data each replication encoder may send per second. 0 is unlimited"));
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshReplicationBurstKB(
+	TEXT("RealtimeMesh.Replication.BurstKB"),
+	64,
+	TEXT("Kilobytes of send allowance a replication encoder can build up while idle"));
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshReplicationChunkKB(
+	TEXT("RealtimeMesh.Replication.ChunkKB"),
+	16,
+	TEXT("Kilobytes of stream data per replicated chunk, the unit changes are found and sent in"));
+
+namespace RealtimeMesh
+{
+	namespace Replication::Private
+	{
+		// Bumped whenever the packet layout changes, packets from another version are rejected
+		static constexpr uint8 ProtocolVersion = 1;
+
+		enum class ERecord : uint8
+		{
+			End,
+			RemoveGroup,
+			BeginGroup,
+			Chunk,
+			EndGroup,
+		};
+
+		enum class EChunkFlags : uint8
+		{
+			None = 0,
+			// Payload is XOR'd against the data the client already has for the chunk
+			Delta = 1 << 0,
+			Compressed = 1 << 1,
+		};
+		ENUM_CLASS_FLAGS(EChunkFlags);
+
+		// Sanity limits for what a packet may claim, so a malformed one can't make the client allocate without bound
+		static constexpr int32 MaxStreamsPerGroup = 256;
+		static constexpr int64 MaxStreamBytes = MAX_int32;
+
+		// Rough size of a chunk record around its payload, for fitting records into the budget before writing them
+		static constexpr int64 ChunkRecordOverhead = 16;
+	}
+
+	struct FRealtimeMeshReplicationGroupUpdate
+	{
+		struct FStreamHeader
+		{
+			FRealtimeMeshStreamKey StreamKey;
+			FRealtimeMeshBufferLayout Layout;
+			int32 Num = 0;
+			int32 ElementsPerChunk = 1;
+			// Not sent, derived from the layout
+			int32 Stride = 0;
+		};
+
+		struct FChunk
+		{
+			int32 StreamIndex = 0;
+			int32 ChunkIndex = 0;
+			Replication::Private::EChunkFlags Flags = Replication::Private::EChunkFlags::None;
+			// Size of the chunk data, the payload is smaller when compressed
+			int32 RawSize = 0;
+			TArray<uint8> Payload;
+		};
+
+		FRealtimeMeshSectionGroupKey SectionGroupKey;
+		TArray<FStreamHeader> Streams;
+		TArray<FRealtimeMeshStreamKey> RemovedStreams;
+		TArray<FChunk> Chunks;
+
+		// Encoder progress through the update
+		bool bBeginSent = false;
+		int32 NextChunk = 0;
+	};
+
+	// =================================================================================================================
+	// Settings
+	// =================================================================================================================
+
+	FRealtimeMeshReplicationSettings FRealtimeMeshReplicationSettings::FromConsoleVariables()
+	{
+		FRealtimeMeshReplicationSettings Settings;
+		Settings.ChunkBytes = FMath::Max(1, CVarRealtimeMeshReplicationChunkKB.GetValueOnAnyThread()) * 1024;
+		Settings.BytesPerSecond = FMath::Max(0, CVarRealtimeMeshReplicationKBPerSecond.GetValueOnAnyThread()) * int64(1024);
+		Settings.MaxBurstBytes = FMath::Max(1, CVarRealtimeMeshReplicationBurstKB.GetValueOnAnyThread()) * int64(1024);
+		return Settings;
+	}
+
+	// =================================================================================================================
+	// Encoder
+	// =================================================================================================================
+
+	FRealtimeMeshReplicationEncoder::FRealtimeMeshReplicationEncoder(const FRealtimeMeshReplicationSettings& InSettings)
+		: Settings(InSettings)
+	{
+		Settings.ChunkBytes = FMath::Max(1, Settings.ChunkBytes);
+	}
+
+	FRealtimeMeshReplicationEncoder::~FRealtimeMeshReplicationEncoder() = default;
+
+	void FRealtimeMeshReplicationEncoder::Tick(float DeltaTime)
+	{
+		if (Settings.BytesPerSecond > 0)
+		{
+			AvailableBytes = FMath::Min<int64>(AvailableBytes + FMath::CeilToInt64(Settings.BytesPerSecond * DeltaTime), Settings.MaxBurstBytes);
+		}
+	}
+
+	void FRealtimeMeshReplicationEncoder::Reset()
+	{
+		Baseline.Empty();
+		DirtyGroups.Empty();
+		RemovedGroups.Empty();
+		InProgress.Reset();
+	}
+
+	void FRealtimeMeshReplicationEncoder::GatherChanges(const TSharedRef<FRealtimeMeshSimple>& Mesh)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshReplicationEncoder::GatherChanges);
+
+		TSet<FRealtimeMeshSectionGroupKey> LiveGroups;
+
+		FRealtimeMeshAccessContext LockContext(Mesh);
+		const int32 NumLODs = Mesh->GetNumLODs(LockContext);
+		for (int32 LODIndex = 0; LODIndex < NumLODs; LODIndex++)
+		{
+			const TSharedPtr<FRealtimeMeshLODSimple> LOD = Mesh->GetLODAs<FRealtimeMeshLODSimple>(LockContext, FRealtimeMeshLODKey(LODIndex));
+			for (const FRealtimeMeshSectionGroupKey& SectionGroupKey : LOD->GetSectionGroupKeys(LockContext))
+			{
+				LiveGroups.Add(SectionGroupKey);
+
+				const TSharedPtr<FRealtimeMeshSectionGroupSimple> SectionGroup = LOD->GetSectionGroupAs<FRealtimeMeshSectionGroupSimple>(LockContext, SectionGroupKey);
+				const FBaselineGroup* BaselineGroup = Baseline.Find(SectionGroupKey);
+				if (!BaselineGroup || BaselineGroup->StreamVersion != SectionGroup->GetStreamVersion(LockContext))
+				{
+					DirtyGroups.FindOrAdd(SectionGroupKey, NextDirtySerial++);
+				}
+			}
+		}
+
+		for (auto It = Baseline.CreateIterator(); It; ++It)
+		{
+			if (!LiveGroups.Contains(It.Key()))
+			{
+				RemovedGroups.AddUnique(It.Key());
+				DirtyGroups.Remove(It.Key());
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	bool FRealtimeMeshReplicationEncoder::PrepareNextUpdate(const TSharedRef<FRealtimeMeshSimple>& Mesh)
+	{
+		while (!InProgress.IsValid() && RemovedGroups.Num() == 0 && DirtyGroups.Num() > 0)
+		{
+			if (!StartGroupUpdate(Mesh))
+			{
+				// Everything left is waiting on evicted streams
+				break;
+			}
+		}
+		return InProgress.IsValid() || RemovedGroups.Num() > 0;
+	}
+
+	bool FRealtimeMeshReplicationEncoder::StartGroupUpdate(const TSharedRef<FRealtimeMeshSimple>& Mesh)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshReplicationEncoder::StartGroupUpdate);
+		using namespace Replication::Private;
+
+		// New section groups first so the client has something to draw, coarse LODs ahead of detailed ones. Groups the client
+		// already holds go strictly oldest change first, ordering them by LOD would let a detailed LOD that's edited every tick
+		// keep jumping ahead of a coarser one that changed once.
+		TArray<FRealtimeMeshSectionGroupKey> Candidates;
+		DirtyGroups.GenerateKeyArray(Candidates);
+		Candidates.Sort([&](const FRealtimeMeshSectionGroupKey& A, const FRealtimeMeshSectionGroupKey& B)
+		{
+			const bool bANew = !Baseline.Contains(A);
+			const bool bBNew = !Baseline.Contains(B);
+			if (bANew != bBNew)
+			{
+				return bANew;
+			}
+			if (bANew && A.LOD().Index() != B.LOD().Index())
+			{
+				return A.LOD().Index() > B.LOD().Index();
+			}
+			return DirtyGroups[A] < DirtyGroups[B];
+		});
+
+		FRealtimeMeshAccessContext LockContext(Mesh);
+		for (const FRealtimeMeshSectionGroupKey& SectionGroupKey : Candidates)
+		{
+			const TSharedPtr<FRealtimeMeshSectionGroupSimple> SectionGroup = Mesh->GetSectionGroupAs<FRealtimeMeshSectionGroupSimple>(LockContext, SectionGroupKey);
+			if (!SectionGroup)
+			{
+				// Removed since it was gathered, the next gather queues the removal
+				DirtyGroups.Remove(SectionGroupKey);
+				continue;
+			}
+			if (SectionGroup->AreStreamsEvicted(LockContext))
+			{
+				// Sending now would empty the client's copy, so wait for the streams to be restored
+				continue;
+			}
+
+			DirtyGroups.Remove(SectionGroupKey);
+
+			FBaselineGroup* BaselineGroup = Baseline.Find(SectionGroupKey);
+			const bool bIsNew = BaselineGroup == nullptr;
+			if (bIsNew)
+			{
+				BaselineGroup = &Baseline.Add(SectionGroupKey);
+			}
+
+			TUniquePtr<FRealtimeMeshReplicationGroupUpdate> Update = MakeUnique<FRealtimeMeshReplicationGroupUpdate>();
+			Update->SectionGroupKey = SectionGroupKey;
+
+			FRealtimeMeshStreamSet Current;
+			SectionGroup->ProcessMeshData(LockContext, [&](const FRealtimeMeshStreamSet& Streams)
+			{
+				Current.CopyFrom(Streams);
+			});
+
+			Current.ForEach([&](const FRealtimeMeshStream& Stream)
+			{
+				DiffStream(Stream, BaselineGroup->Streams.Find(Stream.GetStreamKey()), *Update);
+			});
+			BaselineGroup->Streams.ForEach([&](const FRealtimeMeshStream& Stream)
+			{
+				if (!Current.Contains(Stream.GetStreamKey()))
+				{
+					Update->RemovedStreams.Add(Stream.GetStreamKey());
+				}
+			});
+
+			// What the client will hold once this update lands is what later updates diff against
+			BaselineGroup->StreamVersion = SectionGroup->GetStreamVersion(LockContext);
+			BaselineGroup->Streams = MoveTemp(Current);
+
+			// A new section group still has to be created on the client even when it has no streams
+			if (bIsNew || Update->Streams.Num() > 0 || Update->RemovedStreams.Num() > 0)
+			{
+				// Chunks are independent so compress them in parallel
+				ParallelFor(Update->Chunks.Num(), [&](int32 ChunkIndex)
+				{
+					FRealtimeMeshReplicationGroupUpdate::FChunk& Chunk = Update->Chunks[ChunkIndex];
+
+					int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Oodle, Chunk.RawSize);
+					TArray<uint8> Compressed;
+					Compressed.SetNumUninitialized(CompressedSize);
+					if (FCompression::CompressMemory(NAME_Oodle, Compressed.GetData(), CompressedSize, Chunk.Payload.GetData(), Chunk.RawSize) && CompressedSize < Chunk.RawSize)
+					{
+						Compressed.SetNum(CompressedSize);
+						Chunk.Payload = MoveTemp(Compressed);
+						Chunk.Flags |= EChunkFlags::Compressed;
+					}
+				});
+
+				InProgress = MoveTemp(Update);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void FRealtimeMeshReplicationEncoder::DiffStream(const FRealtimeMeshStream& Stream, const FRealtimeMeshStream* BaselineStream, FRealtimeMeshReplicationGroupUpdate& Update) const
+	{
+		using namespace Replication::Private;
+
+		const int32 Stride = Stream.GetStride();
+		const int32 Num = Stream.Num();
+
+		// Only chunks the client already holds with the same layout can be sent as deltas
+		const bool bHasBaseline = BaselineStream && BaselineStream->GetLayout() == Stream.GetLayout();
+		const int32 BaselineNum = bHasBaseline ? BaselineStream->Num() : 0;
+
+		if (bHasBaseline && BaselineNum == Num && FMemory::Memcmp(Stream.GetData(), BaselineStream->GetData(), int64(Num) * Stride) == 0)
+		{
+			return;
+		}
+
+		const int32 StreamIndex = Update.Streams.Num();
+		FRealtimeMeshReplicationGroupUpdate::FStreamHeader& Header = Update.Streams.AddDefaulted_GetRef();
+		Header.StreamKey = Stream.GetStreamKey();
+		Header.Layout = Stream.GetLayout();
+		Header.Num = Num;
+		Header.ElementsPerChunk = FMath::Max(1, Settings.ChunkBytes / FMath::Max(1, Stride));
+		Header.Stride = Stride;
+
+		for (int32 FirstElement = 0, ChunkIndex = 0; FirstElement < Num; FirstElement += Header.ElementsPerChunk, ChunkIndex++)
+		{
+			const int32 NumElements = FMath::Min(Header.ElementsPerChunk, Num - FirstElement);
+			const int32 NumBytes = NumElements * Stride;
+			const uint8* Data = Stream.GetData() + int64(FirstElement) * Stride;
+
+			FRealtimeMeshReplicationGroupUpdate::FChunk Chunk;
+			Chunk.StreamIndex = StreamIndex;
+			Chunk.ChunkIndex = ChunkIndex;
+			Chunk.RawSize = NumBytes;
+
+			if (FirstElement + NumElements <= BaselineNum)
+			{
+				const uint8* BaselineData = BaselineStream->GetData() + int64(FirstElement) * Stride;
+				if (FMemory::Memcmp(Data, BaselineData, NumBytes) == 0)
+				{
+					continue;
+				}
+
+				Chunk.Flags = EChunkFlags::Delta;
+				Chunk.Payload.SetNumUninitialized(NumBytes);
+				for (int32 Index = 0; Index < NumBytes; Index++)
+				{
+					Chunk.Payload[Index] = Data[Index] ^ BaselineData[Index];
+				}
+			}
+			else
+			{
+				Chunk.Payload = TArray<uint8>(Data, NumBytes);
+			}
+
+			Update.Chunks.Add(MoveTemp(Chunk));
+		}
+	}
+
+	int64 FRealtimeMeshReplicationEncoder::WritePacket(const TSharedRef<FRealtimeMeshSimple>& Mesh, FArchive& Ar)
+	{
+		const int64 Budget = GetAvailableBytes();
+		if (Budget <= 0)
+		{
+			return 0;
+		}
+
+		const int64 Written = WritePacket(Mesh, Ar, Budget);
+		if (Settings.BytesPerSecond > 0)
+		{
+			// Can go negative when a record overshoots, which the next ticks pay back
+			AvailableBytes -= Written;
+		}
+		return Written;
+	}
+
+	int64 FRealtimeMeshReplicationEncoder::WritePacket(const TSharedRef<FRealtimeMeshSimple>& Mesh, FArchive& Ar, int64 ByteBudget)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshReplicationEncoder::WritePacket);
+		using namespace Replication::Private;
+		check(Ar.IsSaving());
+
+		GatherChanges(Mesh);
+		if (!PrepareNextUpdate(Mesh))
+		{
+			return 0;
+		}
+
+		const int64 PacketStart = Ar.Tell();
+		uint8 Version = ProtocolVersion;
+		Ar << Version;
+
+		bool bWroteRecord = false;
+		const auto Fits = [&](int64 RecordSize)
+		{
+			return !bWroteRecord || (Ar.Tell() - PacketStart) + RecordSize <= ByteBudget;
+		};
+		const auto WriteRecordType = [&](ERecord Record)
+		{
+			uint8 RecordByte = static_cast<uint8>(Record);
+			Ar << RecordByte;
+		};
+
+		int64 NumChunksSent = 0;
+		// Checking the budget first means a new section group isn't snapshotted just to wait for the next packet
+		while (Fits(ChunkRecordOverhead) && PrepareNextUpdate(Mesh))
+		{
+			if (!InProgress.IsValid())
+			{
+				FRealtimeMeshSectionGroupKey SectionGroupKey = RemovedGroups[0];
+				WriteRecordType(ERecord::RemoveGroup);
+				Ar << SectionGroupKey;
+				RemovedGroups.RemoveAt(0);
+				bWroteRecord = true;
+				continue;
+			}
+
+			FRealtimeMeshReplicationGroupUpdate& Update = *InProgress;
+			if (!Update.bBeginSent)
+			{
+				if (!Fits(ChunkRecordOverhead * (1 + Update.Streams.Num() + Update.RemovedStreams.Num())))
+				{
+					break;
+				}
+				WriteRecordType(ERecord::BeginGroup);
+				Ar << Update.SectionGroupKey;
+
+				int32 NumStreams = Update.Streams.Num();
+				Ar << NumStreams;
+				for (FRealtimeMeshReplicationGroupUpdate::FStreamHeader& Header : Update.Streams)
+				{
+					Ar << Header.StreamKey;
+					Ar << Header.Layout;
+					Ar << Header.Num;
+					Ar << Header.ElementsPerChunk;
+				}
+				Ar << Update.RemovedStreams;
+
+				Update.bBeginSent = true;
+				bWroteRecord = true;
+			}
+
+			while (Update.NextChunk < Update.Chunks.Num() && Fits(ChunkRecordOverhead + Update.Chunks[Update.NextChunk].Payload.Num()))
+			{
+				FRealtimeMeshReplicationGroupUpdate::FChunk& Chunk = Update.Chunks[Update.NextChunk++];
+				WriteRecordType(ERecord::Chunk);
+
+				uint32 StreamIndex = Chunk.StreamIndex;
+				uint32 ChunkIndex = Chunk.ChunkIndex;
+				uint8 Flags = static_cast<uint8>(Chunk.Flags);
+				uint32 RawSize = Chunk.RawSize;
+				uint32 PayloadSize = Chunk.Payload.Num();
+				Ar.SerializeIntPacked(StreamIndex);
+				Ar.SerializeIntPacked(ChunkIndex);
+				Ar << Flags;
+				Ar.SerializeIntPacked(RawSize);
+				Ar.SerializeIntPacked(PayloadSize);
+				Ar.Serialize(Chunk.Payload.GetData(), PayloadSize);
+
+				// The data is in the packet now, no need to hold on to it
+				Chunk.Payload.Empty();
+				NumChunksSent++;
+				bWroteRecord = true;
+			}
+
+			if (Update.NextChunk < Update.Chunks.Num())
+			{
+				break;
+			}
+
+			WriteRecordType(ERecord::EndGroup);
+			InProgress.Reset();
+		}
+
+		WriteRecordType(ERecord::End);
+
+		const int64 Written = Ar.Tell() - PacketStart;
+		FRealtimeMeshStatCounters::Get().ReplicationBytesSent += Written;
+		FRealtimeMeshStatCounters::Get().ReplicationChunksSent += NumChunksSent;
+		return Written;
+	}
+
+	// =================================================================================================================
+	// Decoder
+	// =================================================================================================================
+
+	FRealtimeMeshReplicationDecoder::FRealtimeMeshReplicationDecoder() = default;
+	FRealtimeMeshReplicationDecoder::~FRealtimeMeshReplicationDecoder() = default;
+
+	void FRealtimeMeshReplicationDecoder::Reset()
+	{
+		Staged.Reset();
+	}
+
+	bool FRealtimeMeshReplicationDecoder::ReadPacket(const TSharedRef<FRealtimeMeshSimple>& Mesh, FArchive& Ar)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshReplicationDecoder::ReadPacket);
+		using namespace Replication::Private;
+		check(Ar.IsLoading());
+
+		const auto Fail = [&](const TCHAR* Reason)
+		{
+			UE_LOG(LogRealtimeMesh, Error, TEXT("Dropping malformed mesh replication packet: %s"), Reason);
+			Staged.Reset();
+			return false;
+		};
+
+		uint8 Version = 0;
+		Ar << Version;
+		if (Ar.IsError() || Version != ProtocolVersion)
+		{
+			return Fail(TEXT("unknown protocol version"));
+		}
+
+		while (true)
+		{
+			uint8 RecordByte = 0;
+			Ar << RecordByte;
+			if (Ar.IsError())
+			{
+				return Fail(TEXT("truncated"));
+			}
+
+			switch (static_cast<ERecord>(RecordByte))
+			{
+			case ERecord::End:
+				return true;
+
+			case ERecord::RemoveGroup:
+				{
+					FRealtimeMeshSectionGroupKey SectionGroupKey;
+					Ar << SectionGroupKey;
+					if (Ar.IsError() || Staged.IsValid())
+					{
+						return Fail(TEXT("section group removed mid update"));
+					}
+					RemoveGroup(Mesh, SectionGroupKey);
+					break;
+				}
+
+			case ERecord::BeginGroup:
+				{
+					if (Staged.IsValid())
+					{
+						return Fail(TEXT("section group started mid update"));
+					}
+					Staged = MakeUnique<FRealtimeMeshReplicationGroupUpdate>();
+					Ar << Staged->SectionGroupKey;
+
+					int32 NumStreams = 0;
+					Ar << NumStreams;
+					if (Ar.IsError() || NumStreams < 0 || NumStreams > MaxStreamsPerGroup)
+					{
+						return Fail(TEXT("bad stream count"));
+					}
+					for (int32 StreamIndex = 0; StreamIndex < NumStreams; StreamIndex++)
+					{
+						FRealtimeMeshReplicationGroupUpdate::FStreamHeader& Header = Staged->Streams.AddDefaulted_GetRef();
+						Ar << Header.StreamKey;
+						Ar << Header.Layout;
+						Ar << Header.Num;
+						Ar << Header.ElementsPerChunk;
+						Header.Stride = FRealtimeMeshBufferLayoutUtilities::GetElementStride(Header.Layout.GetElementType()) * Header.Layout.GetNumElements();
+						if (Ar.IsError() || Header.Stride <= 0 || Header.Num < 0 || Header.ElementsPerChunk <= 0 || int64(Header.Num) * Header.Stride > MaxStreamBytes)
+						{
+							return Fail(TEXT("bad stream header"));
+						}
+
+						// Headers sharing a key would share one stream on apply, sized by whichever came last
+						for (int32 OtherIndex = 0; OtherIndex < StreamIndex; OtherIndex++)
+						{
+							if (Staged->Streams[OtherIndex].StreamKey == Header.StreamKey)
+							{
+								return Fail(TEXT("stream sent twice"));
+							}
+						}
+					}
+					Ar << Staged->RemovedStreams;
+					if (Ar.IsError() || Staged->RemovedStreams.Num() > MaxStreamsPerGroup)
+					{
+						return Fail(TEXT("bad removed streams"));
+					}
+					break;
+				}
+
+			case ERecord::Chunk:
+				{
+					uint32 StreamIndex = 0;
+					uint32 ChunkIndex = 0;
+					uint8 Flags = 0;
+					uint32 RawSize = 0;
+					uint32 PayloadSize = 0;
+					Ar.SerializeIntPacked(StreamIndex);
+					Ar.SerializeIntPacked(ChunkIndex);
+					Ar << Flags;
+					Ar.SerializeIntPacked(RawSize);
+					Ar.SerializeIntPacked(PayloadSize);
+					if (Ar.IsError() || !Staged.IsValid() || !Staged->Streams.IsValidIndex(StreamIndex))
+					{
+						return Fail(TEXT("chunk outside of a section group"));
+					}
+
+					// The chunk has to land inside its stream, and be exactly the size its position says
+					const FRealtimeMeshReplicationGroupUpdate::FStreamHeader& Header = Staged->Streams[StreamIndex];
+					const int64 FirstElement = int64(ChunkIndex) * Header.ElementsPerChunk;
+					const int64 ExpectedSize = FMath::Min<int64>(Header.ElementsPerChunk, Header.Num - FirstElement) * Header.Stride;
+					if (FirstElement >= Header.Num || RawSize != ExpectedSize || PayloadSize > RawSize || (PayloadSize < RawSize && !(Flags & static_cast<uint8>(EChunkFlags::Compressed))))
+					{
+						return Fail(TEXT("chunk out of range"));
+					}
+
+					FRealtimeMeshReplicationGroupUpdate::FChunk& Chunk = Staged->Chunks.AddDefaulted_GetRef();
+					Chunk.StreamIndex = StreamIndex;
+					Chunk.ChunkIndex = ChunkIndex;
+					Chunk.Flags = static_cast<EChunkFlags>(Flags);
+					Chunk.RawSize = RawSize;
+
+					TArray<uint8> Payload;
+					Payload.SetNumUninitialized(PayloadSize);
+					Ar.Serialize(Payload.GetData(), PayloadSize);
+					if (Ar.IsError())
+					{
+						return Fail(TEXT("truncated chunk"));
+					}
+
+					if (EnumHasAnyFlags(Chunk.Flags, EChunkFlags::Compressed))
+					{
+						Chunk.Payload.SetNumUninitialized(RawSize);
+						if (!FCompression::UncompressMemory(NAME_Oodle, Chunk.Payload.GetData(), RawSize, Payload.GetData(), PayloadSize))
+						{
+							return Fail(TEXT("chunk failed to decompress"));
+						}
+					}
+					else
+					{
+						Chunk.Payload = MoveTemp(Payload);
+					}
+					break;
+				}
+
+			case ERecord::EndGroup:
+				{
+					if (!Staged.IsValid())
+					{
+						return Fail(TEXT("section group ended without starting"));
+					}
+					const TUniquePtr<FRealtimeMeshReplicationGroupUpdate> Update = MoveTemp(Staged);
+					if (!ApplyGroupUpdate(Mesh, *Update))
+					{
+						return Fail(TEXT("section group update doesn't match the mesh"));
+					}
+					break;
+				}
+
+			default:
+				return Fail(TEXT("unknown record"));
+			}
+		}
+	}
+
+	bool FRealtimeMeshReplicationDecoder::RemoveGroup(const TSharedRef<FRealtimeMeshSimple>& Mesh, const FRealtimeMeshSectionGroupKey& SectionGroupKey)
+	{
+		FRealtimeMeshUpdateContext UpdateContext(Mesh);
+		const TSharedPtr<FRealtimeMeshLODSimple> LOD = Mesh->GetLODAs<FRealtimeMeshLODSimple>(UpdateContext, SectionGroupKey.LOD());
+		const bool bExists = LOD && LOD->GetSectionGroup(UpdateContext, SectionGroupKey);
+		if (bExists)
+		{
+			LOD->RemoveSectionGroup(UpdateContext, SectionGroupKey);
+		}
+		UpdateContext.Commit();
+		return bExists;
+	}
+
+	bool FRealtimeMeshReplicationDecoder::ApplyGroupUpdate(const TSharedRef<FRealtimeMeshSimple>& Mesh, FRealtimeMeshReplicationGroupUpdate& Update) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshReplicationDecoder::ApplyGroupUpdate);
+		using namespace Replication::Private;
+
+		const FRealtimeMeshLODKey LODKey = Update.SectionGroupKey.LOD();
+		if (LODKey.Index() < 0 || LODKey.Index() > REALTIME_MESH_MAX_LOD_INDEX)
+		{
+			return false;
+		}
+
+		FRealtimeMeshUpdateContext UpdateContext(Mesh);
+
+		// LOD and section group config isn't replicated, so create whatever is missing with the defaults
+		while (Mesh->GetNumLODs(UpdateContext) <= LODKey.Index())
+		{
+			Mesh->AddLOD(UpdateContext, FRealtimeMeshLODConfig());
+		}
+		const TSharedPtr<FRealtimeMeshLODSimple> LOD = Mesh->GetLODAs<FRealtimeMeshLODSimple>(UpdateContext, LODKey);
+		TSharedPtr<FRealtimeMeshSectionGroupSimple> SectionGroup = LOD->GetSectionGroupAs<FRealtimeMeshSectionGroupSimple>(UpdateContext, Update.SectionGroupKey);
+		if (!SectionGroup)
+		{
+			LOD->CreateOrUpdateSectionGroup(UpdateContext, Update.SectionGroupKey, FRealtimeMeshSectionGroupConfig());
+			SectionGroup = LOD->GetSectionGroupAs<FRealtimeMeshSectionGroupSimple>(UpdateContext, Update.SectionGroupKey);
+		}
+
+		// Start every changed stream from the data the client has, which is what the server diffed against
+		FRealtimeMeshStreamSet NewStreams;
+		TArray<int32> PreviousNums;
+		SectionGroup->ProcessMeshData(UpdateContext, [&](const FRealtimeMeshStreamSet& Existing)
+		{
+			for (const FRealtimeMeshReplicationGroupUpdate::FStreamHeader& Header : Update.Streams)
+			{
+				const FRealtimeMeshStream* ExistingStream = Existing.Find(Header.StreamKey);
+				FRealtimeMeshStream& NewStream = ExistingStream && ExistingStream->GetLayout() == Header.Layout
+					? NewStreams.AddStream(*ExistingStream)
+					: NewStreams.AddStream(Header.StreamKey, Header.Layout);
+				PreviousNums.Add(NewStream.Num());
+				NewStream.SetNumUninitialized(Header.Num);
+			}
+		});
+
+		// Every chunk has to fit the stream it's written into, whatever its header said. Delta chunks can also only apply
+		// over data the client already had, anything else means the two ends went out of sync
+		for (const FRealtimeMeshReplicationGroupUpdate::FChunk& Chunk : Update.Chunks)
+		{
+			const FRealtimeMeshReplicationGroupUpdate::FStreamHeader& Header = Update.Streams[Chunk.StreamIndex];
+			const FRealtimeMeshStream* Stream = NewStreams.Find(Header.StreamKey);
+			const int64 ChunkStart = int64(Chunk.ChunkIndex) * Header.ElementsPerChunk * Header.Stride;
+			const bool bFitsStream = Stream && Stream->GetStride() == Header.Stride && Chunk.Payload.Num() == Chunk.RawSize &&
+				ChunkStart + Chunk.RawSize <= int64(Stream->Num()) * Stream->GetStride();
+			if (!bFitsStream || (EnumHasAnyFlags(Chunk.Flags, EChunkFlags::Delta) && ChunkStart + Chunk.RawSize > int64(PreviousNums[Chunk.StreamIndex]) * Header.Stride))
+			{
+				UpdateContext.Commit();
+				return false;
+			}
+		}
+
+		for (const FRealtimeMeshReplicationGroupUpdate::FChunk& Chunk : Update.Chunks)
+		{
+			const FRealtimeMeshReplicationGroupUpdate::FStreamHeader& Header = Update.Streams[Chunk.StreamIndex];
+			FRealtimeMeshStream* Stream = NewStreams.Find(Header.StreamKey);
+			uint8* Data = Stream->GetData() + int64(Chunk.ChunkIndex) * Header.ElementsPerChunk * Header.Stride;
+
+			if (EnumHasAnyFlags(Chunk.Flags, EChunkFlags::Delta))
+			{
+				for (int32 Index = 0; Index < Chunk.RawSize; Index++)
+				{
+					Data[Index] ^= Chunk.Payload[Index];
+				}
+			}
+			else
+			{
+				FMemory::Memcpy(Data, Chunk.Payload.GetData(), Chunk.RawSize);
+			}
+		}
+
+		for (const FRealtimeMeshStreamKey& StreamKey : Update.RemovedStreams)
+		{
+			if (SectionGroup->GetStream(UpdateContext, StreamKey))
+			{
+				SectionGroup->RemoveStream(UpdateContext, StreamKey);
+			}
+		}
+		NewStreams.ForEach([&](FRealtimeMeshStream& Stream)
+		{
+			SectionGroup->CreateOrUpdateStream(UpdateContext, MoveTemp(Stream));
+		});
+
+		UpdateContext.Commit();
+		return true;
+	}
+}
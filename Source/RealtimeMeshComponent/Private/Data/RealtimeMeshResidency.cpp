@@ -0,0 +1,632 @@
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Data/RealtimeMeshResidency.h"
+#include "RealtimeMeshComponentModule.h"
+#include "RealtimeMeshCore.h"
+#include "RealtimeMeshSimple.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Misc/LazySingleton.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshResidencyBudgetMB(
+	TEXT("RealtimeMesh.Residency.BudgetMB"),
+	0,
+	TEXT("Megabytes of evictable LOD stream data kept resident across all meshes with LOD residency enabled, least recently needed LODs are evicted past it. 0 is unlimited"));
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshResidencyEvictAfterFrames(
+	TEXT("RealtimeMesh.Residency.EvictAfterFrames"),
+	600,
+	TEXT("Frames a LOD can go without being drawn before it is evicted even when under budget. Negative only evicts to stay within the budget"));
+
+static TAutoConsoleVariable<float> CVarRealtimeMeshResidencyPrefetchScale(
+	TEXT("RealtimeMesh.Residency.PrefetchScale"),
+	1.25f,
+	TEXT("Scale applied to the screen size a mesh was drawn at before picking the LODs it needs, so more detailed LODs load before they are drawn"));
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshResidencyMaxLoadsPerFrame(
+	TEXT("RealtimeMesh.Residency.MaxLoadsPerFrame"),
+	16,
+	TEXT("LOD loads started per frame, the rest wait for later frames"));
+
+static TAutoConsoleVariable<bool> CVarRealtimeMeshResidencyDiskCache(
+	TEXT("RealtimeMesh.Residency.DiskCache"),
+	false,
+	TEXT("Write evicted LODs to Saved/RealtimeMesh/Residency once compressed instead of keeping them in memory"));
+
+namespace RealtimeMesh
+{
+	// =================================================================================================================
+	// Policy
+	// =================================================================================================================
+
+	FRealtimeMeshHandle FRealtimeMeshResidencyPolicy::Register()
+	{
+		return Meshes.Add(FMeshState());
+	}
+
+	bool FRealtimeMeshResidencyPolicy::Unregister(const FRealtimeMeshHandle& Mesh)
+	{
+		if (const FMeshState* State = Meshes.Find(Mesh))
+		{
+			for (const FLODState& LOD : State->LODs)
+			{
+				if (LOD.Residency != ERealtimeMeshLODResidency::Evicted)
+				{
+					ResidentBytes -= LOD.Bytes;
+				}
+			}
+			return Meshes.Remove(Mesh);
+		}
+		return false;
+	}
+
+	void FRealtimeMeshResidencyPolicy::SetLODSizes(const FRealtimeMeshHandle& Mesh, TConstArrayView<int64> LODSizes, uint64 Frame)
+	{
+		FMeshState* State = Meshes.Find(Mesh);
+		if (!State)
+		{
+			return;
+		}
+
+		for (int32 LODIndex = LODSizes.Num(); LODIndex < State->LODs.Num(); LODIndex++)
+		{
+			if (State->LODs[LODIndex].Residency != ERealtimeMeshLODResidency::Evicted)
+			{
+				ResidentBytes -= State->LODs[LODIndex].Bytes;
+			}
+		}
+
+		const int32 FirstNewLOD = State->LODs.Num();
+		State->LODs.SetNum(LODSizes.Num());
+		for (int32 LODIndex = FirstNewLOD; LODIndex < State->LODs.Num(); LODIndex++)
+		{
+			State->LODs[LODIndex].LastNeededFrame = Frame;
+		}
+
+		for (int32 LODIndex = 0; LODIndex < State->LODs.Num(); LODIndex++)
+		{
+			FLODState& LOD = State->LODs[LODIndex];
+			if (LOD.Residency == ERealtimeMeshLODResidency::Resident)
+			{
+				ResidentBytes += LODSizes[LODIndex] - LOD.Bytes;
+				LOD.Bytes = LODSizes[LODIndex];
+			}
+		}
+	}
+
+	void FRealtimeMeshResidencyPolicy::SetNeededLODs(const FRealtimeMeshHandle& Mesh, int32 FirstNeededLOD, uint64 Frame)
+	{
+		if (FMeshState* State = Meshes.Find(Mesh))
+		{
+			for (int32 LODIndex = FMath::Max(FirstNeededLOD, 0); LODIndex < State->LODs.Num(); LODIndex++)
+			{
+				State->LODs[LODIndex].LastNeededFrame = Frame;
+			}
+		}
+	}
+
+	void FRealtimeMeshResidencyPolicy::Evict(FLODState& LOD, const FRealtimeMeshHandle& Mesh, int32 LODIndex, TArray<FRealtimeMeshResidencyRequest>& OutEvictions)
+	{
+		LOD.Residency = ERealtimeMeshLODResidency::Evicted;
+		ResidentBytes -= LOD.Bytes;
+		OutEvictions.Add({ Mesh, LODIndex });
+	}
+
+	void FRealtimeMeshResidencyPolicy::Update(const FRealtimeMeshResidencySettings& Settings, uint64 Frame, TArray<FRealtimeMeshResidencyRequest>& OutEvictions,
+		TArray<FRealtimeMeshResidencyRequest>& OutLoads)
+	{
+		OutEvictions.Reset();
+		OutLoads.Reset();
+
+		struct FCandidate
+		{
+			FRealtimeMeshHandle Mesh;
+			int32 LODIndex;
+			uint64 LastNeededFrame;
+			int64 Bytes;
+		};
+		TArray<FCandidate> Candidates;
+
+		for (auto It = Meshes.CreateIterator(); It; ++It)
+		{
+			const int32 LastLODIndex = It->LODs.Num() - 1;
+			for (int32 LODIndex = 0; LODIndex < It->LODs.Num(); LODIndex++)
+			{
+				FLODState& LOD = It->LODs[LODIndex];
+				const bool bIsNeeded = LOD.LastNeededFrame >= Frame || LODIndex == LastLODIndex;
+
+				if (LOD.Residency == ERealtimeMeshLODResidency::Evicted)
+				{
+					if (bIsNeeded && OutLoads.Num() < Settings.MaxLoadsPerUpdate)
+					{
+						LOD.Residency = ERealtimeMeshLODResidency::Loading;
+						ResidentBytes += LOD.Bytes;
+						OutLoads.Add({ It.GetHandle(), LODIndex });
+					}
+				}
+				else if (LOD.Residency == ERealtimeMeshLODResidency::Resident && !bIsNeeded && LOD.Bytes > 0)
+				{
+					if (Settings.EvictAfterFrames >= 0 && LOD.LastNeededFrame + Settings.EvictAfterFrames < Frame)
+					{
+						Evict(LOD, It.GetHandle(), LODIndex, OutEvictions);
+					}
+					else
+					{
+						Candidates.Add({ It.GetHandle(), LODIndex, LOD.LastNeededFrame, LOD.Bytes });
+					}
+				}
+			}
+		}
+
+		if (Settings.BudgetBytes > 0 && ResidentBytes > Settings.BudgetBytes)
+		{
+			Candidates.StableSort([](const FCandidate& A, const FCandidate& B)
+			{
+				return A.LastNeededFrame != B.LastNeededFrame ? A.LastNeededFrame < B.LastNeededFrame : A.Bytes > B.Bytes;
+			});
+
+			for (const FCandidate& Candidate : Candidates)
+			{
+				if (ResidentBytes <= Settings.BudgetBytes)
+				{
+					break;
+				}
+				Evict(Meshes.Find(Candidate.Mesh)->LODs[Candidate.LODIndex], Candidate.Mesh, Candidate.LODIndex, OutEvictions);
+			}
+		}
+	}
+
+	void FRealtimeMeshResidencyPolicy::MarkResident(const FRealtimeMeshHandle& Mesh, int32 LODIndex)
+	{
+		FMeshState* State = Meshes.Find(Mesh);
+		if (State && State->LODs.IsValidIndex(LODIndex))
+		{
+			FLODState& LOD = State->LODs[LODIndex];
+			if (LOD.Residency == ERealtimeMeshLODResidency::Evicted)
+			{
+				ResidentBytes += LOD.Bytes;
+			}
+			LOD.Residency = ERealtimeMeshLODResidency::Resident;
+		}
+	}
+
+	bool FRealtimeMeshResidencyPolicy::MarkEvicted(const FRealtimeMeshHandle& Mesh, int32 LODIndex)
+	{
+		FMeshState* State = Meshes.Find(Mesh);
+		if (!State || !State->LODs.IsValidIndex(LODIndex) || State->LODs[LODIndex].Residency != ERealtimeMeshLODResidency::Resident)
+		{
+			return false;
+		}
+
+		State->LODs[LODIndex].Residency = ERealtimeMeshLODResidency::Evicted;
+		ResidentBytes -= State->LODs[LODIndex].Bytes;
+		return true;
+	}
+
+	ERealtimeMeshLODResidency FRealtimeMeshResidencyPolicy::GetResidency(const FRealtimeMeshHandle& Mesh, int32 LODIndex) const
+	{
+		const FMeshState* State = Meshes.Find(Mesh);
+		return State && State->LODs.IsValidIndex(LODIndex) ? State->LODs[LODIndex].Residency : ERealtimeMeshLODResidency::Resident;
+	}
+
+	int32 FRealtimeMeshResidencyPolicy::GetLODForScreenSize(TConstArrayView<float> LODScreenSizes, float ScreenSize)
+	{
+		// Walk backwards and return the first matching LOD, as FRealtimeMeshComponentSceneProxy::ComputeStaticMeshLOD does
+		for (int32 LODIndex = LODScreenSizes.Num() - 1; LODIndex >= 0; --LODIndex)
+		{
+			if (LODScreenSizes[LODIndex] >= 0.0f && LODScreenSizes[LODIndex] > ScreenSize)
+			{
+				return LODIndex;
+			}
+		}
+		return 0;
+	}
+
+	// =================================================================================================================
+	// Cache
+	// =================================================================================================================
+
+	struct FRealtimeMeshResidencyManager::FCachedLOD
+	{
+		FCriticalSection Lock;
+
+		// Streams as they were evicted, until a worker has compressed them
+		TArray<FRealtimeMeshEvictedSectionGroup> SectionGroups;
+		TArray<uint8> Compressed;
+		FString CacheFile;
+
+		// Set once the streams went back into the mesh, by a load or by something that needed them right away
+		bool bRestored = false;
+
+		~FCachedLOD()
+		{
+			Release();
+		}
+
+		void Compress(bool bUseDiskCache)
+		{
+			FScopeLock ScopeLock(&Lock);
+			// Already taken back by a load
+			if (SectionGroups.IsEmpty())
+			{
+				return;
+			}
+
+			TArray<uint8> NewCompressed;
+			if (!CompressSectionGroups(SectionGroups, NewCompressed))
+			{
+				// Keep them as they are, loading handles either
+				return;
+			}
+			SectionGroups.Empty();
+
+			if (bUseDiskCache)
+			{
+				const FString NewCacheFile = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("RealtimeMesh"), TEXT("Residency"), FGuid::NewGuid().ToString() + TEXT(".bin"));
+				if (FFileHelper::SaveArrayToFile(NewCompressed, *NewCacheFile))
+				{
+					CacheFile = NewCacheFile;
+					return;
+				}
+				UE_LOG(LogRealtimeMesh, Warning, TEXT("Failed to write LOD residency cache file %s, keeping it in memory"), *NewCacheFile);
+			}
+
+			Compressed = MoveTemp(NewCompressed);
+			FRealtimeMeshStatCounters::Get().ResidencyCacheMemory += Compressed.Num();
+		}
+
+		/* Puts the streams back into the mesh. Only the first call does anything, later ones wait for it to finish. */
+		void Restore(FRealtimeMeshSimple& Mesh)
+		{
+			FScopeLock ScopeLock(&Lock);
+			if (!bRestored)
+			{
+				bRestored = true;
+				Mesh.RestoreLODStreams(Take());
+			}
+		}
+
+	private:
+		TArray<FRealtimeMeshEvictedSectionGroup> Take()
+		{
+			TArray<FRealtimeMeshEvictedSectionGroup> Result = MoveTemp(SectionGroups);
+			SectionGroups.Empty();
+
+			if (!CacheFile.IsEmpty())
+			{
+				TArray<uint8> FileData;
+				if (!FFileHelper::LoadFileToArray(FileData, *CacheFile) || !DecompressSectionGroups(FileData, Result))
+				{
+					UE_LOG(LogRealtimeMesh, Error, TEXT("Failed to read LOD residency cache file %s, the LOD stays empty"), *CacheFile);
+				}
+			}
+			else if (Compressed.Num() > 0 && !DecompressSectionGroups(Compressed, Result))
+			{
+				UE_LOG(LogRealtimeMesh, Error, TEXT("Failed to decompress cached LOD, the LOD stays empty"));
+			}
+
+			Release();
+			return Result;
+		}
+
+		void Release()
+		{
+			if (Compressed.Num() > 0)
+			{
+				FRealtimeMeshStatCounters::Get().ResidencyCacheMemory -= Compressed.Num();
+				Compressed.Empty();
+			}
+			if (!CacheFile.IsEmpty())
+			{
+				IFileManager::Get().Delete(*CacheFile, false, false, true);
+				CacheFile.Empty();
+			}
+		}
+	};
+
+	bool FRealtimeMeshResidencyManager::CompressSectionGroups(TArray<FRealtimeMeshEvictedSectionGroup>& SectionGroups, TArray<uint8>& OutCompressed)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshResidencyManager::CompressSectionGroups);
+
+		TArray<uint8> Uncompressed;
+		FMemoryWriter Writer(Uncompressed);
+		Writer.SetCustomVersion(FRealtimeMeshVersion::GUID, FRealtimeMeshVersion::LatestVersion, TEXT("RealtimeMesh"));
+		Writer << SectionGroups;
+
+		// Prefixed with the uncompressed size, which decompression needs up front
+		const int32 UncompressedSize = Uncompressed.Num();
+		int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Oodle, UncompressedSize);
+		OutCompressed.SetNumUninitialized(sizeof(int32) + CompressedSize);
+		FMemory::Memcpy(OutCompressed.GetData(), &UncompressedSize, sizeof(int32));
+
+		if (!FCompression::CompressMemory(NAME_Oodle, OutCompressed.GetData() + sizeof(int32), CompressedSize, Uncompressed.GetData(), UncompressedSize))
+		{
+			OutCompressed.Empty();
+			return false;
+		}
+
+		OutCompressed.SetNum(sizeof(int32) + CompressedSize);
+		OutCompressed.Shrink();
+		return true;
+	}
+
+	bool FRealtimeMeshResidencyManager::DecompressSectionGroups(const TArray<uint8>& Compressed, TArray<FRealtimeMeshEvictedSectionGroup>& OutSectionGroups)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshResidencyManager::DecompressSectionGroups);
+
+		if (Compressed.Num() < static_cast<int32>(sizeof(int32)))
+		{
+			return false;
+		}
+
+		int32 UncompressedSize;
+		FMemory::Memcpy(&UncompressedSize, Compressed.GetData(), sizeof(int32));
+
+		TArray<uint8> Uncompressed;
+		Uncompressed.SetNumUninitialized(UncompressedSize);
+		if (!FCompression::UncompressMemory(NAME_Oodle, Uncompressed.GetData(), UncompressedSize, Compressed.GetData() + sizeof(int32), Compressed.Num() - sizeof(int32)))
+		{
+			return false;
+		}
+
+		FMemoryReader Reader(Uncompressed);
+		Reader.SetCustomVersion(FRealtimeMeshVersion::GUID, FRealtimeMeshVersion::LatestVersion, TEXT("RealtimeMesh"));
+		Reader << OutSectionGroups;
+		return !Reader.IsError();
+	}
+
+	// =================================================================================================================
+	// Manager
+	// =================================================================================================================
+
+	FRealtimeMeshResidencyManager::~FRealtimeMeshResidencyManager()
+	{
+		if (TickHandle.IsValid())
+		{
+			FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+			TickHandle.Reset();
+		}
+	}
+
+	void FRealtimeMeshResidencyManager::Register(const TSharedRef<FRealtimeMeshSimple>& Mesh)
+	{
+		check(IsInGameThread());
+
+		if (const FRealtimeMeshHandle* ExistingHandle = MeshHandles.Find(&Mesh.Get()))
+		{
+			const FManagedMesh* Existing = ManagedMeshes.Find(*ExistingHandle);
+			if (Existing && Existing->Mesh.Pin() == Mesh)
+			{
+				return;
+			}
+
+			// Left behind by a destroyed mesh that lived at the same address
+			Policy.Unregister(*ExistingHandle);
+			ManagedMeshes.Remove(*ExistingHandle);
+		}
+
+		const FRealtimeMeshHandle Handle = Policy.Register();
+		FManagedMesh& Managed = ManagedMeshes.Add(Handle);
+		Managed.Mesh = Mesh;
+		Managed.MeshKey = &Mesh.Get();
+		MeshHandles.Add(&Mesh.Get(), Handle);
+
+		Mesh->GetSharedResources()->SetWantsScreenSizeFeedback(true);
+
+		UpdateLODSizes(Handle, Managed, *Mesh);
+
+		if (!TickHandle.IsValid())
+		{
+			TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FRealtimeMeshResidencyManager::Tick));
+		}
+	}
+
+	void FRealtimeMeshResidencyManager::Unregister(const TSharedRef<FRealtimeMeshSimple>& Mesh)
+	{
+		check(IsInGameThread());
+
+		FRealtimeMeshHandle Handle;
+		if (!MeshHandles.RemoveAndCopyValue(&Mesh.Get(), Handle))
+		{
+			return;
+		}
+
+		FManagedMesh Managed;
+		ManagedMeshes.RemoveAndCopyValue(Handle, Managed);
+		Policy.Unregister(Handle);
+
+		Mesh->GetSharedResources()->SetWantsScreenSizeFeedback(false);
+		Mesh->GetSharedResources()->ConsumeScreenSizeFeedback();
+
+		// Loads already in flight are waited on
+		for (const TSharedPtr<FCachedLOD>& CachedLOD : Managed.CachedLODs)
+		{
+			if (CachedLOD.IsValid())
+			{
+				CachedLOD->Restore(*Mesh);
+			}
+		}
+	}
+
+	bool FRealtimeMeshResidencyManager::IsRegistered(const FRealtimeMeshSimple& Mesh) const
+	{
+		const FRealtimeMeshHandle* Handle = MeshHandles.Find(&Mesh);
+		return Handle && ManagedMeshes.Contains(*Handle);
+	}
+
+	bool FRealtimeMeshResidencyManager::EvictLOD(const TSharedRef<FRealtimeMeshSimple>& Mesh, int32 LODIndex)
+	{
+		check(IsInGameThread());
+
+		const FRealtimeMeshHandle* Handle = MeshHandles.Find(&Mesh.Get());
+		FManagedMesh* Managed = Handle ? ManagedMeshes.Find(*Handle) : nullptr;
+		if (!Managed)
+		{
+			return false;
+		}
+
+		UpdateLODSizes(*Handle, *Managed, *Mesh);
+		if (!Policy.MarkEvicted(*Handle, LODIndex))
+		{
+			return false;
+		}
+
+		EvictLOD(*Handle, *Managed, LODIndex, CVarRealtimeMeshResidencyDiskCache.GetValueOnGameThread());
+		return Policy.GetResidency(*Handle, LODIndex) == ERealtimeMeshLODResidency::Evicted;
+	}
+
+	void FRealtimeMeshResidencyManager::RestoreEvictedLODs(const TSharedRef<FRealtimeMeshSimple>& Mesh)
+	{
+		check(IsInGameThread());
+
+		const FRealtimeMeshHandle* Handle = MeshHandles.Find(&Mesh.Get());
+		FManagedMesh* Managed = Handle ? ManagedMeshes.Find(*Handle) : nullptr;
+		if (!Managed)
+		{
+			return;
+		}
+
+		for (int32 LODIndex = 0; LODIndex < Managed->CachedLODs.Num(); LODIndex++)
+		{
+			if (const TSharedPtr<FCachedLOD> CachedLOD = MoveTemp(Managed->CachedLODs[LODIndex]))
+			{
+				Managed->CachedLODs[LODIndex].Reset();
+				CachedLOD->Restore(*Mesh);
+				Policy.MarkResident(*Handle, LODIndex);
+			}
+		}
+	}
+
+	void FRealtimeMeshResidencyManager::UpdateLODSizes(const FRealtimeMeshHandle& Handle, FManagedMesh& Managed, const FRealtimeMeshSimple& Mesh)
+	{
+		// Reading them takes the mesh lock and walks every section group, so it's skipped until the mesh changes
+		const uint32 Version = Mesh.GetResidencyInfoVersion();
+		if (Version == Managed.ResidencyInfoVersion)
+		{
+			return;
+		}
+		Managed.ResidencyInfoVersion = Version;
+
+		TFixedLODArray<int64> EvictableMemory;
+		Mesh.GetLODResidencyInfo(Managed.ScreenSizes, EvictableMemory);
+		Policy.SetLODSizes(Handle, EvictableMemory, GFrameCounter);
+		Managed.CachedLODs.SetNum(EvictableMemory.Num());
+	}
+
+	bool FRealtimeMeshResidencyManager::Tick(float DeltaTime)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshResidencyManager::Tick);
+
+		const uint64 Frame = GFrameCounter;
+		const float PrefetchScale = FMath::Max(CVarRealtimeMeshResidencyPrefetchScale.GetValueOnGameThread(), 0.0f);
+
+		for (auto It = ManagedMeshes.CreateIterator(); It; ++It)
+		{
+			FManagedMesh& Managed = It->Value;
+			const TSharedPtr<FRealtimeMeshSimple> Mesh = Managed.Mesh.Pin();
+			if (!Mesh.IsValid())
+			{
+				Policy.Unregister(It->Key);
+				MeshHandles.Remove(Managed.MeshKey);
+				It.RemoveCurrent();
+				continue;
+			}
+
+			UpdateLODSizes(It->Key, Managed, *Mesh);
+
+			// Nothing reported means no view drew the mesh since the last tick
+			const float ScreenSize = Mesh->GetSharedResources()->ConsumeScreenSizeFeedback();
+			if (ScreenSize > 0.0f)
+			{
+				Policy.SetNeededLODs(It->Key, FRealtimeMeshResidencyPolicy::GetLODForScreenSize(Managed.ScreenSizes, ScreenSize * PrefetchScale), Frame);
+			}
+		}
+
+		FRealtimeMeshResidencySettings Settings;
+		Settings.BudgetBytes = static_cast<int64>(FMath::Max(CVarRealtimeMeshResidencyBudgetMB.GetValueOnGameThread(), 0)) * 1024 * 1024;
+		Settings.EvictAfterFrames = CVarRealtimeMeshResidencyEvictAfterFrames.GetValueOnGameThread();
+		Settings.MaxLoadsPerUpdate = FMath::Max(CVarRealtimeMeshResidencyMaxLoadsPerFrame.GetValueOnGameThread(), 1);
+
+		TArray<FRealtimeMeshResidencyRequest> Evictions;
+		TArray<FRealtimeMeshResidencyRequest> Loads;
+		Policy.Update(Settings, Frame, Evictions, Loads);
+
+		const bool bUseDiskCache = CVarRealtimeMeshResidencyDiskCache.GetValueOnGameThread();
+		for (const FRealtimeMeshResidencyRequest& Eviction : Evictions)
+		{
+			EvictLOD(Eviction.Mesh, ManagedMeshes.FindChecked(Eviction.Mesh), Eviction.LODIndex, bUseDiskCache);
+		}
+		for (const FRealtimeMeshResidencyRequest& Load : Loads)
+		{
+			LoadLOD(Load.Mesh, ManagedMeshes.FindChecked(Load.Mesh), Load.LODIndex);
+		}
+
+		return true;
+	}
+
+	void FRealtimeMeshResidencyManager::EvictLOD(const FRealtimeMeshHandle& Handle, FManagedMesh& Managed, int32 LODIndex, bool bUseDiskCache)
+	{
+		const TSharedPtr<FRealtimeMeshSimple> Mesh = Managed.Mesh.Pin();
+		TArray<FRealtimeMeshEvictedSectionGroup> SectionGroups = Mesh.IsValid()
+			? Mesh->EvictLODStreams(FRealtimeMeshLODKey(LODIndex))
+			: TArray<FRealtimeMeshEvictedSectionGroup>();
+
+		if (SectionGroups.IsEmpty())
+		{
+			Policy.MarkResident(Handle, LODIndex);
+			return;
+		}
+
+		const TSharedRef<FCachedLOD> CachedLOD = MakeShared<FCachedLOD>();
+		CachedLOD->SectionGroups = MoveTemp(SectionGroups);
+		Managed.CachedLODs[LODIndex] = CachedLOD;
+		FRealtimeMeshStatCounters::Get().ResidencyEvictions++;
+
+		Async(EAsyncExecution::ThreadPool, [CachedLOD, bUseDiskCache]()
+		{
+			CachedLOD->Compress(bUseDiskCache);
+		});
+	}
+
+	void FRealtimeMeshResidencyManager::LoadLOD(const FRealtimeMeshHandle& Handle, FManagedMesh& Managed, int32 LODIndex)
+	{
+		// Stays cached until the load lands, so anything needing the streams sooner can restore them itself
+		const TSharedPtr<FCachedLOD> CachedLOD = Managed.CachedLODs[LODIndex];
+		if (!CachedLOD.IsValid())
+		{
+			Policy.MarkResident(Handle, LODIndex);
+			return;
+		}
+
+		Async(EAsyncExecution::ThreadPool, [MeshWeak = Managed.Mesh, CachedLOD, Handle, LODIndex]()
+		{
+			if (const TSharedPtr<FRealtimeMeshSimple> Mesh = MeshWeak.Pin())
+			{
+				CachedLOD->Restore(*Mesh);
+			}
+
+			AsyncTask(ENamedThreads::GameThread, [CachedLOD, Handle, LODIndex]()
+			{
+				// Restored by RestoreEvictedLODs meanwhile, or evicted again into a new cache entry, either way not this load's to finish
+				FRealtimeMeshResidencyManager& Manager = FRealtimeMeshResidencyManager::Get();
+				FManagedMesh* LoadedMesh = Manager.ManagedMeshes.Find(Handle);
+				if (LoadedMesh && LoadedMesh->CachedLODs.IsValidIndex(LODIndex) && LoadedMesh->CachedLODs[LODIndex] == CachedLOD)
+				{
+					LoadedMesh->CachedLODs[LODIndex].Reset();
+					Manager.Policy.MarkResident(Handle, LODIndex);
+					FRealtimeMeshStatCounters::Get().ResidencyLoads++;
+				}
+			});
+		});
+	}
+
+	FRealtimeMeshResidencyManager& FRealtimeMeshResidencyManager::Get()
+	{
+		return TLazySingleton<FRealtimeMeshResidencyManager>::Get();
+	}
+}
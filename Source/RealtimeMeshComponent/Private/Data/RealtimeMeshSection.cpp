@@ -77,16 +77,20 @@ namespace RealtimeMesh
 
 	void FRealtimeMeshSection::UpdateConfig(FRealtimeMeshUpdateContext& UpdateContext, TFunction<void(FRealtimeMeshSectionConfig&)> EditFunc)
 	{
-		bool bShouldRecreateProxy = ShouldRecreateProxyOnChange(UpdateContext);
 		EditFunc(Config);
-		bShouldRecreateProxy |= ShouldRecreateProxyOnChange(UpdateContext);
 
 		if (auto ProxyBuilder = UpdateContext.GetProxyBuilder())
 		{
-			ProxyBuilder->AddSectionTask(Key, [Config = Config](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionProxy& Proxy)
+			// Section config only feeds the mesh batches, so static groups just need their batches re-cached
+			ProxyBuilder->AddSectionTask(Key, SectionGroupHandle, Handle, [Config = Config](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionProxy& Proxy)
 			{
 				Proxy.UpdateConfig(Config);
-			}, bShouldRecreateProxy);
+			}, false);
+
+			if (ShouldUpdateStaticMeshesOnChange(UpdateContext))
+			{
+				ProxyBuilder->MarkForStaticMeshUpdate();
+			}
 		}
 
 		UpdateContext.GetState().ConfigDirtyTree.Flag(Key);
@@ -98,10 +102,15 @@ namespace RealtimeMesh
 
 		if (auto ProxyBuilder = UpdateContext.GetProxyBuilder())
 		{
-			ProxyBuilder->AddSectionTask(Key, [StreamRange = StreamRange](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionProxy& Proxy)
+			ProxyBuilder->AddSectionTask(Key, SectionGroupHandle, Handle, [StreamRange = StreamRange](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionProxy& Proxy)
 			{
 				Proxy.UpdateStreamRange(StreamRange);
-			}, ShouldRecreateProxyOnChange(UpdateContext));
+			}, false);
+
+			if (ShouldUpdateStaticMeshesOnChange(UpdateContext))
+			{
+				ProxyBuilder->MarkForStaticMeshUpdate();
+			}
 		}
 
 		UpdateContext.GetState().StreamRangeDirtyTree.Flag(Key);
@@ -130,7 +139,7 @@ namespace RealtimeMesh
 	{		
 		if (auto ProxyBuilder = UpdateContext.GetProxyBuilder())
 		{
-			ProxyBuilder->AddSectionTask(Key, [Config = Config, StreamRange = StreamRange](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionProxy& Proxy)
+			ProxyBuilder->AddSectionTask(Key, SectionGroupHandle, Handle, [Config = Config, StreamRange = StreamRange](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionProxy& Proxy)
 			{
 				Proxy.Reset();
 				Proxy.UpdateConfig(Config);
@@ -175,4 +184,14 @@ namespace RealtimeMesh
 
 		return false;
 	}
+
+	bool FRealtimeMeshSection::ShouldUpdateStaticMeshesOnChange(const FRealtimeMeshLockContext& LockContext) const
+	{
+		if (const auto ParentGroup = GetSectionGroup(LockContext))
+		{
+			return ParentGroup->ShouldUpdateStaticMeshesOnChange(LockContext);
+		}
+
+		return false;
+	}
 }
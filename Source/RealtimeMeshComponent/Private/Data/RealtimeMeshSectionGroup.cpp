@@ -84,6 +84,7 @@ namespace RealtimeMesh
 		Config = InConfig;
 		Streams.Empty();
 		Sections.Empty();
+		SectionSlots.Empty();
 		Bounds.Reset();
 
 		InitializeProxy(UpdateContext);
@@ -107,7 +108,7 @@ namespace RealtimeMesh
 
 		if (auto ProxyBuilder = UpdateContext.GetProxyBuilder())
 		{
-			ProxyBuilder->AddSectionGroupTask(Key, [](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
+			ProxyBuilder->AddSectionGroupTask(Key, Handle, [](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
 			{
 				Proxy.Reset();
 			});
@@ -149,7 +150,7 @@ namespace RealtimeMesh
 
 		if (auto ProxyBuilder = UpdateContext.GetProxyBuilder())
 		{
-			ProxyBuilder->AddSectionGroupTask(Key, [Config = Config](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
+			ProxyBuilder->AddSectionGroupTask(Key, Handle, [Config = Config](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
 			{
 				Proxy.UpdateConfig(Config);
 			}, bShouldRecreateProxy);
@@ -177,17 +178,17 @@ namespace RealtimeMesh
 					const auto UpdateData = MakeShared<FRealtimeMeshSectionGroupStreamUpdateData>(MoveTemp(StreamCopy), EBufferUsageFlags::Static);
 					UpdateData->CreateBufferAsyncIfPossible(UpdateContext);
 
-					ProxyBuilder->AddSectionGroupTask(Key, [UpdateData = UpdateData](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
-					{
-						Proxy.CreateOrUpdateStream(RHICmdList, UpdateData);
-					}, ShouldRecreateProxyOnChange(UpdateContext));
+					ProxyBuilder->AddCreateOrUpdateStreamCommand(Key, Handle, UpdateData, false);
 				}
 				else
 				{
-					ProxyBuilder->AddSectionGroupTask(Key, [StreamKey](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
-					{
-						Proxy.RemoveStream(StreamKey);
-					}, ShouldRecreateProxyOnChange(UpdateContext));
+					ProxyBuilder->AddRemoveStreamCommand(Key, Handle, StreamKey, false);
+				}
+
+				// Buffers are swapped in place on the existing proxy, static groups only need their batches re-cached
+				if (ShouldUpdateStaticMeshesOnChange(UpdateContext))
+				{
+					ProxyBuilder->MarkForStaticMeshUpdate();
 				}
 			}
 		}
@@ -203,10 +204,12 @@ namespace RealtimeMesh
 			{
 				if (auto ProxyBuilder = UpdateContext.GetProxyBuilder())
 				{
-					ProxyBuilder->AddSectionGroupTask(Key, [StreamKey](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
+					ProxyBuilder->AddRemoveStreamCommand(Key, Handle, StreamKey, false);
+
+					if (ShouldUpdateStaticMeshesOnChange(UpdateContext))
 					{
-						Proxy.RemoveStream(StreamKey);
-					}, ShouldRecreateProxyOnChange(UpdateContext));
+						ProxyBuilder->MarkForStaticMeshUpdate();
+					}
 				}
 			}
 		}
@@ -243,15 +246,19 @@ namespace RealtimeMesh
 
 		if (!bExisted)
 		{
-			const auto Section = SharedResources->CreateSection(SectionKey);
-			Sections.Add(Section);
+			const auto Section = AddSection(SectionKey);
 
 			if (auto ProxyBuilder = UpdateContext.GetProxyBuilder())
 			{
-				ProxyBuilder->AddSectionGroupTask(Key, [SectionKey](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
+				ProxyBuilder->AddSectionGroupTask(Key, Handle, [SectionKey, SectionHandle = Section->Handle](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
 				{
-					Proxy.CreateSectionIfNotExists(SectionKey);
-				});
+					Proxy.CreateSectionIfNotExists(SectionKey, SectionHandle);
+				}, false);
+
+				if (ShouldUpdateStaticMeshesOnChange(UpdateContext))
+				{
+					ProxyBuilder->MarkForStaticMeshUpdate();
+				}
 			}
 		}
 
@@ -261,18 +268,39 @@ namespace RealtimeMesh
 
 	void FRealtimeMeshSectionGroup::RemoveSection(FRealtimeMeshUpdateContext& UpdateContext, const FRealtimeMeshSectionKey& SectionKey)
 	{
-		if (Sections.Remove(SectionKey))
+		if (const FRealtimeMeshSectionRef* Section = Sections.Find(SectionKey))
 		{
+			const FRealtimeMeshHandle SectionHandle = (*Section)->Handle;
+			Sections.Remove(SectionKey);
+			SectionSlots.Remove(SectionHandle);
+
+			// Sections of the group are laid out differently now
+			UpdateContext.GetState().ConfigDirtyTree.Flag(Key);
+
 			if (auto ProxyBuilder = UpdateContext.GetProxyBuilder())
 			{
-				ProxyBuilder->AddSectionGroupTask(Key, [SectionKey](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
+				ProxyBuilder->AddSectionGroupTask(Key, Handle, [SectionHandle](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
 				{
-					Proxy.RemoveSection(SectionKey);
-				}, ShouldRecreateProxyOnChange(UpdateContext));
+					Proxy.RemoveSection(SectionHandle);
+				}, false);
+
+				if (ShouldUpdateStaticMeshesOnChange(UpdateContext))
+				{
+					ProxyBuilder->MarkForStaticMeshUpdate();
+				}
 			}
 		}
 	}
 
+	FRealtimeMeshSectionRef FRealtimeMeshSectionGroup::AddSection(const FRealtimeMeshSectionKey& SectionKey)
+	{
+		const FRealtimeMeshSectionRef Section = SharedResources->CreateSection(SectionKey);
+		Section->SectionGroupHandle = Handle;
+		Section->Handle = SectionSlots.Add(SectionKey);
+		Sections.Add(Section);
+		return Section;
+	}
+
 	bool FRealtimeMeshSectionGroup::Serialize(FArchive& Ar)
 	{
 		int32 NumSections = Sections.Num();
@@ -281,6 +309,7 @@ namespace RealtimeMesh
 		if (Ar.IsLoading())
 		{
 			Sections.Empty();
+			SectionSlots.Empty();
 			for (int32 Index = 0; Index < NumSections; Index++)
 			{
 				FRealtimeMeshSectionKey SectionKey;
@@ -297,9 +326,7 @@ namespace RealtimeMesh
 					SectionKey = FRealtimeMeshSectionKey::Create(Key, SectionName);
 				}
 
-				auto Section = SharedResources->CreateSection(SectionKey);
-				Section->Serialize(Ar);
-				Sections.Add(Section);
+				AddSection(SectionKey)->Serialize(Ar);
 			}
 		}
 		else
@@ -329,9 +356,9 @@ namespace RealtimeMesh
 			// We only send sections here, we rely on the derived to setup the streams
 			for (const auto& Section : Sections)
 			{
-				ProxyBuilder->AddSectionGroupTask(Key, [SectionKey = Section->GetKey(UpdateContext), Config = Config](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
+				ProxyBuilder->AddSectionGroupTask(Key, Handle, [SectionKey = Section->GetKey(UpdateContext), SectionHandle = Section->GetHandle(UpdateContext), Config = Config](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
 				{
-					Proxy.CreateSectionIfNotExists(SectionKey);
+					Proxy.CreateSectionIfNotExists(SectionKey, SectionHandle);
 					Proxy.UpdateConfig(Config);
 				}, ShouldRecreateProxyOnChange(UpdateContext));
 
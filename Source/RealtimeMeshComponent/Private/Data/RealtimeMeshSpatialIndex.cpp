@@ -0,0 +1,286 @@
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Data/RealtimeMeshSpatialIndex.h"
+#include "Async/ParallelFor.h"
+
+namespace RealtimeMesh
+{
+	namespace SpatialIndex::Private
+	{
+		// Batches smaller than this are answered on the calling thread, the task dispatch would cost more than the queries
+		static constexpr int32 MinParallelBatchSize = 256;
+
+		template<typename QueryFunc>
+		static int32 RunBatch(int32 NumQueries, QueryFunc&& Query)
+		{
+			std::atomic<int32> NumHits(0);
+			ParallelFor(NumQueries, [&](int32 Index)
+			{
+				if (Query(Index))
+				{
+					NumHits.fetch_add(1, std::memory_order_relaxed);
+				}
+			}, NumQueries < MinParallelBatchSize ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+			return NumHits.load();
+		}
+	}
+
+	bool FRealtimeMeshSpatialIndexSource::Gather(const FRealtimeMeshStreamSet& Streams)
+	{
+		Positions.Reset();
+		Triangles.Reset();
+		TexCoords.Reset();
+
+		const FRealtimeMeshStream* PositionStream = Streams.Find(FRealtimeMeshStreams::Position);
+		const FRealtimeMeshStream* TriangleStream = Streams.Find(FRealtimeMeshStreams::Triangles);
+		if (!PositionStream || !TriangleStream || PositionStream->Num() == 0 || TriangleStream->Num() == 0 ||
+			!PositionStream->CanConvertTo<FVector3f>() || !TriangleStream->CanConvertTo<TIndex3<int32>>())
+		{
+			RefitFrom.Reset();
+			return false;
+		}
+
+		PositionStream->CopyTo(Positions);
+
+		if (RefitFrom.IsValid() && RefitFrom->GetBVH().GetPositions().Num() != Positions.Num())
+		{
+			RefitFrom.Reset();
+		}
+		if (!RefitFrom.IsValid())
+		{
+			TriangleStream->CopyTo(Triangles);
+		}
+
+		const FRealtimeMeshStream* TexCoordStream = Streams.Find(FRealtimeMeshStreams::TexCoords);
+		if (TexCoordStream && FRealtimeMeshTypeConversionUtilities::CanConvert(TexCoordStream->GetElementType(), GetRealtimeMeshDataElementType<FVector2f>()))
+		{
+			// UVs past the end of a short stream stay zeroed so every channel lines up with the positions
+			const int32 NumUVs = FMath::Min(TexCoordStream->Num(), Positions.Num());
+			TexCoords.SetNum(TexCoordStream->GetNumElements());
+			for (int32 ChannelIndex = 0; ChannelIndex < TexCoords.Num(); ChannelIndex++)
+			{
+				TexCoords[ChannelIndex].SetNumZeroed(Positions.Num());
+				TexCoordStream->GetElementRange<FVector2f>(0, ChannelIndex, MakeArrayView(TexCoords[ChannelIndex].GetData(), NumUVs));
+			}
+		}
+
+		return true;
+	}
+
+	FRealtimeMeshSpatialIndexGroup::FRealtimeMeshSpatialIndexGroup(FRealtimeMeshSpatialIndexSource&& Source)
+		: Key(Source.Key)
+		, StreamVersion(Source.StreamVersion)
+		, TopologyVersion(Source.TopologyVersion)
+		, TexCoords(MoveTemp(Source.TexCoords))
+		, bWasRefit(false)
+	{
+		if (Source.RefitFrom.IsValid())
+		{
+			BVH = Source.RefitFrom->GetBVH();
+			bWasRefit = BVH.Refit(MoveTemp(Source.Positions));
+			check(bWasRefit);
+		}
+		else
+		{
+			BVH.Build(MoveTemp(Source.Positions), Source.Triangles);
+		}
+	}
+
+	bool FRealtimeMeshSpatialIndexGroup::GetTexCoord(const FRealtimeMeshTriangleHit& Hit, int32 UVChannel, FVector2f& OutUV) const
+	{
+		if (!Hit.IsValid() || !TexCoords.IsValidIndex(UVChannel))
+		{
+			return false;
+		}
+
+		const TArray<FVector2f>& Channel = TexCoords[UVChannel];
+		OutUV = Channel[Hit.Vertices.V0] * Hit.Barycentrics.X + Channel[Hit.Vertices.V1] * Hit.Barycentrics.Y + Channel[Hit.Vertices.V2] * Hit.Barycentrics.Z;
+		return true;
+	}
+
+	SIZE_T FRealtimeMeshSpatialIndexGroup::GetAllocatedSize() const
+	{
+		SIZE_T Size = BVH.GetAllocatedSize() + TexCoords.GetAllocatedSize();
+		for (const TArray<FVector2f>& Channel : TexCoords)
+		{
+			Size += Channel.GetAllocatedSize();
+		}
+		return Size;
+	}
+
+	TSharedRef<const FRealtimeMeshSpatialIndex> FRealtimeMeshSpatialIndex::Build(FRealtimeMeshLODKey LODKey, TArray<FRealtimeMeshSpatialIndexSource>&& ChangedSources,
+		TArray<FRealtimeMeshSpatialIndexGroupRef>&& UnchangedGroups)
+	{
+		TArray<TSharedPtr<const FRealtimeMeshSpatialIndexGroup>> BuiltGroups;
+		BuiltGroups.SetNum(ChangedSources.Num());
+
+		ParallelFor(ChangedSources.Num(), [&](int32 Index)
+		{
+			BuiltGroups[Index] = MakeShared<FRealtimeMeshSpatialIndexGroup>(MoveTemp(ChangedSources[Index]));
+		}, ChangedSources.Num() < 2 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::Unbalanced);
+
+		TArray<FRealtimeMeshSpatialIndexGroupRef> Groups = MoveTemp(UnchangedGroups);
+		for (TSharedPtr<const FRealtimeMeshSpatialIndexGroup>& BuiltGroup : BuiltGroups)
+		{
+			Groups.Add(BuiltGroup.ToSharedRef());
+		}
+
+		return MakeShared<FRealtimeMeshSpatialIndex>(LODKey, MoveTemp(Groups));
+	}
+
+	const FRealtimeMeshSpatialIndexGroup* FRealtimeMeshSpatialIndex::FindGroup(const FRealtimeMeshSectionGroupKey& SectionGroupKey) const
+	{
+		const FRealtimeMeshSpatialIndexGroupRef* Group = Groups.FindByPredicate([&](const FRealtimeMeshSpatialIndexGroupRef& Entry)
+		{
+			return Entry->GetKey() == SectionGroupKey;
+		});
+		return Group ? &Group->Get() : nullptr;
+	}
+
+	bool FRealtimeMeshSpatialIndex::IsUpToDate(const TMap<FRealtimeMeshSectionGroupKey, uint32>& StreamVersions) const
+	{
+		if (StreamVersions.Num() != Groups.Num())
+		{
+			return false;
+		}
+
+		for (const FRealtimeMeshSpatialIndexGroupRef& Group : Groups)
+		{
+			const uint32* Version = StreamVersions.Find(Group->GetKey());
+			if (!Version || *Version != Group->GetStreamVersion())
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool FRealtimeMeshSpatialIndex::Raycast(const FVector3f& Origin, const FVector3f& Direction, float MaxDistance, FRealtimeMeshSpatialHit& OutHit) const
+	{
+		bool bHit = false;
+		float ClosestDistance = MaxDistance;
+		for (const FRealtimeMeshSpatialIndexGroupRef& Group : Groups)
+		{
+			FRealtimeMeshTriangleHit GroupHit;
+			if (Group->GetBVH().Raycast(Origin, Direction, ClosestDistance, GroupHit))
+			{
+				static_cast<FRealtimeMeshTriangleHit&>(OutHit) = GroupHit;
+				OutHit.SectionGroupKey = Group->GetKey();
+				ClosestDistance = GroupHit.Distance;
+				bHit = true;
+			}
+		}
+		return bHit;
+	}
+
+	bool FRealtimeMeshSpatialIndex::SweepSphere(const FVector3f& Origin, const FVector3f& Direction, float Radius, float MaxDistance, FRealtimeMeshSpatialHit& OutHit) const
+	{
+		bool bHit = false;
+		float ClosestDistance = MaxDistance;
+		for (const FRealtimeMeshSpatialIndexGroupRef& Group : Groups)
+		{
+			FRealtimeMeshTriangleHit GroupHit;
+			if (Group->GetBVH().SweepSphere(Origin, Direction, Radius, ClosestDistance, GroupHit))
+			{
+				static_cast<FRealtimeMeshTriangleHit&>(OutHit) = GroupHit;
+				OutHit.SectionGroupKey = Group->GetKey();
+				ClosestDistance = GroupHit.Distance;
+				bHit = true;
+			}
+		}
+		return bHit;
+	}
+
+	bool FRealtimeMeshSpatialIndex::FindClosestPoint(const FVector3f& Point, float MaxDistance, FRealtimeMeshSpatialHit& OutHit) const
+	{
+		bool bHit = false;
+		float ClosestDistance = MaxDistance;
+		for (const FRealtimeMeshSpatialIndexGroupRef& Group : Groups)
+		{
+			FRealtimeMeshTriangleHit GroupHit;
+			if (Group->GetBVH().FindClosestPoint(Point, ClosestDistance, GroupHit))
+			{
+				static_cast<FRealtimeMeshTriangleHit&>(OutHit) = GroupHit;
+				OutHit.SectionGroupKey = Group->GetKey();
+				ClosestDistance = GroupHit.Distance;
+				bHit = true;
+			}
+		}
+		return bHit;
+	}
+
+	bool FRealtimeMeshSpatialIndex::GetTexCoord(const FRealtimeMeshSpatialHit& Hit, int32 UVChannel, FVector2f& OutUV) const
+	{
+		const FRealtimeMeshSpatialIndexGroup* Group = FindGroup(Hit.SectionGroupKey);
+		return Group && Group->GetTexCoord(Hit, UVChannel, OutUV);
+	}
+
+	bool FRealtimeMeshSpatialIndex::FindTexCoordAtLocation(const FVector3f& Location, float MaxDistance, int32 UVChannel, FVector2f& OutUV) const
+	{
+		FRealtimeMeshSpatialHit Hit;
+		return FindClosestPoint(Location, MaxDistance, Hit) && GetTexCoord(Hit, UVChannel, OutUV);
+	}
+
+	bool FRealtimeMeshSpatialIndex::FindTexCoordByRaycast(const FVector3f& Origin, const FVector3f& Direction, float MaxDistance, int32 UVChannel, FVector2f& OutUV) const
+	{
+		FRealtimeMeshSpatialHit Hit;
+		return Raycast(Origin, Direction, MaxDistance, Hit) && GetTexCoord(Hit, UVChannel, OutUV);
+	}
+
+	int32 FRealtimeMeshSpatialIndex::FindTexCoordsAtLocations(TConstArrayView<FVector3f> Locations, float MaxDistance, int32 UVChannel, TArrayView<FVector2f> OutUVs,
+		TArrayView<bool> OutFound) const
+	{
+		check(OutUVs.Num() == Locations.Num() && OutFound.Num() == Locations.Num());
+
+		return SpatialIndex::Private::RunBatch(Locations.Num(), [&](int32 Index)
+		{
+			OutFound[Index] = FindTexCoordAtLocation(Locations[Index], MaxDistance, UVChannel, OutUVs[Index]);
+			return OutFound[Index];
+		});
+	}
+
+	int32 FRealtimeMeshSpatialIndex::RaycastBatch(TConstArrayView<FVector3f> Origins, TConstArrayView<FVector3f> Directions, float MaxDistance,
+		TArrayView<FRealtimeMeshSpatialHit> OutHits) const
+	{
+		check(Directions.Num() == Origins.Num() && OutHits.Num() == Origins.Num());
+
+		return SpatialIndex::Private::RunBatch(Origins.Num(), [&](int32 Index)
+		{
+			OutHits[Index] = FRealtimeMeshSpatialHit();
+			return Raycast(Origins[Index], Directions[Index], MaxDistance, OutHits[Index]);
+		});
+	}
+
+	int32 FRealtimeMeshSpatialIndex::SweepSphereBatch(TConstArrayView<FVector3f> Origins, TConstArrayView<FVector3f> Directions, float Radius, float MaxDistance,
+		TArrayView<FRealtimeMeshSpatialHit> OutHits) const
+	{
+		check(Directions.Num() == Origins.Num() && OutHits.Num() == Origins.Num());
+
+		return SpatialIndex::Private::RunBatch(Origins.Num(), [&](int32 Index)
+		{
+			OutHits[Index] = FRealtimeMeshSpatialHit();
+			return SweepSphere(Origins[Index], Directions[Index], Radius, MaxDistance, OutHits[Index]);
+		});
+	}
+
+	int32 FRealtimeMeshSpatialIndex::FindClosestPointBatch(TConstArrayView<FVector3f> Points, float MaxDistance, TArrayView<FRealtimeMeshSpatialHit> OutHits) const
+	{
+		check(OutHits.Num() == Points.Num());
+
+		return SpatialIndex::Private::RunBatch(Points.Num(), [&](int32 Index)
+		{
+			OutHits[Index] = FRealtimeMeshSpatialHit();
+			return FindClosestPoint(Points[Index], MaxDistance, OutHits[Index]);
+		});
+	}
+
+	SIZE_T FRealtimeMeshSpatialIndex::GetAllocatedSize() const
+	{
+		SIZE_T Size = Groups.GetAllocatedSize();
+		for (const FRealtimeMeshSpatialIndexGroupRef& Group : Groups)
+		{
+			Size += Group->GetAllocatedSize();
+		}
+		return Size;
+	}
+}
@@ -6,6 +6,9 @@
 #include "Core/RealtimeMeshBuilder.h"
 #include "Core/RealtimeMeshDataStream.h"
 #include "Core/RealtimeMeshDataTypes.h"
+#include "RealtimeMeshCore.h"
+
+DECLARE_CYCLE_STAT(TEXT("RealtimeMeshAlgo - Generate Tangents"), STAT_RealtimeMeshAlgo_GenerateTangents, STATGROUP_RealtimeMesh);
 
 using namespace RealtimeMesh;
 
@@ -284,6 +287,11 @@ TOptional<TMap<int32, FRealtimeMeshStreamRange>> RealtimeMeshAlgo::GetStreamRang
 
 void RealtimeMeshAlgo::GenerateTangents(RealtimeMesh::FRealtimeMeshStreamSet& StreamSet, bool bComputeSmoothNormals)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(RealtimeMeshAlgo::GenerateTangents);
+	SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshAlgo_GenerateTangents);
+	CSV_SCOPED_TIMING_STAT(RealtimeMesh, GenerateTangents);
+	FRealtimeMeshStatCounters::Get().TangentGenerations++;
+	
 	if (!StreamSet.Contains(FRealtimeMeshStreams::Triangles) || !StreamSet.Contains(FRealtimeMeshStreams::Position))
 	{
 		return;
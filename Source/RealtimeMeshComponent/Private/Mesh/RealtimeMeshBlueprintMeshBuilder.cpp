@@ -6,6 +6,7 @@
 #include "RealtimeMeshComponentModule.h"
 #include "Core/RealtimeMeshDataStream.h"
 #include "Logging/MessageLog.h"
+#include "Async/ParallelFor.h"
 
 #define LOCTEXT_NAMESPACE "RealtimeMesh"
 
@@ -32,6 +33,11 @@ static TAutoConsoleVariable<int32> CVarRealtimeMeshBuilderPoolMaxSizeThreshold(
 	16,
 	TEXT("Maximum number of builders a URealtimeMeshStreamPool will allow to be in the pool before running garbage collection"));
 
+static TAutoConsoleVariable<int32> CVarRealtimeMeshBuilderBulkBatchSize(
+	TEXT("RealtimeMesh.Builder.BulkBatchSize"),
+	16384,
+	TEXT("Number of rows converted per task by the bulk array functions on blueprint builders that can't go through a stream copy. Larger arrays are split across the task graph. 0 disables parallel conversion"));
+
 
 static RealtimeMesh::FRealtimeMeshBufferLayout GetBufferLayout(ERealtimeMeshSimpleStreamType StreamType, int32 NumElements)
 {
@@ -69,6 +75,78 @@ static RealtimeMesh::FRealtimeMeshBufferLayout GetBufferLayout(ERealtimeMeshSimp
 	}
 }
 
+// Runs Func(BatchStart, BatchCount) over [0, Count), spreading the batches across the task graph once Count exceeds the batch size.
+// Func must only touch the rows in its own batch.
+template <typename FuncType>
+static void ForEachBulkBatch(int32 Count, FuncType&& Func)
+{
+	const int32 BatchSize = CVarRealtimeMeshBuilderBulkBatchSize.GetValueOnAnyThread();
+	if (BatchSize <= 0 || Count <= BatchSize)
+	{
+		Func(0, Count);
+		return;
+	}
+
+	const int32 NumBatches = FMath::DivideAndRoundUp(Count, BatchSize);
+	ParallelFor(NumBatches, [&](int32 BatchIndex)
+	{
+		const int32 BatchStart = BatchIndex * BatchSize;
+		Func(BatchStart, FMath::Min(BatchSize, Count - BatchStart));
+	});
+}
+
+static bool CanWriteBulkElements(const RealtimeMesh::FRealtimeMeshStream& Stream, const RealtimeMesh::FRealtimeMeshBufferLayout& SourceLayout, int32 StartIndex, int32 ElementIndex)
+{
+	const RealtimeMesh::FRealtimeMeshElementType FromType = SourceLayout.GetElementType();
+	const RealtimeMesh::FRealtimeMeshElementType ToType = Stream.GetLayout().GetElementType();
+	return StartIndex >= 0 && StartIndex <= Stream.Num() &&
+		ElementIndex >= 0 && (ElementIndex + SourceLayout.GetNumElements()) <= Stream.GetNumElements() &&
+		(FromType == ToType || RealtimeMesh::FRealtimeMeshTypeConversionUtilities::CanConvert(FromType, ToType));
+}
+
+// Writes rows of SourceElementsPerRow elements into the stream starting at StartIndex/ElementIndex, growing the stream as needed.
+template <typename SourceType>
+static bool WriteBulkElements(RealtimeMesh::FRealtimeMeshStream& Stream, int32 StartIndex, int32 ElementIndex, TConstArrayView<SourceType> Values, int32 SourceElementsPerRow = 1)
+{
+	const RealtimeMesh::FRealtimeMeshBufferLayout SourceLayout = RealtimeMesh::GetRealtimeMeshBufferLayout<SourceType>(SourceElementsPerRow);
+	if (!CanWriteBulkElements(Stream, SourceLayout, StartIndex, ElementIndex))
+	{
+		return false;
+	}
+
+	const int32 NumRows = Values.Num() / SourceElementsPerRow;
+	if (StartIndex + NumRows > Stream.Num())
+	{
+		// Grow first, the stream (and anything linked to it) can't be resized while the copy is in flight
+		Stream.SetNumZeroed(StartIndex + NumRows, false);
+	}
+
+	// Large ranges are chunked across the task graph by the stream copy itself
+	Stream.SetElementRange(StartIndex, ElementIndex, SourceLayout, reinterpret_cast<const uint8*>(Values.GetData()), NumRows);
+	return true;
+}
+
+// Reads a single element from Count rows starting at StartIndex, converting to DestType. A negative Count reads to the end of the stream.
+template <typename DestType>
+static TArray<DestType> ReadBulkElements(const RealtimeMesh::FRealtimeMeshStream& Stream, int32 StartIndex, int32 Count, int32 ElementIndex)
+{
+	using namespace RealtimeMesh;
+	TArray<DestType> Result;
+
+	const FRealtimeMeshElementType FromType = Stream.GetLayout().GetElementType();
+	const FRealtimeMeshElementType ToType = GetRealtimeMeshDataElementType<DestType>();
+	if (StartIndex < 0 || StartIndex > Stream.Num() || ElementIndex < 0 || ElementIndex >= Stream.GetNumElements() ||
+		(FromType != ToType && !FRealtimeMeshTypeConversionUtilities::CanConvert(FromType, ToType)))
+	{
+		return Result;
+	}
+
+	Count = Count < 0 ? Stream.Num() - StartIndex : FMath::Min(Count, Stream.Num() - StartIndex);
+	Result.SetNumUninitialized(Count);
+	Stream.GetElementRange<DestType>(StartIndex, ElementIndex, Result);
+	return Result;
+}
+
 
 
 bool FRealtimeMeshStreamRowPtr::IsValid() const
@@ -487,6 +565,151 @@ FVector4 URealtimeMeshStream::GetVector4(URealtimeMeshStream*& Builder, FRealtim
 	return FVector4::Zero();
 }
 
+int32 URealtimeMeshStream::AppendIntArray(URealtimeMeshStream*& Builder, const TArray<int32>& Values, int32 ElementIdx)
+{
+	Builder = this;
+	return Stream.IsValid() ? SetIntArray(Builder, Stream->Num(), Values, ElementIdx) : INDEX_NONE;
+}
+
+int32 URealtimeMeshStream::AppendFloatArray(URealtimeMeshStream*& Builder, const TArray<float>& Values, int32 ElementIdx)
+{
+	Builder = this;
+	return Stream.IsValid() ? SetFloatArray(Builder, Stream->Num(), Values, ElementIdx) : INDEX_NONE;
+}
+
+int32 URealtimeMeshStream::AppendVector2Array(URealtimeMeshStream*& Builder, const TArray<FVector2D>& Values, int32 ElementIdx)
+{
+	Builder = this;
+	return Stream.IsValid() ? SetVector2Array(Builder, Stream->Num(), Values, ElementIdx) : INDEX_NONE;
+}
+
+int32 URealtimeMeshStream::AppendVector3Array(URealtimeMeshStream*& Builder, const TArray<FVector>& Values, int32 ElementIdx)
+{
+	Builder = this;
+	return Stream.IsValid() ? SetVector3Array(Builder, Stream->Num(), Values, ElementIdx) : INDEX_NONE;
+}
+
+int32 URealtimeMeshStream::AppendVector4Array(URealtimeMeshStream*& Builder, const TArray<FVector4>& Values, int32 ElementIdx)
+{
+	Builder = this;
+	return Stream.IsValid() ? SetVector4Array(Builder, Stream->Num(), Values, ElementIdx) : INDEX_NONE;
+}
+
+int32 URealtimeMeshStream::SetIntArray(URealtimeMeshStream*& Builder, int32 StartIndex, const TArray<int32>& Values, int32 ElementIdx)
+{
+	Builder = this;
+	if (Stream.IsValid() && WriteBulkElements<int32>(*Stream, StartIndex, ElementIdx, Values))
+	{
+		return StartIndex;
+	}
+	RMC_RATE_LIMIT_LOG({
+		FMessageLog("RealtimeMesh").Error(LOCTEXT("MeshStream_SetIntArray_Invalid", "SetIntArray: Stream not valid, range out of bounds, or type not convertible"));
+	});
+	return INDEX_NONE;
+}
+
+int32 URealtimeMeshStream::SetFloatArray(URealtimeMeshStream*& Builder, int32 StartIndex, const TArray<float>& Values, int32 ElementIdx)
+{
+	Builder = this;
+	if (Stream.IsValid() && WriteBulkElements<float>(*Stream, StartIndex, ElementIdx, Values))
+	{
+		return StartIndex;
+	}
+	RMC_RATE_LIMIT_LOG({
+		FMessageLog("RealtimeMesh").Error(LOCTEXT("MeshStream_SetFloatArray_Invalid", "SetFloatArray: Stream not valid, range out of bounds, or type not convertible"));
+	});
+	return INDEX_NONE;
+}
+
+int32 URealtimeMeshStream::SetVector2Array(URealtimeMeshStream*& Builder, int32 StartIndex, const TArray<FVector2D>& Values, int32 ElementIdx)
+{
+	Builder = this;
+	if (Stream.IsValid() && WriteBulkElements<FVector2D>(*Stream, StartIndex, ElementIdx, Values))
+	{
+		return StartIndex;
+	}
+	RMC_RATE_LIMIT_LOG({
+		FMessageLog("RealtimeMesh").Error(LOCTEXT("MeshStream_SetVector2Array_Invalid", "SetVector2Array: Stream not valid, range out of bounds, or type not convertible"));
+	});
+	return INDEX_NONE;
+}
+
+int32 URealtimeMeshStream::SetVector3Array(URealtimeMeshStream*& Builder, int32 StartIndex, const TArray<FVector>& Values, int32 ElementIdx)
+{
+	Builder = this;
+	if (Stream.IsValid() && WriteBulkElements<FVector>(*Stream, StartIndex, ElementIdx, Values))
+	{
+		return StartIndex;
+	}
+	RMC_RATE_LIMIT_LOG({
+		FMessageLog("RealtimeMesh").Error(LOCTEXT("MeshStream_SetVector3Array_Invalid", "SetVector3Array: Stream not valid, range out of bounds, or type not convertible"));
+	});
+	return INDEX_NONE;
+}
+
+int32 URealtimeMeshStream::SetVector4Array(URealtimeMeshStream*& Builder, int32 StartIndex, const TArray<FVector4>& Values, int32 ElementIdx)
+{
+	Builder = this;
+	if (Stream.IsValid() && WriteBulkElements<FVector4>(*Stream, StartIndex, ElementIdx, Values))
+	{
+		return StartIndex;
+	}
+	RMC_RATE_LIMIT_LOG({
+		FMessageLog("RealtimeMesh").Error(LOCTEXT("MeshStream_SetVector4Array_Invalid", "SetVector4Array: Stream not valid, range out of bounds, or type not convertible"));
+	});
+	return INDEX_NONE;
+}
+
+TArray<int32> URealtimeMeshStream::GetIntArray(URealtimeMeshStream*& Builder, int32 StartIndex, int32 Count, int32 ElementIdx)
+{
+	Builder = this;
+	if (Stream.IsValid())
+	{
+		return ReadBulkElements<int32>(*Stream, StartIndex, Count, ElementIdx);
+	}
+	return TArray<int32>();
+}
+
+TArray<float> URealtimeMeshStream::GetFloatArray(URealtimeMeshStream*& Builder, int32 StartIndex, int32 Count, int32 ElementIdx)
+{
+	Builder = this;
+	if (Stream.IsValid())
+	{
+		return ReadBulkElements<float>(*Stream, StartIndex, Count, ElementIdx);
+	}
+	return TArray<float>();
+}
+
+TArray<FVector2D> URealtimeMeshStream::GetVector2Array(URealtimeMeshStream*& Builder, int32 StartIndex, int32 Count, int32 ElementIdx)
+{
+	Builder = this;
+	if (Stream.IsValid())
+	{
+		return ReadBulkElements<FVector2D>(*Stream, StartIndex, Count, ElementIdx);
+	}
+	return TArray<FVector2D>();
+}
+
+TArray<FVector> URealtimeMeshStream::GetVector3Array(URealtimeMeshStream*& Builder, int32 StartIndex, int32 Count, int32 ElementIdx)
+{
+	Builder = this;
+	if (Stream.IsValid())
+	{
+		return ReadBulkElements<FVector>(*Stream, StartIndex, Count, ElementIdx);
+	}
+	return TArray<FVector>();
+}
+
+TArray<FVector4> URealtimeMeshStream::GetVector4Array(URealtimeMeshStream*& Builder, int32 StartIndex, int32 Count, int32 ElementIdx)
+{
+	Builder = this;
+	if (Stream.IsValid())
+	{
+		return ReadBulkElements<FVector4>(*Stream, StartIndex, Count, ElementIdx);
+	}
+	return TArray<FVector4>();
+}
+
 
 
 
@@ -1067,6 +1290,151 @@ void URealtimeMeshLocalBuilder::GetVertex(URealtimeMeshLocalBuilder*& Builder, i
 	}
 }
 
+int32 URealtimeMeshLocalBuilder::AppendPositions(URealtimeMeshLocalBuilder*& Builder, const TArray<FVector>& Positions)
+{
+	Builder = this;
+	return SetPositions(Builder, MeshBuilder.IsValid() ? MeshBuilder->NumVertices() : 0, Positions);
+}
+
+int32 URealtimeMeshLocalBuilder::SetPositions(URealtimeMeshLocalBuilder*& Builder, int32 StartIndex, const TArray<FVector>& Positions)
+{
+	using namespace RealtimeMesh;
+
+	Builder = this;
+	if (MeshBuilder.IsValid())
+	{
+		if (FRealtimeMeshStream* PositionStream = Streams->Find(FRealtimeMeshStreams::Position))
+		{
+			if (WriteBulkElements<FVector>(*PositionStream, StartIndex, 0, Positions))
+			{
+				return StartIndex;
+			}
+		}
+	}
+	
+	RMC_RATE_LIMIT_LOG({
+		FMessageLog("RealtimeMesh").Error(LOCTEXT("MeshLocalBuilder_SetPositions_Invalid", "SetPositions: Builder not valid or StartIndex out of range"));
+	});
+	return INDEX_NONE;
+}
+
+int32 URealtimeMeshLocalBuilder::SetNormalsAndTangents(URealtimeMeshLocalBuilder*& Builder, int32 StartIndex, const TArray<FVector>& Normals, const TArray<FVector>& Tangents)
+{
+	using namespace RealtimeMesh;
+
+	Builder = this;
+	if (MeshBuilder.IsValid() && MeshBuilder->HasTangents() && StartIndex >= 0 && StartIndex <= MeshBuilder->NumVertices() &&
+		(Tangents.Num() == 0 || Tangents.Num() == Normals.Num()))
+	{
+		if (StartIndex + Normals.Num() > MeshBuilder->NumVertices())
+		{
+			// Grow through the position stream so all the linked vertex streams pick up their defaults
+			Streams->FindChecked(FRealtimeMeshStreams::Position).SetNumZeroed(StartIndex + Normals.Num(), false);
+		}
+
+		ForEachBulkBatch(Normals.Num(), [&](int32 BatchStart, int32 BatchCount)
+		{
+			for (int32 Index = BatchStart; Index < BatchStart + BatchCount; Index++)
+			{
+				if (Tangents.Num() > 0)
+				{
+					MeshBuilder->SetNormalAndTangent(StartIndex + Index, FVector3f(Normals[Index]), FVector3f(Tangents[Index]));
+				}
+				else
+				{
+					MeshBuilder->SetNormal(StartIndex + Index, FVector3f(Normals[Index]));
+				}
+			}
+		});
+		return StartIndex;
+	}
+	
+	RMC_RATE_LIMIT_LOG({
+		FMessageLog("RealtimeMesh").Error(LOCTEXT("MeshLocalBuilder_SetNormalsAndTangents_Invalid", "SetNormalsAndTangents: Builder not valid, tangents not enabled, or arrays mismatched"));
+	});
+	return INDEX_NONE;
+}
+
+int32 URealtimeMeshLocalBuilder::SetColors(URealtimeMeshLocalBuilder*& Builder, int32 StartIndex, const TArray<FLinearColor>& Colors)
+{
+	using namespace RealtimeMesh;
+
+	Builder = this;
+	if (MeshBuilder.IsValid() && MeshBuilder->HasVertexColors() && StartIndex >= 0 && StartIndex <= MeshBuilder->NumVertices())
+	{
+		FRealtimeMeshStream& ColorStream = Streams->FindChecked(FRealtimeMeshStreams::Color);
+		if (StartIndex + Colors.Num() > ColorStream.Num())
+		{
+			ColorStream.SetNumZeroed(StartIndex + Colors.Num(), false);
+		}
+
+		// Converted here rather than through the registry to match the sRGB conversion used by AddVertex/EditVertex
+		TArrayView<FColor> DestColors = ColorStream.GetArrayView<FColor>();
+		ForEachBulkBatch(Colors.Num(), [&](int32 BatchStart, int32 BatchCount)
+		{
+			for (int32 Index = BatchStart; Index < BatchStart + BatchCount; Index++)
+			{
+				DestColors[StartIndex + Index] = Colors[Index].ToFColor(true);
+			}
+		});
+		return StartIndex;
+	}
+	
+	RMC_RATE_LIMIT_LOG({
+		FMessageLog("RealtimeMesh").Error(LOCTEXT("MeshLocalBuilder_SetColors_Invalid", "SetColors: Builder not valid, colors not enabled, or StartIndex out of range"));
+	});
+	return INDEX_NONE;
+}
+
+int32 URealtimeMeshLocalBuilder::SetTexCoords(URealtimeMeshLocalBuilder*& Builder, int32 StartIndex, const TArray<FVector2D>& TexCoords, int32 Channel)
+{
+	using namespace RealtimeMesh;
+
+	Builder = this;
+	if (MeshBuilder.IsValid() && MeshBuilder->HasTexCoords())
+	{
+		if (WriteBulkElements<FVector2D>(Streams->FindChecked(FRealtimeMeshStreams::TexCoords), StartIndex, Channel, TexCoords))
+		{
+			return StartIndex;
+		}
+	}
+	
+	RMC_RATE_LIMIT_LOG({
+		FMessageLog("RealtimeMesh").Error(LOCTEXT("MeshLocalBuilder_SetTexCoords_Invalid", "SetTexCoords: Builder not valid, channel not enabled, or StartIndex out of range"));
+	});
+	return INDEX_NONE;
+}
+
+int32 URealtimeMeshLocalBuilder::AppendTriangles(URealtimeMeshLocalBuilder*& Builder, const TArray<int32>& Triangles, const TArray<int32>& PolyGroups)
+{
+	Builder = this;
+	return SetTriangles(Builder, MeshBuilder.IsValid() ? MeshBuilder->NumTriangles() : 0, Triangles, PolyGroups);
+}
+
+int32 URealtimeMeshLocalBuilder::SetTriangles(URealtimeMeshLocalBuilder*& Builder, int32 StartIndex, const TArray<int32>& Triangles, const TArray<int32>& PolyGroups)
+{
+	using namespace RealtimeMesh;
+
+	Builder = this;
+	const int32 NumTriangles = Triangles.Num() / 3;
+	if (MeshBuilder.IsValid() && (Triangles.Num() % 3) == 0 && (PolyGroups.Num() == 0 || PolyGroups.Num() == NumTriangles))
+	{
+		if (WriteBulkElements<int32>(Streams->FindChecked(FRealtimeMeshStreams::Triangles), StartIndex, 0, Triangles, 3))
+		{
+			if (PolyGroups.Num() > 0 && MeshBuilder->HasPolyGroups())
+			{
+				ensure(WriteBulkElements<int32>(Streams->FindChecked(FRealtimeMeshStreams::PolyGroups), StartIndex, 0, PolyGroups));
+			}
+			return StartIndex;
+		}
+	}
+	
+	RMC_RATE_LIMIT_LOG({
+		FMessageLog("RealtimeMesh").Error(LOCTEXT("MeshLocalBuilder_SetTriangles_Invalid", "SetTriangles: Builder not valid, StartIndex out of range, or triangle/polygroup counts mismatched"));
+	});
+	return INDEX_NONE;
+}
+
 
 
 URealtimeMeshStream* URealtimeMeshStreamPool::RequestStream(const FRealtimeMeshStreamKey& StreamKey, ERealtimeMeshSimpleStreamType StreamType, int32 NumElements)
@@ -1263,90 +1631,65 @@ URealtimeMeshStreamSet* URealtimeMeshStreamUtils::CopyStreamSetFromComponents(UR
 		Builder.EnableColors();
 	}
 	
-	for (int32 Index = 0; Index < Components.Positions.Num(); Index++)
-	{
-		auto Vertex = Builder.AddVertex(FVector3f(Components.Positions[Index]));
+	const int32 BaseVertex = Builder.NumVertices();
+	WriteBulkElements<FVector>(Streams->GetStreamSet().FindChecked(RealtimeMesh::FRealtimeMeshStreams::Position), BaseVertex, 0, Components.Positions);
 
-		if (Components.Normals.Num() > Vertex)
+	ForEachBulkBatch(Components.Positions.Num(), [&](int32 BatchStart, int32 BatchCount)
+	{
+		for (int32 Index = BatchStart; Index < BatchStart + BatchCount; Index++)
 		{
-			if (Components.Tangents.Num() > 0)
+			auto Vertex = Builder.EditVertex(BaseVertex + Index);
+
+			if (Components.Normals.Num() > Index)
 			{
-				if (Components.Binormals.Num() > 0)
+				if (Components.Tangents.Num() > 0)
 				{
-					Vertex.SetTangents(FVector3f(Components.Normals[Index]), FVector3f(Components.Binormals[Index]), FVector3f(Components.Tangents[Index]));
+					if (Components.Binormals.Num() > 0)
+					{
+						Vertex.SetTangents(FVector3f(Components.Normals[Index]), FVector3f(Components.Binormals[Index]), FVector3f(Components.Tangents[Index]));
+					}
+					else
+					{
+						Vertex.SetNormalAndTangent(FVector3f(Components.Normals[Index]), FVector3f(Components.Tangents[Index]));
+					}
 				}
 				else
 				{
-					Vertex.SetNormalAndTangent(FVector3f(Components.Normals[Index]), FVector3f(Components.Tangents[Index]));
+					Vertex.SetNormal(FVector3f(Components.Normals[Index]));				
 				}
 			}
-			else
+
+			if (Components.Colors.Num() > Index)
 			{
-				Vertex.SetNormal(FVector3f(Components.Normals[Index]));				
+				Vertex.SetColor(Components.Colors[Index]);
 			}
 		}
-
-		if (Components.Colors.Num() > Vertex)
-		{
-			Vertex.SetColor(Components.Colors[Index]);
-		}
-
-		if (Components.UV0.Num() > Vertex)
-		{
-			Vertex.SetTexCoord(FVector2f(Components.UV0[Index]));
-		}	
-	}
+	});
 
 	if (NumUVs > 0)
 	{
-		if (Components.UV1.Num() > 0)
-		{
-			RealtimeMesh::TRealtimeMeshStridedStreamBuilder<FVector2f, void> UV0Builder(Streams->GetStreamSet().FindChecked(RealtimeMesh::FRealtimeMeshStreams::TexCoords), 1);
-
-			const int32 NumToCopy = FMath::Min(Builder.NumVertices(), Components.UV1.Num());
-			for (int32 Index = 0; Index < NumToCopy; Index++)
-			{
-				UV0Builder.Set(Index, FVector2f(Components.UV1[Index]));
-			}
-		}
-
-		if (Components.UV2.Num() > 0)
+		RealtimeMesh::FRealtimeMeshStream& TexCoordStream = Streams->GetStreamSet().FindChecked(RealtimeMesh::FRealtimeMeshStreams::TexCoords);
+		const TConstArrayView<FVector2D> UVChannels[] = { Components.UV0, Components.UV1, Components.UV2, Components.UV3 };
+		for (int32 Channel = 0; Channel < NumUVs; Channel++)
 		{
-			RealtimeMesh::TRealtimeMeshStridedStreamBuilder<FVector2f, void> UV1Builder(Streams->GetStreamSet().FindChecked(RealtimeMesh::FRealtimeMeshStreams::TexCoords), 2);
-
-			const int32 NumToCopy = FMath::Min(Builder.NumVertices(), Components.UV2.Num());
-			for (int32 Index = 0; Index < NumToCopy; Index++)
-			{
-				UV1Builder.Set(Index, FVector2f(Components.UV2[Index]));
-			}
+			const int32 NumToCopy = FMath::Min(Components.Positions.Num(), UVChannels[Channel].Num());
+			WriteBulkElements<FVector2D>(TexCoordStream, BaseVertex, Channel, UVChannels[Channel].Left(NumToCopy));
 		}
-
-		if (Components.UV3.Num() > 0)
-		{
-			RealtimeMesh::TRealtimeMeshStridedStreamBuilder<FVector2f, void> UV2Builder(Streams->GetStreamSet().FindChecked(RealtimeMesh::FRealtimeMeshStreams::TexCoords), 3);
-
-			const int32 NumToCopy = FMath::Min(Builder.NumVertices(), Components.UV3.Num());
-			for (int32 Index = 0; Index < NumToCopy; Index++)
-			{
-				UV2Builder.Set(Index, FVector2f(Components.UV3[Index]));
-			}
-		}		
 	}
 
+	const int32 NumTriangles = Components.Triangles.Num() / 3;
+	const int32 BaseTriangle = Builder.NumTriangles();
+	WriteBulkElements<int32>(Streams->GetStreamSet().FindChecked(RealtimeMesh::FRealtimeMeshStreams::Triangles), BaseTriangle, 0,
+		TConstArrayView<int32>(Components.Triangles).Left(NumTriangles * 3), 3);
+
 	if (Components.PolyGroups.Num() > 0)
 	{
-		for (int32 Index = 0; Index < Components.Triangles.Num(); Index+=3)
-		{
-			Builder.AddTriangle(Components.Triangles[Index + 0], Components.Triangles[Index + 1], Components.Triangles[Index + 2], Components.PolyGroups.IsValidIndex(Index / 3) ? Components.PolyGroups[Index / 3] : 0);
-		}	
-	}
-	else
-	{		
-		for (int32 Index = 0; Index < Components.Triangles.Num(); Index+=3)
-		{
-			Builder.AddTriangle(Components.Triangles[Index + 0], Components.Triangles[Index + 1], Components.Triangles[Index + 2]);
-		}
+		Builder.EnablePolyGroups();
+		const int32 NumToCopy = FMath::Min(NumTriangles, Components.PolyGroups.Num());
+		WriteBulkElements<int32>(Streams->GetStreamSet().FindChecked(RealtimeMesh::FRealtimeMeshStreams::PolyGroups), BaseTriangle, 0,
+			TConstArrayView<int32>(Components.PolyGroups).Left(NumToCopy));
 	}
+
 	return Streams;
 }
 
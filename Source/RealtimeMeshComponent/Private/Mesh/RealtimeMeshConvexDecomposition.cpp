@@ -0,0 +1,607 @@
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Mesh/RealtimeMeshConvexDecomposition.h"
+#include "Async/ParallelFor.h"
+#include "CompGeom/ConvexHull3.h"
+
+namespace RealtimeMesh::ConvexDecomposition::Private
+{
+	using namespace UE::Geometry;
+
+	// Most split planes tried along each axis when splitting a part. Parts thicker than this try evenly spaced planes.
+	static constexpr int32 MaxSplitCandidatesPerAxis = 16;
+
+	enum class EVoxelState : uint8
+	{
+		Empty,
+		Surface,
+		Outside,
+	};
+
+	struct FVoxelGrid
+	{
+		FVector3d Origin;
+		double VoxelSize;
+		FIntVector Dims;
+		TArray<EVoxelState> States;
+
+		int32 ToIndex(int32 X, int32 Y, int32 Z) const { return (Z * Dims.Y + Y) * Dims.X + X; }
+		FVector3d GetCorner(int32 X, int32 Y, int32 Z) const { return Origin + FVector3d(X, Y, Z) * VoxelSize; }
+		double GetVoxelVolume() const { return VoxelSize * VoxelSize * VoxelSize; }
+	};
+
+	struct FHullMeasure
+	{
+		int32 NumVoxels = 0;
+		double Volume = 0.0;
+		double Area = 0.0;
+
+		/*
+		 * Space the hull covers beyond the voxels. A convex shape still leaves a staircase of roughly half a voxel between
+		 * its voxels and the hull of their corners, so that much is discounted to keep convex parts from being split.
+		 */
+		double GetError(const FVoxelGrid& Grid) const
+		{
+			return FMath::Max(0.0, Volume - NumVoxels * Grid.GetVoxelVolume() - 0.5 * Grid.VoxelSize * Area);
+		}
+	};
+
+	struct FPart
+	{
+		// Sorted by Z, then Y, then X, so every row along X is one contiguous run
+		TArray<FIntVector> Voxels;
+		FIntVector Min;
+		FIntVector Max;
+		FHullMeasure Measure;
+		bool bCanSplit = true;
+
+		void UpdateBounds()
+		{
+			Min = FIntVector(TNumericLimits<int32>::Max());
+			Max = FIntVector(TNumericLimits<int32>::Lowest());
+			for (const FIntVector& Voxel : Voxels)
+			{
+				Min = FIntVector(FMath::Min(Min.X, Voxel.X), FMath::Min(Min.Y, Voxel.Y), FMath::Min(Min.Z, Voxel.Z));
+				Max = FIntVector(FMath::Max(Max.X, Voxel.X), FMath::Max(Max.Y, Voxel.Y), FMath::Max(Max.Z, Voxel.Z));
+			}
+		}
+	};
+
+	static bool AxisSeparates(const FVector3d& Axis, const FVector3d& V0, const FVector3d& V1, const FVector3d& V2, const FVector3d& HalfExtent)
+	{
+		const double P0 = V0 | Axis;
+		const double P1 = V1 | Axis;
+		const double P2 = V2 | Axis;
+		const double Radius = HalfExtent.X * FMath::Abs(Axis.X) + HalfExtent.Y * FMath::Abs(Axis.Y) + HalfExtent.Z * FMath::Abs(Axis.Z);
+		return FMath::Min3(P0, P1, P2) > Radius || FMath::Max3(P0, P1, P2) < -Radius;
+	}
+
+	/* Separating axis test between a triangle and an axis aligned box (Akenine-Moller) */
+	static bool TriangleOverlapsBox(const FVector3d& Center, const FVector3d& HalfExtent, const FVector3d& A, const FVector3d& B, const FVector3d& C)
+	{
+		const FVector3d V0 = A - Center;
+		const FVector3d V1 = B - Center;
+		const FVector3d V2 = C - Center;
+		const FVector3d Edges[3] = { V1 - V0, V2 - V1, V0 - V2 };
+		const FVector3d BoxAxes[3] = { FVector3d::UnitX(), FVector3d::UnitY(), FVector3d::UnitZ() };
+
+		for (const FVector3d& BoxAxis : BoxAxes)
+		{
+			if (AxisSeparates(BoxAxis, V0, V1, V2, HalfExtent))
+			{
+				return false;
+			}
+			for (const FVector3d& Edge : Edges)
+			{
+				if (AxisSeparates(BoxAxis ^ Edge, V0, V1, V2, HalfExtent))
+				{
+					return false;
+				}
+			}
+		}
+
+		return !AxisSeparates(Edges[0] ^ Edges[1], V0, V1, V2, HalfExtent);
+	}
+
+	/*
+	 * Sizes the grid to the voxel budget. The mesh is inset by one and a half voxels so that even with the slack on the
+	 * surface test the outer layer stays empty, and the outside can be flood filled from a corner.
+	 */
+	static bool InitGrid(const FBox3d& Bounds, int32 VoxelBudget, FVoxelGrid& OutGrid)
+	{
+		const FVector3d Size = Bounds.GetSize();
+		const double MinExtent = FMath::Max(Size.GetMax() * 1e-3, UE_KINDA_SMALL_NUMBER);
+		const FVector3d ClampedSize = Size.ComponentMax(FVector3d(MinExtent));
+
+		auto GetDims = [&Size](double VoxelSize)
+		{
+			return FIntVector(
+				FMath::Max(1, FMath::CeilToInt(Size.X / VoxelSize)) + 3,
+				FMath::Max(1, FMath::CeilToInt(Size.Y / VoxelSize)) + 3,
+				FMath::Max(1, FMath::CeilToInt(Size.Z / VoxelSize)) + 3);
+		};
+
+		// Flat meshes don't fill the budget the way the volume estimate assumes, so grow the voxels until it fits
+		double VoxelSize = FMath::Pow(ClampedSize.X * ClampedSize.Y * ClampedSize.Z / VoxelBudget, 1.0 / 3.0);
+		FIntVector Dims = GetDims(VoxelSize);
+		while (static_cast<int64>(Dims.X) * Dims.Y * Dims.Z > VoxelBudget)
+		{
+			VoxelSize *= 1.05;
+			Dims = GetDims(VoxelSize);
+		}
+
+		OutGrid.VoxelSize = VoxelSize;
+		OutGrid.Dims = Dims;
+		OutGrid.Origin = Bounds.Min - FVector3d(VoxelSize * 1.5);
+		OutGrid.States.SetNumZeroed(Dims.X * Dims.Y * Dims.Z);
+		return true;
+	}
+
+	static void VoxelizeSurface(FVoxelGrid& Grid, TConstArrayView<FVector3d> Positions, TConstArrayView<TIndex3<int32>> Triangles)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshConvexDecomposition::VoxelizeSurface);
+
+		// A hair of slack so triangles lying exactly on a voxel boundary mark the voxels on both sides
+		constexpr double Slack = 1e-4;
+
+		auto ToVoxel = [&Grid](double Value, double Origin, int32 Dim)
+		{
+			return FMath::Clamp(FMath::FloorToInt((Value - Origin) / Grid.VoxelSize), 0, Dim - 1);
+		};
+
+		// Bucket the triangles by Z layer, so each layer can be filled on its own without any synchronization
+		TArray<FIntVector> TriangleMin;
+		TArray<FIntVector> TriangleMax;
+		TriangleMin.SetNumUninitialized(Triangles.Num());
+		TriangleMax.SetNumUninitialized(Triangles.Num());
+
+		TArray<TArray<int32>> LayerTriangles;
+		LayerTriangles.SetNum(Grid.Dims.Z);
+		for (int32 TriangleIndex = 0; TriangleIndex < Triangles.Num(); TriangleIndex++)
+		{
+			const TIndex3<int32>& Triangle = Triangles[TriangleIndex];
+			FBox3d Bounds(ForceInit);
+			Bounds += Positions[Triangle.V0];
+			Bounds += Positions[Triangle.V1];
+			Bounds += Positions[Triangle.V2];
+			Bounds = Bounds.ExpandBy(Grid.VoxelSize * Slack);
+
+			TriangleMin[TriangleIndex] = FIntVector(ToVoxel(Bounds.Min.X, Grid.Origin.X, Grid.Dims.X), ToVoxel(Bounds.Min.Y, Grid.Origin.Y, Grid.Dims.Y), ToVoxel(Bounds.Min.Z, Grid.Origin.Z, Grid.Dims.Z));
+			TriangleMax[TriangleIndex] = FIntVector(ToVoxel(Bounds.Max.X, Grid.Origin.X, Grid.Dims.X), ToVoxel(Bounds.Max.Y, Grid.Origin.Y, Grid.Dims.Y), ToVoxel(Bounds.Max.Z, Grid.Origin.Z, Grid.Dims.Z));
+			for (int32 Z = TriangleMin[TriangleIndex].Z; Z <= TriangleMax[TriangleIndex].Z; Z++)
+			{
+				LayerTriangles[Z].Add(TriangleIndex);
+			}
+		}
+
+		const FVector3d HalfExtent(Grid.VoxelSize * (0.5 + Slack));
+		ParallelFor(Grid.Dims.Z, [&](int32 Z)
+		{
+			for (const int32 TriangleIndex : LayerTriangles[Z])
+			{
+				const TIndex3<int32>& Triangle = Triangles[TriangleIndex];
+				for (int32 Y = TriangleMin[TriangleIndex].Y; Y <= TriangleMax[TriangleIndex].Y; Y++)
+				{
+					for (int32 X = TriangleMin[TriangleIndex].X; X <= TriangleMax[TriangleIndex].X; X++)
+					{
+						EVoxelState& State = Grid.States[Grid.ToIndex(X, Y, Z)];
+						if (State == EVoxelState::Empty &&
+							TriangleOverlapsBox(Grid.GetCorner(X, Y, Z) + FVector3d(Grid.VoxelSize * 0.5), HalfExtent, Positions[Triangle.V0], Positions[Triangle.V1], Positions[Triangle.V2]))
+						{
+							State = EVoxelState::Surface;
+						}
+					}
+				}
+			}
+		});
+	}
+
+	/* Marks every empty voxel reachable from the border as outside. Whatever empty space is left is enclosed by the mesh. */
+	static void FloodFillOutside(FVoxelGrid& Grid)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshConvexDecomposition::FloodFillOutside);
+
+		TArray<FIntVector> Stack;
+		Stack.Add(FIntVector::ZeroValue);
+		Grid.States[0] = EVoxelState::Outside;
+
+		const FIntVector Offsets[6] = { FIntVector(1, 0, 0), FIntVector(-1, 0, 0), FIntVector(0, 1, 0), FIntVector(0, -1, 0), FIntVector(0, 0, 1), FIntVector(0, 0, -1) };
+		while (Stack.Num() > 0)
+		{
+#if RMC_ENGINE_ABOVE_5_5
+			const FIntVector Voxel = Stack.Pop(EAllowShrinking::No);
+#else
+			const FIntVector Voxel = Stack.Pop(false);
+#endif
+			for (const FIntVector& Offset : Offsets)
+			{
+				const FIntVector Neighbor = Voxel + Offset;
+				if (Neighbor.X < 0 || Neighbor.Y < 0 || Neighbor.Z < 0 || Neighbor.X >= Grid.Dims.X || Neighbor.Y >= Grid.Dims.Y || Neighbor.Z >= Grid.Dims.Z)
+				{
+					continue;
+				}
+
+				EVoxelState& State = Grid.States[Grid.ToIndex(Neighbor.X, Neighbor.Y, Neighbor.Z)];
+				if (State == EVoxelState::Empty)
+				{
+					State = EVoxelState::Outside;
+					Stack.Add(Neighbor);
+				}
+			}
+		}
+	}
+
+	/*
+	 * Collects the corners of the first and last voxel of every row along X. Anything between them is inside their hull,
+	 * so that's all the hull needs. Voxels are expected in part order, so rows are contiguous.
+	 */
+	template<typename FilterFunc>
+	static int32 GatherRowCorners(const FVoxelGrid& Grid, TConstArrayView<FIntVector> Voxels, FilterFunc&& Filter, TArray<FVector3d>& OutPoints)
+	{
+		int32 NumVoxels = 0;
+		FIntVector RowStart(INDEX_NONE);
+		int32 RowEndX = INDEX_NONE;
+
+		auto EmitRow = [&]()
+		{
+			if (RowEndX == INDEX_NONE)
+			{
+				return;
+			}
+			for (const int32 X : { RowStart.X, RowEndX + 1 })
+			{
+				OutPoints.Add(Grid.GetCorner(X, RowStart.Y, RowStart.Z));
+				OutPoints.Add(Grid.GetCorner(X, RowStart.Y + 1, RowStart.Z));
+				OutPoints.Add(Grid.GetCorner(X, RowStart.Y, RowStart.Z + 1));
+				OutPoints.Add(Grid.GetCorner(X, RowStart.Y + 1, RowStart.Z + 1));
+			}
+		};
+
+		for (const FIntVector& Voxel : Voxels)
+		{
+			if (!Filter(Voxel))
+			{
+				continue;
+			}
+
+			NumVoxels++;
+			if (RowEndX != INDEX_NONE && Voxel.Y == RowStart.Y && Voxel.Z == RowStart.Z)
+			{
+				RowEndX = Voxel.X;
+				continue;
+			}
+
+			EmitRow();
+			RowStart = Voxel;
+			RowEndX = Voxel.X;
+		}
+		EmitRow();
+
+		return NumVoxels;
+	}
+
+	/* Solves the hull of the points, optionally returning its vertices */
+	static bool MeasureHull(TArrayView<const FVector3d> Points, FHullMeasure& OutMeasure, TArray<FVector3d>* OutVertices = nullptr)
+	{
+		OutMeasure.Volume = 0.0;
+		OutMeasure.Area = 0.0;
+
+		FConvexHull3d Hull;
+		if (Points.Num() < 4 || !Hull.Solve(Points) || Hull.GetDimension() < 3)
+		{
+			return false;
+		}
+
+		TSet<int32> HullVertices;
+		const FVector3d Reference = Points[0];
+		for (const FIndex3i& Triangle : Hull.GetTriangles())
+		{
+			const FVector3d A = Points[Triangle.A] - Reference;
+			const FVector3d B = Points[Triangle.B] - Reference;
+			const FVector3d C = Points[Triangle.C] - Reference;
+			OutMeasure.Volume += (A | (B ^ C)) / 6.0;
+			OutMeasure.Area += ((B - A) ^ (C - A)).Size() * 0.5;
+
+			if (OutVertices)
+			{
+				HullVertices.Add(Triangle.A);
+				HullVertices.Add(Triangle.B);
+				HullVertices.Add(Triangle.C);
+			}
+		}
+		OutMeasure.Volume = FMath::Abs(OutMeasure.Volume);
+
+		if (OutVertices)
+		{
+			OutVertices->Reset(HullVertices.Num());
+			for (const int32 VertexIndex : HullVertices)
+			{
+				OutVertices->Add(Points[VertexIndex]);
+			}
+		}
+		return true;
+	}
+
+	struct FSplitCandidate
+	{
+		int32 Axis = 0;
+		int32 Plane = 0;
+		FHullMeasure Below;
+		FHullMeasure Above;
+		double Cost = TNumericLimits<double>::Max();
+	};
+
+	/* Splits the part along the axis aligned plane that leaves the least space between the halves and their hulls */
+	static bool SplitPart(const FVoxelGrid& Grid, const FPart& Part, FPart& OutBelow, FPart& OutAbove)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshConvexDecomposition::SplitPart);
+
+		// Voxels with a coordinate below the plane go to the lower half
+		TArray<FSplitCandidate> Candidates;
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			const int32 NumPlanes = Part.Max[Axis] - Part.Min[Axis];
+			const int32 NumCandidates = FMath::Min(NumPlanes, MaxSplitCandidatesPerAxis);
+			for (int32 Index = 0; Index < NumCandidates; Index++)
+			{
+				const int32 Plane = Part.Min[Axis] + 1 + (NumCandidates > 1 ? FMath::RoundToInt(static_cast<double>(Index) * (NumPlanes - 1) / (NumCandidates - 1)) : NumPlanes / 2);
+				if (Candidates.Num() == 0 || Candidates.Last().Axis != Axis || Candidates.Last().Plane != Plane)
+				{
+					FSplitCandidate& Candidate = Candidates.AddDefaulted_GetRef();
+					Candidate.Axis = Axis;
+					Candidate.Plane = Plane;
+				}
+			}
+		}
+
+		ParallelFor(Candidates.Num(), [&](int32 CandidateIndex)
+		{
+			FSplitCandidate& Candidate = Candidates[CandidateIndex];
+			TArray<FVector3d> Points;
+
+			Candidate.Below.NumVoxels = GatherRowCorners(Grid, Part.Voxels, [&Candidate](const FIntVector& Voxel) { return Voxel[Candidate.Axis] < Candidate.Plane; }, Points);
+			const bool bBelowValid = Candidate.Below.NumVoxels > 0 && MeasureHull(Points, Candidate.Below);
+
+			Points.Reset();
+			Candidate.Above.NumVoxels = GatherRowCorners(Grid, Part.Voxels, [&Candidate](const FIntVector& Voxel) { return Voxel[Candidate.Axis] >= Candidate.Plane; }, Points);
+			const bool bAboveValid = Candidate.Above.NumVoxels > 0 && MeasureHull(Points, Candidate.Above);
+
+			if (bBelowValid && bAboveValid)
+			{
+				Candidate.Cost = Candidate.Below.GetError(Grid) + Candidate.Above.GetError(Grid);
+			}
+		});
+
+		// Lowest cost wins, ties go to the earliest candidate so the result doesn't depend on scheduling
+		const FSplitCandidate* Best = nullptr;
+		for (const FSplitCandidate& Candidate : Candidates)
+		{
+			if (Candidate.Cost < TNumericLimits<double>::Max() && (!Best || Candidate.Cost < Best->Cost))
+			{
+				Best = &Candidate;
+			}
+		}
+		if (!Best)
+		{
+			return false;
+		}
+
+		OutBelow.Voxels.Reset(Best->Below.NumVoxels);
+		OutAbove.Voxels.Reset(Best->Above.NumVoxels);
+		for (const FIntVector& Voxel : Part.Voxels)
+		{
+			(Voxel[Best->Axis] < Best->Plane ? OutBelow : OutAbove).Voxels.Add(Voxel);
+		}
+		OutBelow.Measure = Best->Below;
+		OutAbove.Measure = Best->Above;
+		OutBelow.UpdateBounds();
+		OutAbove.UpdateBounds();
+		return true;
+	}
+
+	/* Farthest point sampling down to MaxVertices, which keeps the vertices spread over the whole hull */
+	static void ReduceHullVertices(TArray<FVector3d>& Vertices, int32 MaxVertices)
+	{
+		if (Vertices.Num() <= MaxVertices)
+		{
+			return;
+		}
+
+		FVector3d Centroid = FVector3d::ZeroVector;
+		for (const FVector3d& Vertex : Vertices)
+		{
+			Centroid += Vertex;
+		}
+		Centroid /= Vertices.Num();
+
+		TArray<double> DistanceSquared;
+		DistanceSquared.Init(TNumericLimits<double>::Max(), Vertices.Num());
+
+		int32 Next = 0;
+		for (int32 Index = 1; Index < Vertices.Num(); Index++)
+		{
+			if (FVector3d::DistSquared(Vertices[Index], Centroid) > FVector3d::DistSquared(Vertices[Next], Centroid))
+			{
+				Next = Index;
+			}
+		}
+
+		TArray<FVector3d> Selected;
+		Selected.Reserve(MaxVertices);
+		while (Selected.Num() < MaxVertices)
+		{
+			const FVector3d Chosen = Vertices[Next];
+			Selected.Add(Chosen);
+
+			Next = INDEX_NONE;
+			for (int32 Index = 0; Index < Vertices.Num(); Index++)
+			{
+				DistanceSquared[Index] = FMath::Min(DistanceSquared[Index], FVector3d::DistSquared(Vertices[Index], Chosen));
+				if (Next == INDEX_NONE || DistanceSquared[Index] > DistanceSquared[Next])
+				{
+					Next = Index;
+				}
+			}
+		}
+
+		Vertices = MoveTemp(Selected);
+	}
+}
+
+namespace RealtimeMesh
+{
+	FName FRealtimeMeshConvexDecomposition::GetHullBaseName()
+	{
+		static const FName BaseName(TEXT("ConvexDecomposition"));
+		return BaseName;
+	}
+
+	bool FRealtimeMeshConvexDecomposition::IsGeneratedHull(const FRealtimeMeshCollisionConvex& Hull)
+	{
+		return Hull.IsGenerated();
+	}
+
+	TArray<FRealtimeMeshCollisionConvex> FRealtimeMeshConvexDecomposition::Compute(TConstArrayView<FVector3f> Positions, TConstArrayView<TIndex3<int32>> Triangles,
+		const FRealtimeMeshConvexDecompositionSettings& Settings)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshConvexDecomposition::Compute);
+		using namespace ConvexDecomposition::Private;
+
+		const int32 MaxHulls = FMath::Clamp(Settings.MaxHulls, 1, 256);
+		const int32 MaxVerticesPerHull = FMath::Clamp(Settings.MaxVerticesPerHull, 4, 255);
+		const int32 VoxelBudget = FMath::Clamp(Settings.VoxelResolution, 1000, 10000000);
+
+		// Work in double precision from here, the hull solver wants it anyway
+		TArray<FVector3d> Vertices;
+		Vertices.SetNumUninitialized(Positions.Num());
+		for (int32 Index = 0; Index < Positions.Num(); Index++)
+		{
+			Vertices[Index] = FVector3d(Positions[Index]);
+		}
+
+		TArray<TIndex3<int32>> ValidTriangles;
+		ValidTriangles.Reserve(Triangles.Num());
+		FBox3d Bounds(ForceInit);
+		for (const TIndex3<int32>& Triangle : Triangles)
+		{
+			if (Vertices.IsValidIndex(Triangle.V0) && Vertices.IsValidIndex(Triangle.V1) && Vertices.IsValidIndex(Triangle.V2))
+			{
+				ValidTriangles.Add(Triangle);
+				Bounds += Vertices[Triangle.V0];
+				Bounds += Vertices[Triangle.V1];
+				Bounds += Vertices[Triangle.V2];
+			}
+		}
+		if (ValidTriangles.Num() == 0)
+		{
+			return TArray<FRealtimeMeshCollisionConvex>();
+		}
+
+		FVoxelGrid Grid;
+		InitGrid(Bounds, VoxelBudget, Grid);
+		VoxelizeSurface(Grid, Vertices, ValidTriangles);
+		FloodFillOutside(Grid);
+
+		// Surface voxels plus whatever the mesh encloses. Walking the grid in order leaves the voxels sorted by row.
+		TArray<FPart> Parts;
+		FPart& Root = Parts.AddDefaulted_GetRef();
+		for (int32 Z = 0; Z < Grid.Dims.Z; Z++)
+		{
+			for (int32 Y = 0; Y < Grid.Dims.Y; Y++)
+			{
+				for (int32 X = 0; X < Grid.Dims.X; X++)
+				{
+					if (Grid.States[Grid.ToIndex(X, Y, Z)] != EVoxelState::Outside)
+					{
+						Root.Voxels.Add(FIntVector(X, Y, Z));
+					}
+				}
+			}
+		}
+		Root.UpdateBounds();
+
+		TArray<FVector3d> Points;
+		Root.Measure.NumVoxels = GatherRowCorners(Grid, Root.Voxels, [](const FIntVector&) { return true; }, Points);
+		MeasureHull(Points, Root.Measure);
+		const double TotalVolume = FMath::Max(Root.Measure.Volume, UE_DOUBLE_SMALL_NUMBER);
+
+		// Keep splitting whichever part strays furthest from the mesh until it's close enough or we're out of hulls
+		while (Parts.Num() < MaxHulls)
+		{
+			int32 WorstPart = INDEX_NONE;
+			double WorstError = 0.0;
+			for (int32 PartIndex = 0; PartIndex < Parts.Num(); PartIndex++)
+			{
+				const double Error = Parts[PartIndex].Measure.GetError(Grid);
+				if (Parts[PartIndex].bCanSplit && Error > WorstError)
+				{
+					WorstPart = PartIndex;
+					WorstError = Error;
+				}
+			}
+
+			if (WorstPart == INDEX_NONE || WorstError / TotalVolume <= Settings.MaxConcavity)
+			{
+				break;
+			}
+
+			FPart Below;
+			FPart Above;
+			if (!SplitPart(Grid, Parts[WorstPart], Below, Above))
+			{
+				Parts[WorstPart].bCanSplit = false;
+				continue;
+			}
+
+			Parts[WorstPart] = MoveTemp(Below);
+			Parts.Add(MoveTemp(Above));
+		}
+
+		TArray<FRealtimeMeshCollisionConvex> Hulls;
+		Hulls.SetNum(Parts.Num());
+		ParallelFor(Parts.Num(), [&](int32 PartIndex)
+		{
+			TArray<FVector3d> PartPoints;
+			GatherRowCorners(Grid, Parts[PartIndex].Voxels, [](const FIntVector&) { return true; }, PartPoints);
+
+			TArray<FVector3d> HullVertices;
+			FHullMeasure Measure;
+			if (MeasureHull(PartPoints, Measure, &HullVertices))
+			{
+				ReduceHullVertices(HullVertices, MaxVerticesPerHull);
+				Hulls[PartIndex].SetVertices(MoveTemp(HullVertices));
+			}
+		});
+
+		// Parts can only come out degenerate if the solver gave up on them, drop those
+		Hulls.RemoveAll([](const FRealtimeMeshCollisionConvex& Hull) { return Hull.GetVertices().Num() == 0; });
+		for (int32 HullIndex = 0; HullIndex < Hulls.Num(); HullIndex++)
+		{
+			Hulls[HullIndex].Name = FName(GetHullBaseName(), HullIndex + 1);
+			Hulls[HullIndex].SetGenerated(true);
+		}
+		return Hulls;
+	}
+
+	void FRealtimeMeshConvexDecomposition::ReplaceGeneratedHulls(FRealtimeMeshSimpleGeometry& SimpleGeometry, TArray<FRealtimeMeshCollisionConvex>&& Hulls)
+	{
+		TArray<int32> GeneratedIndices;
+		for (auto It = SimpleGeometry.ConvexHulls.CreateConstIterator(); It; ++It)
+		{
+			if (IsGeneratedHull(*It))
+			{
+				GeneratedIndices.Add(It.GetIndex());
+			}
+		}
+		for (const int32 Index : GeneratedIndices)
+		{
+			SimpleGeometry.ConvexHulls.Remove(Index);
+		}
+
+		for (FRealtimeMeshCollisionConvex& Hull : Hulls)
+		{
+			Hull.SetGenerated(true);
+			SimpleGeometry.ConvexHulls.Add(MoveTemp(Hull));
+		}
+	}
+}
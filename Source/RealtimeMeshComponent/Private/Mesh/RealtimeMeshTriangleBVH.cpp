@@ -0,0 +1,731 @@
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+
+#include "Mesh/RealtimeMeshTriangleBVH.h"
+
+
+namespace RealtimeMesh::TriangleBVH::Private
+{
+	static constexpr int32 NumBins = 16;
+
+	struct FTraversalEntry
+	{
+		int32 NodeIndex;
+		float Distance;
+	};
+	using FTraversalStack = TArray<FTraversalEntry, TInlineAllocator<64>>;
+
+	static FTraversalEntry PopEntry(FTraversalStack& Stack)
+	{
+#if RMC_ENGINE_ABOVE_5_5
+		return Stack.Pop(EAllowShrinking::No);
+#else
+		return Stack.Pop(false);
+#endif
+	}
+
+	static float SurfaceArea(const FBox3f& Box)
+	{
+		if (!Box.IsValid)
+		{
+			return 0.0f;
+		}
+		const FVector3f Size = Box.GetSize();
+		return 2.0f * (Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X);
+	}
+
+	static float SafeDivide(float Numerator, float Denominator)
+	{
+		return FMath::Abs(Denominator) > UE_SMALL_NUMBER ? Numerator / Denominator : 0.0f;
+	}
+
+	/* Reciprocal of the ray direction, with zero components clamped to a large finite value so the slab test never sees NaN */
+	static FVector3f SafeInverseDirection(const FVector3f& Direction)
+	{
+		auto Invert = [](float Value)
+		{
+			return FMath::Abs(Value) > UE_SMALL_NUMBER ? 1.0f / Value : (Value < 0.0f ? -UE_BIG_NUMBER : UE_BIG_NUMBER);
+		};
+		return FVector3f(Invert(Direction.X), Invert(Direction.Y), Invert(Direction.Z));
+	}
+
+	/*
+	 * Returns the ray parameter the box, grown by Expansion on every side, is entered at.
+	 * Negative if the ray misses it within MaxDistance.
+	 */
+	static float IntersectRayBox(const FRealtimeMeshTriangleBVH::FNode& Node, const FVector3f& Origin, const FVector3f& InvDirection, float MaxDistance, float Expansion = 0.0f)
+	{
+		const FVector3f T0 = (Node.BoundsMin - FVector3f(Expansion) - Origin) * InvDirection;
+		const FVector3f T1 = (Node.BoundsMax + FVector3f(Expansion) - Origin) * InvDirection;
+		const float TEnter = FMath::Max3(FMath::Min(T0.X, T1.X), FMath::Min(T0.Y, T1.Y), FMath::Min(T0.Z, T1.Z));
+		const float TExit = FMath::Min3(FMath::Max(T0.X, T1.X), FMath::Max(T0.Y, T1.Y), FMath::Max(T0.Z, T1.Z));
+		const float TStart = FMath::Max(TEnter, 0.0f);
+		return (TExit >= TStart && TStart <= MaxDistance) ? TStart : -1.0f;
+	}
+
+	static float PointBoxDistanceSquared(const FRealtimeMeshTriangleBVH::FNode& Node, const FVector3f& Point)
+	{
+		const FVector3f Below = Node.BoundsMin - Point;
+		const FVector3f Above = Point - Node.BoundsMax;
+		const FVector3f Outside(FMath::Max3(Below.X, Above.X, 0.0f), FMath::Max3(Below.Y, Above.Y, 0.0f), FMath::Max3(Below.Z, Above.Z, 0.0f));
+		return Outside.SizeSquared();
+	}
+
+	/* Double sided Moller-Trumbore, returns the ray parameter of the hit or a negative number on a miss */
+	static float IntersectRayTriangle(const FVector3f& Origin, const FVector3f& Direction, const FVector3f& A, const FVector3f& B, const FVector3f& C, float& OutU, float& OutV)
+	{
+		const FVector3f Edge1 = B - A;
+		const FVector3f Edge2 = C - A;
+		const FVector3f P = Direction ^ Edge2;
+		const float Determinant = Edge1 | P;
+		if (FMath::Abs(Determinant) <= UE_SMALL_NUMBER)
+		{
+			return -1.0f;
+		}
+
+		const float InvDeterminant = 1.0f / Determinant;
+		const FVector3f ToOrigin = Origin - A;
+		OutU = (ToOrigin | P) * InvDeterminant;
+		if (OutU < 0.0f || OutU > 1.0f)
+		{
+			return -1.0f;
+		}
+
+		const FVector3f Q = ToOrigin ^ Edge1;
+		OutV = (Direction | Q) * InvDeterminant;
+		if (OutV < 0.0f || OutU + OutV > 1.0f)
+		{
+			return -1.0f;
+		}
+
+		return (Edge2 | Q) * InvDeterminant;
+	}
+
+	/* Closest point on triangle ABC to Point, by Voronoi region (Ericson, Real-Time Collision Detection 5.1.5) */
+	static FVector3f ClosestPointOnTriangle(const FVector3f& Point, const FVector3f& A, const FVector3f& B, const FVector3f& C, FVector3f& OutBarycentrics)
+	{
+		const FVector3f AB = B - A;
+		const FVector3f AC = C - A;
+		const FVector3f AP = Point - A;
+		const float D1 = AB | AP;
+		const float D2 = AC | AP;
+		if (D1 <= 0.0f && D2 <= 0.0f)
+		{
+			OutBarycentrics = FVector3f(1.0f, 0.0f, 0.0f);
+			return A;
+		}
+
+		const FVector3f BP = Point - B;
+		const float D3 = AB | BP;
+		const float D4 = AC | BP;
+		if (D3 >= 0.0f && D4 <= D3)
+		{
+			OutBarycentrics = FVector3f(0.0f, 1.0f, 0.0f);
+			return B;
+		}
+
+		const float VC = D1 * D4 - D3 * D2;
+		if (VC <= 0.0f && D1 >= 0.0f && D3 <= 0.0f)
+		{
+			const float V = SafeDivide(D1, D1 - D3);
+			OutBarycentrics = FVector3f(1.0f - V, V, 0.0f);
+			return A + AB * V;
+		}
+
+		const FVector3f CP = Point - C;
+		const float D5 = AB | CP;
+		const float D6 = AC | CP;
+		if (D6 >= 0.0f && D5 <= D6)
+		{
+			OutBarycentrics = FVector3f(0.0f, 0.0f, 1.0f);
+			return C;
+		}
+
+		const float VB = D5 * D2 - D1 * D6;
+		if (VB <= 0.0f && D2 >= 0.0f && D6 <= 0.0f)
+		{
+			const float W = SafeDivide(D2, D2 - D6);
+			OutBarycentrics = FVector3f(1.0f - W, 0.0f, W);
+			return A + AC * W;
+		}
+
+		const float VA = D3 * D6 - D5 * D4;
+		if (VA <= 0.0f && (D4 - D3) >= 0.0f && (D5 - D6) >= 0.0f)
+		{
+			const float W = SafeDivide(D4 - D3, (D4 - D3) + (D5 - D6));
+			OutBarycentrics = FVector3f(0.0f, 1.0f - W, W);
+			return B + (C - B) * W;
+		}
+
+		const float Denominator = VA + VB + VC;
+		const float V = SafeDivide(VB, Denominator);
+		const float W = SafeDivide(VC, Denominator);
+		OutBarycentrics = FVector3f(1.0f - V - W, V, W);
+		return A + AB * V + AC * W;
+	}
+
+	static FVector3f FaceNormal(const FVector3f& A, const FVector3f& B, const FVector3f& C)
+	{
+		return ((B - A) ^ (C - A)).GetSafeNormal();
+	}
+
+	/* First time a sphere moving along the ray touches the vertex, negative if never */
+	static float SweepSphereVertex(const FVector3f& Origin, const FVector3f& Direction, float RadiusSquared, const FVector3f& Vertex)
+	{
+		const FVector3f ToOrigin = Origin - Vertex;
+		const float B = ToOrigin | Direction;
+		const float C = ToOrigin.SizeSquared() - RadiusSquared;
+		const float Discriminant = B * B - C;
+		if (Discriminant < 0.0f)
+		{
+			return -1.0f;
+		}
+		return -B - FMath::Sqrt(Discriminant);
+	}
+
+	/* First time a sphere moving along the ray touches the side of the edge, negative if never. The ends are left to SweepSphereVertex. */
+	static float SweepSphereEdge(const FVector3f& Origin, const FVector3f& Direction, float RadiusSquared, const FVector3f& P, const FVector3f& Q)
+	{
+		const FVector3f Edge = Q - P;
+		const FVector3f ToOrigin = Origin - P;
+		const float EdgeLengthSquared = Edge | Edge;
+		const float OriginAlongEdge = ToOrigin | Edge;
+		const float DirectionAlongEdge = Direction | Edge;
+
+		// Quadratic for the distance from the moving center to the edge's line reaching the radius
+		const float A = EdgeLengthSquared - DirectionAlongEdge * DirectionAlongEdge;
+		if (A <= UE_SMALL_NUMBER * EdgeLengthSquared)
+		{
+			return -1.0f;
+		}
+		const float B = EdgeLengthSquared * (ToOrigin | Direction) - DirectionAlongEdge * OriginAlongEdge;
+		const float C = EdgeLengthSquared * (ToOrigin.SizeSquared() - RadiusSquared) - OriginAlongEdge * OriginAlongEdge;
+		const float Discriminant = B * B - A * C;
+		if (Discriminant < 0.0f)
+		{
+			return -1.0f;
+		}
+
+		const float Time = (-B - FMath::Sqrt(Discriminant)) / A;
+		const float ContactAlongEdge = OriginAlongEdge + Time * DirectionAlongEdge;
+		return (ContactAlongEdge >= 0.0f && ContactAlongEdge <= EdgeLengthSquared) ? Time : -1.0f;
+	}
+
+	/* First time a sphere moving along the ray touches the triangle within MaxDistance, negative if it doesn't */
+	static float SweepSphereTriangle(const FVector3f& Origin, const FVector3f& Direction, float Radius, float MaxDistance, const FVector3f& A, const FVector3f& B, const FVector3f& C)
+	{
+		const float RadiusSquared = Radius * Radius;
+
+		FVector3f Barycentrics;
+		if (FVector3f::DistSquared(Origin, ClosestPointOnTriangle(Origin, A, B, C, Barycentrics)) <= RadiusSquared)
+		{
+			return 0.0f;
+		}
+
+		float BestTime = -1.0f;
+		auto Consider = [&](float Time)
+		{
+			if (Time >= 0.0f && Time <= MaxDistance && (BestTime < 0.0f || Time < BestTime))
+			{
+				BestTime = Time;
+			}
+		};
+
+		// The face itself, when the contact point lands inside the triangle
+		const FVector3f Normal = (B - A) ^ (C - A);
+		const float NormalLength = Normal.Size();
+		if (NormalLength > UE_SMALL_NUMBER)
+		{
+			const FVector3f UnitNormal = Normal / NormalLength;
+			const float Distance = (Origin - A) | UnitNormal;
+			const float Approach = Direction | UnitNormal;
+			if (FMath::Abs(Approach) > UE_SMALL_NUMBER)
+			{
+				const float Side = Distance >= 0.0f ? 1.0f : -1.0f;
+				const float Time = (Side * Radius - Distance) / Approach;
+				const FVector3f Contact = Origin + Direction * Time - UnitNormal * (Side * Radius);
+				if ((((B - A) ^ (Contact - A)) | Normal) >= 0.0f && (((C - B) ^ (Contact - B)) | Normal) >= 0.0f && (((A - C) ^ (Contact - C)) | Normal) >= 0.0f)
+				{
+					Consider(Time);
+				}
+			}
+		}
+
+		Consider(SweepSphereEdge(Origin, Direction, RadiusSquared, A, B));
+		Consider(SweepSphereEdge(Origin, Direction, RadiusSquared, B, C));
+		Consider(SweepSphereEdge(Origin, Direction, RadiusSquared, C, A));
+		Consider(SweepSphereVertex(Origin, Direction, RadiusSquared, A));
+		Consider(SweepSphereVertex(Origin, Direction, RadiusSquared, B));
+		Consider(SweepSphereVertex(Origin, Direction, RadiusSquared, C));
+
+		return BestTime;
+	}
+}
+
+namespace RealtimeMesh
+{
+	void FRealtimeMeshTriangleBVH::Build(TArray<FVector3f>&& InPositions, TConstArrayView<TIndex3<int32>> InTriangles)
+	{
+		Reset();
+		Positions = MoveTemp(InPositions);
+
+		TArray<FBox3f> TriangleBounds;
+		TArray<FVector3f> Centroids;
+		TriangleBounds.Reserve(InTriangles.Num());
+		Centroids.Reserve(InTriangles.Num());
+		TriangleIndices.Reserve(InTriangles.Num());
+
+		const int32 NumPositions = Positions.Num();
+		for (int32 TriangleIndex = 0; TriangleIndex < InTriangles.Num(); TriangleIndex++)
+		{
+			const TIndex3<int32>& Triangle = InTriangles[TriangleIndex];
+			if (!FMath::IsWithin(Triangle.V0, 0, NumPositions) || !FMath::IsWithin(Triangle.V1, 0, NumPositions) || !FMath::IsWithin(Triangle.V2, 0, NumPositions))
+			{
+				continue;
+			}
+
+			FBox3f Bounds(ForceInit);
+			Bounds += Positions[Triangle.V0];
+			Bounds += Positions[Triangle.V1];
+			Bounds += Positions[Triangle.V2];
+			TriangleBounds.Add(Bounds);
+			Centroids.Add(Bounds.GetCenter());
+			TriangleIndices.Add(TriangleIndex);
+		}
+
+		if (TriangleIndices.Num() == 0)
+		{
+			Reset();
+			return;
+		}
+
+		Nodes.Reserve(FMath::Max(1, 2 * TriangleIndices.Num() / MaxLeafTriangles));
+		BuildRecursive(TriangleBounds, Centroids, 0, TriangleIndices.Num());
+		Nodes.Shrink();
+
+		Triangles.SetNumUninitialized(TriangleIndices.Num());
+		for (int32 Index = 0; Index < TriangleIndices.Num(); Index++)
+		{
+			Triangles[Index] = InTriangles[TriangleIndices[Index]];
+		}
+	}
+
+	int32 FRealtimeMeshTriangleBVH::BuildRecursive(TArray<FBox3f>& TriangleBounds, TArray<FVector3f>& Centroids, int32 First, int32 Count)
+	{
+		using namespace TriangleBVH::Private;
+
+		FBox3f NodeBounds(ForceInit);
+		FBox3f CentroidBounds(ForceInit);
+		for (int32 Index = First; Index < First + Count; Index++)
+		{
+			NodeBounds += TriangleBounds[Index];
+			CentroidBounds += Centroids[Index];
+		}
+
+		const int32 NodeIndex = Nodes.AddUninitialized();
+		Nodes[NodeIndex].BoundsMin = NodeBounds.Min;
+		Nodes[NodeIndex].BoundsMax = NodeBounds.Max;
+		Nodes[NodeIndex].FirstOrChild = First;
+		Nodes[NodeIndex].NumTriangles = Count;
+
+		if (Count <= MaxLeafTriangles)
+		{
+			return NodeIndex;
+		}
+
+		const FVector3f CentroidExtent = CentroidBounds.GetSize();
+		const int32 Axis = CentroidExtent.X >= CentroidExtent.Y && CentroidExtent.X >= CentroidExtent.Z ? 0 : (CentroidExtent.Y >= CentroidExtent.Z ? 1 : 2);
+		const float AxisMin = CentroidBounds.Min[Axis];
+		const float AxisExtent = CentroidExtent[Axis];
+
+		int32 Mid = First + Count / 2;
+		if (AxisExtent > UE_SMALL_NUMBER)
+		{
+			// Bin the centroids along the widest axis and pick the boundary with the lowest surface area cost
+			int32 BinCounts[NumBins] = { };
+			FBox3f BinBounds[NumBins];
+			for (FBox3f& Bin : BinBounds)
+			{
+				Bin.Init();
+			}
+
+			const float BinScale = NumBins / AxisExtent;
+			auto GetBin = [&](int32 Index)
+			{
+				return FMath::Clamp(static_cast<int32>((Centroids[Index][Axis] - AxisMin) * BinScale), 0, NumBins - 1);
+			};
+
+			for (int32 Index = First; Index < First + Count; Index++)
+			{
+				const int32 Bin = GetBin(Index);
+				BinCounts[Bin]++;
+				BinBounds[Bin] += TriangleBounds[Index];
+			}
+
+			float RightAreas[NumBins];
+			int32 RightCounts[NumBins];
+			{
+				FBox3f Accumulated(ForceInit);
+				int32 AccumulatedCount = 0;
+				for (int32 Bin = NumBins - 1; Bin > 0; Bin--)
+				{
+					Accumulated += BinBounds[Bin];
+					AccumulatedCount += BinCounts[Bin];
+					RightAreas[Bin] = SurfaceArea(Accumulated);
+					RightCounts[Bin] = AccumulatedCount;
+				}
+			}
+
+			int32 BestSplit = INDEX_NONE;
+			float BestCost = TNumericLimits<float>::Max();
+			{
+				FBox3f Accumulated(ForceInit);
+				int32 AccumulatedCount = 0;
+				for (int32 Bin = 0; Bin < NumBins - 1; Bin++)
+				{
+					Accumulated += BinBounds[Bin];
+					AccumulatedCount += BinCounts[Bin];
+					if (AccumulatedCount == 0 || RightCounts[Bin + 1] == 0)
+					{
+						continue;
+					}
+
+					const float Cost = SurfaceArea(Accumulated) * AccumulatedCount + RightAreas[Bin + 1] * RightCounts[Bin + 1];
+					if (Cost < BestCost)
+					{
+						BestCost = Cost;
+						BestSplit = Bin;
+					}
+				}
+			}
+
+			if (BestSplit != INDEX_NONE)
+			{
+				// Partition the range in place, keeping the side tables in step with the triangle indices
+				int32 Left = First;
+				int32 Right = First + Count - 1;
+				while (Left <= Right)
+				{
+					if (GetBin(Left) <= BestSplit)
+					{
+						Left++;
+					}
+					else
+					{
+						Swap(TriangleIndices[Left], TriangleIndices[Right]);
+						Swap(TriangleBounds[Left], TriangleBounds[Right]);
+						Swap(Centroids[Left], Centroids[Right]);
+						Right--;
+					}
+				}
+				Mid = Left;
+			}
+		}
+
+		// All centroids landed in one place, an even split by index still bounds the depth
+		if (Mid <= First || Mid >= First + Count)
+		{
+			Mid = First + Count / 2;
+		}
+
+		Nodes[NodeIndex].NumTriangles = 0;
+		BuildRecursive(TriangleBounds, Centroids, First, Mid - First);
+		const int32 SecondChild = BuildRecursive(TriangleBounds, Centroids, Mid, First + Count - Mid);
+		Nodes[NodeIndex].FirstOrChild = SecondChild;
+
+		return NodeIndex;
+	}
+
+	void FRealtimeMeshTriangleBVH::Reset()
+	{
+		Nodes.Empty();
+		Positions.Empty();
+		Triangles.Empty();
+		TriangleIndices.Empty();
+	}
+
+	FBox3f FRealtimeMeshTriangleBVH::GetBounds() const
+	{
+		return Nodes.Num() > 0 ? FBox3f(Nodes[0].BoundsMin, Nodes[0].BoundsMax) : FBox3f(ForceInit);
+	}
+
+	bool FRealtimeMeshTriangleBVH::Raycast(const FVector3f& Origin, const FVector3f& Direction, float MaxDistance, FRealtimeMeshTriangleHit& OutHit) const
+	{
+		using namespace TriangleBVH::Private;
+
+		if (Nodes.Num() == 0)
+		{
+			return false;
+		}
+
+		const FVector3f InvDirection = SafeInverseDirection(Direction);
+		float ClosestDistance = MaxDistance;
+		int32 ClosestTriangle = INDEX_NONE;
+		float ClosestU = 0.0f;
+		float ClosestV = 0.0f;
+
+		FTraversalStack Stack;
+		const float RootDistance = IntersectRayBox(Nodes[0], Origin, InvDirection, ClosestDistance);
+		if (RootDistance >= 0.0f)
+		{
+			Stack.Add({ 0, RootDistance });
+		}
+
+		while (Stack.Num() > 0)
+		{
+			const FTraversalEntry Entry = PopEntry(Stack);
+			if (Entry.Distance > ClosestDistance)
+			{
+				continue;
+			}
+
+			const FNode& Node = Nodes[Entry.NodeIndex];
+			if (Node.IsLeaf())
+			{
+				for (int32 Index = Node.FirstOrChild; Index < Node.FirstOrChild + Node.NumTriangles; Index++)
+				{
+					const TIndex3<int32>& Triangle = Triangles[Index];
+					float U, V;
+					const float Distance = IntersectRayTriangle(Origin, Direction, Positions[Triangle.V0], Positions[Triangle.V1], Positions[Triangle.V2], U, V);
+					if (Distance >= 0.0f && Distance <= ClosestDistance)
+					{
+						ClosestDistance = Distance;
+						ClosestTriangle = Index;
+						ClosestU = U;
+						ClosestV = V;
+					}
+				}
+				continue;
+			}
+
+			// Visit the nearer child first so the far one is usually culled by the hit it finds
+			const int32 FirstChild = Entry.NodeIndex + 1;
+			const int32 SecondChild = Node.FirstOrChild;
+			const float FirstDistance = IntersectRayBox(Nodes[FirstChild], Origin, InvDirection, ClosestDistance);
+			const float SecondDistance = IntersectRayBox(Nodes[SecondChild], Origin, InvDirection, ClosestDistance);
+			const bool bFirstIsNear = FirstDistance <= SecondDistance || SecondDistance < 0.0f;
+			const FTraversalEntry Near = bFirstIsNear ? FTraversalEntry{ FirstChild, FirstDistance } : FTraversalEntry{ SecondChild, SecondDistance };
+			const FTraversalEntry Far = bFirstIsNear ? FTraversalEntry{ SecondChild, SecondDistance } : FTraversalEntry{ FirstChild, FirstDistance };
+			if (Far.Distance >= 0.0f)
+			{
+				Stack.Add(Far);
+			}
+			if (Near.Distance >= 0.0f)
+			{
+				Stack.Add(Near);
+			}
+		}
+
+		if (ClosestTriangle == INDEX_NONE)
+		{
+			return false;
+		}
+
+		const TIndex3<int32>& Triangle = Triangles[ClosestTriangle];
+		OutHit.TriangleIndex = TriangleIndices[ClosestTriangle];
+		OutHit.Vertices = Triangle;
+		OutHit.Distance = ClosestDistance;
+		OutHit.Location = Origin + Direction * ClosestDistance;
+		OutHit.Normal = FaceNormal(Positions[Triangle.V0], Positions[Triangle.V1], Positions[Triangle.V2]);
+		OutHit.Barycentrics = FVector3f(1.0f - ClosestU - ClosestV, ClosestU, ClosestV);
+		return true;
+	}
+
+	bool FRealtimeMeshTriangleBVH::FindClosestPoint(const FVector3f& Point, float MaxDistance, FRealtimeMeshTriangleHit& OutHit) const
+	{
+		using namespace TriangleBVH::Private;
+
+		if (Nodes.Num() == 0)
+		{
+			return false;
+		}
+
+		float ClosestDistanceSquared = FMath::Square(MaxDistance);
+		int32 ClosestTriangle = INDEX_NONE;
+		FVector3f ClosestLocation = FVector3f::ZeroVector;
+		FVector3f ClosestBarycentrics = FVector3f::ZeroVector;
+
+		FTraversalStack Stack;
+		Stack.Add({ 0, PointBoxDistanceSquared(Nodes[0], Point) });
+
+		while (Stack.Num() > 0)
+		{
+			const FTraversalEntry Entry = PopEntry(Stack);
+			if (Entry.Distance > ClosestDistanceSquared)
+			{
+				continue;
+			}
+
+			const FNode& Node = Nodes[Entry.NodeIndex];
+			if (Node.IsLeaf())
+			{
+				for (int32 Index = Node.FirstOrChild; Index < Node.FirstOrChild + Node.NumTriangles; Index++)
+				{
+					const TIndex3<int32>& Triangle = Triangles[Index];
+					FVector3f Barycentrics;
+					const FVector3f Location = ClosestPointOnTriangle(Point, Positions[Triangle.V0], Positions[Triangle.V1], Positions[Triangle.V2], Barycentrics);
+					const float DistanceSquared = FVector3f::DistSquared(Point, Location);
+					if (DistanceSquared <= ClosestDistanceSquared)
+					{
+						ClosestDistanceSquared = DistanceSquared;
+						ClosestTriangle = Index;
+						ClosestLocation = Location;
+						ClosestBarycentrics = Barycentrics;
+					}
+				}
+				continue;
+			}
+
+			const int32 FirstChild = Entry.NodeIndex + 1;
+			const int32 SecondChild = Node.FirstOrChild;
+			const float FirstDistance = PointBoxDistanceSquared(Nodes[FirstChild], Point);
+			const float SecondDistance = PointBoxDistanceSquared(Nodes[SecondChild], Point);
+			if (FirstDistance <= SecondDistance)
+			{
+				Stack.Add({ SecondChild, SecondDistance });
+				Stack.Add({ FirstChild, FirstDistance });
+			}
+			else
+			{
+				Stack.Add({ FirstChild, FirstDistance });
+				Stack.Add({ SecondChild, SecondDistance });
+			}
+		}
+
+		if (ClosestTriangle == INDEX_NONE)
+		{
+			return false;
+		}
+
+		const TIndex3<int32>& Triangle = Triangles[ClosestTriangle];
+		OutHit.TriangleIndex = TriangleIndices[ClosestTriangle];
+		OutHit.Vertices = Triangle;
+		OutHit.Distance = FMath::Sqrt(ClosestDistanceSquared);
+		OutHit.Location = ClosestLocation;
+		OutHit.Normal = FaceNormal(Positions[Triangle.V0], Positions[Triangle.V1], Positions[Triangle.V2]);
+		OutHit.Barycentrics = ClosestBarycentrics;
+		return true;
+	}
+
+	bool FRealtimeMeshTriangleBVH::SweepSphere(const FVector3f& Origin, const FVector3f& Direction, float Radius, float MaxDistance, FRealtimeMeshTriangleHit& OutHit) const
+	{
+		using namespace TriangleBVH::Private;
+
+		if (Nodes.Num() == 0)
+		{
+			return false;
+		}
+
+		// Same traversal as a raycast, against boxes grown by the radius
+		const FVector3f InvDirection = SafeInverseDirection(Direction);
+		float ClosestDistance = MaxDistance;
+		int32 ClosestTriangle = INDEX_NONE;
+
+		FTraversalStack Stack;
+		const float RootDistance = IntersectRayBox(Nodes[0], Origin, InvDirection, ClosestDistance, Radius);
+		if (RootDistance >= 0.0f)
+		{
+			Stack.Add({ 0, RootDistance });
+		}
+
+		while (Stack.Num() > 0)
+		{
+			const FTraversalEntry Entry = PopEntry(Stack);
+			if (Entry.Distance > ClosestDistance)
+			{
+				continue;
+			}
+
+			const FNode& Node = Nodes[Entry.NodeIndex];
+			if (Node.IsLeaf())
+			{
+				for (int32 Index = Node.FirstOrChild; Index < Node.FirstOrChild + Node.NumTriangles; Index++)
+				{
+					const TIndex3<int32>& Triangle = Triangles[Index];
+					const float Distance = SweepSphereTriangle(Origin, Direction, Radius, ClosestDistance, Positions[Triangle.V0], Positions[Triangle.V1], Positions[Triangle.V2]);
+					if (Distance >= 0.0f && (Distance < ClosestDistance || ClosestTriangle == INDEX_NONE))
+					{
+						ClosestDistance = Distance;
+						ClosestTriangle = Index;
+					}
+				}
+				continue;
+			}
+
+			const int32 FirstChild = Entry.NodeIndex + 1;
+			const int32 SecondChild = Node.FirstOrChild;
+			const float FirstDistance = IntersectRayBox(Nodes[FirstChild], Origin, InvDirection, ClosestDistance, Radius);
+			const float SecondDistance = IntersectRayBox(Nodes[SecondChild], Origin, InvDirection, ClosestDistance, Radius);
+			const bool bFirstIsNear = FirstDistance <= SecondDistance || SecondDistance < 0.0f;
+			const FTraversalEntry Near = bFirstIsNear ? FTraversalEntry{ FirstChild, FirstDistance } : FTraversalEntry{ SecondChild, SecondDistance };
+			const FTraversalEntry Far = bFirstIsNear ? FTraversalEntry{ SecondChild, SecondDistance } : FTraversalEntry{ FirstChild, FirstDistance };
+			if (Far.Distance >= 0.0f)
+			{
+				Stack.Add(Far);
+			}
+			if (Near.Distance >= 0.0f)
+			{
+				Stack.Add(Near);
+			}
+		}
+
+		if (ClosestTriangle == INDEX_NONE)
+		{
+			return false;
+		}
+
+		const TIndex3<int32>& Triangle = Triangles[ClosestTriangle];
+		const FVector3f& A = Positions[Triangle.V0];
+		const FVector3f& B = Positions[Triangle.V1];
+		const FVector3f& C = Positions[Triangle.V2];
+		const FVector3f Center = Origin + Direction * ClosestDistance;
+
+		OutHit.TriangleIndex = TriangleIndices[ClosestTriangle];
+		OutHit.Vertices = Triangle;
+		OutHit.Distance = ClosestDistance;
+		OutHit.Location = ClosestPointOnTriangle(Center, A, B, C, OutHit.Barycentrics);
+		OutHit.Normal = (Center - OutHit.Location).GetSafeNormal();
+		if (OutHit.Normal.IsZero())
+		{
+			OutHit.Normal = FaceNormal(A, B, C);
+		}
+		return true;
+	}
+
+	bool FRealtimeMeshTriangleBVH::Refit(TArray<FVector3f>&& NewPositions)
+	{
+		if (NewPositions.Num() != Positions.Num())
+		{
+			return false;
+		}
+
+		Positions = MoveTemp(NewPositions);
+
+		// Children always come after their parent, so walking backwards sees both children before the node itself
+		for (int32 NodeIndex = Nodes.Num() - 1; NodeIndex >= 0; NodeIndex--)
+		{
+			FNode& Node = Nodes[NodeIndex];
+			FBox3f Bounds(ForceInit);
+			if (Node.IsLeaf())
+			{
+				for (int32 Index = Node.FirstOrChild; Index < Node.FirstOrChild + Node.NumTriangles; Index++)
+				{
+					const TIndex3<int32>& Triangle = Triangles[Index];
+					Bounds += Positions[Triangle.V0];
+					Bounds += Positions[Triangle.V1];
+					Bounds += Positions[Triangle.V2];
+				}
+			}
+			else
+			{
+				const FNode& FirstChild = Nodes[NodeIndex + 1];
+				const FNode& SecondChild = Nodes[Node.FirstOrChild];
+				Bounds = FBox3f(FirstChild.BoundsMin.ComponentMin(SecondChild.BoundsMin), FirstChild.BoundsMax.ComponentMax(SecondChild.BoundsMax));
+			}
+			Node.BoundsMin = Bounds.Min;
+			Node.BoundsMax = Bounds.Max;
+		}
+
+		return true;
+	}
+}
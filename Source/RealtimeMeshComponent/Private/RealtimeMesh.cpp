@@ -87,12 +87,14 @@ void URealtimeMesh::Initialize(const TSharedRef<RealtimeMesh::FRealtimeMeshShare
 	if (SharedResources)
 	{
 		SharedResources->OnRenderProxyRequiresUpdate().RemoveAll(this);
+		SharedResources->OnRenderProxyRequiresStaticMeshUpdate().RemoveAll(this);
 		SharedResources->OnBoundsChanged().RemoveAll(this);
 	}
 
 	SharedResources = InSharedResources;
 
 	SharedResources->OnRenderProxyRequiresUpdate().AddUObject(this, &URealtimeMesh::HandleRenderProxyRequiresUpdate);
+	SharedResources->OnRenderProxyRequiresStaticMeshUpdate().AddUObject(this, &URealtimeMesh::HandleRenderProxyRequiresStaticMeshUpdate);
 	SharedResources->OnBoundsChanged().AddUObject(this, &URealtimeMesh::HandleBoundsUpdated);
 
 	/*SharedResources->OnMeshBoundsChanged().AddUObject(this, &URealtimeMesh::HandleBoundsUpdated);
@@ -309,6 +311,7 @@ void URealtimeMesh::BeginDestroy()
 	if (SharedResources)
 	{
 		SharedResources->OnRenderProxyRequiresUpdate().RemoveAll(this);
+		SharedResources->OnRenderProxyRequiresStaticMeshUpdate().RemoveAll(this);
 		SharedResources->OnBoundsChanged().RemoveAll(this);
 	}
 
@@ -483,8 +486,25 @@ ERealtimeMeshCollisionUpdateResult URealtimeMesh::ApplyCollisionUpdate(FRealtime
 {
 	if (NewCollisionKey > CurrentCollisionVersion)
 	{
-		UBodySetup* NewBodySetup = NewObject<UBodySetup>(this, NAME_None, (IsTemplate() ? RF_Public : RF_NoFlags));
-		NewBodySetup->BodySetupGuid = FGuid::NewGuid();
+		// Reuse the existing body setup so continuous edits don't churn a new UObject per update.
+		// Components recreate their physics state off the broadcast below, and the old chaos
+		// geometry stays alive through its refcount until the last body using it is gone.
+		UBodySetup* NewBodySetup = BodySetup;
+		if (NewBodySetup)
+		{
+			NewBodySetup->ClearPhysicsMeshes();
+			NewBodySetup->AggGeom.EmptyElements();
+#if RMC_ENGINE_ABOVE_5_4
+			NewBodySetup->TriMeshGeometries.Empty();
+#else
+			NewBodySetup->ChaosTriMeshes.Empty();
+#endif
+		}
+		else
+		{
+			NewBodySetup = NewObject<UBodySetup>(this, NAME_None, (IsTemplate() ? RF_Public : RF_NoFlags));
+			NewBodySetup->BodySetupGuid = FGuid::NewGuid();
+		}
 		NewBodySetup->bGenerateMirroredCollision = false;
 		NewBodySetup->bDoubleSidedGeometry = true;
 		NewBodySetup->bCreatedPhysicsMeshes = true;
@@ -542,5 +562,11 @@ void URealtimeMesh::HandleRenderProxyRequiresUpdate()
 	BroadcastRenderDataChangedEvent(true);
 }
 
+void URealtimeMesh::HandleRenderProxyRequiresStaticMeshUpdate()
+{
+	Modify(true);
+	BroadcastRenderDataChangedEvent(false);
+}
+
 
 #undef LOCTEXT_NAMESPACE
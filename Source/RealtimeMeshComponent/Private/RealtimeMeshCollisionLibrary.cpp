@@ -4,9 +4,20 @@
 #include "RealtimeMeshCollisionLibrary.h"
 
 #include "RealtimeMeshComponent.h"
+#include "RealtimeMeshSimple.h"
 #include "Core/RealtimeMeshBuilder.h"
 #include "PhysicsEngine/BodySetup.h"
 #include "PhysicsEngine/PhysicsSettings.h"
+#include "RealtimeMeshCore.h"
+#include "Async/ParallelFor.h"
+#include "Algo/Sort.h"
+
+DECLARE_CYCLE_STAT(TEXT("RealtimeMeshCollisionTools - Cook Complex Mesh"), STAT_RealtimeMeshCollisionTools_CookComplexMesh, STATGROUP_RealtimeMesh);
+
+static TAutoConsoleVariable<float> CVarRealtimeMeshCollisionHitUVSearchDistance(
+	TEXT("RealtimeMesh.Collision.HitUVSearchDistance"),
+	1.0f,
+	TEXT("How far from a hit location batched hit UV lookups search the render mesh, when there's no cooked UV data to use. Covers the gap between collision and render geometry"));
 
 
 bool URealtimeMeshCollisionTools::FindCollisionUVRealtimeMesh(const FHitResult& Hit, int32 UVChannel, FVector2D& UV)
@@ -30,6 +41,57 @@ bool URealtimeMeshCollisionTools::FindCollisionUVRealtimeMesh(const FHitResult&
 	return bSuccess;
 }
 
+int32 URealtimeMeshCollisionTools::FindCollisionUVsRealtimeMesh(const TArray<FHitResult>& Hits, int32 UVChannel, TArray<FVector2D>& UVs, TArray<bool>& Found)
+{
+	using namespace RealtimeMesh;
+
+	UVs.SetNumZeroed(Hits.Num());
+	Found.SetNumZeroed(Hits.Num());
+
+	const bool bHasCookedUVs = UPhysicsSettings::Get()->bSupportUVFromHitResults;
+	const float SearchDistance = CVarRealtimeMeshCollisionHitUVSearchDistance.GetValueOnAnyThread();
+
+	// Hits tend to come in runs against the same few components, so the spatial index is only looked up once per mesh
+	TMap<const URealtimeMeshSimple*, FRealtimeMeshSpatialIndexPtr> SpatialIndices;
+	
+	int32 NumFound = 0;
+	for (int32 HitIndex = 0; HitIndex < Hits.Num(); HitIndex++)
+	{
+		const FHitResult& Hit = Hits[HitIndex];
+		const URealtimeMeshComponent* HitComp = Cast<URealtimeMeshComponent>(Hit.Component.Get());
+		const URealtimeMesh* RealtimeMesh = HitComp ? HitComp->GetRealtimeMesh() : nullptr;
+		if (!RealtimeMesh)
+		{
+			continue;
+		}
+
+		const FVector LocalHitPos = HitComp->GetComponentToWorld().InverseTransformPosition(Hit.Location);
+		if (bHasCookedUVs && HitComp->GetBodySetup() && RealtimeMesh->CalcTexCoordAtLocation(LocalHitPos, Hit.ElementIndex, Hit.FaceIndex, UVChannel, UVs[HitIndex]))
+		{
+			Found[HitIndex] = true;
+		}
+		else if (const URealtimeMeshSimple* SimpleMesh = Cast<URealtimeMeshSimple>(RealtimeMesh))
+		{
+			FRealtimeMeshSpatialIndexPtr* SpatialIndex = SpatialIndices.Find(SimpleMesh);
+			if (!SpatialIndex)
+			{
+				SpatialIndex = &SpatialIndices.Add(SimpleMesh, SimpleMesh->GetMeshAs<FRealtimeMeshSimple>()->GetSpatialIndex(FRealtimeMeshLODKey(0)));
+			}
+
+			FVector2f UV;
+			if (SpatialIndex->IsValid() && (*SpatialIndex)->FindTexCoordAtLocation(FVector3f(LocalHitPos), SearchDistance, UVChannel, UV))
+			{
+				UVs[HitIndex] = FVector2D(UV);
+				Found[HitIndex] = true;
+			}
+		}
+
+		NumFound += Found[HitIndex] ? 1 : 0;
+	}
+
+	return NumFound;
+}
+
 void URealtimeMeshCollisionTools::CookConvexHull(FRealtimeMeshCollisionConvex& ConvexHull)
 {
 	if (ConvexHull.HasCookedMesh())
@@ -81,56 +143,241 @@ void URealtimeMeshCollisionTools::CookConvexHull(FRealtimeMeshCollisionConvex& C
 	ConvexHull.Cooked = MakeShared<FRealtimeMeshCookedConvexMeshData>(NonMirrored);
 }
 
+bool URealtimeMeshCollisionTools::CookCollisionInfo(FRealtimeMeshCollisionInfo& CollisionInfo, int32 MaxConcurrency, const RealtimeMesh::FRealtimeMeshCancellationToken& CancellationToken)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(URealtimeMeshCollisionTools::CookCollisionInfo);
+
+	struct FCookWorkItem
+	{
+		int32 Cost;
+		int32 Index;
+		bool bIsComplex;
+	};
+
+	TArray<FCookWorkItem> WorkItems;
+	for (const int32 MeshIndex : CollisionInfo.ComplexGeometry.GetMeshIDsNeedingCook())
+	{
+		WorkItems.Add({ CollisionInfo.ComplexGeometry.GetByIndex(MeshIndex).GetTriangles().Num(), MeshIndex, true });
+	}
+	for (const int32 ConvexIndex : CollisionInfo.SimpleGeometry.GetMeshIDsNeedingCook())
+	{
+		WorkItems.Add({ CollisionInfo.SimpleGeometry.ConvexHulls.GetByIndex(ConvexIndex).GetVertices().Num(), ConvexIndex, false });
+	}
+
+	if (WorkItems.Num() == 0)
+	{
+		return !CancellationToken.IsCancelled();
+	}
+
+	// Start the biggest elements first so one large mesh doesn't end up cooking alone at the tail.
+	// Ties are broken on type and index so the schedule is the same every run.
+	WorkItems.Sort([](const FCookWorkItem& A, const FCookWorkItem& B)
+	{
+		if (A.Cost != B.Cost)
+		{
+			return A.Cost > B.Cost;
+		}
+		if (A.bIsComplex != B.bIsComplex)
+		{
+			return A.bIsComplex;
+		}
+		return A.Index < B.Index;
+	});
+
+	// Each worker pulls the next item off a shared counter, so the number of workers is the concurrency cap
+	const int32 NumWorkers = MaxConcurrency > 0 ? FMath::Min(MaxConcurrency, WorkItems.Num()) : WorkItems.Num();
+	std::atomic<int32> NextWorkItem(0);
+
+	ParallelFor(NumWorkers, [&](int32 WorkerIndex)
+	{
+		for (int32 ItemIndex = NextWorkItem++; ItemIndex < WorkItems.Num(); ItemIndex = NextWorkItem++)
+		{
+			// A newer cook has been requested, so don't bother with anything not already started
+			if (CancellationToken.IsCancelled())
+			{
+				return;
+			}
+
+			const FCookWorkItem& Item = WorkItems[ItemIndex];
+			if (Item.bIsComplex)
+			{
+				CookComplexMesh(CollisionInfo.ComplexGeometry.GetByIndex(Item.Index), CollisionInfo.Configuration);
+			}
+			else
+			{
+				CookConvexHull(CollisionInfo.SimpleGeometry.ConvexHulls.GetByIndex(Item.Index));
+			}
+		}
+	}, NumWorkers == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::Unbalanced);
+
+	return !CancellationToken.IsCancelled();
+}
+
 void URealtimeMeshCollisionTools::CookComplexMesh(FRealtimeMeshCollisionMesh& CollisionMesh)
 {
-	constexpr bool EnableMeshClean = false;
+	CookComplexMesh(CollisionMesh, FRealtimeMeshCollisionConfiguration());
+}
+
+bool URealtimeMeshCollisionTools::CleanCollisionMesh(const TArray<FVector3f>& InVertices, const TArray<RealtimeMesh::TIndex3<int32>>& InTriangles, float WeldThreshold,
+	TArray<FVector3f>& OutVertices, TArray<RealtimeMesh::TIndex3<int32>>& OutTriangles, TArray<int32>& OutVertexRemap, TArray<int32>& OutFaceRemap)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(URealtimeMeshCollisionTools::CleanCollisionMesh);
+	using namespace RealtimeMesh;
+
+	const int32 NumVertices = InVertices.Num();
+	const int32 NumTriangles = InTriangles.Num();
+
+	// Snap every vertex to the weld grid. Vertices in the same cell are merged, so two points closer than the
+	// threshold can still stay apart if they straddle a cell boundary. A threshold of 0 only merges exact matches.
+	TArray<FVector3f> WeldKeys;
+	WeldKeys.SetNumUninitialized(NumVertices);
+	const float InvWeldThreshold = WeldThreshold > 0.0f ? 1.0f / WeldThreshold : 0.0f;
+	ParallelFor(NumVertices, [&](int32 VertIndex)
+	{
+		const FVector3f& Vertex = InVertices[VertIndex];
+		// Adding zero folds -0 into +0 so they hash the same
+		WeldKeys[VertIndex] = WeldThreshold > 0.0f
+			? FVector3f(FMath::RoundToFloat(Vertex.X * InvWeldThreshold), FMath::RoundToFloat(Vertex.Y * InvWeldThreshold), FMath::RoundToFloat(Vertex.Z * InvWeldThreshold)) + FVector3f::ZeroVector
+			: Vertex + FVector3f::ZeroVector;
+	});
+
+	// The first vertex seen in a cell represents it, which keeps the result independent of thread timing
+	TArray<int32> WeldedVertex;
+	WeldedVertex.SetNumUninitialized(NumVertices);
+	{
+		TMap<FVector3f, int32> CellRepresentative;
+		CellRepresentative.Reserve(NumVertices);
+		for (int32 VertIndex = 0; VertIndex < NumVertices; VertIndex++)
+		{
+			WeldedVertex[VertIndex] = CellRepresentative.FindOrAdd(WeldKeys[VertIndex], VertIndex);
+		}
+	}
+
+	// Remap the triangles onto the welded vertices and flag the ones that collapsed
+	TArray<TIndex3<int32>> WeldedTriangles;
+	WeldedTriangles.SetNumUninitialized(NumTriangles);
+	TArray<bool> KeepTriangle;
+	KeepTriangle.SetNumUninitialized(NumTriangles);
+	ParallelFor(NumTriangles, [&](int32 TriIndex)
+	{
+		const TIndex3<int32>& Tri = InTriangles[TriIndex];
+		const bool bInRange = InVertices.IsValidIndex(Tri.V0) && InVertices.IsValidIndex(Tri.V1) && InVertices.IsValidIndex(Tri.V2);
+		if (!bInRange)
+		{
+			KeepTriangle[TriIndex] = false;
+			return;
+		}
+
+		const TIndex3<int32> Welded(WeldedVertex[Tri.V0], WeldedVertex[Tri.V1], WeldedVertex[Tri.V2]);
+		WeldedTriangles[TriIndex] = Welded;
+		KeepTriangle[TriIndex] = !Welded.IsDegenerate() &&
+			Chaos::FConvexBuilder::IsValidTriangle(InVertices[Welded.V0], InVertices[Welded.V1], InVertices[Welded.V2]);
+	});
+
+	// Drop faces that use the same three vertices as an earlier face, whatever their winding, and gather what's left
+	TSet<TIndex3<int32>> SeenFaces;
+	SeenFaces.Reserve(NumTriangles);
+	TArray<int32> NewVertexIndex;
+	NewVertexIndex.Init(INDEX_NONE, NumVertices);
+
+	OutTriangles.Reset(NumTriangles);
+	OutFaceRemap.Reset(NumTriangles);
+	for (int32 TriIndex = 0; TriIndex < NumTriangles; TriIndex++)
+	{
+		if (!KeepTriangle[TriIndex])
+		{
+			continue;
+		}
+
+		const TIndex3<int32>& Tri = WeldedTriangles[TriIndex];
+		int32 Sorted[3] = { Tri.V0, Tri.V1, Tri.V2 };
+		Algo::Sort(Sorted);
+		bool bAlreadySeen = false;
+		SeenFaces.Add(TIndex3<int32>(Sorted[0], Sorted[1], Sorted[2]), &bAlreadySeen);
+		if (bAlreadySeen)
+		{
+			continue;
+		}
+
+		OutTriangles.Add(Tri);
+		OutFaceRemap.Add(TriIndex);
+		NewVertexIndex[Tri.V0] = 0;
+		NewVertexIndex[Tri.V1] = 0;
+		NewVertexIndex[Tri.V2] = 0;
+	}
+
+	// Compact down to the vertices still in use, in their original order
+	OutVertices.Reset();
+	OutVertexRemap.Reset();
+	for (int32 VertIndex = 0; VertIndex < NumVertices; VertIndex++)
+	{
+		if (NewVertexIndex[VertIndex] != INDEX_NONE)
+		{
+			NewVertexIndex[VertIndex] = OutVertices.Add(InVertices[VertIndex]);
+			OutVertexRemap.Add(VertIndex);
+		}
+	}
+
+	ParallelFor(OutTriangles.Num(), [&](int32 TriIndex)
+	{
+		TIndex3<int32>& Tri = OutTriangles[TriIndex];
+		Tri = TIndex3<int32>(NewVertexIndex[Tri.V0], NewVertexIndex[Tri.V1], NewVertexIndex[Tri.V2]);
+	});
+
+	return OutVertices.Num() != NumVertices || OutTriangles.Num() != NumTriangles;
+}
+
+void URealtimeMeshCollisionTools::CookComplexMesh(FRealtimeMeshCollisionMesh& CollisionMesh, const FRealtimeMeshCollisionConfiguration& Configuration)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(URealtimeMeshCollisionTools::CookComplexMesh);
+	SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshCollisionTools_CookComplexMesh);
+	CSV_SCOPED_TIMING_STAT(RealtimeMesh, CookComplexMesh);
+	RealtimeMesh::FRealtimeMeshStatCounters::Get().ComplexCollisionCooks++;
 	
 	if(CollisionMesh.Vertices.Num() == 0)
 	{
 		CollisionMesh.Cooked = MakeShared<FRealtimeMeshCookedTriMeshData>();
 	}
 
-	TArray<FVector3f> FinalVerts = CollisionMesh.Vertices;
+	TArray<int32> OutVertexRemap;
+	TArray<int32> OutFaceRemap;
 
-	// Push indices into one flat array
-	TArray<int32> FinalIndices;
-	FinalIndices.Reserve(CollisionMesh.Triangles.Num() * 3);
-	for(const RealtimeMesh::TIndex3<int32>& Tri : CollisionMesh.Triangles)
+	// Welding and removing degenerate/duplicate faces produces new arrays along with the remaps back to the source,
+	// otherwise the source arrays are read in place and the only copy made is into the chaos particles and triangles
+	TArray<FVector3f> CleanedVerts;
+	TArray<RealtimeMesh::TIndex3<int32>> CleanedTriangles;
+	const bool bUseCleanedMesh = Configuration.bCleanComplexMeshes &&
+		CleanCollisionMesh(CollisionMesh.Vertices, CollisionMesh.Triangles, Configuration.CleanWeldThreshold, CleanedVerts, CleanedTriangles, OutVertexRemap, OutFaceRemap);
+	if (!bUseCleanedMesh)
 	{
-		// NOTE: This is where the Winding order of the triangles are changed to be consistent throughout the rest of the physics engine
-		// After this point we should have clockwise (CW) winding in left handed (LH) coordinates (or equivalently CCW in RH)
-		// This is the opposite convention followed in most of the unreal engine
-		FinalIndices.Add(CollisionMesh.bFlipNormals ? Tri.V1 : Tri.V0);
-		FinalIndices.Add(CollisionMesh.bFlipNormals ? Tri.V0 : Tri.V1);
-		FinalIndices.Add(Tri.V2);
+		OutVertexRemap.Reset();
+		OutFaceRemap.Reset();
 	}
+	
+	const TArray<FVector3f>& SourceVerts = bUseCleanedMesh ? CleanedVerts : CollisionMesh.Vertices;
+	const TArray<RealtimeMesh::TIndex3<int32>>& SourceTriangles = bUseCleanedMesh ? CleanedTriangles : CollisionMesh.Triangles;
+	const bool bFlipNormals = CollisionMesh.bFlipNormals;
 
-	/*if(EnableMeshClean)
-	{
-		Chaos::CleanTrimesh(FinalVerts, FinalIndices, &OutFaceRemap, &OutVertexRemap);
-	}*/
-
-	// Build particle list #BG Maybe allow TParticles to copy vectors?
 	Chaos::FTriangleMeshImplicitObject::ParticlesType TriMeshParticles;
-	TriMeshParticles.AddParticles(FinalVerts.Num());
+	TriMeshParticles.AddParticles(SourceVerts.Num());
 
-	const int32 NumVerts = FinalVerts.Num();
+	const int32 NumVerts = SourceVerts.Num();
 	for(int32 VertIndex = 0; VertIndex < NumVerts; ++VertIndex)
 	{
 #if RMC_ENGINE_ABOVE_5_4
-		TriMeshParticles.SetX(VertIndex, FinalVerts[VertIndex]);
+		TriMeshParticles.SetX(VertIndex, SourceVerts[VertIndex]);
 #else
-		TriMeshParticles.X(VertIndex) = FinalVerts[VertIndex];
+		TriMeshParticles.X(VertIndex) = SourceVerts[VertIndex];
 #endif
 	}
 
-	TArray<int32> OutVertexRemap;
-	TArray<int32> OutFaceRemap;
+	// Deformable meshes keep the vertex remap to themselves so particles stay in remap order, which is what RefitComplexMesh writes in
+	const bool bShareVertexRemap = Chaos::TriMeshPerPolySupport && !Configuration.bDeformableMesh;
 
-	// Build chaos triangle list. #BGTODO Just make the clean function take these types instead of double copying
-	auto LambdaHelper = [&CollisionMesh, &FinalVerts, &FinalIndices, &TriMeshParticles, &OutFaceRemap, &OutVertexRemap](auto& Triangles)
+	// Build chaos triangle list
+	auto LambdaHelper = [&CollisionMesh, &SourceVerts, &SourceTriangles, bFlipNormals, bShareVertexRemap, &TriMeshParticles, &OutFaceRemap, &OutVertexRemap](auto& Triangles)
 	{
-		const int32 NumTriangles = FinalIndices.Num() / 3;
+		const int32 NumTriangles = SourceTriangles.Num();
 		bool bHasMaterials = CollisionMesh.Materials.Num() > 0;
 		TArray<uint16> MaterialIndices;
 
@@ -146,62 +393,43 @@ void URealtimeMeshCollisionTools::CookComplexMesh(FRealtimeMeshCollisionMesh& Co
 		Triangles.Reserve(NumTriangles);
 		for(int32 TriangleIndex = 0; TriangleIndex < NumTriangles; ++TriangleIndex)
 		{
+			// NOTE: This is where the Winding order of the triangles are changed to be consistent throughout the rest of the physics engine
+			// After this point we should have clockwise (CW) winding in left handed (LH) coordinates (or equivalently CCW in RH)
+			// This is the opposite convention followed in most of the unreal engine
+			const RealtimeMesh::TIndex3<int32>& Tri = SourceTriangles[TriangleIndex];
+			const int32 V0 = bFlipNormals ? Tri.V1 : Tri.V0;
+			const int32 V1 = bFlipNormals ? Tri.V0 : Tri.V1;
+			const int32 V2 = Tri.V2;
+
 			// Only add this triangle if it is valid
-			const int32 BaseIndex = TriangleIndex * 3;
-			const bool bIsValidTriangle = Chaos::FConvexBuilder::IsValidTriangle(
-				FinalVerts[FinalIndices[BaseIndex]],
-				FinalVerts[FinalIndices[BaseIndex + 1]],
-				FinalVerts[FinalIndices[BaseIndex + 2]]);
+			const bool bIsValidTriangle = Chaos::FConvexBuilder::IsValidTriangle(SourceVerts[V0], SourceVerts[V1], SourceVerts[V2]);
 
 			// TODO: Figure out a proper way to handle this. Could these edges get sewn together? Is this important?
 			//if (ensureMsgf(bIsValidTriangle, TEXT("FChaosDerivedDataCooker::BuildTriangleMeshes(): Trimesh attempted cooked with invalid triangle!")));
 			if(bIsValidTriangle)
 			{
-				Triangles.Add(Chaos::TVector<int32, 3>(FinalIndices[BaseIndex], FinalIndices[BaseIndex + 1], FinalIndices[BaseIndex + 2]));
-				OutFaceRemap.Add(OldFaceRemap.IsEmpty()? TriangleIndex : OldFaceRemap[TriangleIndex]);
+				Triangles.Add(Chaos::TVector<int32, 3>(V0, V1, V2));
+				// Faces left out by cleaning are skipped by the remap, so materials are looked up by the source face
+				const int32 SourceFaceIndex = OldFaceRemap.IsEmpty()? TriangleIndex : OldFaceRemap[TriangleIndex];
+				OutFaceRemap.Add(SourceFaceIndex);
 
 				if(bHasMaterials)
 				{
-					/*if(EnableMeshClean)
+					if(ensure(CollisionMesh.Materials.IsValidIndex(SourceFaceIndex)))
 					{
-						if(!ensure(OldFaceRemap.IsValidIndex(TriangleIndex)))
-						{
-							MaterialIndices.Empty();
-							bHasMaterials = false;
-						}
-						else
-						{
-							const int32 OriginalIndex = OldFaceRemap[TriangleIndex];
-
-							if(ensure(Materials.IsValidIndex(OriginalIndex)))
-							{
-								MaterialIndices.Add(Materials[OriginalIndex]);
-							}
-							else
-							{
-								MaterialIndices.Empty();
-								bHasMaterials = false;
-							}
-						}
+						MaterialIndices.Add(CollisionMesh.Materials[SourceFaceIndex]);
 					}
-					else*/
+					else
 					{
-						if(ensure(CollisionMesh.Materials.IsValidIndex(TriangleIndex)))
-						{
-							MaterialIndices.Add(CollisionMesh.Materials[TriangleIndex]);
-						}
-						else
-						{
-							MaterialIndices.Empty();
-							bHasMaterials = false;
-						}
+						MaterialIndices.Empty();
+						bHasMaterials = false;
 					}
 				}
 			}
 		}
 
 		TUniquePtr<TArray<int32>> OutFaceRemapPtr = MakeUnique<TArray<int32>>(OutFaceRemap);
-		TUniquePtr<TArray<int32>> OutVertexRemapPtr = Chaos::TriMeshPerPolySupport ? MakeUnique<TArray<int32>>(OutVertexRemap) : nullptr;
+		TUniquePtr<TArray<int32>> OutVertexRemapPtr = bShareVertexRemap ? MakeUnique<TArray<int32>>(OutVertexRemap) : nullptr;
 		
 		
 #if RMC_ENGINE_ABOVE_5_4
@@ -228,7 +456,7 @@ void URealtimeMeshCollisionTools::CookComplexMesh(FRealtimeMeshCollisionMesh& Co
 			MoveTemp(OutVertexRemap), MoveTemp(OutFaceRemap), MoveTemp(UVInfo));
 	};
 
-	if(FinalVerts.Num() < TNumericLimits<uint16>::Max())
+	if(SourceVerts.Num() < TNumericLimits<uint16>::Max())
 	{
 		TArray<Chaos::TVector<uint16, 3>> TrianglesSmallIdx;
 		LambdaHelper(TrianglesSmallIdx);
@@ -240,6 +468,108 @@ void URealtimeMeshCollisionTools::CookComplexMesh(FRealtimeMeshCollisionMesh& Co
 	}	
 }
 
+bool URealtimeMeshCollisionTools::RefitComplexMesh(FRealtimeMeshCollisionMesh& CollisionMesh, const FRealtimeMeshCookedTriMeshData& PreviousCook)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(URealtimeMeshCollisionTools::RefitComplexMesh);
+
+	if (!PreviousCook.HasMesh())
+	{
+		return false;
+	}
+
+	const auto PreviousMesh = PreviousCook.GetMesh();
+	const TArray<int32>& VertexRemap = PreviousCook.GetVertexRemap();
+	const int32 NumParticles = static_cast<int32>(PreviousMesh->Particles().Size());
+
+	// Particles are either the source vertices as they are, or the welded ones picked out by the remap
+	if (VertexRemap.Num() > 0 ? VertexRemap.Num() != NumParticles : CollisionMesh.Vertices.Num() != NumParticles)
+	{
+		return false;
+	}
+
+	Chaos::FTriangleMeshImplicitObject::ParticlesType TriMeshParticles;
+	TriMeshParticles.AddParticles(NumParticles);
+	for (int32 ParticleIndex = 0; ParticleIndex < NumParticles; ParticleIndex++)
+	{
+		const int32 SourceIndex = VertexRemap.Num() > 0 ? VertexRemap[ParticleIndex] : ParticleIndex;
+		if (!CollisionMesh.Vertices.IsValidIndex(SourceIndex))
+		{
+			return false;
+		}
+#if RMC_ENGINE_ABOVE_5_4
+		TriMeshParticles.SetX(ParticleIndex, CollisionMesh.Vertices[SourceIndex]);
+#else
+		TriMeshParticles.X(ParticleIndex) = CollisionMesh.Vertices[SourceIndex];
+#endif
+	}
+
+	// The previous mesh may still be in use by the physics scene so it's left alone. Rather than deep copying it (particles,
+	// triangles and a tree that's about to be thrown away) the moved particles go straight into a new mesh along with the
+	// previous cook's triangles, which are already cleaned, validated and in tree order, so only the tree is rebuilt
+	const TArray<int32>& FaceRemap = PreviousCook.GetFaceRemap();
+	auto BuildRefitMesh = [&](const auto& PreviousTriangles)
+	{
+		TArray<uint16> MaterialIndices;
+		if (CollisionMesh.Materials.Num() > 0)
+		{
+			MaterialIndices.Reserve(PreviousTriangles.Num());
+			for (int32 TriangleIndex = 0; TriangleIndex < PreviousTriangles.Num(); TriangleIndex++)
+			{
+				const int32 SourceFaceIndex = FaceRemap.IsValidIndex(TriangleIndex) ? FaceRemap[TriangleIndex] : TriangleIndex;
+				if (!CollisionMesh.Materials.IsValidIndex(SourceFaceIndex))
+				{
+					MaterialIndices.Empty();
+					break;
+				}
+				MaterialIndices.Add(CollisionMesh.Materials[SourceFaceIndex]);
+			}
+		}
+
+		auto Triangles = PreviousTriangles;
+		TUniquePtr<TArray<int32>> FaceRemapPtr = MakeUnique<TArray<int32>>(FaceRemap);
+#if RMC_ENGINE_ABOVE_5_4
+		return Chaos::FTriangleMeshImplicitObjectPtr(new Chaos::FTriangleMeshImplicitObject(MoveTemp(TriMeshParticles), MoveTemp(Triangles), MoveTemp(MaterialIndices), MoveTemp(FaceRemapPtr)));
+#else
+		return MakeShared<Chaos::FTriangleMeshImplicitObject>(MoveTemp(TriMeshParticles), MoveTemp(Triangles), MoveTemp(MaterialIndices), MoveTemp(FaceRemapPtr));
+#endif
+	};
+
+	const Chaos::FTrimeshIndexBuffer& PreviousElements = PreviousMesh->Elements();
+	const auto RefitMesh = PreviousElements.RequiresLargeIndices()
+		? BuildRefitMesh(PreviousElements.GetLargeIndexBuffer())
+		: BuildRefitMesh(PreviousElements.GetSmallIndexBuffer());
+
+	// Building the tree can reorder the triangles again now that they've moved
+	TArray<int32> RefitFaceRemap;
+	RefitFaceRemap.SetNumUninitialized(RefitMesh->Elements().GetNumTriangles());
+	for (int32 TriangleIndex = 0; TriangleIndex < RefitFaceRemap.Num(); TriangleIndex++)
+	{
+		RefitFaceRemap[TriangleIndex] = RefitMesh->GetExternalFaceIndexFromInternal(TriangleIndex);
+	}
+
+	FRealtimeMeshCollisionMeshCookedUVData UVInfo;
+	if (UPhysicsSettings::Get()->bSupportUVFromHitResults)
+	{
+		UVInfo.FillFromTriMesh(CollisionMesh);
+	}
+
+	CollisionMesh.Cooked = MakeShared<FRealtimeMeshCookedTriMeshData>(RefitMesh,
+		TArray<int32>(VertexRemap), MoveTemp(RefitFaceRemap), MoveTemp(UVInfo));
+	RealtimeMesh::FRealtimeMeshStatCounters::Get().ComplexCollisionRefits++;
+	return true;
+}
+
+uint32 URealtimeMeshCollisionTools::GetComplexMeshTopologyHash(const FRealtimeMeshCollisionMesh& CollisionMesh, const FRealtimeMeshCollisionConfiguration& Configuration)
+{
+	uint32 Hash = FCrc::MemCrc32(CollisionMesh.Triangles.GetData(), CollisionMesh.Triangles.Num() * sizeof(RealtimeMesh::TIndex3<int32>));
+	Hash = FCrc::MemCrc32(CollisionMesh.Materials.GetData(), CollisionMesh.Materials.Num() * sizeof(uint16), Hash);
+	Hash = HashCombine(Hash, GetTypeHash(CollisionMesh.Vertices.Num()));
+	Hash = HashCombine(Hash, GetTypeHash(CollisionMesh.bFlipNormals));
+	Hash = HashCombine(Hash, GetTypeHash(Configuration.bCleanComplexMeshes));
+	Hash = HashCombine(Hash, GetTypeHash(Configuration.CleanWeldThreshold));
+	return Hash;
+}
+
 void URealtimeMeshCollisionTools::CopySimpleGeometryToBodySetup(const FRealtimeMeshSimpleGeometry& SimpleGeom, UBodySetup* BodySetup)
 {
 	for (const auto& Sphere : SimpleGeom.Spheres)
@@ -332,9 +662,33 @@ void URealtimeMeshCollisionTools::CopyComplexGeometryToBodySetup(const FRealtime
 	}	
 }
 
+namespace RealtimeMesh::CollisionLibrary::Private
+{
+	// Every triangle appended in one call shares a material, so fill the whole run at once
+	static void AppendMaterialRun(TArray<uint16>& Materials, int32 FirstTriangle, int32 NumTriangles, int32 MaterialIndex)
+	{
+		// Keep materials lined up with triangles that were added without any
+		Materials.SetNumZeroed(FirstTriangle);
+
+		const int32 StartIndex = Materials.AddUninitialized(NumTriangles);
+		uint16* MaterialData = Materials.GetData() + StartIndex;
+		const uint16 Material = static_cast<uint16>(MaterialIndex);
+		for (int32 Index = 0; Index < NumTriangles; Index++)
+		{
+			MaterialData[Index] = Material;
+		}
+	}
+
+	static bool CanGatherTriangles(const FRealtimeMeshStream& TriangleStream)
+	{
+		return TriangleStream.CanConvertTo<TIndex3<int32>>();
+	}
+}
+
 bool URealtimeMeshCollisionTools::AppendStreamsToCollisionMesh(FRealtimeMeshCollisionMesh& CollisionMesh, const RealtimeMesh::FRealtimeMeshStreamSet& Streams, int32 MaterialIndex)
 {
 	using namespace RealtimeMesh;
+	using namespace RealtimeMesh::CollisionLibrary::Private;
 
 	const auto PositionStream = Streams.Find(FRealtimeMeshStreams::Position);
 	const auto TriangleStream = Streams.Find(FRealtimeMeshStreams::Triangles);
@@ -358,11 +712,19 @@ bool URealtimeMeshCollisionTools::AppendStreamsToCollisionMesh(FRealtimeMeshColl
 		return false;
 	}
 
+	if (!CanGatherTriangles(*TriangleStream))
+	{
+		UE_LOG(LogRealtimeMeshInterface, Warning, TEXT("Unable to append collision vertices: triangle stream not convertible to TIndex3<int32>"));
+		return false;
+	}
+
 	CollisionMesh.ReleaseCooked();
 	
 	const int32 StartVertexIndex = CollisionMesh.Vertices.Num();
+	const int32 NumVertices = PositionStream->Num();
 
-	// Copy in the vertices
+	// Copy in the vertices. This is a single memcpy when the stream is already FVector3f, and one batched
+	// pass through the conversion registry otherwise.
 	PositionStream->CopyTo(CollisionMesh.Vertices);
 
 	if (UPhysicsSettings::Get()->bSupportUVFromHitResults)
@@ -377,23 +739,15 @@ bool URealtimeMeshCollisionTools::AppendStreamsToCollisionMesh(FRealtimeMeshColl
 			{
 				CollisionMesh.TexCoords[Index].SetNumZeroed(CollisionMesh.Vertices.Num());
 			}
-			
-			for (int32 ChannelIndex = 0; ChannelIndex < TexCoordsStream->GetNumElements(); ChannelIndex++)
-			{
-				TRealtimeMeshStridedStreamBuilder<const FVector2f, void> UVData(*TexCoordsStream, ChannelIndex);
-				const int32 NumUVsToCopy = FMath::Min(UVData.Num(), PositionStream->Num());
-				auto& CollisionUVChannel = CollisionMesh.TexCoords[ChannelIndex];
-				CollisionUVChannel.SetNumUninitialized(NumUVsToCopy);
-			
-				for (int32 TexCoordIdx = 0; TexCoordIdx < NumUVsToCopy; TexCoordIdx++)
-				{
-					CollisionUVChannel[TexCoordIdx] = UVData[TexCoordIdx];
-				}
 
-				// Make sure the uv data is the same length as the position data
-				if (PositionStream->Num() > UVData.Num())
+			if (FRealtimeMeshTypeConversionUtilities::CanConvert(TexCoordsStream->GetElementType(), GetRealtimeMeshDataElementType<FVector2f>()))
+			{
+				// Anything past the end of a short UV stream stays zeroed
+				const int32 NumUVsToCopy = FMath::Min(TexCoordsStream->Num(), NumVertices);
+				for (int32 ChannelIndex = 0; ChannelIndex < TexCoordsStream->GetNumElements(); ChannelIndex++)
 				{
-					CollisionUVChannel.SetNumZeroed(PositionStream->Num());
+					TexCoordsStream->GetElementRange<FVector2f>(0, ChannelIndex,
+						MakeArrayView(CollisionMesh.TexCoords[ChannelIndex].GetData() + StartVertexIndex, NumUVsToCopy));
 				}
 			}
 		}
@@ -412,19 +766,23 @@ bool URealtimeMeshCollisionTools::AppendStreamsToCollisionMesh(FRealtimeMeshColl
 		}
 	}
 
-	TRealtimeMeshStreamBuilder<const TIndex3<uint32>, void> TrianglesData(*TriangleStream);
-	CollisionMesh.Triangles.Reserve(CollisionMesh.Triangles.Num() + TrianglesData.Num());
-	CollisionMesh.Materials.Reserve(CollisionMesh.Triangles.Num());
+	// Triangles come across in one block as well, widened from 16 bit through the conversion registry if needed
+	const int32 StartTriangleIndex = CollisionMesh.Triangles.Num();
+	const int32 NumTriangles = TriangleStream->Num();
+	TriangleStream->CopyRange(0, NumTriangles, CollisionMesh.Triangles);
 
-	for (int32 TriIdx = 0; TriIdx < TrianglesData.Num(); TriIdx++)
+	if (StartVertexIndex > 0)
 	{
-		TIndex3<int32>& Tri = CollisionMesh.Triangles.AddDefaulted_GetRef();
-		Tri.V0 = TrianglesData[TriIdx].GetElement(0).GetValue() + StartVertexIndex;
-		Tri.V1 = TrianglesData[TriIdx].GetElement(1).GetValue() + StartVertexIndex;
-		Tri.V2 = TrianglesData[TriIdx].GetElement(2).GetValue() + StartVertexIndex;
-
-		CollisionMesh.Materials.Add(MaterialIndex);
+		TIndex3<int32>* NewTriangles = CollisionMesh.Triangles.GetData() + StartTriangleIndex;
+		for (int32 TriIdx = 0; TriIdx < NumTriangles; TriIdx++)
+		{
+			NewTriangles[TriIdx].V0 += StartVertexIndex;
+			NewTriangles[TriIdx].V1 += StartVertexIndex;
+			NewTriangles[TriIdx].V2 += StartVertexIndex;
+		}
 	}
+
+	AppendMaterialRun(CollisionMesh.Materials, StartTriangleIndex, NumTriangles, MaterialIndex);
 	
 	return true;
 }
@@ -433,6 +791,7 @@ bool URealtimeMeshCollisionTools::AppendStreamsToCollisionMesh(FRealtimeMeshColl
 	int32 FirstTriangle, int32 TriangleCount)
 {
 	using namespace RealtimeMesh;
+	using namespace RealtimeMesh::CollisionLibrary::Private;
 
 	const auto PositionStream = Streams.Find(FRealtimeMeshStreams::Position);
 	const auto TriangleStream = Streams.Find(FRealtimeMeshStreams::Triangles);
@@ -456,6 +815,12 @@ bool URealtimeMeshCollisionTools::AppendStreamsToCollisionMesh(FRealtimeMeshColl
 		return false;
 	}
 
+	if (!CanGatherTriangles(*TriangleStream))
+	{
+		UE_LOG(LogRealtimeMeshInterface, Warning, TEXT("Unable to append collision vertices: triangle stream not convertible to TIndex3<int32>"));
+		return false;
+	}
+
 	const int32 AvailableTriangles = TriangleStream->Num();
 	if (FirstTriangle < 0 || FirstTriangle >= AvailableTriangles)
 	{
@@ -475,13 +840,9 @@ bool URealtimeMeshCollisionTools::AppendStreamsToCollisionMesh(FRealtimeMeshColl
 	TMap<uint32, uint32> VertexRemap;
 	const int32 OriginalVertexCount = CollisionMesh.Vertices.Num();
 	
-	TRealtimeMeshStreamBuilder<const TIndex3<uint32>, void> TrianglesData(*TriangleStream);
-	CollisionMesh.Triangles.Reserve(CollisionMesh.Triangles.Num() + TriangleCount);
-	CollisionMesh.Materials.Reserve(CollisionMesh.Triangles.Num() + TriangleCount);
-
-	// Make sure materials is same length as triangles
-	CollisionMesh.Materials.SetNumZeroed(CollisionMesh.Triangles.Num());
-
+	// Pull the triangle range across in one block, then remap it in place
+	const int32 StartTriangleIndex = CollisionMesh.Triangles.Num();
+	TriangleStream->CopyRange(FirstTriangle, TriangleCount, CollisionMesh.Triangles);
 
 	int32 NewVertexIndex = OriginalVertexCount;
 	const auto RemapVertex = [&](int32 Index)
@@ -494,15 +855,14 @@ bool URealtimeMeshCollisionTools::AppendStreamsToCollisionMesh(FRealtimeMeshColl
 		return VertexRemap.FindOrAdd(Index) = NewVertexIndex++;		
 	};
 	
-	for (int32 TriIdx = 0; TriIdx < TriangleCount; TriIdx++)
+	for (TIndex3<int32>& Tri : MakeArrayView(CollisionMesh.Triangles.GetData() + StartTriangleIndex, TriangleCount))
 	{
-		TIndex3<int32>& Tri = CollisionMesh.Triangles.AddDefaulted_GetRef();
-		Tri.V0 = RemapVertex(TrianglesData[TriIdx + FirstTriangle].GetElement(0).GetValue());
-		Tri.V1 = RemapVertex(TrianglesData[TriIdx + FirstTriangle].GetElement(1).GetValue());
-		Tri.V2 = RemapVertex(TrianglesData[TriIdx + FirstTriangle].GetElement(2).GetValue());
+		Tri.V0 = RemapVertex(Tri.V0);
+		Tri.V1 = RemapVertex(Tri.V1);
+		Tri.V2 = RemapVertex(Tri.V2);
+	}
 
-		CollisionMesh.Materials.Add(MaterialIndex);
-	}	
+	AppendMaterialRun(CollisionMesh.Materials, StartTriangleIndex, TriangleCount, MaterialIndex);	
 	
 
 	// Copy in the vertices
@@ -670,6 +1030,40 @@ FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::RemoveS
 	return SimpleGeometry;
 }
 
+FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::AddSpheres(FRealtimeMeshSimpleGeometry& SimpleGeometry,
+                                                                                    const TArray<FRealtimeMeshCollisionSphere>& InSpheres, TArray<int32>& OutIndices)
+{
+	SimpleGeometry.Spheres.Append(InSpheres, &OutIndices);
+	return SimpleGeometry;
+}
+
+FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::UpdateSpheres(FRealtimeMeshSimpleGeometry& SimpleGeometry,
+                                                                                       const TArray<int32>& Indices, const TArray<FRealtimeMeshCollisionSphere>& InSpheres, int32& NumUpdated)
+{
+	if (Indices.Num() != InSpheres.Num())
+	{
+		UE_LOG(LogRealtimeMeshInterface, Warning, TEXT("UpdateSpheres: Got %d indices but %d shapes"), Indices.Num(), InSpheres.Num());
+		NumUpdated = 0;
+		return SimpleGeometry;
+	}
+	NumUpdated = SimpleGeometry.Spheres.UpdateMany(Indices, InSpheres);
+	return SimpleGeometry;
+}
+
+FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::RemoveSpheres(FRealtimeMeshSimpleGeometry& SimpleGeometry,
+                                                                                       const TArray<int32>& Indices, int32& NumRemoved)
+{
+	NumRemoved = SimpleGeometry.Spheres.RemoveMany(Indices);
+	return SimpleGeometry;
+}
+
+FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::RemoveSpheresByName(FRealtimeMeshSimpleGeometry& SimpleGeometry,
+                                                                                             const TArray<FName>& SphereNames, int32& NumRemoved)
+{
+	NumRemoved = SimpleGeometry.Spheres.RemoveManyByName(SphereNames);
+	return SimpleGeometry;
+}
+
 
 // Box Functions
 
@@ -715,6 +1109,40 @@ FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::RemoveB
 	return SimpleGeometry;
 }
 
+FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::AddBoxes(FRealtimeMeshSimpleGeometry& SimpleGeometry,
+                                                                                  const TArray<FRealtimeMeshCollisionBox>& InBoxes, TArray<int32>& OutIndices)
+{
+	SimpleGeometry.Boxes.Append(InBoxes, &OutIndices);
+	return SimpleGeometry;
+}
+
+FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::UpdateBoxes(FRealtimeMeshSimpleGeometry& SimpleGeometry,
+                                                                                     const TArray<int32>& Indices, const TArray<FRealtimeMeshCollisionBox>& InBoxes, int32& NumUpdated)
+{
+	if (Indices.Num() != InBoxes.Num())
+	{
+		UE_LOG(LogRealtimeMeshInterface, Warning, TEXT("UpdateBoxes: Got %d indices but %d shapes"), Indices.Num(), InBoxes.Num());
+		NumUpdated = 0;
+		return SimpleGeometry;
+	}
+	NumUpdated = SimpleGeometry.Boxes.UpdateMany(Indices, InBoxes);
+	return SimpleGeometry;
+}
+
+FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::RemoveBoxes(FRealtimeMeshSimpleGeometry& SimpleGeometry,
+                                                                                     const TArray<int32>& Indices, int32& NumRemoved)
+{
+	NumRemoved = SimpleGeometry.Boxes.RemoveMany(Indices);
+	return SimpleGeometry;
+}
+
+FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::RemoveBoxesByName(FRealtimeMeshSimpleGeometry& SimpleGeometry,
+                                                                                           const TArray<FName>& BoxNames, int32& NumRemoved)
+{
+	NumRemoved = SimpleGeometry.Boxes.RemoveManyByName(BoxNames);
+	return SimpleGeometry;
+}
+
 
 // Capsule Functions
 
@@ -760,6 +1188,40 @@ FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::RemoveC
 	return SimpleGeometry;
 }
 
+FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::AddCapsules(FRealtimeMeshSimpleGeometry& SimpleGeometry,
+                                                                                     const TArray<FRealtimeMeshCollisionCapsule>& InCapsules, TArray<int32>& OutIndices)
+{
+	SimpleGeometry.Capsules.Append(InCapsules, &OutIndices);
+	return SimpleGeometry;
+}
+
+FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::UpdateCapsules(FRealtimeMeshSimpleGeometry& SimpleGeometry,
+                                                                                        const TArray<int32>& Indices, const TArray<FRealtimeMeshCollisionCapsule>& InCapsules, int32& NumUpdated)
+{
+	if (Indices.Num() != InCapsules.Num())
+	{
+		UE_LOG(LogRealtimeMeshInterface, Warning, TEXT("UpdateCapsules: Got %d indices but %d shapes"), Indices.Num(), InCapsules.Num());
+		NumUpdated = 0;
+		return SimpleGeometry;
+	}
+	NumUpdated = SimpleGeometry.Capsules.UpdateMany(Indices, InCapsules);
+	return SimpleGeometry;
+}
+
+FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::RemoveCapsules(FRealtimeMeshSimpleGeometry& SimpleGeometry,
+                                                                                        const TArray<int32>& Indices, int32& NumRemoved)
+{
+	NumRemoved = SimpleGeometry.Capsules.RemoveMany(Indices);
+	return SimpleGeometry;
+}
+
+FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::RemoveCapsulesByName(FRealtimeMeshSimpleGeometry& SimpleGeometry,
+                                                                                              const TArray<FName>& CapsuleNames, int32& NumRemoved)
+{
+	NumRemoved = SimpleGeometry.Capsules.RemoveManyByName(CapsuleNames);
+	return SimpleGeometry;
+}
+
 
 // Tapered Capsule Functions
 
@@ -808,6 +1270,40 @@ FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::RemoveT
 	return SimpleGeometry;
 }
 
+FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::AddTaperedCapsules(FRealtimeMeshSimpleGeometry& SimpleGeometry,
+                                                                                            const TArray<FRealtimeMeshCollisionTaperedCapsule>& InTaperedCapsules, TArray<int32>& OutIndices)
+{
+	SimpleGeometry.TaperedCapsules.Append(InTaperedCapsules, &OutIndices);
+	return SimpleGeometry;
+}
+
+FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::UpdateTaperedCapsules(FRealtimeMeshSimpleGeometry& SimpleGeometry,
+                                                                                               const TArray<int32>& Indices, const TArray<FRealtimeMeshCollisionTaperedCapsule>& InTaperedCapsules, int32& NumUpdated)
+{
+	if (Indices.Num() != InTaperedCapsules.Num())
+	{
+		UE_LOG(LogRealtimeMeshInterface, Warning, TEXT("UpdateTaperedCapsules: Got %d indices but %d shapes"), Indices.Num(), InTaperedCapsules.Num());
+		NumUpdated = 0;
+		return SimpleGeometry;
+	}
+	NumUpdated = SimpleGeometry.TaperedCapsules.UpdateMany(Indices, InTaperedCapsules);
+	return SimpleGeometry;
+}
+
+FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::RemoveTaperedCapsules(FRealtimeMeshSimpleGeometry& SimpleGeometry,
+                                                                                               const TArray<int32>& Indices, int32& NumRemoved)
+{
+	NumRemoved = SimpleGeometry.TaperedCapsules.RemoveMany(Indices);
+	return SimpleGeometry;
+}
+
+FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::RemoveTaperedCapsulesByName(FRealtimeMeshSimpleGeometry& SimpleGeometry,
+                                                                                                     const TArray<FName>& TaperedCapsuleNames, int32& NumRemoved)
+{
+	NumRemoved = SimpleGeometry.TaperedCapsules.RemoveManyByName(TaperedCapsuleNames);
+	return SimpleGeometry;
+}
+
 
 // Convex Functions
 
@@ -853,4 +1349,38 @@ FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::RemoveC
 	return SimpleGeometry;
 }
 
+FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::AddConvexHulls(FRealtimeMeshSimpleGeometry& SimpleGeometry,
+                                                                                        const TArray<FRealtimeMeshCollisionConvex>& InConvexHulls, TArray<int32>& OutIndices)
+{
+	SimpleGeometry.ConvexHulls.Append(InConvexHulls, &OutIndices);
+	return SimpleGeometry;
+}
+
+FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::UpdateConvexHulls(FRealtimeMeshSimpleGeometry& SimpleGeometry,
+                                                                                           const TArray<int32>& Indices, const TArray<FRealtimeMeshCollisionConvex>& InConvexHulls, int32& NumUpdated)
+{
+	if (Indices.Num() != InConvexHulls.Num())
+	{
+		UE_LOG(LogRealtimeMeshInterface, Warning, TEXT("UpdateConvexHulls: Got %d indices but %d shapes"), Indices.Num(), InConvexHulls.Num());
+		NumUpdated = 0;
+		return SimpleGeometry;
+	}
+	NumUpdated = SimpleGeometry.ConvexHulls.UpdateMany(Indices, InConvexHulls);
+	return SimpleGeometry;
+}
+
+FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::RemoveConvexHulls(FRealtimeMeshSimpleGeometry& SimpleGeometry,
+                                                                                           const TArray<int32>& Indices, int32& NumRemoved)
+{
+	NumRemoved = SimpleGeometry.ConvexHulls.RemoveMany(Indices);
+	return SimpleGeometry;
+}
+
+FRealtimeMeshSimpleGeometry& URealtimeMeshSimpleGeometryFunctionLibrary::RemoveConvexHullsByName(FRealtimeMeshSimpleGeometry& SimpleGeometry,
+                                                                                                 const TArray<FName>& ConvexHullNames, int32& NumRemoved)
+{
+	NumRemoved = SimpleGeometry.ConvexHulls.RemoveManyByName(ConvexHullNames);
+	return SimpleGeometry;
+}
+
 
@@ -14,6 +14,8 @@
 #include "RenderProxy/RealtimeMeshNaniteProxyInterface.h"
 #include "RenderProxy/RealtimeMeshProxy.h"
 #include "Net/UnrealNetwork.h"
+#include "SceneInterface.h"
+#include "Async/Async.h"
 
 
 DECLARE_CYCLE_STAT(TEXT("RealtimeMeshComponent - Collision Data Received"), STAT_RealtimeMeshComponent_NewCollisionMeshReceived, STATGROUP_RealtimeMesh);
@@ -134,6 +136,8 @@ FPrimitiveSceneProxy* URealtimeMeshComponent::CreateSceneProxy()
 {
 	SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshComponent_CreateSceneProxy);
 
+	bSceneProxyUsesNanite = false;
+
 	if (IsValid(RealtimeMesh))
 	{		
 		if (const auto MeshRenderProxy = RealtimeMesh->GetMesh()->GetRenderProxy(true))
@@ -144,7 +148,8 @@ FPrimitiveSceneProxy* URealtimeMeshComponent::CreateSceneProxy()
 				RealtimeMesh::IRealtimeMeshNaniteSceneProxyManager& NaniteModule = RealtimeMesh::IRealtimeMeshNaniteSceneProxyManager::GetNaniteModule();
 
 				if (MeshRenderProxy->HasNaniteResources_GT() && NaniteModule.ShouldUseNanite(this))
-				{					
+				{
+					bSceneProxyUsesNanite = true;
 					return RealtimeMesh::IRealtimeMeshNaniteSceneProxyManager::GetNaniteModule().CreateNewSceneProxy(this, MeshRenderProxy.ToSharedRef());
 				}				
 			}
@@ -335,11 +340,55 @@ void URealtimeMeshComponent::HandleBoundsUpdated(URealtimeMesh* InRealtimeMesh)
 
 void URealtimeMeshComponent::HandleMeshRenderingDataChanged(URealtimeMesh* InRealtimeMesh, bool bShouldProxyRecreate)
 {
-	if (bShouldProxyRecreate)
+	if (bShouldProxyRecreate || (SceneProxy && bSceneProxyUsesNanite))
 	{
 		PrecachePSOs();
 		MarkRenderStateDirty();
 	}
+	else if (SceneProxy && GetScene() && IsValid(InRealtimeMesh))
+	{
+		// Static draw data changed in place. The scene only re-caches the batches it already gathered, so once the
+		// pending proxy commands are applied, refresh the cached draws in place when the batches are unchanged and
+		// only recreate the render state when sections, ranges or index buffers moved so the new batches get gathered.
+		if (const auto MeshProxy = InRealtimeMesh->GetMesh()->GetRenderProxy())
+		{
+			ENQUEUE_RENDER_COMMAND(RealtimeMeshStaticMeshUpdate)(
+				[ThisWeak = TWeakObjectPtr<URealtimeMeshComponent>(this), ProxyWeak = MeshProxy.ToWeakPtr(), Scene = GetScene(),
+					StaticProxy = static_cast<RealtimeMesh::FRealtimeMeshComponentSceneProxy*>(SceneProxy)](FRHICommandListImmediate& RHICmdList)
+			{
+				// The scene proxy is released by a render command enqueued after this one, so it is still alive here
+				if (const auto Proxy = ProxyWeak.Pin())
+				{
+					Proxy->ProcessCommands(RHICmdList);
+				}
+
+				if (StaticProxy->HasStaticDrawLayoutChanged())
+				{
+					// Hidden sections and shadows are masked in place, so this is down to sections, ranges, materials or
+					// merged runs changing, and still costs a proxy recreation like any other
+					RealtimeMesh::FRealtimeMeshStatCounters::Get().ProxyRecreateRequests++;
+
+					AsyncTask(ENamedThreads::GameThread, [ThisWeak]()
+					{
+						if (URealtimeMeshComponent* Component = ThisWeak.Get())
+						{
+							Component->PrecachePSOs();
+							Component->MarkRenderStateDirty();
+						}
+					});
+				}
+				else
+				{
+					Scene->UpdateCachedRenderStates(StaticProxy);
+#if RHI_RAYTRACING
+					// Rebuilt or refit geometry is re-cached through the mesh proxy's static ray tracing event, this
+					// picks up material changes on the batches the static ray tracing instance was built from
+					Scene->UpdateCachedRayTracingState(StaticProxy);
+#endif
+				}
+			});
+		}
+	}
 }
 
 void URealtimeMeshComponent::HandleCollisionBodyUpdated(URealtimeMesh* InRealtimeMesh, UBodySetup* BodySetup)
@@ -7,6 +7,22 @@
 #include "RealtimeMeshCore.h"
 
 
+DEFINE_STAT(STAT_RealtimeMesh_CPUStreamMemory);
+DEFINE_STAT(STAT_RealtimeMesh_GPUBufferMemory);
+DEFINE_STAT(STAT_RealtimeMesh_NumGPUBuffers);
+DEFINE_STAT(STAT_RealtimeMesh_GPUBytesUploaded);
+DEFINE_STAT(STAT_RealtimeMesh_ProxyCommandBatches);
+DEFINE_STAT(STAT_RealtimeMesh_ProxyCommands);
+
+CSV_DEFINE_CATEGORY_MODULE(REALTIMEMESHCOMPONENT_API, RealtimeMesh, true);
+
+RealtimeMesh::FRealtimeMeshStatCounters& RealtimeMesh::FRealtimeMeshStatCounters::Get()
+{
+	static FRealtimeMeshStatCounters Counters;
+	return Counters;
+}
+
+
 // Register the custom version with core
 FCustomVersionRegistration GRegisterRealtimeMeshCustomVersion(RealtimeMesh::FRealtimeMeshVersion::GUID, RealtimeMesh::FRealtimeMeshVersion::LatestVersion, TEXT("RealtimeMesh"));
 
@@ -50,6 +50,31 @@ namespace RealtimeMesh
 		OwningMesh = InOwningMesh, Owner = InOwner;
 	}
 
+	void FRealtimeMeshSharedResources::ReportScreenSize(float ScreenSize)
+	{
+		if (!(ScreenSize > 0.0f))
+		{
+			return;
+		}
+
+		// Non negative floats order the same as their bit patterns, so this is an atomic max
+		const float ClampedScreenSize = FMath::Min(ScreenSize, TNumericLimits<float>::Max());
+		uint32 NewBits;
+		FMemory::Memcpy(&NewBits, &ClampedScreenSize, sizeof(uint32));
+		uint32 CurrentBits = ScreenSizeFeedbackBits.load(std::memory_order_relaxed);
+		while (NewBits > CurrentBits && !ScreenSizeFeedbackBits.compare_exchange_weak(CurrentBits, NewBits, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	float FRealtimeMeshSharedResources::ConsumeScreenSizeFeedback()
+	{
+		const uint32 Bits = ScreenSizeFeedbackBits.exchange(0, std::memory_order_relaxed);
+		float ScreenSize;
+		FMemory::Memcpy(&ScreenSize, &Bits, sizeof(float));
+		return ScreenSize;
+	}
+
 	ERHIFeatureLevel::Type FRealtimeMeshSharedResources::GetFeatureLevel() const
 	{
 		if (const auto ProxyPinned = Proxy.Pin()) { return ProxyPinned->GetRHIFeatureLevel(); }
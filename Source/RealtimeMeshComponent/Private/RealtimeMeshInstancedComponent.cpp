@@ -0,0 +1,129 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "RealtimeMeshInstancedComponent.h"
+
+#include "RealtimeMesh.h"
+#include "RenderProxy/RealtimeMeshInstancedComponentProxy.h"
+#include "RenderProxy/RealtimeMeshProxy.h"
+
+DECLARE_CYCLE_STAT(TEXT("RealtimeMeshInstancedComponent - Create Scene Proxy"), STAT_RealtimeMeshInstancedComponent_CreateSceneProxy, STATGROUP_RealtimeMesh);
+
+URealtimeMeshInstancedComponent::URealtimeMeshInstancedComponent()
+{
+}
+
+int32 URealtimeMeshInstancedComponent::AddInstance(const FTransform& InstanceTransform)
+{
+	const int32 InstanceIndex = InstanceTransforms.Add(InstanceTransform);
+	HandleInstancesChanged();
+	return InstanceIndex;
+}
+
+void URealtimeMeshInstancedComponent::AddInstances(const TArray<FTransform>& NewInstanceTransforms)
+{
+	if (NewInstanceTransforms.Num() > 0)
+	{
+		InstanceTransforms.Append(NewInstanceTransforms);
+		HandleInstancesChanged();
+	}
+}
+
+bool URealtimeMeshInstancedComponent::UpdateInstanceTransform(int32 InstanceIndex, const FTransform& NewInstanceTransform)
+{
+	if (!InstanceTransforms.IsValidIndex(InstanceIndex))
+	{
+		return false;
+	}
+
+	InstanceTransforms[InstanceIndex] = NewInstanceTransform;
+	HandleInstancesChanged();
+	return true;
+}
+
+bool URealtimeMeshInstancedComponent::RemoveInstance(int32 InstanceIndex)
+{
+	if (!InstanceTransforms.IsValidIndex(InstanceIndex))
+	{
+		return false;
+	}
+
+	InstanceTransforms.RemoveAt(InstanceIndex);
+	HandleInstancesChanged();
+	return true;
+}
+
+void URealtimeMeshInstancedComponent::ClearInstances()
+{
+	if (InstanceTransforms.Num() > 0)
+	{
+		InstanceTransforms.Empty();
+		HandleInstancesChanged();
+	}
+}
+
+bool URealtimeMeshInstancedComponent::GetInstanceTransform(int32 InstanceIndex, FTransform& OutInstanceTransform) const
+{
+	if (!InstanceTransforms.IsValidIndex(InstanceIndex))
+	{
+		return false;
+	}
+
+	OutInstanceTransform = InstanceTransforms[InstanceIndex];
+	return true;
+}
+
+FBoxSphereBounds URealtimeMeshInstancedComponent::CalcBounds(const FTransform& LocalToWorld) const
+{
+	if (GetRealtimeMesh() && InstanceTransforms.Num() > 0)
+	{
+		const FBoxSphereBounds MeshBounds = FBoxSphereBounds(GetRealtimeMesh()->GetLocalBounds());
+
+		FBox InstancesBox(ForceInit);
+		for (const FTransform& InstanceTransform : InstanceTransforms)
+		{
+			InstancesBox += MeshBounds.TransformBy(InstanceTransform).GetBox();
+		}
+		return FBoxSphereBounds(InstancesBox).TransformBy(LocalToWorld);
+	}
+
+	return FBoxSphereBounds(FSphere(FVector::ZeroVector, 1)).TransformBy(LocalToWorld);
+}
+
+FPrimitiveSceneProxy* URealtimeMeshInstancedComponent::CreateSceneProxy()
+{
+	SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshInstancedComponent_CreateSceneProxy);
+
+	if (GetRealtimeMesh() && InstanceTransforms.Num() > 0)
+	{
+		if (const auto MeshRenderProxy = GetRealtimeMesh()->GetMesh()->GetRenderProxy(true))
+		{
+			return new RealtimeMesh::FRealtimeMeshInstancedSceneProxy(this, MeshRenderProxy.ToSharedRef());
+		}
+	}
+
+	return nullptr;
+}
+
+UBodySetup* URealtimeMeshInstancedComponent::GetBodySetup()
+{
+	// The mesh body is built for a single instance at the component transform
+	return nullptr;
+}
+
+#if WITH_EDITOR
+void URealtimeMeshInstancedComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(URealtimeMeshInstancedComponent, InstanceTransforms))
+	{
+		HandleInstancesChanged();
+	}
+}
+#endif
+
+void URealtimeMeshInstancedComponent::HandleInstancesChanged()
+{
+	UpdateBounds();
+	MarkRenderStateDirty();
+}
@@ -92,6 +92,15 @@ FArchive& operator<<(FArchive& Ar, FRealtimeMeshSectionGroupConfig& Config)
 	{
 		Ar << Config.DrawType;
 	}
+	if (Ar.CustomVer(RealtimeMesh::FRealtimeMeshVersion::GUID) >= RealtimeMesh::FRealtimeMeshVersion::SectionGroupSupportsSectionMerging)
+	{
+		Ar << Config.bMergeCompatibleSections;
+	}
+	if (Ar.CustomVer(RealtimeMesh::FRealtimeMeshVersion::GUID) >= RealtimeMesh::FRealtimeMeshVersion::SectionGroupRayTracingSettings)
+	{
+		Ar << Config.RayTracingBuildQuality;
+		Ar << Config.bAllowRayTracingRefit;
+	}
 	return Ar;
 }
 	
@@ -124,6 +133,12 @@ FArchive& operator<<(FArchive& Ar, FRealtimeMeshCollisionConfiguration& Config)
 	{
 		Ar << Config.bMergeAllMeshes;
 	}
+
+	if (Ar.CustomVer(RealtimeMesh::FRealtimeMeshVersion::GUID) >= RealtimeMesh::FRealtimeMeshVersion::CollisionMeshCleaning)
+	{
+		Ar << Config.bCleanComplexMeshes;
+		Ar << Config.CleanWeldThreshold;
+	}
 	return Ar;
 }
 
@@ -172,6 +187,11 @@ FArchive& operator<<(FArchive& Ar, FRealtimeMeshCollisionConvex& Shape)
 	Ar << static_cast<FRealtimeMeshCollisionShape&>(Shape);
 	Ar << Shape.Vertices;
 	Ar << Shape.BoundingBox;
+
+	if (Ar.CustomVer(RealtimeMesh::FRealtimeMeshVersion::GUID) >= RealtimeMesh::FRealtimeMeshVersion::ConvexHullGeneratedFlag)
+	{
+		Ar << Shape.bGenerated;
+	}
 	return Ar;
 }
 
@@ -15,16 +15,29 @@
 #include "Mesh/RealtimeMeshBlueprintMeshBuilder.h"
 #include "RenderProxy/RealtimeMeshProxy.h"
 #include "Logging/MessageLog.h"
+#include "Data/RealtimeMeshResidency.h"
+#include "Async/ParallelFor.h"
+#include "Serialization/BulkData.h"
+#include "IO/IoDispatcher.h"
+#include "RenderProxy/RealtimeMeshRayTracing.h"
+#include "RenderUtils.h"
 
 #define LOCTEXT_NAMESPACE "RealtimeMeshSimple"
 
 using namespace RealtimeMesh;
 
+static TAutoConsoleVariable<int32> CVarRealtimeMeshCollisionMaxConsecutiveCookCancels(
+	TEXT("RealtimeMesh.Collision.MaxConsecutiveCookCancels"),
+	4,
+	TEXT("Number of times in a row a running collision cook can be cancelled by a newer request before one is allowed to finish. 0 never cancels a running cook, newer requests then just wait for it"));
+
 namespace RealtimeMesh
 {
 	namespace Simple::Private
 	{
 		static thread_local bool bShouldDeferPolyGroupUpdates = false;		
+
+		static std::atomic<uint32> NextStreamVersion(1);
 	}	
 	
 	FRealtimeMeshSectionSimple::FRealtimeMeshSectionSimple(const FRealtimeMeshSharedResourcesRef& InSharedResources, const FRealtimeMeshSectionKey& InKey)
@@ -150,6 +163,12 @@ namespace RealtimeMesh
 		}
 	}
 
+	FRealtimeMeshSectionGroupSimple::~FRealtimeMeshSectionGroupSimple()
+	{
+		Streams.Empty();
+		UpdateStreamMemoryStats();
+	}
+
 	void FRealtimeMeshSectionGroupSimple::ClearPolyGroupSectionHandler(FRealtimeMeshUpdateContext& UpdateContext)
 	{
 		ConfigHandler = FRealtimeMeshPolyGroupConfigHandler::CreateSP(this, &FRealtimeMeshSectionGroupSimple::DefaultPolyGroupSectionHandler);
@@ -178,12 +197,15 @@ namespace RealtimeMesh
 								  FText::FromString(UpdatedStream.ToString()), FText::FromName(SharedResources->GetMeshName())));
 			}
 		}
+
+		MarkStreamsChanged(UpdatedStreams.Contains(FRealtimeMeshStreams::Triangles));
 	}
 
 	void FRealtimeMeshSectionGroupSimple::CreateOrUpdateStream(FRealtimeMeshUpdateContext& UpdateContext, FRealtimeMeshStream&& Stream)
 	{
 		// Replace the stored stream (We allow this to copy as we then pass the stream to the RT command queue)
 		Streams.AddStream(Stream);
+		MarkStreamsChanged(Stream.GetStreamKey() == FRealtimeMeshStreams::Triangles);
 		
 		// If this stream is a segments stream or polygon group stream lets update the sections
 		if (bAutoCreateSectionsForPolygonGroups && !Simple::Private::bShouldDeferPolyGroupUpdates)
@@ -216,6 +238,7 @@ namespace RealtimeMesh
 				FText::Format(LOCTEXT("RemoveStreamInvalid", "Attempted to remove invalid stream {0} in Mesh:{1}"),
 				              FText::FromString(StreamKey.ToString()), FText::FromName(SharedResources->GetMeshName())));
 		}
+		MarkStreamsChanged(StreamKey == FRealtimeMeshStreams::Triangles);
 
 		FRealtimeMeshSectionGroup::RemoveStream(UpdateContext, StreamKey);
 	}
@@ -269,10 +292,7 @@ namespace RealtimeMesh
 					const auto UpdateData = MakeShared<FRealtimeMeshSectionGroupStreamUpdateData>(MoveTemp(Copy), EBufferUsageFlags::Static);
 					UpdateData->CreateBufferAsyncIfPossible(UpdateContext);
 
-					ProxyBuilder->AddSectionGroupTask(Key, [UpdateData](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
-					{
-						Proxy.CreateOrUpdateStream(RHICmdList, UpdateData);
-					}, ShouldRecreateProxyOnChange(UpdateContext));
+					ProxyBuilder->AddCreateOrUpdateStreamCommand(Key, Handle, UpdateData, ShouldRecreateProxyOnChange(UpdateContext));
 				}
 			}
 		});
@@ -280,19 +300,165 @@ namespace RealtimeMesh
 		FRealtimeMeshSectionGroup::InitializeProxy(UpdateContext);
 	}
 
+	void FRealtimeMeshSectionGroupSimple::FinalizeUpdate(FRealtimeMeshUpdateContext& UpdateContext)
+	{
+		FRealtimeMeshSectionGroup::FinalizeUpdate(UpdateContext);
+
+#if RHI_RAYTRACING
+		// The proxy only keeps a CPU copy of the triangles while the visible sections have gaps for ray tracing to compact
+		// away. When a section change opens up gaps without new triangles going along with it, send it a copy.
+		const auto ProxyBuilder = UpdateContext.GetProxyBuilder();
+		const FRealtimeMeshStream* Triangles = Streams.Find(FRealtimeMeshStreams::Triangles);
+		if (!ProxyBuilder || !Triangles || Triangles->Num() == 0 || !IsRayTracingEnabled())
+		{
+			return;
+		}
+
+		const FRealtimeMeshUpdateState& State = UpdateContext.GetState();
+		if (State.StreamDirtyTree.HasDirtyStreams(Key) && State.StreamDirtyTree.GetDirtyStreams(Key).Contains(FRealtimeMeshStreams::Triangles))
+		{
+			return;
+		}
+
+		bool bSectionsChanged = State.ConfigDirtyTree.IsDirty(Key);
+		TArray<FRealtimeMeshStreamRange, TInlineAllocator<8>> VisibleRanges;
+		for (const FRealtimeMeshSectionRef& Section : Sections)
+		{
+			const FRealtimeMeshSectionConfig SectionConfig = Section->GetConfig(UpdateContext);
+			if (SectionConfig.bIsVisible && SectionConfig.bIsMainPassRenderable)
+			{
+				VisibleRanges.Add(Section->GetStreamRange(UpdateContext));
+			}
+			bSectionsChanged |= State.StreamRangeDirtyTree.IsDirty(Section->GetKey(UpdateContext));
+		}
+
+		if (bSectionsChanged && !FRealtimeMeshRayTracingIndexCompactor::AreRangesContiguous(VisibleRanges))
+		{
+			const TSharedRef<const FRealtimeMeshStream> IndexSource = MakeShared<FRealtimeMeshStream>(*Triangles);
+			ProxyBuilder->AddSectionGroupTask(Key, Handle, [IndexSource](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
+			{
+				Proxy.SetRayTracingIndexSource(IndexSource);
+			}, false);
+		}
+#endif
+	}
+
 	void FRealtimeMeshSectionGroupSimple::Reset(FRealtimeMeshUpdateContext& UpdateContext)
 	{
 		Streams.Empty();
+		MarkStreamsChanged(true);
 		FRealtimeMeshSectionGroup::Reset(UpdateContext);
 	}
 
+	bool FRealtimeMeshSectionGroupSimple::HasCollisionSections(const FRealtimeMeshLockContext& LockContext) const
+	{
+		for (const FRealtimeMeshSectionRef& Section : Sections)
+		{
+			if (StaticCastSharedRef<FRealtimeMeshSectionSimple>(Section)->HasCollision(LockContext))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool FRealtimeMeshSectionGroupSimple::CanEvictStreams(const FRealtimeMeshLockContext& LockContext) const
+	{
+		return !AreStreamsEvicted(LockContext) && TrackedStreamMemory > 0 && !HasCollisionSections(LockContext);
+	}
+
+	FRealtimeMeshStreamSet FRealtimeMeshSectionGroupSimple::EvictStreams(FRealtimeMeshUpdateContext& UpdateContext)
+	{
+		FRealtimeMeshStreamSet EvictedStreams = MoveTemp(Streams);
+		Streams.Empty();
+
+		// Only the GPU side is told, the stream keys stay registered and nothing is flagged dirty so bounds and collision hold
+		if (auto ProxyBuilder = UpdateContext.GetProxyBuilder())
+		{
+			EvictedStreams.ForEach([&](const FRealtimeMeshStream& Stream)
+			{
+				if (SharedResources->WantsStreamOnGPU(Stream.GetStreamKey()))
+				{
+					ProxyBuilder->AddRemoveStreamCommand(Key, Handle, Stream.GetStreamKey(), false);
+				}
+			});
+
+			if (ShouldUpdateStaticMeshesOnChange(UpdateContext))
+			{
+				ProxyBuilder->MarkForStaticMeshUpdate();
+			}
+		}
+
+		MarkStreamsChanged(true);
+		EvictedStreamVersion = StreamVersion;
+		return EvictedStreams;
+	}
+
+	bool FRealtimeMeshSectionGroupSimple::RestoreStreams(FRealtimeMeshUpdateContext& UpdateContext, FRealtimeMeshStreamSet&& InStreams)
+	{
+		if (!AreStreamsEvicted(UpdateContext))
+		{
+			return false;
+		}
+
+		Streams = MoveTemp(InStreams);
+		MarkStreamsChanged(true);
+		EvictedStreamVersion = 0;
+
+		Streams.ForEach([&](const FRealtimeMeshStream& Stream)
+		{
+			if (SharedResources->WantsStreamOnGPU(Stream.GetStreamKey()) && Stream.Num() > 0)
+			{
+				if (auto ProxyBuilder = UpdateContext.GetProxyBuilder())
+				{
+					FRealtimeMeshStream Copy(Stream);
+					const auto UpdateData = MakeShared<FRealtimeMeshSectionGroupStreamUpdateData>(MoveTemp(Copy), EBufferUsageFlags::Static);
+					UpdateData->CreateBufferAsyncIfPossible(UpdateContext);
+
+					ProxyBuilder->AddCreateOrUpdateStreamCommand(Key, Handle, UpdateData, ShouldRecreateProxyOnChange(UpdateContext));
+				}
+			}
+		});
+
+		if (auto ProxyBuilder = UpdateContext.GetProxyBuilder())
+		{
+			if (ShouldUpdateStaticMeshesOnChange(UpdateContext))
+			{
+				ProxyBuilder->MarkForStaticMeshUpdate();
+			}
+		}
+		return true;
+	}
+
 	bool FRealtimeMeshSectionGroupSimple::Serialize(FArchive& Ar)
 	{
+		if (Ar.IsSaving() && EvictedStreamVersion != 0 && EvictedStreamVersion == StreamVersion)
+		{
+			// The mesh restores residency's LODs before saving, so this is only reached when saving off the game thread
+			UE_LOG(LogRealtimeMesh, Warning, TEXT("Saving section group %s of mesh %s while LOD residency has its streams evicted, they are saved empty"),
+				*Key.ToString(), *SharedResources->GetMeshName().ToString());
+		}
+
 		const bool bResult = FRealtimeMeshSectionGroup::Serialize(Ar);
 
 		if (ensure(bResult))
 		{
-			Ar << Streams;
+			if (StaticCastSharedRef<FRealtimeMeshSharedResourcesSimple>(SharedResources)->ShouldSerializeStreamsAsBulkData(Ar))
+			{
+				// The payloads follow the rest of the mesh, see FRealtimeMeshSimple::SerializeStreamBulkData. Until they are decoded the
+				// group is left as if evicted, so they come back through RestoreStreams like any other evicted streams.
+				if (Ar.IsLoading())
+				{
+					Streams.Empty();
+					MarkStreamsChanged(true);
+					EvictedStreamVersion = StreamVersion;
+				}
+			}
+			else
+			{
+				Ar << Streams;
+				MarkStreamsChanged(true);
+			}
 		}
 
 		return bResult;
@@ -420,6 +586,40 @@ namespace RealtimeMesh
 			(Sections.Num() == 0 || (Sections.Num() == 1 && Sections.Contains(FRealtimeMeshSectionKey::CreateForPolyGroup(Key, 0))));
 	}
 
+	void FRealtimeMeshSectionGroupSimple::UpdateStreamMemoryStats()
+	{
+		SIZE_T NewStreamMemory = 0;
+		Streams.ForEach([&](const FRealtimeMeshStream& Stream)
+		{
+			NewStreamMemory += Stream.GetAllocatedSize();
+		});
+
+		if (NewStreamMemory != TrackedStreamMemory)
+		{
+			const int64 Delta = static_cast<int64>(NewStreamMemory) - static_cast<int64>(TrackedStreamMemory);
+			if (Delta > 0)
+			{
+				INC_MEMORY_STAT_BY(STAT_RealtimeMesh_CPUStreamMemory, Delta);
+			}
+			else
+			{
+				DEC_MEMORY_STAT_BY(STAT_RealtimeMesh_CPUStreamMemory, -Delta);
+			}
+			FRealtimeMeshStatCounters::Get().CPUStreamMemory += Delta;
+			TrackedStreamMemory = NewStreamMemory;
+		}
+	}
+
+	void FRealtimeMeshSectionGroupSimple::MarkStreamsChanged(bool bTrianglesChanged)
+	{
+		StreamVersion = Simple::Private::NextStreamVersion.fetch_add(1, std::memory_order_relaxed);
+		if (bTrianglesChanged)
+		{
+			TopologyVersion = StreamVersion;
+		}
+		UpdateStreamMemoryStats();
+	}
+
 	bool FRealtimeMeshLODSimple::GenerateComplexCollision(const FRealtimeMeshLockContext& LockContext, FRealtimeMeshComplexGeometry& ComplexGeometry) const
 	{
 		bool bHasSectionData = false;
@@ -436,6 +636,20 @@ namespace RealtimeMesh
 		return bHasSectionData;
 	}
 
+	bool FRealtimeMeshLODSimple::CanEvictStreams(const FRealtimeMeshLockContext& LockContext) const
+	{
+		for (const auto& SectionGroup : SectionGroups)
+		{
+			const auto& SimpleSectionGroup = StaticCastSharedRef<FRealtimeMeshSectionGroupSimple>(SectionGroup);
+			if (!SimpleSectionGroup->CanEvictStreams(LockContext) && !SimpleSectionGroup->AreStreamsEvicted(LockContext) &&
+				SimpleSectionGroup->GetStreamMemory(LockContext) > 0)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
 
 	FRealtimeMeshRef FRealtimeMeshSharedResourcesSimple::CreateRealtimeMesh() const
 	{
@@ -534,6 +748,91 @@ namespace RealtimeMesh
 		return MarkCollisionDirty();
 	}
 
+	void FRealtimeMeshSimple::ProcessSimpleGeometry(TFunctionRef<void(const FRealtimeMeshSimpleGeometry&)> ProcessFunc) const
+	{
+		FRealtimeMeshScopeGuardRead ScopeGuard(SharedResources->GetGuard());
+		ProcessFunc(SimpleGeometry);
+	}
+
+	TFuture<ERealtimeMeshCollisionUpdateResult> FRealtimeMeshSimple::EditSimpleGeometry(TFunctionRef<bool(FRealtimeMeshSimpleGeometry&)> EditFunc)
+	{
+		FRealtimeMeshScopeGuardWrite ScopeGuard(SharedResources->GetGuard());
+		if (!EditFunc(SimpleGeometry))
+		{
+			return MakeFulfilledPromise<ERealtimeMeshCollisionUpdateResult>(ERealtimeMeshCollisionUpdateResult::Ignored).GetFuture();
+		}
+		return MarkCollisionDirty();
+	}
+
+	TFuture<ERealtimeMeshCollisionUpdateResult> FRealtimeMeshSimple::GenerateConvexDecomposition(FRealtimeMeshLODKey LODKey, const FRealtimeMeshConvexDecompositionSettings& Settings)
+	{
+		// Copy the whole LOD out into one soup, the decomposition runs off the lock
+		TArray<FVector3f> Positions;
+		TArray<TIndex3<int32>> Triangles;
+		{
+			FRealtimeMeshAccessContext LockContext(this->AsShared());
+			const TSharedPtr<FRealtimeMeshLODSimple> LOD = GetLODAs<FRealtimeMeshLODSimple>(LockContext, LODKey);
+			if (!LOD.IsValid())
+			{
+				return MakeFulfilledPromise<ERealtimeMeshCollisionUpdateResult>(ERealtimeMeshCollisionUpdateResult::Error).GetFuture();
+			}
+
+			for (const FRealtimeMeshSectionGroupKey& SectionGroupKey : LOD->GetSectionGroupKeys(LockContext))
+			{
+				const TSharedPtr<FRealtimeMeshSectionGroupSimple> SectionGroup = LOD->GetSectionGroupAs<FRealtimeMeshSectionGroupSimple>(LockContext, SectionGroupKey);
+				SectionGroup->ProcessMeshData(LockContext, [&Positions, &Triangles](const FRealtimeMeshStreamSet& Streams)
+				{
+					const FRealtimeMeshStream* PositionStream = Streams.Find(FRealtimeMeshStreams::Position);
+					const FRealtimeMeshStream* TriangleStream = Streams.Find(FRealtimeMeshStreams::Triangles);
+					if (!PositionStream || !TriangleStream || !PositionStream->CanConvertTo<FVector3f>() || !TriangleStream->CanConvertTo<TIndex3<int32>>())
+					{
+						return;
+					}
+
+					const int32 BaseVertex = Positions.Num();
+					const int32 FirstTriangle = Triangles.Num();
+					PositionStream->CopyTo(Positions);
+					TriangleStream->CopyTo(Triangles);
+					for (int32 Index = FirstTriangle; Index < Triangles.Num(); Index++)
+					{
+						const TIndex3<int32> Triangle = Triangles[Index];
+						Triangles[Index] = TIndex3<int32>(Triangle.V0 + BaseVertex, Triangle.V1 + BaseVertex, Triangle.V2 + BaseVertex);
+					}
+				});
+			}
+		}
+
+		auto Promise = MakeShared<TPromise<ERealtimeMeshCollisionUpdateResult>>();
+		auto Future = Promise->GetFuture();
+
+		auto ThisWeak = StaticCastWeakPtr<FRealtimeMeshSimple>(this->AsWeak());
+		Async(EAsyncExecution::TaskGraph, [ThisWeak, Settings, Positions = MoveTemp(Positions), Triangles = MoveTemp(Triangles), Promise]() mutable
+		{
+			TArray<FRealtimeMeshCollisionConvex> Hulls = FRealtimeMeshConvexDecomposition::Compute(Positions, Triangles, Settings);
+
+			const auto ThisShared = ThisWeak.Pin();
+			if (!ThisShared)
+			{
+				Promise->SetValue(ERealtimeMeshCollisionUpdateResult::Ignored);
+				return;
+			}
+
+			TFuture<ERealtimeMeshCollisionUpdateResult> CollisionFuture;
+			{
+				FRealtimeMeshScopeGuardWrite ScopeGuard(ThisShared->SharedResources->GetGuard());
+				FRealtimeMeshConvexDecomposition::ReplaceGeneratedHulls(ThisShared->SimpleGeometry, MoveTemp(Hulls));
+				CollisionFuture = ThisShared->MarkCollisionDirty();
+			}
+
+			CollisionFuture.Next([Promise](ERealtimeMeshCollisionUpdateResult Result)
+			{
+				Promise->SetValue(Result);
+			});
+		});
+
+		return Future;
+	}
+
 	TFuture<ERealtimeMeshCollisionUpdateResult> FRealtimeMeshSimple::ClearCustomComplexMeshGeometry()
 	{
 		FRealtimeMeshScopeGuardWrite ScopeGuard(SharedResources->GetGuard());
@@ -644,6 +943,221 @@ namespace RealtimeMesh
 		FRealtimeMesh::ClearCardRepresentation(UpdateContext);
 	}
 
+	TFuture<FRealtimeMeshSpatialIndexPtr> FRealtimeMeshSimple::UpdateSpatialIndex(FRealtimeMeshLODKey LODKey) const
+	{
+		FRealtimeMeshSpatialIndexPtr PreviousIndex;
+		uint32 BuildGeneration;
+		{
+			FScopeLock Lock(&SpatialIndexLock);
+			if (const FSpatialIndexState* State = SpatialIndices.Find(LODKey))
+			{
+				PreviousIndex = State->Index;
+			}
+			BuildGeneration = SpatialIndexGeneration;
+		}
+
+		TMap<FRealtimeMeshSectionGroupKey, FRealtimeMeshSpatialIndexGroupRef> PreviousGroups;
+		if (PreviousIndex)
+		{
+			for (const FRealtimeMeshSpatialIndexGroupRef& Group : PreviousIndex->GetGroups())
+			{
+				PreviousGroups.Add(Group->GetKey(), Group);
+			}
+		}
+
+		// Only the groups whose streams changed are copied out, the rest are carried over from the previous index.
+		// Groups where just the vertices moved keep their triangles from the previous index as well.
+		TArray<FRealtimeMeshSpatialIndexSource> ChangedSources;
+		TArray<FRealtimeMeshSpatialIndexGroupRef> UnchangedGroups;
+		{
+			FRealtimeMeshAccessContext LockContext(this->AsShared());
+			const TSharedPtr<FRealtimeMeshLODSimple> LOD = GetLODAs<FRealtimeMeshLODSimple>(LockContext, LODKey);
+			if (!LOD.IsValid())
+			{
+				return MakeFulfilledPromise<FRealtimeMeshSpatialIndexPtr>(nullptr).GetFuture();
+			}
+
+			for (const FRealtimeMeshSectionGroupKey& SectionGroupKey : LOD->GetSectionGroupKeys(LockContext))
+			{
+				const TSharedPtr<FRealtimeMeshSectionGroupSimple> SectionGroup = LOD->GetSectionGroupAs<FRealtimeMeshSectionGroupSimple>(LockContext, SectionGroupKey);
+				const uint32 StreamVersion = SectionGroup->GetStreamVersion(LockContext);
+
+				const FRealtimeMeshSpatialIndexGroupRef* PreviousGroup = PreviousGroups.Find(SectionGroupKey);
+				if (PreviousGroup && (*PreviousGroup)->GetStreamVersion() == StreamVersion)
+				{
+					UnchangedGroups.Add(*PreviousGroup);
+					continue;
+				}
+
+				// Groups without usable triangles still get an empty entry, so the index knows it's up to date with them
+				FRealtimeMeshSpatialIndexSource& Source = ChangedSources.AddDefaulted_GetRef();
+				Source.Key = SectionGroupKey;
+				Source.StreamVersion = StreamVersion;
+				Source.TopologyVersion = SectionGroup->GetTopologyVersion(LockContext);
+				if (PreviousGroup && (*PreviousGroup)->GetTopologyVersion() == Source.TopologyVersion)
+				{
+					Source.RefitFrom = *PreviousGroup;
+				}
+				SectionGroup->ProcessMeshData(LockContext, [&Source](const FRealtimeMeshStreamSet& Streams)
+				{
+					Source.Gather(Streams);
+				});
+			}
+		}
+
+		if (PreviousIndex && ChangedSources.Num() == 0 && UnchangedGroups.Num() == PreviousIndex->GetGroups().Num())
+		{
+			return MakeFulfilledPromise<FRealtimeMeshSpatialIndexPtr>(PreviousIndex).GetFuture();
+		}
+
+		uint32 BuildSerial;
+		{
+			FScopeLock Lock(&SpatialIndexLock);
+			FSpatialIndexState& State = SpatialIndices.FindOrAdd(LODKey);
+			BuildSerial = ++State.NextSerial;
+			State.NumBuildsInFlight++;
+		}
+
+		auto ThisWeak = StaticCastWeakPtr<const FRealtimeMeshSimple>(this->AsWeak());
+		return Async(EAsyncExecution::TaskGraph, [ThisWeak, LODKey, BuildSerial, BuildGeneration, ChangedSources = MoveTemp(ChangedSources), UnchangedGroups = MoveTemp(UnchangedGroups)]() mutable
+		{
+			FRealtimeMeshSpatialIndexPtr NewIndex = FRealtimeMeshSpatialIndex::Build(LODKey, MoveTemp(ChangedSources), MoveTemp(UnchangedGroups));
+
+			if (const auto ThisShared = ThisWeak.Pin())
+			{
+				FScopeLock Lock(&ThisShared->SpatialIndexLock);
+				FSpatialIndexState& State = ThisShared->SpatialIndices.FindOrAdd(LODKey);
+				State.NumBuildsInFlight--;
+
+				// The mesh was reset while this built, so it describes data that no longer exists
+				if (BuildGeneration != ThisShared->SpatialIndexGeneration)
+				{
+					return FRealtimeMeshSpatialIndexPtr();
+				}
+
+				if (BuildSerial > State.IndexSerial)
+				{
+					State.Index = NewIndex;
+					State.IndexSerial = BuildSerial;
+				}
+			}
+
+			return NewIndex;
+		});
+	}
+
+	FRealtimeMeshSpatialIndexPtr FRealtimeMeshSimple::GetSpatialIndex(FRealtimeMeshLODKey LODKey, bool bWaitForUpToDate) const
+	{
+		if (bWaitForUpToDate)
+		{
+			return UpdateSpatialIndex(LODKey).Get();
+		}
+
+		FRealtimeMeshSpatialIndexPtr CurrentIndex;
+		bool bIsBuilding = false;
+		{
+			FScopeLock Lock(&SpatialIndexLock);
+			if (const FSpatialIndexState* State = SpatialIndices.Find(LODKey))
+			{
+				CurrentIndex = State->Index;
+				bIsBuilding = State->NumBuildsInFlight > 0;
+			}
+		}
+
+		// Let a running build finish before starting another, the next query picks up anything it missed
+		if (!bIsBuilding)
+		{
+			UpdateSpatialIndex(LODKey);
+		}
+
+		return CurrentIndex;
+	}
+
+	void FRealtimeMeshSimple::SetLODResidencyEnabled(bool bEnabled)
+	{
+		check(IsInGameThread());
+		const TSharedRef<FRealtimeMeshSimple> ThisShared = StaticCastSharedRef<FRealtimeMeshSimple>(this->AsShared());
+		if (bEnabled)
+		{
+			FRealtimeMeshResidencyManager::Get().Register(ThisShared);
+		}
+		else
+		{
+			FRealtimeMeshResidencyManager::Get().Unregister(ThisShared);
+		}
+	}
+
+	bool FRealtimeMeshSimple::IsLODResidencyEnabled() const
+	{
+		return FRealtimeMeshResidencyManager::Get().IsRegistered(*this);
+	}
+
+	void FRealtimeMeshSimple::GetLODResidencyInfo(TFixedLODArray<float>& OutScreenSizes, TFixedLODArray<int64>& OutEvictableMemory) const
+	{
+		OutScreenSizes.Reset();
+		OutEvictableMemory.Reset();
+
+		FRealtimeMeshAccessContext LockContext(this->AsShared());
+		for (const FRealtimeMeshLODRef& LOD : LODs)
+		{
+			const FRealtimeMeshLODConfig Config = LOD->GetConfig(LockContext);
+			OutScreenSizes.Add(Config.bIsVisible ? Config.ScreenSize : -1.0f);
+
+			int64 EvictableMemory = 0;
+			if (StaticCastSharedRef<FRealtimeMeshLODSimple>(LOD)->CanEvictStreams(LockContext))
+			{
+				for (const FRealtimeMeshSectionGroupKey& SectionGroupKey : LOD->GetSectionGroupKeys(LockContext))
+				{
+					const TSharedPtr<FRealtimeMeshSectionGroupSimple> SectionGroup = LOD->GetSectionGroupAs<FRealtimeMeshSectionGroupSimple>(LockContext, SectionGroupKey);
+					if (SectionGroup->CanEvictStreams(LockContext))
+					{
+						EvictableMemory += SectionGroup->GetStreamMemory(LockContext);
+					}
+				}
+			}
+			OutEvictableMemory.Add(EvictableMemory);
+		}
+	}
+
+	TArray<FRealtimeMeshEvictedSectionGroup> FRealtimeMeshSimple::EvictLODStreams(FRealtimeMeshLODKey LODKey)
+	{
+		TArray<FRealtimeMeshEvictedSectionGroup> Evicted;
+
+		FRealtimeMeshUpdateContext UpdateContext(this->AsShared());
+		const TSharedPtr<FRealtimeMeshLODSimple> LOD = GetLODAs<FRealtimeMeshLODSimple>(UpdateContext, LODKey);
+		if (LOD && LOD->CanEvictStreams(UpdateContext))
+		{
+			for (const FRealtimeMeshSectionGroupKey& SectionGroupKey : LOD->GetSectionGroupKeys(UpdateContext))
+			{
+				const TSharedPtr<FRealtimeMeshSectionGroupSimple> SectionGroup = LOD->GetSectionGroupAs<FRealtimeMeshSectionGroupSimple>(UpdateContext, SectionGroupKey);
+				if (SectionGroup->CanEvictStreams(UpdateContext))
+				{
+					Evicted.Add({ SectionGroupKey, SectionGroup->EvictStreams(UpdateContext) });
+				}
+			}
+		}
+		UpdateContext.Commit();
+
+		return Evicted;
+	}
+
+	int32 FRealtimeMeshSimple::RestoreLODStreams(TArray<FRealtimeMeshEvictedSectionGroup>&& SectionGroups)
+	{
+		int32 NumRestored = 0;
+
+		FRealtimeMeshUpdateContext UpdateContext(this->AsShared());
+		for (FRealtimeMeshEvictedSectionGroup& Evicted : SectionGroups)
+		{
+			if (const TSharedPtr<FRealtimeMeshSectionGroupSimple> SectionGroup = GetSectionGroupAs<FRealtimeMeshSectionGroupSimple>(UpdateContext, Evicted.SectionGroupKey))
+			{
+				NumRestored += SectionGroup->RestoreStreams(UpdateContext, MoveTemp(Evicted.Streams)) ? 1 : 0;
+			}
+		}
+		UpdateContext.Commit();
+
+		return NumRestored;
+	}
+
 	bool FRealtimeMeshSimple::GenerateComplexCollision(const FRealtimeMeshLockContext& LockContext, FRealtimeMeshComplexGeometry& OutComplexGeometry) const
 	{
 		// Copy any custom complex geometry
@@ -696,6 +1210,15 @@ namespace RealtimeMesh
 		FRealtimeMeshScopeGuardWrite ScopeGuard(SharedResources->GetGuard());
 		CollisionConfig = FRealtimeMeshCollisionConfiguration();
 		SimpleGeometry = FRealtimeMeshSimpleGeometry();
+
+		{
+			FScopeLock Lock(&SpatialIndexLock);
+			for (auto& SpatialIndex : SpatialIndices)
+			{
+				SpatialIndex.Value.Index.Reset();
+			}
+			SpatialIndexGeneration++;
+		}
 		
 		FRealtimeMesh::Reset(UpdateContext, bRemoveRenderProxy);
 
@@ -706,6 +1229,7 @@ namespace RealtimeMesh
 	void FRealtimeMeshSimple::FinalizeUpdate(FRealtimeMeshUpdateContext& UpdateContext)
 	{
 		FRealtimeMesh::FinalizeUpdate(UpdateContext);
+		ResidencyInfoVersion.fetch_add(1, std::memory_order_release);
 		
 		if (UpdateContext.GetState<FRealtimeMeshSimpleUpdateState>().CollisionGroupDirtySet.HasAnyDirty())
 		{
@@ -717,93 +1241,400 @@ namespace RealtimeMesh
 		{
 			TOptional<FBoxSphereBounds3f> NewBounds;
 
-			// Get nanite bounds
-			if (NaniteResources && NaniteResources->HasValidData())
+			// Get nanite bounds
+			if (NaniteResources && NaniteResources->HasValidData())
+			{
+				NewBounds = FBoxSphereBounds3f(NaniteResources->GetBounds());
+			}
+
+			// Add existing computed bounds
+			if (NewBounds && Bounds.HasComputedBounds())
+			{
+				NewBounds = *NewBounds + Bounds.GetComputedBounds();				
+			}
+
+			if (NewBounds)
+			{
+				Bounds.SetComputedBounds(*NewBounds);
+			}
+		}
+	}
+
+	bool FRealtimeMeshSimple::Serialize(FArchive& Ar, URealtimeMesh* Owner)
+	{
+		// Saving needs every stream in place, and a reload must not have the last load restore into the new section groups
+		FlushPendingStreamLoad();
+		if (Ar.IsSaving() && IsInGameThread())
+		{
+			FRealtimeMeshResidencyManager::Get().RestoreEvictedLODs(StaticCastSharedRef<FRealtimeMeshSimple>(this->AsShared()));
+		}
+
+		const TSharedRef<FRealtimeMeshSharedResourcesSimple> SimpleResources = StaticCastSharedRef<FRealtimeMeshSharedResourcesSimple>(SharedResources);
+		if (Ar.CustomVer(FRealtimeMeshVersion::GUID) >= FRealtimeMeshVersion::StreamBulkDataStorage)
+		{
+			uint8 StreamStorage = static_cast<uint8>(SimpleResources->GetStreamStorage());
+			Ar << StreamStorage;
+			SimpleResources->SetStreamStorage(static_cast<ERealtimeMeshStreamStorage>(StreamStorage));
+		}
+		else if (Ar.IsLoading())
+		{
+			SimpleResources->SetStreamStorage(ERealtimeMeshStreamStorage::Inline);
+		}
+
+		const bool bResult = FRealtimeMesh::Serialize(Ar, Owner);
+
+		if (Ar.CustomVer(FRealtimeMeshVersion::GUID) >= FRealtimeMeshVersion::SimpleMeshStoresCollisionConfig)
+		{
+			Ar << CollisionConfig;
+			Ar << SimpleGeometry;
+		}
+
+		if (Ar.CustomVer(FRealtimeMeshVersion::GUID) >= FRealtimeMeshVersion::SimpleMeshStoresCustomComplexCollision)
+		{
+			if (Ar.CustomVer(FRealtimeMeshVersion::GUID) >= FRealtimeMeshVersion::CollisionOverhaul)
+			{
+				Ar << ComplexGeometry;
+			}
+			else
+			{
+				check(Ar.IsLoading())
+				FRealtimeMeshStreamSet ComplexMeshGeometry;
+				int32 NumStreams = ComplexMeshGeometry.Num();
+				Ar << NumStreams;
+
+				ComplexMeshGeometry.Empty();
+				for (int32 Index = 0; Index < NumStreams; Index++)
+				{
+					FRealtimeMeshStreamKey StreamKey;
+					Ar << StreamKey;
+					FRealtimeMeshStream Stream;
+					Ar << Stream;
+					Stream.SetStreamKey(StreamKey);
+
+					ComplexMeshGeometry.AddStream(MoveTemp(Stream));
+				}
+				
+				FRealtimeMeshCollisionMesh CollisionMesh;
+				URealtimeMeshCollisionTools::AppendStreamsToCollisionMesh(CollisionMesh, ComplexMeshGeometry, 0);
+				ComplexGeometry.Add(MoveTemp(CollisionMesh));
+			}
+		}
+
+		if (Ar.CustomVer(FRealtimeMeshVersion::GUID) >= FRealtimeMeshVersion::DistanceFieldAndCardRepresentationSupport)
+		{
+			DistanceField.Serialize(Ar, Owner);
+
+			bool bHasCardRepresentation = CardRepresentation.IsValid();
+			Ar << bHasCardRepresentation;
+			if (bHasCardRepresentation)
+			{
+				if (Ar.IsLoading() && !CardRepresentation.IsValid())
+				{
+					CardRepresentation = MakeUnique<FRealtimeMeshCardRepresentation>();
+				}
+				
+				CardRepresentation->Serialize(Ar, Owner);				
+			}
+			else
+			{
+				CardRepresentation.Reset();
+			}
+		}
+
+		if (SimpleResources->ShouldSerializeStreamsAsBulkData(Ar))
+		{
+			SerializeStreamBulkData(Ar, Owner);
+		}
+
+		if (Ar.IsLoading() && RenderProxy)
+		{
+			MarkCollisionDirtyNoCallback();
+		}
+
+		return bResult;
+	}
+
+	namespace Simple::Private
+	{
+		struct FStreamBulkDataEntry
+		{
+			FRealtimeMeshStreamKey StreamKey;
+			FRealtimeMeshBufferLayout Layout;
+			int32 Num = 0;
+			int64 Offset = 0;
+
+			friend FArchive& operator<<(FArchive& Ar, FStreamBulkDataEntry& Entry)
+			{
+				Ar << Entry.StreamKey;
+				Ar << Entry.Layout;
+				Ar << Entry.Num;
+				Ar << Entry.Offset;
+				return Ar;
+			}
+		};
+
+		struct FSectionGroupBulkDataEntry
+		{
+			FRealtimeMeshSectionGroupKey SectionGroupKey;
+			TArray<FStreamBulkDataEntry> Streams;
+
+			friend FArchive& operator<<(FArchive& Ar, FSectionGroupBulkDataEntry& Entry)
+			{
+				Ar << Entry.SectionGroupKey;
+				Ar << Entry.Streams;
+				return Ar;
+			}
+		};
+
+		// Payloads start on this alignment so mapped memory can be read in place
+		static constexpr int64 StreamBulkDataAlignment = 16;
+
+		static TArray<FRealtimeMeshEvictedSectionGroup> DecodeStreamBulkData(FByteBulkData& BulkData, TConstArrayView<FSectionGroupBulkDataEntry> Entries)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(RealtimeMesh::DecodeStreamBulkData);
+
+			TArray<FRealtimeMeshEvictedSectionGroup> SectionGroups;
+			SectionGroups.SetNum(Entries.Num());
+
+			const int64 DataSize = BulkData.GetBulkDataSize();
+			std::atomic<bool> bHadInvalidEntries { false };
+
+			// Streams are allocated up front so their payloads can land straight in them
+			ParallelFor(Entries.Num(), [&](int32 Index)
+			{
+				FRealtimeMeshEvictedSectionGroup& SectionGroup = SectionGroups[Index];
+				SectionGroup.SectionGroupKey = Entries[Index].SectionGroupKey;
+
+				for (const FStreamBulkDataEntry& Entry : Entries[Index].Streams)
+				{
+					FRealtimeMeshStream Stream(Entry.StreamKey, Entry.Layout);
+					const int64 NumBytes = static_cast<int64>(Entry.Num) * Stream.GetStride();
+					if (Entry.Num < 0 || Entry.Offset < 0 || Entry.Offset + NumBytes > DataSize)
+					{
+						bHadInvalidEntries = true;
+						continue;
+					}
+
+					Stream.SetNumUninitialized(Entry.Num);
+					SectionGroup.Streams.AddStream(MoveTemp(Stream));
+				}
+			});
+
+			auto ForEachPayload = [&](int32 Index, TFunctionRef<void(FRealtimeMeshStream& Stream, int64 Offset)> Func)
 			{
-				NewBounds = FBoxSphereBounds3f(NaniteResources->GetBounds());
-			}
+				for (const FStreamBulkDataEntry& Entry : Entries[Index].Streams)
+				{
+					FRealtimeMeshStream* Stream = SectionGroups[Index].Streams.Find(Entry.StreamKey);
+					if (Stream && Stream->Num() > 0)
+					{
+						Func(*Stream, Entry.Offset);
+					}
+				}
+			};
 
-			// Add existing computed bounds
-			if (NewBounds && Bounds.HasComputedBounds())
+			if (DataSize > 0 && !BulkData.IsBulkDataLoaded() && BulkData.CanLoadFromDisk())
 			{
-				NewBounds = *NewBounds + Bounds.GetComputedBounds();				
+				// Locking would read the whole payload into a heap copy only to copy it again, so each stream reads its own range
+				int32 NumPayloads = 0;
+				for (const FSectionGroupBulkDataEntry& Entry : Entries)
+				{
+					NumPayloads += Entry.Streams.Num();
+				}
+
+				TArray<FIoBuffer> Destinations;
+				Destinations.Reserve(NumPayloads);
+				FBulkDataBatchRequest::FBatchBuilder Batch = FBulkDataBatchRequest::NewBatch(NumPayloads);
+				for (int32 Index = 0; Index < Entries.Num(); Index++)
+				{
+					ForEachPayload(Index, [&](FRealtimeMeshStream& Stream, int64 Offset)
+					{
+						FIoBuffer& Destination = Destinations.Emplace_GetRef(FIoBuffer::Wrap, Stream.GetData(), Stream.GetResourceDataSize());
+						Batch.Read(BulkData, Offset, Destination.GetSize(), AIOP_Normal, Destination);
+					});
+				}
+
+				FBulkDataBatchRequest Request;
+				if (Batch.Issue(Request) == FBulkDataRequest::EStatus::Pending)
+				{
+					Request.Wait();
+				}
+				if (!Request.IsOk())
+				{
+					UE_LOG(LogRealtimeMesh, Error, TEXT("Failed to read stream bulk data, the streams are left uninitialized"));
+				}
+			}
+			else if (DataSize > 0)
+			{
+				// Already resident, inline or memory mapped, so each section group copies from where it is
+				const uint8* Data = static_cast<const uint8*>(BulkData.LockReadOnly());
+				ParallelFor(Entries.Num(), [&](int32 Index)
+				{
+					ForEachPayload(Index, [&](FRealtimeMeshStream& Stream, int64 Offset)
+					{
+						FMemory::Memcpy(Stream.GetData(), Data + Offset, Stream.GetResourceDataSize());
+					});
+				});
+				BulkData.Unlock();
 			}
 
-			if (NewBounds)
+			if (bHadInvalidEntries)
 			{
-				Bounds.SetComputedBounds(*NewBounds);
+				UE_LOG(LogRealtimeMesh, Error, TEXT("Stream bulk data is smaller than its entries say, the affected streams were dropped"));
 			}
+			return SectionGroups;
 		}
 	}
 
-	bool FRealtimeMeshSimple::Serialize(FArchive& Ar, URealtimeMesh* Owner)
+	struct FRealtimeMeshStreamBulkLoad
 	{
-		const bool bResult = FRealtimeMesh::Serialize(Ar, Owner);
+		FCriticalSection Lock;
+		FByteBulkData BulkData;
+		TArray<Simple::Private::FSectionGroupBulkDataEntry> Entries;
+		bool bFinished = false;
+	};
 
-		if (Ar.CustomVer(FRealtimeMeshVersion::GUID) >= FRealtimeMeshVersion::SimpleMeshStoresCollisionConfig)
-		{
-			Ar << CollisionConfig;
-			Ar << SimpleGeometry;
-		}
+	void FRealtimeMeshSimple::SerializeStreamBulkData(FArchive& Ar, URealtimeMesh* Owner)
+	{
+		using namespace Simple::Private;
 
-		if (Ar.CustomVer(FRealtimeMeshVersion::GUID) >= FRealtimeMeshVersion::SimpleMeshStoresCustomComplexCollision)
+		if (Ar.IsLoading())
 		{
-			if (Ar.CustomVer(FRealtimeMeshVersion::GUID) >= FRealtimeMeshVersion::CollisionOverhaul)
+			TArray<FSectionGroupBulkDataEntry> Entries;
+			Ar << Entries;
+
+			const TSharedRef<FRealtimeMeshStreamBulkLoad> Load = MakeShared<FRealtimeMeshStreamBulkLoad>();
+			Load->BulkData.Serialize(Ar, Owner, INDEX_NONE, FPlatformProperties::RequiresCookedData());
+
+			// Groups that feed collision are needed by the cook that follows the load, so they are never deferred
+			TArray<FSectionGroupBulkDataEntry> Immediate;
+			const bool bLazy = StaticCastSharedRef<FRealtimeMeshSharedResourcesSimple>(SharedResources)->GetStreamStorage() == ERealtimeMeshStreamStorage::LazyBulkData;
 			{
-				Ar << ComplexGeometry;
+				FRealtimeMeshAccessContext LockContext(this->AsShared());
+				for (FSectionGroupBulkDataEntry& Entry : Entries)
+				{
+					bool bIsNeededNow = !bLazy;
+					if (!bIsNeededNow)
+					{
+						const TSharedPtr<FRealtimeMeshSectionGroupSimple> SectionGroup = GetSectionGroupAs<FRealtimeMeshSectionGroupSimple>(LockContext, Entry.SectionGroupKey);
+						bIsNeededNow = SectionGroup.IsValid() && SectionGroup->HasCollisionSections(LockContext);
+					}
+
+					if (bIsNeededNow)
+					{
+						Immediate.Add(MoveTemp(Entry));
+					}
+					else
+					{
+						Load->Entries.Add(MoveTemp(Entry));
+					}
+				}
 			}
-			else
+
+			if (Immediate.Num() > 0)
 			{
-				check(Ar.IsLoading())
-				FRealtimeMeshStreamSet ComplexMeshGeometry;
-				int32 NumStreams = ComplexMeshGeometry.Num();
-				Ar << NumStreams;
+				RestoreLODStreams(DecodeStreamBulkData(Load->BulkData, Immediate));
+			}
 
-				ComplexMeshGeometry.Empty();
-				for (int32 Index = 0; Index < NumStreams; Index++)
+			if (Load->Entries.Num() > 0)
+			{
 				{
-					FRealtimeMeshStreamKey StreamKey;
-					Ar << StreamKey;
-					FRealtimeMeshStream Stream;
-					Ar << Stream;
-					Stream.SetStreamKey(StreamKey);
-
-					ComplexMeshGeometry.AddStream(MoveTemp(Stream));
+					FScopeLock ScopeLock(&PendingStreamLoadLock);
+					PendingStreamLoad = Load;
 				}
-				
-				FRealtimeMeshCollisionMesh CollisionMesh;
-				URealtimeMeshCollisionTools::AppendStreamsToCollisionMesh(CollisionMesh, ComplexMeshGeometry, 0);
-				ComplexGeometry.Add(MoveTemp(CollisionMesh));
+
+				Async(EAsyncExecution::ThreadPool, [ThisWeak = StaticCastWeakPtr<FRealtimeMeshSimple>(this->AsWeak()), Load]()
+				{
+					if (const TSharedPtr<FRealtimeMeshSimple> This = ThisWeak.Pin())
+					{
+						This->FinishStreamLoad(Load);
+					}
+				});
 			}
 		}
-
-		if (Ar.CustomVer(FRealtimeMeshVersion::GUID) >= FRealtimeMeshVersion::DistanceFieldAndCardRepresentationSupport)
+		else
 		{
-			DistanceField.Serialize(Ar, Owner);
-
-			bool bHasCardRepresentation = CardRepresentation.IsValid();
-			Ar << bHasCardRepresentation;
-			if (bHasCardRepresentation)
+			TArray<FSectionGroupBulkDataEntry> Entries;
+			TArray64<uint8> Payload;
 			{
-				if (Ar.IsLoading() && !CardRepresentation.IsValid())
+				FRealtimeMeshAccessContext LockContext(this->AsShared());
+				for (const FRealtimeMeshLODRef& LOD : LODs)
 				{
-					CardRepresentation = MakeUnique<FRealtimeMeshCardRepresentation>();
+					for (const FRealtimeMeshSectionGroupKey& SectionGroupKey : LOD->GetSectionGroupKeys(LockContext))
+					{
+						FSectionGroupBulkDataEntry& Entry = Entries.Add_GetRef({ SectionGroupKey });
+						LOD->GetSectionGroupAs<FRealtimeMeshSectionGroupSimple>(LockContext, SectionGroupKey)->ProcessMeshData(LockContext, [&](const FRealtimeMeshStreamSet& Streams)
+						{
+							Streams.ForEach([&](const FRealtimeMeshStream& Stream)
+							{
+								Payload.AddZeroed(Align(Payload.Num(), StreamBulkDataAlignment) - Payload.Num());
+								Entry.Streams.Add({ Stream.GetStreamKey(), Stream.GetLayout(), Stream.Num(), Payload.Num() });
+								Payload.Append(Stream.GetData(), Stream.GetResourceDataSize());
+							});
+						});
+					}
 				}
-				
-				CardRepresentation->Serialize(Ar, Owner);				
 			}
-			else
+			Ar << Entries;
+
+			FByteBulkData BulkData;
+			BulkData.SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload | BULKDATA_MemoryMappedPayload);
+			BulkData.Lock(LOCK_READ_WRITE);
+			FMemory::Memcpy(BulkData.Realloc(Payload.Num()), Payload.GetData(), Payload.Num());
+			BulkData.Unlock();
+			BulkData.Serialize(Ar, Owner, INDEX_NONE, false);
+		}
+	}
+
+	void FRealtimeMeshSimple::FinishStreamLoad(const TSharedRef<FRealtimeMeshStreamBulkLoad>& Load)
+	{
+		{
+			FScopeLock ScopeLock(&Load->Lock);
+			if (!Load->bFinished)
 			{
-				CardRepresentation.Reset();
+				Load->bFinished = true;
+				RestoreLODStreams(Simple::Private::DecodeStreamBulkData(Load->BulkData, Load->Entries));
+				Load->BulkData.RemoveBulkData();
+				Load->Entries.Empty();
 			}
 		}
 
-		if (Ar.IsLoading() && RenderProxy)
+		FScopeLock ScopeLock(&PendingStreamLoadLock);
+		if (PendingStreamLoad == Load)
 		{
-			MarkCollisionDirtyNoCallback();
+			PendingStreamLoad.Reset();
 		}
+	}
 
-		return bResult;
+	ERealtimeMeshStreamStorage FRealtimeMeshSimple::GetStreamStorage() const
+	{
+		FRealtimeMeshScopeGuardRead ScopeGuard(SharedResources);
+		return StaticCastSharedRef<FRealtimeMeshSharedResourcesSimple>(SharedResources)->GetStreamStorage();
+	}
+
+	void FRealtimeMeshSimple::SetStreamStorage(ERealtimeMeshStreamStorage NewStorage)
+	{
+		FRealtimeMeshScopeGuardWrite ScopeGuard(SharedResources);
+		StaticCastSharedRef<FRealtimeMeshSharedResourcesSimple>(SharedResources)->SetStreamStorage(NewStorage);
+	}
+
+	bool FRealtimeMeshSimple::HasPendingStreamLoad() const
+	{
+		FScopeLock ScopeLock(&PendingStreamLoadLock);
+		return PendingStreamLoad.IsValid();
+	}
+
+	void FRealtimeMeshSimple::FlushPendingStreamLoad()
+	{
+		TSharedPtr<FRealtimeMeshStreamBulkLoad> Load;
+		{
+			FScopeLock ScopeLock(&PendingStreamLoadLock);
+			Load = PendingStreamLoad;
+		}
+
+		if (Load.IsValid())
+		{
+			FinishStreamLoad(Load.ToSharedRef());
+		}
 	}
 	
 	void FRealtimeMeshSimple::MarkCollisionDirtyNoCallback() const
@@ -843,57 +1674,127 @@ namespace RealtimeMesh
 
 	void FRealtimeMeshSimple::ProcessEndOfFrameUpdates()
 	{
-		TSharedPtr<TPromise<ERealtimeMeshCollisionUpdateResult>> CollisionPromise;
+		bool bHasCollisionRequest = false;
 		{
 			FRealtimeMeshScopeGuardWrite ScopeGuard(SharedResources);
-			CollisionPromise = MoveTemp(PendingCollisionPromise);
-			PendingCollisionPromise.Reset();
+			if (PendingCollisionPromise.IsValid())
+			{
+				WaitingCollisionPromises.Add(MoveTemp(PendingCollisionPromise));
+				PendingCollisionPromise.Reset();
+				bHasCollisionRequest = true;
+			}
 		}
 		
-		if (CollisionPromise.IsValid())
+		if (bHasCollisionRequest)
 		{
-			auto Promise = MoveTemp(*CollisionPromise);
+			StartCollisionCook();
+		}
+		FRealtimeMesh::ProcessEndOfFrameUpdates();
+	}
 
-			const int32 UpdateKey = GetNextCollisionUpdateVersion();
-			
-			const bool bAsyncCook = CollisionConfig.bUseAsyncCook;
-			const ERealtimeMeshThreadType AllowedGenerationThread = bAsyncCook ? ERealtimeMeshThreadType::AsyncThread : ERealtimeMeshThreadType::GameThread;
+	void FRealtimeMeshSimple::StartCollisionCook()
+	{
+		const TOptional<FRealtimeMeshCollisionCookScheduler::FTicket> Ticket = CollisionCookScheduler.Request(
+			GetNextCollisionUpdateVersion(), CVarRealtimeMeshCollisionMaxConsecutiveCookCancels.GetValueOnGameThread());
+
+		// Already cooking, this request will be picked up when that finishes
+		if (!Ticket.IsSet())
+		{
+			return;
+		}
 
-			auto CollisionData = MakeShared<FRealtimeMeshCollisionInfo>();
+		TArray<TSharedPtr<TPromise<ERealtimeMeshCollisionUpdateResult>>> Promises;
+		auto CollisionData = MakeShared<FRealtimeMeshCollisionInfo>();
+		{
+			FRealtimeMeshScopeGuardRead ScopeGuard(SharedResources);
+			Promises = MoveTemp(WaitingCollisionPromises);
+			WaitingCollisionPromises.Reset();
 			CollisionData->Configuration = CollisionConfig;
 			CollisionData->SimpleGeometry = SimpleGeometry;
+		}
+			
+		const bool bAsyncCook = CollisionData->Configuration.bUseAsyncCook;
+		const ERealtimeMeshThreadType AllowedGenerationThread = bAsyncCook ? ERealtimeMeshThreadType::AsyncThread : ERealtimeMeshThreadType::GameThread;
 			
-			auto ThisWeak = StaticCastWeakPtr<FRealtimeMeshSimple>(this->AsWeak());
+		auto ThisWeak = StaticCastWeakPtr<FRealtimeMeshSimple>(this->AsWeak());
 
-			DoOnAllowedThread(AllowedGenerationThread, [ThisWeak, CollisionData, ResultPromise = MoveTemp(Promise), UpdateKey]() mutable
-			{				
-				if (const auto ThisShared = ThisWeak.Pin())
+		DoOnAllowedThread(AllowedGenerationThread, [ThisWeak, CollisionData, Promises = MoveTemp(Promises), Ticket = Ticket.GetValue()]() mutable
+		{				
+			if (const auto ThisShared = ThisWeak.Pin())
+			{
+				TFuture<ERealtimeMeshCollisionUpdateResult> CollisionUpdateFuture;
+				if (!Ticket.CancellationToken.IsCancelled())
 				{
 					FRealtimeMeshAccessContext AccessContext(ThisShared.ToSharedRef());
 					FRealtimeMeshComplexGeometry NewComplexGeometry;
-					
+				
 					if (ThisShared->GenerateComplexCollision(AccessContext, NewComplexGeometry))
 					{
 						CollisionData->ComplexGeometry = MoveTemp(NewComplexGeometry);
 					}
+				}
 
-					auto CollisionUpdateFuture = ThisShared->UpdateCollision(MoveTemp(*CollisionData), UpdateKey);
-
-					ContinueOnGameThread(MoveTemp(CollisionUpdateFuture), [ResultPromise = MoveTemp(ResultPromise)](TFuture<ERealtimeMeshCollisionUpdateResult>&& Result) mutable
-					{
-						ResultPromise.EmplaceValue(Result.Get());
-					});
+				if (!Ticket.CancellationToken.IsCancelled())
+				{
+					CollisionUpdateFuture = ThisShared->UpdateCollision(MoveTemp(*CollisionData), Ticket.Version, Ticket.CancellationToken);
 				}
 				else
 				{
-					DoOnGameThread([ResultPromise = MoveTemp(ResultPromise)]() mutable
-					{
-						ResultPromise.EmplaceValue(ERealtimeMeshCollisionUpdateResult::Ignored);
-					});
+					CollisionUpdateFuture = MakeFulfilledPromise<ERealtimeMeshCollisionUpdateResult>(ERealtimeMeshCollisionUpdateResult::Ignored).GetFuture();
 				}
-			});
+
+				ContinueOnGameThread(MoveTemp(CollisionUpdateFuture), [ThisWeak, Promises = MoveTemp(Promises), Ticket](TFuture<ERealtimeMeshCollisionUpdateResult>&& Result) mutable
+				{
+					if (const auto ThisShared = ThisWeak.Pin())
+					{
+						ThisShared->FinishCollisionCook(Ticket, MoveTemp(Promises), Result.Get());
+					}
+					else
+					{
+						for (const auto& Promise : Promises)
+						{
+							Promise->SetValue(ERealtimeMeshCollisionUpdateResult::Ignored);
+						}
+					}
+				});
+			}
+			else
+			{
+				DoOnGameThread([Promises = MoveTemp(Promises)]() mutable
+				{
+					for (const auto& Promise : Promises)
+					{
+						Promise->SetValue(ERealtimeMeshCollisionUpdateResult::Ignored);
+					}
+				});
+			}
+		});
+	}
+
+	void FRealtimeMeshSimple::FinishCollisionCook(const FRealtimeMeshCollisionCookScheduler::FTicket& Ticket, TArray<TSharedPtr<TPromise<ERealtimeMeshCollisionUpdateResult>>>&& Promises,
+		ERealtimeMeshCollisionUpdateResult Result)
+	{
+		check(IsInGameThread());
+
+		// A cook that bailed out hands its callers over to the cook that replaces it
+		const bool bWasCancelled = Result != ERealtimeMeshCollisionUpdateResult::Updated && Ticket.CancellationToken.IsCancelled();
+		if (bWasCancelled)
+		{
+			FRealtimeMeshScopeGuardWrite ScopeGuard(SharedResources);
+			WaitingCollisionPromises.Append(MoveTemp(Promises));
+		}
+		else
+		{
+			for (const auto& Promise : Promises)
+			{
+				Promise->SetValue(Result);
+			}
+		}
+
+		if (CollisionCookScheduler.Finish(Ticket.Version, bWasCancelled))
+		{
+			StartCollisionCook();
 		}
-		FRealtimeMesh::ProcessEndOfFrameUpdates();
 	}
 }
 
@@ -1418,6 +2319,122 @@ TFuture<ERealtimeMeshProxyUpdateStatus> URealtimeMeshSimple::ClearCardRepresenta
 	return UpdateContext.Commit();
 }
 
+bool URealtimeMeshSimple::FindTexCoordAtLocation(const FRealtimeMeshLODKey& LODKey, const FVector& LocalLocation, int32 UVChannel, float MaxDistance, FVector2D& UV) const
+{
+	const FRealtimeMeshSpatialIndexPtr SpatialIndex = GetMeshAs<FRealtimeMeshSimple>()->GetSpatialIndex(LODKey);
+	FVector2f FoundUV;
+	if (SpatialIndex && SpatialIndex->FindTexCoordAtLocation(FVector3f(LocalLocation), MaxDistance, UVChannel, FoundUV))
+	{
+		UV = FVector2D(FoundUV);
+		return true;
+	}
+	return false;
+}
+
+bool URealtimeMeshSimple::FindTexCoordByRaycast(const FRealtimeMeshLODKey& LODKey, const FVector& LocalOrigin, const FVector& LocalDirection, int32 UVChannel, float MaxDistance,
+	FVector2D& UV) const
+{
+	const FVector Direction = LocalDirection.GetSafeNormal();
+	if (Direction.IsZero())
+	{
+		return false;
+	}
+
+	const FRealtimeMeshSpatialIndexPtr SpatialIndex = GetMeshAs<FRealtimeMeshSimple>()->GetSpatialIndex(LODKey);
+	FVector2f FoundUV;
+	if (SpatialIndex && SpatialIndex->FindTexCoordByRaycast(FVector3f(LocalOrigin), FVector3f(Direction), MaxDistance, UVChannel, FoundUV))
+	{
+		UV = FVector2D(FoundUV);
+		return true;
+	}
+	return false;
+}
+
+int32 URealtimeMeshSimple::FindTexCoordsAtLocations(const FRealtimeMeshLODKey& LODKey, const TArray<FVector>& LocalLocations, int32 UVChannel, float MaxDistance,
+	TArray<FVector2D>& UVs, TArray<bool>& Found) const
+{
+	UVs.SetNumZeroed(LocalLocations.Num());
+	Found.SetNumZeroed(LocalLocations.Num());
+
+	const FRealtimeMeshSpatialIndexPtr SpatialIndex = GetMeshAs<FRealtimeMeshSimple>()->GetSpatialIndex(LODKey);
+	if (!SpatialIndex)
+	{
+		return 0;
+	}
+
+	TArray<FVector3f> Locations;
+	Locations.SetNumUninitialized(LocalLocations.Num());
+	for (int32 Index = 0; Index < LocalLocations.Num(); Index++)
+	{
+		Locations[Index] = FVector3f(LocalLocations[Index]);
+	}
+
+	TArray<FVector2f> FoundUVs;
+	FoundUVs.SetNumZeroed(Locations.Num());
+	const int32 NumFound = SpatialIndex->FindTexCoordsAtLocations(Locations, MaxDistance, UVChannel, FoundUVs, Found);
+
+	for (int32 Index = 0; Index < FoundUVs.Num(); Index++)
+	{
+		UVs[Index] = FVector2D(FoundUVs[Index]);
+	}
+	return NumFound;
+}
+
+bool URealtimeMeshSimple::LineTraceRenderData(const FRealtimeMeshLODKey& LODKey, const FVector& Start, const FVector& End, FVector& HitLocation, FVector& HitNormal,
+	FRealtimeMeshSectionGroupKey& HitSectionGroup) const
+{
+	const FVector Delta = End - Start;
+	const double Length = Delta.Size();
+	const FRealtimeMeshSpatialIndexPtr SpatialIndex = Length > UE_SMALL_NUMBER ? GetMeshAs<FRealtimeMeshSimple>()->GetSpatialIndex(LODKey) : nullptr;
+
+	FRealtimeMeshSpatialHit Hit;
+	if (SpatialIndex && SpatialIndex->Raycast(FVector3f(Start), FVector3f(Delta / Length), Length, Hit))
+	{
+		HitLocation = FVector(Hit.Location);
+		HitNormal = FVector(Hit.Normal);
+		HitSectionGroup = Hit.SectionGroupKey;
+		return true;
+	}
+	return false;
+}
+
+bool URealtimeMeshSimple::SweepSphereRenderData(const FRealtimeMeshLODKey& LODKey, const FVector& Start, const FVector& End, float Radius, FVector& HitLocation,
+	FVector& HitNormal, FRealtimeMeshSectionGroupKey& HitSectionGroup) const
+{
+	const FVector Delta = End - Start;
+	const double Length = Delta.Size();
+	const FRealtimeMeshSpatialIndexPtr SpatialIndex = GetMeshAs<FRealtimeMeshSimple>()->GetSpatialIndex(LODKey);
+
+	// A zero length sweep is still a valid overlap test, the direction just doesn't matter
+	const FVector3f Direction = Length > UE_SMALL_NUMBER ? FVector3f(Delta / Length) : FVector3f::UnitX();
+
+	FRealtimeMeshSpatialHit Hit;
+	if (SpatialIndex && SpatialIndex->SweepSphere(FVector3f(Start), Direction, FMath::Max(Radius, 0.0f), Length, Hit))
+	{
+		HitLocation = FVector(Hit.Location);
+		HitNormal = FVector(Hit.Normal);
+		HitSectionGroup = Hit.SectionGroupKey;
+		return true;
+	}
+	return false;
+}
+
+bool URealtimeMeshSimple::FindClosestPointOnRenderData(const FRealtimeMeshLODKey& LODKey, const FVector& Point, float MaxDistance, FVector& ClosestPoint, FVector& Normal,
+	FRealtimeMeshSectionGroupKey& HitSectionGroup) const
+{
+	const FRealtimeMeshSpatialIndexPtr SpatialIndex = GetMeshAs<FRealtimeMeshSimple>()->GetSpatialIndex(LODKey);
+
+	FRealtimeMeshSpatialHit Hit;
+	if (SpatialIndex && SpatialIndex->FindClosestPoint(FVector3f(Point), MaxDistance, Hit))
+	{
+		ClosestPoint = FVector(Hit.Location);
+		Normal = FVector(Hit.Normal);
+		HitSectionGroup = Hit.SectionGroupKey;
+		return true;
+	}
+	return false;
+}
+
 FRealtimeMeshCollisionConfiguration URealtimeMeshSimple::GetCollisionConfig() const
 {
 	return GetMeshAs<FRealtimeMeshSimple>()->GetCollisionConfig();
@@ -1458,6 +2475,52 @@ void URealtimeMeshSimple::SetSimpleGeometry(const FRealtimeMeshSimpleGeometry& I
 		});
 }
 
+void URealtimeMeshSimple::ProcessSimpleGeometry(TFunctionRef<void(const FRealtimeMeshSimpleGeometry&)> ProcessFunc) const
+{
+	return GetMeshAs<FRealtimeMeshSimple>()->ProcessSimpleGeometry(ProcessFunc);
+}
+
+// ReSharper disable once CppMemberFunctionMayBeConst
+TFuture<ERealtimeMeshCollisionUpdateResult> URealtimeMeshSimple::EditSimpleGeometry(TFunctionRef<bool(FRealtimeMeshSimpleGeometry&)> EditFunc)
+{
+	return GetMeshAs<FRealtimeMeshSimple>()->EditSimpleGeometry(EditFunc);
+}
+
+TFuture<ERealtimeMeshCollisionUpdateResult> URealtimeMeshSimple::GenerateConvexDecomposition(const FRealtimeMeshLODKey& LODKey, const FRealtimeMeshConvexDecompositionSettings& Settings)
+{
+	return GetMeshAs<FRealtimeMeshSimple>()->GenerateConvexDecomposition(LODKey, Settings);
+}
+
+void URealtimeMeshSimple::GenerateConvexDecomposition(const FRealtimeMeshLODKey& LODKey, const FRealtimeMeshConvexDecompositionSettings& Settings,
+	const FRealtimeMeshSimpleCollisionCompletionCallback& CompletionCallback)
+{
+	GenerateConvexDecomposition(LODKey, Settings)
+		.Next([CompletionCallback](ERealtimeMeshCollisionUpdateResult Status)
+		{
+			(void)CompletionCallback.ExecuteIfBound(Status);
+		});
+}
+
+void URealtimeMeshSimple::SetLODResidencyEnabled(bool bEnabled)
+{
+	GetMeshAs<FRealtimeMeshSimple>()->SetLODResidencyEnabled(bEnabled);
+}
+
+bool URealtimeMeshSimple::IsLODResidencyEnabled() const
+{
+	return GetMeshAs<FRealtimeMeshSimple>()->IsLODResidencyEnabled();
+}
+
+void URealtimeMeshSimple::SetStreamStorage(ERealtimeMeshStreamStorage NewStorage)
+{
+	GetMeshAs<FRealtimeMeshSimple>()->SetStreamStorage(NewStorage);
+}
+
+ERealtimeMeshStreamStorage URealtimeMeshSimple::GetStreamStorage() const
+{
+	return GetMeshAs<FRealtimeMeshSimple>()->GetStreamStorage();
+}
+
 void URealtimeMeshSimple::Reset()
 {
 	Super::Reset();
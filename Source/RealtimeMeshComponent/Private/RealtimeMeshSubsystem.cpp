@@ -7,6 +7,10 @@
 #include "Engine/Engine.h"
 #include "Engine/Level.h"
 #include "Misc/LazySingleton.h"
+#include "RealtimeMeshCore.h"
+
+DECLARE_CYCLE_STAT(TEXT("RealtimeMeshEndOfFrameUpdateManager - Process End Of Frame Updates"), STAT_RealtimeMeshEndOfFrameUpdateManager_ProcessUpdates, STATGROUP_RealtimeMesh);
+DECLARE_DWORD_COUNTER_STAT(TEXT("RealtimeMeshEndOfFrameUpdateManager - Updated Meshes"), STAT_RealtimeMeshEndOfFrameUpdateManager_UpdatedMeshes, STATGROUP_RealtimeMesh);
 
 
 URealtimeMeshSubsystem::URealtimeMeshSubsystem()
@@ -102,6 +106,10 @@ URealtimeMeshSubsystem* URealtimeMeshSubsystem::GetInstance(UWorld* World)
 
 void RealtimeMesh::FRealtimeMeshEndOfFrameUpdateManager::OnPreSendAllEndOfFrameUpdates(UWorld* World)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshEndOfFrameUpdateManager::OnPreSendAllEndOfFrameUpdates);
+	SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshEndOfFrameUpdateManager_ProcessUpdates);
+	CSV_SCOPED_TIMING_STAT(RealtimeMesh, EndOfFrameUpdates);
+	
 	SyncRoot.Lock();
 	auto MeshesCopy = MoveTemp(MeshesToUpdate);
 	SyncRoot.Unlock();
@@ -111,6 +119,8 @@ void RealtimeMesh::FRealtimeMeshEndOfFrameUpdateManager::OnPreSendAllEndOfFrameU
 		if (auto Mesh = MeshWeak.Pin())
 		{
 			Mesh->ProcessEndOfFrameUpdates();
+			INC_DWORD_STAT(STAT_RealtimeMeshEndOfFrameUpdateManager_UpdatedMeshes);
+			RealtimeMesh::FRealtimeMeshStatCounters::Get().EndOfFrameUpdates++;
 		}
 	}
 }
@@ -28,6 +28,7 @@
 
 DECLARE_CYCLE_STAT(TEXT("RealtimeMeshComponentSceneProxy - Create Mesh Batch"), STAT_RealtimeMeshComponentSceneProxy_CreateMeshBatch, STATGROUP_RealtimeMesh);
 DECLARE_CYCLE_STAT(TEXT("RealtimeMeshComponentSceneProxy - Get Dynamic Mesh Elements"), STAT_RealtimeMeshComponentSceneProxy_GetDynamicMeshElements, STATGROUP_RealtimeMesh);
+DECLARE_CYCLE_STAT(TEXT("RealtimeMeshComponentSceneProxy - Update Dynamic Batch Templates"), STAT_RealtimeMeshComponentSceneProxy_UpdateDynamicBatchTemplates, STATGROUP_RealtimeMesh);
 DECLARE_CYCLE_STAT(TEXT("RealtimeMeshComponentSceneProxy - Draw Static Mesh Elements"), STAT_RealtimeMeshComponentSceneProxy_DrawStaticMeshElements, STATGROUP_RealtimeMesh);
 DECLARE_CYCLE_STAT(TEXT("RealtimeMeshComponentSceneProxy - Get Dynamic Ray Tracing Instances"), STAT_RealtimeMeshComponentSceneProxy_GetDynamicRayTracingInstances,
                    STATGROUP_RealtimeMesh);
@@ -69,7 +70,10 @@ namespace RealtimeMesh
 		: FPrimitiveSceneProxy(Component)
 		  , RealtimeMeshProxy(InRealtimeMeshProxy)
 		  , BodySetup(Component->GetBodySetup())
+		  , StaticDrawSignature(0)
+		  , NumStaticMeshBatches(0)
 		  , bAnyMaterialUsesDithering(false)
+		  , bStaticRayTracingRelevant(false)
 	{
 		check(Component->GetRealtimeMesh() != nullptr);
 
@@ -116,15 +120,45 @@ namespace RealtimeMesh
 
 	FRealtimeMeshComponentSceneProxy::~FRealtimeMeshComponentSceneProxy()
 	{
+		RealtimeMeshProxy->OnStaticRayTracingChanged().Remove(StaticRayTracingChangedHandle);
 	}
 
 	void FRealtimeMeshComponentSceneProxy::CreateRenderThreadResources(FRHICommandListBase& RHICmdList)
 	{
 		MeshReferencingHandle = RealtimeMeshProxy->GetReferencingHandle();		
 		RealtimeMeshProxy->ProcessCommands(RHICmdList);
+
+#if RHI_RAYTRACING
+		// Commands processed by anyone after this point can rebuild or refit the geometry the scene cached for static
+		// ray tracing, so subscribe only now that this proxy's own view of the mesh is up to date.
+		bStaticRayTracingRelevant = IsRayTracingStaticRelevant();
+		StaticRayTracingChangedHandle = RealtimeMeshProxy->OnStaticRayTracingChanged().AddRaw(this, &FRealtimeMeshComponentSceneProxy::HandleStaticRayTracingChanged);
+#endif
+		
 		FPrimitiveSceneProxy::CreateRenderThreadResources(RHICmdList);
 	}
 
+	void FRealtimeMeshComponentSceneProxy::DestroyRenderThreadResources()
+	{
+		RealtimeMeshProxy->OnStaticRayTracingChanged().Remove(StaticRayTracingChangedHandle);
+		StaticRayTracingChangedHandle.Reset();
+		FPrimitiveSceneProxy::DestroyRenderThreadResources();
+	}
+
+	void FRealtimeMeshComponentSceneProxy::HandleStaticRayTracingChanged()
+	{
+#if RHI_RAYTRACING
+		check(IsInRenderingThread());
+
+		// Dynamic ray tracing is gathered every frame so has nothing cached. A change in static relevance can't be
+		// refreshed in place, HasStaticDrawLayoutChanged reports it so the owning component recreates the render state
+		if (GetPrimitiveSceneInfo() != nullptr && bStaticRayTracingRelevant && IsRayTracingStaticRelevant())
+		{
+			GetScene().UpdateCachedRayTracingState(this);
+		}
+#endif
+	}
+
 	bool FRealtimeMeshComponentSceneProxy::CanBeOccluded() const
 	{
 		return !MaterialRelevance.bDisableDepthTest;
@@ -151,7 +185,7 @@ namespace RealtimeMesh
 		
 		const bool bForceDynamicPath = IsRichView(*View->Family) || IsSelected() || View->Family->EngineShowFlags.Wireframe;
 
-		Result.bStaticRelevance = !bForceDynamicPath && RealtimeMeshProxy->GetDrawMask().IsSet(ERealtimeMeshDrawMask::DrawStatic);
+		Result.bStaticRelevance = bAllowStaticRelevance && !bForceDynamicPath && RealtimeMeshProxy->GetDrawMask().IsSet(ERealtimeMeshDrawMask::DrawStatic);
 		Result.bDynamicRelevance = bForceDynamicPath || RealtimeMeshProxy->GetDrawMask().IsSet(ERealtimeMeshDrawMask::DrawDynamic) || bDebugVisualizationActive;
 
 		Result.bRenderInMainPass = ShouldRenderInMainPass();
@@ -160,6 +194,15 @@ namespace RealtimeMesh
 		MaterialRelevance.SetPrimitiveViewRelevance(Result);
 		Result.bTranslucentSelfShadow = bCastVolumetricTranslucentShadow;
 		Result.bVelocityRelevance = IsMovable() && Result.bOpaque && Result.bRenderInMainPass;
+
+		// Cached static draws pick their LOD without asking the proxy, so the screen size they're drawn at is reported from here
+		if (Result.bStaticRelevance && Result.bDrawRelevance && RealtimeMeshProxy->GetSharedResources()->WantsScreenSizeFeedback())
+		{
+			const FSceneView& LODView = GetLODView(*View);
+			const FBoxSphereBounds& ProxyBounds = GetBounds();
+			ReportScreenSize(ComputeBoundsScreenRadiusSquared(ProxyBounds.Origin, ProxyBounds.SphereRadius, LODView) *
+				LODView.LODDistanceFactor * LODView.LODDistanceFactor);
+		}
 		return Result;
 	}
 
@@ -174,10 +217,108 @@ namespace RealtimeMesh
 	}
 
 	
+	/* Hashes every static batch drawn through it, optionally forwarding them on to the scene */
+	class FRealtimeMeshStaticDrawSignatureCollector final : public FStaticPrimitiveDrawInterface
+	{
+	public:
+		explicit FRealtimeMeshStaticDrawSignatureCollector(FStaticPrimitiveDrawInterface* InForwardPDI = nullptr)
+			: ForwardPDI(InForwardPDI), Signature(0), NumBatches(0) { }
+
+		virtual void SetHitProxy(HHitProxy* HitProxy) override
+		{
+			if (ForwardPDI)
+			{
+				ForwardPDI->SetHitProxy(HitProxy);
+			}
+		}
+
+		virtual void ReserveMemoryForMeshes(int32 MeshNum) override
+		{
+			if (ForwardPDI)
+			{
+				ForwardPDI->ReserveMemoryForMeshes(MeshNum);
+			}
+		}
+
+		virtual void DrawMesh(const FMeshBatch& Mesh, float ScreenSize) override
+		{
+			// Everything the scene copies out of the batch when caching it, the vertex buffers behind the
+			// vertex factory are left out as re-caching in place picks those up from the factory itself.
+			const FMeshBatchElement& Element = Mesh.Elements[0];
+			Signature = HashCombine(Signature, PointerHash(Mesh.VertexFactory));
+			Signature = HashCombine(Signature, PointerHash(Mesh.MaterialRenderProxy));
+			Signature = HashCombine(Signature, PointerHash(Element.IndexBuffer));
+			Signature = HashCombine(Signature, GetTypeHash(Element.FirstIndex));
+			Signature = HashCombine(Signature, GetTypeHash(Element.NumPrimitives));
+			Signature = HashCombine(Signature, GetTypeHash(Element.MinVertexIndex));
+			Signature = HashCombine(Signature, GetTypeHash(Element.MaxVertexIndex));
+			Signature = HashCombine(Signature, GetTypeHash(Element.MinScreenSize));
+			Signature = HashCombine(Signature, GetTypeHash(Element.MaxScreenSize));
+			Signature = HashCombine(Signature, GetTypeHash(ScreenSize));
+			Signature = HashCombine(Signature, GetTypeHash(static_cast<uint32>(Mesh.Type)));
+			Signature = HashCombine(Signature, GetTypeHash(static_cast<uint32>(Mesh.SegmentIndex)));
+			Signature = HashCombine(Signature, GetTypeHash(static_cast<uint32>(Mesh.RuntimeVirtualTextureMaterialType)));
+
+			const uint32 Flags =
+				(Mesh.CastShadow ? 1 << 0 : 0) |
+				(Mesh.bUseForMaterial ? 1 << 1 : 0) |
+				(Mesh.bUseForDepthPass ? 1 << 2 : 0) |
+				(Mesh.bUseAsOccluder ? 1 << 3 : 0) |
+				(Mesh.ReverseCulling ? 1 << 4 : 0) |
+				(Mesh.bDitheredLODTransition ? 1 << 5 : 0) |
+				(Mesh.bRenderToVirtualTexture ? 1 << 6 : 0);
+			Signature = HashCombine(Signature, GetTypeHash(Flags));
+			NumBatches++;
+
+			if (ForwardPDI)
+			{
+				ForwardPDI->DrawMesh(Mesh, ScreenSize);
+			}
+		}
+
+		uint32 GetSignature() const { return HashCombine(Signature, GetTypeHash(NumBatches)); }
+		int32 GetNumBatches() const { return NumBatches; }
+
+	private:
+		FStaticPrimitiveDrawInterface* ForwardPDI;
+		uint32 Signature;
+		int32 NumBatches;
+	};
+	
 	void FRealtimeMeshComponentSceneProxy::DrawStaticElements(FStaticPrimitiveDrawInterface* PDI)
 	{
 		SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshComponentSceneProxy_DrawStaticMeshElements);
-	
+
+		// The scene only gathers static elements when the primitive is added, so any previously
+		// cached batches have been discarded and only the buffers of the new batches need holding.
+		StaticResources.ClearReferences();
+
+		FRealtimeMeshStaticDrawSignatureCollector SignatureCollector(PDI);
+		GatherStaticElements(&SignatureCollector, StaticResources);
+		StaticDrawSignature = SignatureCollector.GetSignature();
+		NumStaticMeshBatches = SignatureCollector.GetNumBatches();
+	}
+
+	bool FRealtimeMeshComponentSceneProxy::HasStaticDrawLayoutChanged() const
+	{
+		check(IsInRenderingThread());
+
+		// Buffers referenced here are released again on return, the cached batches still hold their own
+		FRealtimeMeshResourceReferenceList Resources;
+		FRealtimeMeshStaticDrawSignatureCollector SignatureCollector;
+		GatherStaticElements(&SignatureCollector, Resources);
+
+#if RHI_RAYTRACING
+		if (IsRayTracingStaticRelevant() != bStaticRayTracingRelevant)
+		{
+			return true;
+		}
+#endif
+		return SignatureCollector.GetSignature() != StaticDrawSignature;
+	}
+
+	void FRealtimeMeshComponentSceneProxy::GatherStaticElements(FStaticPrimitiveDrawInterface* PDI, FRealtimeMeshResourceReferenceList& Resources) const
+	{
 		// Walk active LODs
 		for (auto LodIt = RealtimeMeshProxy->GetActiveStaticLODMaskIter(); LodIt; ++LodIt)
 		{
@@ -203,11 +344,12 @@ namespace RealtimeMesh
 
 				check(SectionGroup->GetStream(FRealtimeMeshStreams::Triangles)->IsResourceInitialized());
 
-				for (auto SectionIt = SectionGroup->GetActiveSectionMaskIter(); SectionIt; ++SectionIt)
+				for (const FRealtimeMeshSectionDrawRange& DrawRange : SectionGroup->GetDrawRanges())
 				{
-					const FRealtimeMeshSectionProxy* Section = *SectionIt;
+					const FRealtimeMeshSectionProxyPtr Section = SectionGroup->GetSection(DrawRange.SectionHandle);
+					check(Section.IsValid());
 
-					FMaterialRenderProxy* MaterialProxy = MaterialMap.GetMaterial(Section->GetMaterialSlot());
+					FMaterialRenderProxy* MaterialProxy = MaterialMap.GetMaterial(DrawRange.MaterialSlot);
 					
 					FMeshBatch MeshBatch;
 
@@ -215,10 +357,10 @@ namespace RealtimeMesh
 					MeshBatch.bWireframe = false;
 
 					// Let SectionGroup do initial setup
-					bool bIsValid = SectionGroup->InitializeMeshBatch(MeshBatch, StaticResources, IsLocalToWorldDeterminantNegative(), false);
+					bool bIsValid = SectionGroup->InitializeMeshBatch(MeshBatch, Resources, IsLocalToWorldDeterminantNegative(), false);
 
-					// Let Section finish setup
-					bIsValid = bIsValid && Section->InitializeMeshBatch(MeshBatch, GetUniformBuffer());
+					// Let Section finish setup, over the merged range if it was merged with its neighbours
+					bIsValid = bIsValid && Section->InitializeMeshBatchForRange(MeshBatch, GetUniformBuffer(), DrawRange.StreamRange);
 
 					check(MeshBatch.VertexFactory == VertexFactory.Get());
 					check(MeshBatch.VertexFactory && MeshBatch.VertexFactory->IsInitialized());
@@ -227,10 +369,23 @@ namespace RealtimeMesh
 					{						
 						// TODO: Should this check material?
 						MeshBatch.bDitheredLODTransition &= bAnyMaterialUsesDithering && !IsMovable() && LODMask.IsDithered() &&
-							MaterialMap.GetMaterialSupportsDither(Section->GetMaterialSlot());
-						MeshBatch.CastShadow &= bCastDynamicShadow;
+							MaterialMap.GetMaterialSupportsDither(DrawRange.MaterialSlot);
+
+						// Hiding a section or turning off its shadow only re-points these, the scene then re-caches the
+						// same batches. Shadow casting is baked into a batch, so shadows get a batch of their own to mask.
+						const TSharedPtr<FRealtimeMeshPassIndexBuffer> MainPassIndexBuffer = Section->GetMainPassIndexBuffer();
+						const TSharedPtr<FRealtimeMeshPassIndexBuffer> ShadowPassIndexBuffer = Section->GetShadowPassIndexBuffer();
+						check(MainPassIndexBuffer.IsValid() && ShadowPassIndexBuffer.IsValid());
+						Resources.AddResource(MainPassIndexBuffer);
+						Resources.AddResource(ShadowPassIndexBuffer);
+
+						MeshBatch.Elements[0].IndexBuffer = MainPassIndexBuffer.Get();
+						MeshBatch.CastShadow = false;
 #if RHI_RAYTRACING
 						MeshBatch.CastRayTracedShadow &= bCastDynamicShadow;
+
+						// Cached static ray tracing instances pick the material for each geometry segment by segment index
+						MeshBatch.SegmentIndex = FMath::Max(SectionGroup->GetRayTracingSegmentIndex(DrawRange.SectionHandle), 0);
 #endif
 
 						auto& BatchElement = MeshBatch.Elements[0];
@@ -253,7 +408,21 @@ namespace RealtimeMesh
 							}
 						}
 
-						PDI->DrawMesh(MeshBatch, LODScreenSizes.GetLowerBoundValue());						
+						PDI->DrawMesh(MeshBatch, LODScreenSizes.GetLowerBoundValue());
+
+						if (bCastDynamicShadow)
+						{
+							FMeshBatch ShadowMeshBatch(MeshBatch);
+							ShadowMeshBatch.Elements[0].IndexBuffer = ShadowPassIndexBuffer.Get();
+							ShadowMeshBatch.CastShadow = true;
+							ShadowMeshBatch.bUseForMaterial = false;
+							ShadowMeshBatch.bUseForDepthPass = false;
+							ShadowMeshBatch.bUseAsOccluder = false;
+#if RHI_RAYTRACING
+							ShadowMeshBatch.CastRayTracedShadow = false;
+#endif
+							PDI->DrawMesh(ShadowMeshBatch, LODScreenSizes.GetLowerBoundValue());
+						}
 					}
 				}
 			}			
@@ -389,6 +558,92 @@ namespace RealtimeMesh
 		}
 	}
 
+	void FRealtimeMeshComponentSceneProxy::UpdateDynamicBatchTemplates() const
+	{
+		const uint32 ProxyStateVersion = RealtimeMeshProxy->GetStateVersion();
+		const bool bDeterminantNegative = IsLocalToWorldDeterminantNegative();
+		FRHIUniformBuffer* PrimitiveUniformBuffer = GetUniformBuffer();
+
+		if (DynamicBatchTemplatesVersion.IsSet() && DynamicBatchTemplatesVersion.GetValue() == ProxyStateVersion &&
+			bDynamicBatchTemplatesDeterminantNegative == bDeterminantNegative && DynamicBatchTemplatesUniformBuffer == PrimitiveUniformBuffer)
+		{
+			return;
+		}
+
+		SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshComponentSceneProxy_UpdateDynamicBatchTemplates);
+
+		DynamicBatchTemplates.Reset();
+		DynamicBatchResources.ClearReferences();
+
+		// Walk every active LOD, as rich views/selection/wireframe can force static groups through the dynamic path
+		for (auto LodIt = RealtimeMeshProxy->GetActiveLODMaskIter(); LodIt; ++LodIt)
+		{
+			const FRealtimeMeshLODProxy* LOD = *LodIt;
+			const auto LODScreenSizes = RealtimeMeshProxy->GetScreenSizeRangeForLOD(LodIt.GetIndex());
+
+			for (auto SectionGroupIt = LOD->GetActiveSectionGroupMaskIter(); SectionGroupIt; ++SectionGroupIt)
+			{
+				const FRealtimeMeshSectionGroupProxy* SectionGroup = *SectionGroupIt;
+				const bool bIsDynamicPath = SectionGroup->GetDrawMask().ShouldRenderDynamicPath();
+
+				auto VertexFactory = SectionGroup->GetVertexFactory();
+				check(VertexFactory && VertexFactory.IsValid() && VertexFactory->IsInitialized());
+
+				for (const FRealtimeMeshSectionDrawRange& DrawRange : SectionGroup->GetDrawRanges())
+				{
+					// Static groups keep ranges for their hidden sections, those only exist to be masked in the cached batches
+					if (!DrawRange.DrawMask.ShouldRender())
+					{
+						continue;
+					}
+
+					const FRealtimeMeshSectionProxyPtr Section = SectionGroup->GetSection(DrawRange.SectionHandle);
+					check(Section.IsValid());
+
+					FDynamicMeshBatchTemplate Template;
+					Template.LODIndex = LodIt.GetIndex();
+					Template.bIsDynamicPath = bIsDynamicPath;
+					// TODO: Should this check material?
+					Template.bSupportsDitheredLODTransition = bAnyMaterialUsesDithering && !IsMovable() && MaterialMap.GetMaterialSupportsDither(DrawRange.MaterialSlot);
+
+					FMeshBatch& MeshBatch = Template.MeshBatch;
+					FMaterialRenderProxy* MaterialProxy = MaterialMap.GetMaterial(DrawRange.MaterialSlot);
+					MeshBatch.MaterialRenderProxy = MaterialProxy? MaterialProxy : UMaterial::GetDefaultMaterial(MD_Surface)->GetRenderProxy();
+					MeshBatch.bWireframe = false;
+
+					// Let SectionGroup do initial setup
+					bool bIsValid = SectionGroup->InitializeMeshBatch(MeshBatch, DynamicBatchResources, bDeterminantNegative, false);
+
+					// Let Section finish setup, over the merged range if it was merged with its neighbours
+					bIsValid = bIsValid && Section->InitializeMeshBatchForRange(MeshBatch, PrimitiveUniformBuffer, DrawRange.StreamRange);
+
+					check(MeshBatch.VertexFactory && MeshBatch.VertexFactory->IsInitialized());
+					check(MeshBatch.Elements[0].IndexBuffer && MeshBatch.Elements[0].IndexBuffer->IsInitialized());
+
+					if (bIsValid)
+					{
+						MeshBatch.CastShadow &= bCastDynamicShadow;
+#if RHI_RAYTRACING
+						MeshBatch.CastRayTracedShadow &= bCastDynamicShadow;
+#endif
+
+						auto& BatchElement = MeshBatch.Elements[0];
+
+						// Setup LOD screen sizes
+						BatchElement.MinScreenSize = LODScreenSizes.GetLowerBoundValue();
+						BatchElement.MaxScreenSize = LODScreenSizes.GetUpperBoundValue();
+
+						DynamicBatchTemplates.Add(MoveTemp(Template));
+					}
+				}
+			}
+		}
+
+		DynamicBatchTemplatesVersion = ProxyStateVersion;
+		bDynamicBatchTemplatesDeterminantNegative = bDeterminantNegative;
+		DynamicBatchTemplatesUniformBuffer = PrimitiveUniformBuffer;
+	}
+
 	void FRealtimeMeshComponentSceneProxy::GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap,
 	                                                              FMeshElementCollector& Collector) const
 	{
@@ -400,14 +655,23 @@ namespace RealtimeMesh
 		// Check if we should show vertex colors via material swap
 		const bool bShowVertexColors = CVarRealtimeMeshShowVertexColors.GetValueOnRenderThread() != 0;
 
-		/*FColoredMaterialRenderProxy* WireframeMaterialInstance = nullptr;
+		FMaterialRenderProxy* WireframeMaterialInstance = nullptr;
 		if (bWireframe)
 		{
 			WireframeMaterialInstance = new FColoredMaterialRenderProxy(GEngine->WireframeMaterial ? GEngine->WireframeMaterial->GetRenderProxy() : nullptr,
 			                                                            FLinearColor(0.0f, 0.16f, 1.0f));
 			Collector.RegisterOneFrameMaterialProxy(WireframeMaterialInstance);
-		}*/
+		}
+
+		// Override with vertex color material if debug mode is enabled
+		FMaterialRenderProxy* VertexColorMaterialProxy = nullptr;
+		if (bShowVertexColors && GEngine->VertexColorViewModeMaterial_ColorOnly)
+		{
+			VertexColorMaterialProxy = GEngine->VertexColorViewModeMaterial_ColorOnly->GetRenderProxy();
+		}
 
+		FScopeLock TemplatesLock(&DynamicBatchTemplatesLock);
+		UpdateDynamicBatchTemplates();
 
 		for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ViewIndex++)
 		{
@@ -419,90 +683,29 @@ namespace RealtimeMesh
 				FFrozenSceneViewMatricesGuard FrozenMatricesGuard(*const_cast<FSceneView*>(Views[ViewIndex]));
 				FLODMask LODMask = GetLODMask(View);
 
-				// Walk active LODs
-				for (auto LodIt = bForceDynamicPath? RealtimeMeshProxy->GetActiveLODMaskIter() : RealtimeMeshProxy->GetActiveDynamicLODMaskIter(); LodIt; ++LodIt)
+				// Per frame work is just LOD/path selection and a copy of the prebuilt batch
+				for (const FDynamicMeshBatchTemplate& Template : DynamicBatchTemplates)
 				{
-					if (LODMask.ContainsLOD(LodIt.GetIndex()))
+					if (!LODMask.ContainsLOD(Template.LODIndex) || (!bForceDynamicPath && !Template.bIsDynamicPath))
 					{
-						const FRealtimeMeshLODProxy* LOD = *LodIt;
-						check(LOD->GetDrawMask().ShouldRenderDynamicPath() || (bForceDynamicPath && LOD->GetDrawMask().ShouldRenderStaticPath()));
-						
-						const auto LODScreenSizes = RealtimeMeshProxy->GetScreenSizeRangeForLOD(LodIt.GetIndex());
-
-						// Walk all section groups within the LOD
-						for (auto SectionGroupIt = bForceDynamicPath? LOD->GetActiveSectionGroupMaskIter() : LOD->GetActiveSectionGroupMaskIter(); SectionGroupIt; ++SectionGroupIt)
-						{
-							const FRealtimeMeshSectionGroupProxy* SectionGroup = *SectionGroupIt;
-							if (!bForceDynamicPath && !SectionGroup->GetDrawMask().ShouldRenderDynamicPath())
-							{
-								continue;
-							}
-
-							auto VertexFactory = SectionGroup->GetVertexFactory();
-							check(VertexFactory && VertexFactory.IsValid() && VertexFactory->IsInitialized());
-
-							for (auto SectionIt = bForceDynamicPath? SectionGroup->GetActiveSectionMaskIter() : SectionGroup->GetActiveSectionMaskIter(); SectionIt; ++SectionIt)
-							{
-								const FRealtimeMeshSectionProxy* Section = *SectionIt;
-
-								FMaterialRenderProxy* MaterialProxy = MaterialMap.GetMaterial(Section->GetMaterialSlot());
-								
-								//const bool bWireframe = AllowDebugViewmodes() && ViewFamily.EngineShowFlags.Wireframe;
-
-								if (bWireframe)
-								{
-									MaterialProxy = new FColoredMaterialRenderProxy(GEngine->WireframeMaterial ? GEngine->WireframeMaterial->GetRenderProxy() : nullptr,
-																								FLinearColor(0.0f, 0.16f, 1.0f));
-									Collector.RegisterOneFrameMaterialProxy(MaterialProxy);
-								}
-
-								FMeshBatch& MeshBatch = Collector.AllocateMesh();
-
-								MeshBatch.MaterialRenderProxy = MaterialProxy? MaterialProxy : UMaterial::GetDefaultMaterial(MD_Surface)->GetRenderProxy();
-								
-								// Override with vertex color material if debug mode is enabled
-								if (bShowVertexColors)
-								{
-									UMaterialInterface* VertexColorMaterial = GEngine->VertexColorViewModeMaterial_ColorOnly;
-									if (VertexColorMaterial)
-									{
-										MeshBatch.MaterialRenderProxy = VertexColorMaterial->GetRenderProxy();
-									}
-								}
-								
-								MeshBatch.bWireframe = bWireframe;
-
-								// Let SectionGroup do initial setup
-								FRealtimeMeshResourceReferenceList DynamicResources;
-								bool bIsValid = SectionGroup->InitializeMeshBatch(MeshBatch, DynamicResources, IsLocalToWorldDeterminantNegative(), false);
-
-								// Let Section finish setup
-								bIsValid = bIsValid && Section->InitializeMeshBatch(MeshBatch, GetUniformBuffer());
-
-								check(MeshBatch.VertexFactory && MeshBatch.VertexFactory->IsInitialized());
-								check(MeshBatch.Elements[0].IndexBuffer && MeshBatch.Elements[0].IndexBuffer->IsInitialized());
-								
-								if (bIsValid)
-								{						
-									// TODO: Should this check material?
-									MeshBatch.bDitheredLODTransition &= bAnyMaterialUsesDithering && !IsMovable() && LODMask.IsDithered() &&
-										MaterialMap.GetMaterialSupportsDither(Section->GetMaterialSlot());
-									MeshBatch.CastShadow &= bCastDynamicShadow;
-#if RHI_RAYTRACING
-									MeshBatch.CastRayTracedShadow &= bCastDynamicShadow;
-#endif
+						continue;
+					}
 
-									auto& BatchElement = MeshBatch.Elements[0];
+					FMeshBatch& MeshBatch = Collector.AllocateMesh();
+					MeshBatch = Template.MeshBatch;
 
-									// Setup LOD screen sizes
-									BatchElement.MinScreenSize = LODScreenSizes.GetLowerBoundValue();
-									BatchElement.MaxScreenSize = LODScreenSizes.GetUpperBoundValue();
-									
-									Collector.AddMesh(ViewIndex, MeshBatch);
-								}
-							}
-						}		
+					if (WireframeMaterialInstance)
+					{
+						MeshBatch.MaterialRenderProxy = WireframeMaterialInstance;
+					}
+					if (VertexColorMaterialProxy)
+					{
+						MeshBatch.MaterialRenderProxy = VertexColorMaterialProxy;
 					}
+					MeshBatch.bWireframe = bWireframe;
+					MeshBatch.bDitheredLODTransition &= Template.bSupportsDitheredLODTransition && LODMask.IsDithered();
+
+					Collector.AddMesh(ViewIndex, MeshBatch);
 				}
 			}
 		}
@@ -579,11 +782,16 @@ namespace RealtimeMesh
 
 
 #if RHI_RAYTRACING
+	void FRealtimeMeshComponentSceneProxy::GatherRayTracingInstanceTransforms(TArray<FMatrix>& OutTransforms) const
+	{
+		OutTransforms.Add(GetLocalToWorld());
+	}
+
 	bool FRealtimeMeshComponentSceneProxy::IsRayTracingStaticRelevant() const
 	{
-		// Still some work to finish for static ray tracing to behave correctly as it's initialized on the GT before
-		// the 
-		return false && RealtimeMeshProxy->GetDrawMask().CanRenderInStaticRayTracing();
+		// The draw mask only allows static ray tracing when every LOD traces a single Static section group whose
+		// static batches line up with its geometry segments, anything else goes through GetDynamicRayTracingInstances
+		return CVarRayTracingRealtimeMesh.GetValueOnAnyThread() && RealtimeMeshProxy->GetDrawMask().CanRenderInStaticRayTracing();
 	}
 	
 
@@ -677,10 +885,11 @@ namespace RealtimeMesh
 #endif
 			
 			RayTracingInstance.Geometry = RayTracingGeometry;
-			RayTracingInstance.InstanceTransforms.Add(GetLocalToWorld());
+			GatherRayTracingInstanceTransforms(RayTracingInstance.InstanceTransforms);
 			
 			if (RayTracingGeometry->IsValid() && RayTracingGeometry->IsInitialized())
 			{
+				// Materials map 1:1 onto the geometry segments here, so sections are never merged for ray tracing
 				for (auto SectionIt = SectionGroup->GetActiveSectionMaskIter(); SectionIt; ++SectionIt)
 				{
 					const FRealtimeMeshSectionProxy* Section = *SectionIt;
@@ -741,10 +950,17 @@ namespace RealtimeMesh
 
 		const float ScreenRadiusSquared = ComputeBoundsScreenRadiusSquared(Origin, SphereRadius, View.GetTemporalLODOrigin(SampleIndex), View.ViewMatrices.GetProjectionMatrix())
 			* FactorScale * FactorScale * View.LODDistanceFactor * View.LODDistanceFactor;
+		ReportScreenSize(ScreenRadiusSquared);
 
 		// Walk backwards and return the first matching LOD
 		for (int32 LODIndex = NumLODs - 1; LODIndex >= 0; --LODIndex)
 		{
+			// LODs without render data, like ones evicted by LOD residency, are covered by their active neighbours
+			if (!RealtimeMeshProxy->IsLODActive(LODIndex))
+			{
+				continue;
+			}
+
 			const float LODSScreenSizeSquared = FMath::Square(RealtimeMeshProxy->GetScreenSizeRangeForLOD(LODIndex).GetLowerBoundValue() * 0.5f);
 			if (LODSScreenSizeSquared > ScreenRadiusSquared)
 			{
@@ -752,7 +968,7 @@ namespace RealtimeMesh
 			}
 		}
 
-		return MinLOD;
+		return FMath::Max(MinLOD, RealtimeMeshProxy->GetFirstLODIndex());
 	}
 
 	int8 FRealtimeMeshComponentSceneProxy::ComputeStaticMeshLOD(const FVector4& Origin, const float SphereRadius, const FSceneView& View, int32 MinLOD, float FactorScale) const
@@ -760,10 +976,16 @@ namespace RealtimeMesh
 		const FSceneView& LODView = GetLODView(View);
 		const float ScreenRadiusSquared = ComputeBoundsScreenRadiusSquared(Origin, SphereRadius, LODView) * FactorScale * FactorScale * LODView.LODDistanceFactor * LODView.
 			LODDistanceFactor;
+		ReportScreenSize(ScreenRadiusSquared);
 
 		// Walk backwards and return the first matching LOD
 		for (int32 LODIndex = RealtimeMeshProxy->GetNumLODs() - 1; LODIndex >= 0; --LODIndex)
 		{
+			if (!RealtimeMeshProxy->IsLODActive(LODIndex))
+			{
+				continue;
+			}
+
 			const float LODSScreenSizeSquared = FMath::Square(RealtimeMeshProxy->GetScreenSizeRangeForLOD(LODIndex).GetLowerBoundValue() * 0.5f);
 			if (LODSScreenSizeSquared > ScreenRadiusSquared)
 			{
@@ -771,7 +993,17 @@ namespace RealtimeMesh
 			}
 		}
 
-		return MinLOD;
+		return FMath::Max(MinLOD, RealtimeMeshProxy->GetFirstLODIndex());
+	}
+
+	void FRealtimeMeshComponentSceneProxy::ReportScreenSize(float ScreenRadiusSquared) const
+	{
+		const FRealtimeMeshSharedResourcesRef& SharedResources = RealtimeMeshProxy->GetSharedResources();
+		if (SharedResources->WantsScreenSizeFeedback())
+		{
+			// Same scale the LOD screen sizes are compared at above
+			SharedResources->ReportScreenSize(2.0f * FMath::Sqrt(ScreenRadiusSquared));
+		}
 	}
 
 
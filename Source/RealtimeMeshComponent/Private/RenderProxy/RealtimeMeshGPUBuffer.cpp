@@ -2,6 +2,7 @@
 
 #include "RenderProxy/RealtimeMeshGPUBuffer.h"
 #include "Data/RealtimeMeshUpdateBuilder.h"
+#include "RealtimeMeshCore.h"
 
 namespace RealtimeMesh
 {
@@ -70,7 +71,13 @@ namespace RealtimeMesh
 #endif
 			}
 			
-#endif			
+#endif
+
+			if (Buffer.IsValid())
+			{
+				INC_DWORD_STAT_BY(STAT_RealtimeMesh_GPUBytesUploaded, Stream.GetResourceDataSize());
+				FRealtimeMeshStatCounters::Get().GPUBytesUploaded += Stream.GetResourceDataSize();
+			}
 		}
 	}
 
@@ -127,6 +134,39 @@ namespace RealtimeMesh
 				Buffer =  RHICmdList.CreateIndexBuffer(Stream.GetElementStride(), Stream.GetResourceDataSize(), UsageFlags | BUF_IndexBuffer | BUF_ShaderResource, CreateInfo);
 			}
 #endif
+
+			INC_DWORD_STAT_BY(STAT_RealtimeMesh_GPUBytesUploaded, Stream.GetResourceDataSize());
+			FRealtimeMeshStatCounters::Get().GPUBytesUploaded += Stream.GetResourceDataSize();
+		}
+	}
+
+	void FRealtimeMeshGPUBuffer::TrackBufferMemory(const FBufferRHIRef& InBuffer)
+	{
+		UntrackBufferMemory();
+
+		if (InBuffer.IsValid())
+		{
+			TrackedMemorySize = InBuffer->GetSize();
+			INC_MEMORY_STAT_BY(STAT_RealtimeMesh_GPUBufferMemory, TrackedMemorySize);
+			INC_DWORD_STAT(STAT_RealtimeMesh_NumGPUBuffers);
+
+			FRealtimeMeshStatCounters& Counters = FRealtimeMeshStatCounters::Get();
+			Counters.GPUBufferMemory += TrackedMemorySize;
+			Counters.NumGPUBuffers++;
+		}
+	}
+
+	void FRealtimeMeshGPUBuffer::UntrackBufferMemory()
+	{
+		if (TrackedMemorySize > 0)
+		{
+			DEC_MEMORY_STAT_BY(STAT_RealtimeMesh_GPUBufferMemory, TrackedMemorySize);
+			DEC_DWORD_STAT(STAT_RealtimeMesh_NumGPUBuffers);
+
+			FRealtimeMeshStatCounters& Counters = FRealtimeMeshStatCounters::Get();
+			Counters.GPUBufferMemory -= TrackedMemorySize;
+			Counters.NumGPUBuffers--;
+			TrackedMemorySize = 0;
 		}
 	}
 }
@@ -0,0 +1,80 @@
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "RenderProxy/RealtimeMeshInstanceCulling.h"
+#include "SceneManagement.h"
+
+DECLARE_CYCLE_STAT(TEXT("RealtimeMeshInstanceCulling - Cull And Select LODs"), STAT_RealtimeMeshInstanceCulling_CullAndSelectLODs, STATGROUP_RealtimeMesh);
+
+namespace RealtimeMesh
+{
+	float FRealtimeMeshInstanceCulling::ComputeScreenRadiusSquared(const FRealtimeMeshInstanceCullingParams& Params, const FBoxSphereBounds& WorldBounds)
+	{
+		return ComputeBoundsScreenRadiusSquared(WorldBounds.Origin, WorldBounds.SphereRadius, Params.ViewOrigin, Params.ProjectionMatrix) *
+			Params.LODDistanceFactor * Params.LODDistanceFactor;
+	}
+
+	int32 FRealtimeMeshInstanceCulling::SelectLOD(const FRealtimeMeshInstanceCullingParams& Params, float ScreenRadiusSquared)
+	{
+		// Walk backwards and return the first matching LOD, as FRealtimeMeshComponentSceneProxy::ComputeStaticMeshLOD does
+		for (int32 LODIndex = Params.LODScreenSizes.Num() - 1; LODIndex >= 0; --LODIndex)
+		{
+			if (Params.ActiveLODs.IsValidIndex(LODIndex) && !Params.ActiveLODs[LODIndex])
+			{
+				continue;
+			}
+
+			const float LODScreenSizeSquared = FMath::Square(Params.LODScreenSizes[LODIndex] * 0.5f);
+			if (LODScreenSizeSquared > ScreenRadiusSquared)
+			{
+				return FMath::Max(LODIndex, Params.MinLOD);
+			}
+		}
+
+		return FMath::Max(Params.MinLOD, Params.FirstLOD);
+	}
+
+	void FRealtimeMeshInstanceCulling::CullAndSelectLODs(const FRealtimeMeshInstanceCullingParams& Params, TConstArrayView<FMatrix> InstanceToWorld, FRealtimeMeshInstanceCullingResult& OutResult)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshInstanceCulling::CullAndSelectLODs);
+		SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshInstanceCulling_CullAndSelectLODs);
+
+		const int32 NumLODs = FMath::Max(Params.LODScreenSizes.Num(), 1);
+		OutResult.Reset(NumLODs);
+
+		for (int32 InstanceIndex = 0; InstanceIndex < InstanceToWorld.Num(); InstanceIndex++)
+		{
+			const FBoxSphereBounds WorldBounds = Params.LocalBounds.TransformBy(InstanceToWorld[InstanceIndex]);
+
+			if (Params.ViewFrustum && !Params.ViewFrustum->IntersectBox(WorldBounds.Origin, WorldBounds.BoxExtent))
+			{
+				OutResult.NumCulled++;
+				continue;
+			}
+
+			const float ScreenRadiusSquared = ComputeScreenRadiusSquared(Params, WorldBounds);
+			OutResult.MaxScreenRadiusSquared = FMath::Max(OutResult.MaxScreenRadiusSquared, ScreenRadiusSquared);
+
+			const int32 LODIndex = FMath::Clamp(SelectLOD(Params, ScreenRadiusSquared), 0, NumLODs - 1);
+			OutResult.InstancesPerLOD[LODIndex].Add(InstanceIndex);
+			OutResult.NumVisible++;
+		}
+	}
+
+	void FRealtimeMeshInstanceCulling::BuildInstanceRuns(TConstArrayView<int32> SortedInstances, TArray<uint32>& OutRuns)
+	{
+		OutRuns.Reset();
+		for (const int32 InstanceIndex : SortedInstances)
+		{
+			check(OutRuns.Num() == 0 || static_cast<uint32>(InstanceIndex) > OutRuns.Last());
+			if (OutRuns.Num() > 0 && OutRuns.Last() + 1 == static_cast<uint32>(InstanceIndex))
+			{
+				OutRuns.Last() = InstanceIndex;
+			}
+			else
+			{
+				OutRuns.Add(InstanceIndex);
+				OutRuns.Add(InstanceIndex);
+			}
+		}
+	}
+}
@@ -0,0 +1,296 @@
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "RenderProxy/RealtimeMeshInstancedComponentProxy.h"
+
+#include "RealtimeMeshInstancedComponent.h"
+#include "RenderProxy/RealtimeMeshProxy.h"
+#include "RenderProxy/RealtimeMeshInstanceCulling.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialRenderProxy.h"
+#include "PrimitiveUniformShaderParametersBuilder.h"
+#include "RenderUtils.h"
+#include "SceneInterface.h"
+#include "SceneManagement.h"
+#include "UnrealEngine.h"
+#if RMC_ENGINE_ABOVE_5_6
+#include "SceneView.h"
+#endif
+
+DECLARE_CYCLE_STAT(TEXT("RealtimeMeshInstancedSceneProxy - Get Dynamic Mesh Elements"), STAT_RealtimeMeshInstancedSceneProxy_GetDynamicMeshElements, STATGROUP_RealtimeMesh);
+
+namespace RealtimeMesh
+{
+	/* Instance runs each LOD draws in one view, the batches point into these until the frame is done with them */
+	struct FRealtimeMeshInstanceRunsResource : public FOneFrameResource
+	{
+		TFixedLODArray<TArray<uint32>> RunsPerLOD;
+	};
+
+	FRealtimeMeshInstancedSceneProxy::FRealtimeMeshInstancedSceneProxy(URealtimeMeshInstancedComponent* Component, const FRealtimeMeshProxyRef& InRealtimeMeshProxy)
+		: FRealtimeMeshComponentSceneProxy(Component, InRealtimeMeshProxy)
+		, MeshLocalBounds(Component->GetRealtimeMesh()->GetLocalBounds())
+		, bUseGPUSceneInstancing(UseGPUScene(GMaxRHIShaderPlatform, GetScene().GetFeatureLevel()))
+	{
+		const TArray<FTransform>& InstanceTransforms = Component->GetInstanceTransforms();
+		InstanceToPrimitive.Reserve(InstanceTransforms.Num());
+		for (const FTransform& InstanceTransform : InstanceTransforms)
+		{
+			InstanceToPrimitive.Add(InstanceTransform.ToMatrixWithScale());
+		}
+
+		if (bUseGPUSceneInstancing)
+		{
+			UpdateInstanceSceneDataBuffers(Component->GetRenderMatrix());
+			SetupInstanceSceneDataBuffers(&InstanceSceneDataBuffers);
+		}
+
+		// Instances are culled and LOD'd per view, which the cached static path can't do
+		bAllowStaticRelevance = false;
+
+		// Distance fields and cards are built for a single instance at the primitive transform
+		bSupportsDistanceFieldRepresentation = false;
+		bCastsDynamicIndirectShadow = false;
+	}
+
+	void FRealtimeMeshInstancedSceneProxy::UpdateInstanceSceneDataBuffers(const FMatrix& PrimitiveLocalToWorld)
+	{
+		const FInstanceSceneDataBuffers::FAccessTag AccessTag(PointerHash(this));
+		InstanceSceneDataBuffers.SetPrimitiveLocalToWorld(PrimitiveLocalToWorld, AccessTag);
+
+		// The instances never move while the proxy lives, motion of the primitive itself is picked up by GPUScene from
+		// the primitive's previous transform, so there's no per instance previous transform to keep
+		FInstanceSceneDataBuffers::FWriteView InstanceData = InstanceSceneDataBuffers.BeginWriteAccess(AccessTag);
+		InstanceData.InstanceToPrimitiveRelative.SetNumUninitialized(InstanceToPrimitive.Num());
+		for (int32 InstanceIndex = 0; InstanceIndex < InstanceToPrimitive.Num(); InstanceIndex++)
+		{
+			InstanceData.InstanceToPrimitiveRelative[InstanceIndex] = InstanceSceneDataBuffers.ComputeInstanceToPrimitiveRelative(FMatrix44f(InstanceToPrimitive[InstanceIndex]), AccessTag);
+		}
+		InstanceData.InstanceLocalBounds.SetNumUninitialized(1);
+		InstanceData.InstanceLocalBounds[0] = FRenderBounds(MeshLocalBounds.GetBox());
+		InstanceSceneDataBuffers.EndWriteAccess(AccessTag);
+	}
+
+	void FRealtimeMeshInstancedSceneProxy::OnTransformChanged(FRHICommandListBase& RHICmdList)
+	{
+		FRealtimeMeshComponentSceneProxy::OnTransformChanged(RHICmdList);
+
+		// Instance transforms are stored relative to the primitive's world position
+		if (bUseGPUSceneInstancing)
+		{
+			UpdateInstanceSceneDataBuffers(GetLocalToWorld());
+		}
+	}
+
+	SIZE_T FRealtimeMeshInstancedSceneProxy::GetTypeHash() const
+	{
+		static size_t UniquePointer;
+		return reinterpret_cast<size_t>(&UniquePointer);
+	}
+
+	uint32 FRealtimeMeshInstancedSceneProxy::GetMemoryFootprint() const
+	{
+		return (sizeof(*this) + GetAllocatedSize() + InstanceToPrimitive.GetAllocatedSize());
+	}
+
+	FPrimitiveViewRelevance FRealtimeMeshInstancedSceneProxy::GetViewRelevance(const FSceneView* View) const
+	{
+		// Static groups draw through the dynamic path too, static relevance is never given to this proxy
+		FPrimitiveViewRelevance Result = FRealtimeMeshComponentSceneProxy::GetViewRelevance(View);
+		Result.bDynamicRelevance = GetRealtimeMeshProxy()->GetDrawMask().ShouldRender();
+		return Result;
+	}
+
+	void FRealtimeMeshInstancedSceneProxy::DrawStaticElements(FStaticPrimitiveDrawInterface* PDI)
+	{
+	}
+
+	void FRealtimeMeshInstancedSceneProxy::GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap,
+	                                                              FMeshElementCollector& Collector) const
+	{
+		SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshInstancedSceneProxy_GetDynamicMeshElements);
+
+		if (InstanceToPrimitive.IsEmpty())
+		{
+			return;
+		}
+
+		const FRealtimeMeshProxyRef& MeshProxy = GetRealtimeMeshProxy();
+
+		const bool bWireframe = AllowDebugViewmodes() && ViewFamily.EngineShowFlags.Wireframe;
+		FMaterialRenderProxy* WireframeMaterialInstance = nullptr;
+		if (bWireframe)
+		{
+			WireframeMaterialInstance = new FColoredMaterialRenderProxy(GEngine->WireframeMaterial ? GEngine->WireframeMaterial->GetRenderProxy() : nullptr,
+			                                                            FLinearColor(0.0f, 0.16f, 1.0f));
+			Collector.RegisterOneFrameMaterialProxy(WireframeMaterialInstance);
+		}
+
+		// Instance transforms are view independent, so resolve them once for all views
+		const FMatrix& LocalToWorld = GetLocalToWorld();
+		TArray<FMatrix> InstanceToWorld;
+		InstanceToWorld.SetNumUninitialized(InstanceToPrimitive.Num());
+		for (int32 InstanceIndex = 0; InstanceIndex < InstanceToPrimitive.Num(); InstanceIndex++)
+		{
+			InstanceToWorld[InstanceIndex] = InstanceToPrimitive[InstanceIndex] * LocalToWorld;
+		}
+
+		// Same LOD rule as ComputeStaticMeshLOD, so LODs without render data are skipped and never picked
+		FRealtimeMeshInstanceCullingParams CullingParams;
+		CullingParams.LocalBounds = MeshLocalBounds;
+		for (int32 LODIndex = 0; LODIndex < MeshProxy->GetNumLODs(); LODIndex++)
+		{
+			CullingParams.LODScreenSizes.Add(MeshProxy->GetScreenSizeRangeForLOD(LODIndex).GetLowerBoundValue());
+			CullingParams.ActiveLODs.Add(MeshProxy->IsLODActive(LODIndex));
+		}
+		CullingParams.FirstLOD = FMath::Max(MeshProxy->GetFirstLODIndex(), 0);
+
+		const FCachedSystemScalabilityCVars CachedSystemScalabilityCVars = GetCachedScalabilityCVars();
+		const float InvScreenSizeScale = (CachedSystemScalabilityCVars.StaticMeshLODDistanceScale != 0.f) ? (1.0f / CachedSystemScalabilityCVars.StaticMeshLODDistanceScale) : 1.0f;
+
+		// Without GPUScene each instance gets at most one primitive uniform buffer per frame, shared between views
+		TArray<FDynamicPrimitiveUniformBuffer*> InstanceUniformBuffers;
+		FMatrix PreviousLocalToWorld = LocalToWorld;
+		bool bOutputVelocity = false;
+		if (!bUseGPUSceneInstancing)
+		{
+			InstanceUniformBuffers.SetNumZeroed(InstanceToPrimitive.Num());
+
+			bool bHasPrecomputedVolumetricLightmap;
+			int32 SingleCaptureIndex;
+			GetScene().GetPrimitiveUniformShaderParameters_RenderThread(GetPrimitiveSceneInfo(), bHasPrecomputedVolumetricLightmap, PreviousLocalToWorld, SingleCaptureIndex, bOutputVelocity);
+		}
+
+		FScopeLock TemplatesLock(&DynamicBatchTemplatesLock);
+		UpdateDynamicBatchTemplates();
+
+		FRealtimeMeshInstanceCullingResult CullingResult;
+		for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ViewIndex++)
+		{
+			const FSceneView* View = Views[ViewIndex];
+			if (!IsShown(View) || !(VisibilityMap & (1 << ViewIndex)))
+			{
+				continue;
+			}
+
+			const FSceneView& LODView = GetLODView(*View);
+			CullingParams.ViewFrustum = &View->ViewFrustum;
+			CullingParams.ViewOrigin = LODView.ViewMatrices.GetViewOrigin();
+			CullingParams.ProjectionMatrix = LODView.ViewMatrices.GetProjectionMatrix();
+			CullingParams.LODDistanceFactor = InvScreenSizeScale * LODView.LODDistanceFactor;
+			CullingParams.MinLOD = (View->DrawDynamicFlags & EDrawDynamicFlags::ForceLowestLOD) ? FMath::Max(MeshProxy->GetLastLODIndex(), 0) : 0;
+
+			FRealtimeMeshInstanceCulling::CullAndSelectLODs(CullingParams, InstanceToWorld, CullingResult);
+			if (CullingResult.NumVisible > 0)
+			{
+				// The largest visible instance decides which LODs this view still needs resident
+				ReportScreenSize(CullingResult.MaxScreenRadiusSquared);
+			}
+
+			if (bUseGPUSceneInstancing)
+			{
+				FRealtimeMeshInstanceRunsResource& InstanceRuns = Collector.AllocateOneFrameResource<FRealtimeMeshInstanceRunsResource>();
+				InstanceRuns.RunsPerLOD.SetNum(CullingResult.InstancesPerLOD.Num());
+				for (int32 LODIndex = 0; LODIndex < CullingResult.InstancesPerLOD.Num(); LODIndex++)
+				{
+					FRealtimeMeshInstanceCulling::BuildInstanceRuns(CullingResult.InstancesPerLOD[LODIndex], InstanceRuns.RunsPerLOD[LODIndex]);
+				}
+
+				// One batch per section draws every visible instance of its LOD, GPUScene supplies each instance's transform
+				for (const FDynamicMeshBatchTemplate& Template : DynamicBatchTemplates)
+				{
+					if (!InstanceRuns.RunsPerLOD.IsValidIndex(Template.LODIndex) || InstanceRuns.RunsPerLOD[Template.LODIndex].IsEmpty())
+					{
+						continue;
+					}
+					const TArray<uint32>& Runs = InstanceRuns.RunsPerLOD[Template.LODIndex];
+
+					FMeshBatch& MeshBatch = Collector.AllocateMesh();
+					MeshBatch = Template.MeshBatch;
+
+					if (WireframeMaterialInstance)
+					{
+						MeshBatch.MaterialRenderProxy = WireframeMaterialInstance;
+					}
+					MeshBatch.bWireframe = bWireframe;
+					MeshBatch.bDitheredLODTransition = false;
+
+					FMeshBatchElement& BatchElement = MeshBatch.Elements[0];
+					BatchElement.bIsInstanceRuns = true;
+					BatchElement.InstanceRuns = Runs.GetData();
+					BatchElement.NumInstances = Runs.Num() / 2;
+
+					Collector.AddMesh(ViewIndex, MeshBatch);
+				}
+				continue;
+			}
+
+			for (const FDynamicMeshBatchTemplate& Template : DynamicBatchTemplates)
+			{
+				if (!CullingResult.InstancesPerLOD.IsValidIndex(Template.LODIndex))
+				{
+					continue;
+				}
+
+				for (const int32 InstanceIndex : CullingResult.InstancesPerLOD[Template.LODIndex])
+				{
+					FDynamicPrimitiveUniformBuffer*& InstanceUniformBuffer = InstanceUniformBuffers[InstanceIndex];
+					if (InstanceUniformBuffer == nullptr)
+					{
+						const FMatrix& InstanceLocalToWorld = InstanceToWorld[InstanceIndex];
+
+						FPrimitiveUniformShaderParametersBuilder Builder;
+						BuildUniformShaderParameters(Builder);
+						Builder
+							.LocalToWorld(InstanceLocalToWorld)
+							.PreviousLocalToWorld(InstanceToPrimitive[InstanceIndex] * PreviousLocalToWorld)
+							.OutputVelocity(bOutputVelocity)
+							.WorldBounds(MeshLocalBounds.TransformBy(InstanceLocalToWorld))
+							.LocalBounds(MeshLocalBounds);
+
+						InstanceUniformBuffer = &Collector.AllocateOneFrameResource<FDynamicPrimitiveUniformBuffer>();
+						InstanceUniformBuffer->Set(Collector.GetRHICommandList(), Builder);
+					}
+
+					FMeshBatch& MeshBatch = Collector.AllocateMesh();
+					MeshBatch = Template.MeshBatch;
+
+					if (WireframeMaterialInstance)
+					{
+						MeshBatch.MaterialRenderProxy = WireframeMaterialInstance;
+					}
+					MeshBatch.bWireframe = bWireframe;
+					MeshBatch.bDitheredLODTransition = false;
+
+					// The shared batch points at the primitive uniform buffer, swap in the instance's own transform
+					FMeshBatchElement& BatchElement = MeshBatch.Elements[0];
+					BatchElement.PrimitiveUniformBuffer = nullptr;
+					BatchElement.PrimitiveUniformBufferResource = &InstanceUniformBuffer->UniformBuffer;
+
+					Collector.AddMesh(ViewIndex, MeshBatch);
+				}
+			}
+		}
+
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+		for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ViewIndex++)
+		{
+			if (VisibilityMap & (1 << ViewIndex))
+			{
+				RenderBounds(Collector.GetPDI(ViewIndex), ViewFamily.EngineShowFlags, GetBounds(), IsSelected());
+			}
+		}
+#endif
+	}
+
+#if RHI_RAYTRACING
+	void FRealtimeMeshInstancedSceneProxy::GatherRayTracingInstanceTransforms(TArray<FMatrix>& OutTransforms) const
+	{
+		const FMatrix& LocalToWorld = GetLocalToWorld();
+		OutTransforms.Reserve(OutTransforms.Num() + InstanceToPrimitive.Num());
+		for (const FMatrix& InstanceTransform : InstanceToPrimitive)
+		{
+			OutTransforms.Add(InstanceTransform * LocalToWorld);
+		}
+	}
+#endif
+}
@@ -2,7 +2,6 @@
 
 #include "RenderProxy/RealtimeMeshLODProxy.h"
 
-#include "Algo/IndexOf.h"
 #include "Data/RealtimeMeshShared.h"
 #include "Core/RealtimeMeshLODConfig.h"
 #include "RenderProxy/RealtimeMeshSectionGroupProxy.h"
@@ -26,50 +25,87 @@ namespace RealtimeMesh
 	{
 		check(SectionGroupKey.IsPartOf(Key));
 
-		if (SectionGroupMap.Contains(SectionGroupKey))
+		if (const FRealtimeMeshHandle* SectionGroupHandle = SectionGroupMap.Find(SectionGroupKey))
 		{
-			return SectionGroups[SectionGroupMap[SectionGroupKey]];
+			return GetSectionGroup(*SectionGroupHandle);
 		}
 		return FRealtimeMeshSectionGroupProxyPtr();
 	}
 
+	FRealtimeMeshSectionGroupProxyPtr FRealtimeMeshLODProxy::GetSectionGroup(const FRealtimeMeshHandle& SectionGroupHandle) const
+	{
+		if (const FRealtimeMeshSectionGroupProxyRef* SectionGroup = SectionGroups.Find(SectionGroupHandle))
+		{
+			return *SectionGroup;
+		}
+		return FRealtimeMeshSectionGroupProxyPtr();
+	}
+
+	FRealtimeMeshHandle FRealtimeMeshLODProxy::FindSectionGroupHandle(const FRealtimeMeshSectionGroupKey& SectionGroupKey) const
+	{
+		return SectionGroupMap.FindRef(SectionGroupKey);
+	}
+
 	void FRealtimeMeshLODProxy::UpdateConfig(const FRealtimeMeshLODConfig& NewConfig)
 	{
 		Config = NewConfig;
 	}
 
-	void FRealtimeMeshLODProxy::CreateSectionGroupIfNotExists(const FRealtimeMeshSectionGroupKey& SectionGroupKey)
+	void FRealtimeMeshLODProxy::CreateSectionGroupIfNotExists(const FRealtimeMeshSectionGroupKey& SectionGroupKey, const FRealtimeMeshHandle& SectionGroupHandle)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshLODProxy::CreateSectionGroupIfNotExists);
 		
 		check(SectionGroupKey.IsPartOf(Key));
+		check(SectionGroupHandle.IsSet());
 
-		// Does this section already exist
-		if (!SectionGroupMap.Contains(SectionGroupKey))
+		// Does this section group already exist
+		if (SectionGroups.IsValidHandle(SectionGroupHandle))
 		{
-			const int32 SectionGroupIndex = SectionGroups.Add(SharedResources->CreateSectionGroupProxy(SectionGroupKey));
-			SectionGroupMap.Add(SectionGroupKey, SectionGroupIndex);
+			return;
 		}
+
+		// Anything still at this slot, or still under this key, was dropped on the game thread without the proxy hearing about it
+		if (SectionGroups.IsAllocated(SectionGroupHandle.Index))
+		{
+			SectionGroupMap.Remove(SectionGroups[SectionGroupHandle.Index]->GetKey());
+		}
+		FRealtimeMeshHandle StaleHandle;
+		if (SectionGroupMap.RemoveAndCopyValue(SectionGroupKey, StaleHandle))
+		{
+			SectionGroups.Remove(StaleHandle);
+		}
+
+		SectionGroups.EmplaceAt(SectionGroupHandle, SharedResources->CreateSectionGroupProxy(SectionGroupKey));
+		SectionGroupMap.Add(SectionGroupKey, SectionGroupHandle);
 	}
 
-	void FRealtimeMeshLODProxy::RemoveSectionGroup(const FRealtimeMeshSectionGroupKey& SectionGroupKey)
+	void FRealtimeMeshLODProxy::RemoveSectionGroup(const FRealtimeMeshHandle& SectionGroupHandle)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshLODProxy::RemoveSectionGroup);
-		
-		check(SectionGroupKey.IsPartOf(Key));
 
-		if (SectionGroupMap.Contains(SectionGroupKey))
+		// The slot is recycled in place, so no other section group moves and the map needs no rebuild
+		if (const FRealtimeMeshSectionGroupProxyRef* SectionGroup = SectionGroups.Find(SectionGroupHandle))
 		{
-			const int32 SectionGroupIndex = SectionGroupMap[SectionGroupKey];
-			SectionGroups.RemoveAt(SectionGroupIndex);
-			RebuildSectionGroupMap();
+			SectionGroupMap.Remove((*SectionGroup)->GetKey());
+			SectionGroups.Remove(SectionGroupHandle);
 		}
 	}
 
 #if RHI_RAYTRACING
 	FRayTracingGeometry* FRealtimeMeshLODProxy::GetStaticRayTracingGeometry() const
 	{
-		return SectionGroups.IsValidIndex(StaticRayTraceSectionGroup)? SectionGroups[StaticRayTraceSectionGroup]->GetRayTracingGeometry() : nullptr;
+		return SectionGroups.IsAllocated(StaticRayTraceSectionGroup)? SectionGroups[StaticRayTraceSectionGroup]->GetRayTracingGeometry() : nullptr;
+	}
+
+	uint32 FRealtimeMeshLODProxy::GetStaticRayTracingRevision() const
+	{
+		if (!SectionGroups.IsAllocated(StaticRayTraceSectionGroup))
+		{
+			return 0;
+		}
+
+		const FRealtimeMeshSectionGroupProxyRef& SectionGroup = SectionGroups[StaticRayTraceSectionGroup];
+		return HashCombine(PointerHash(SectionGroup->GetRayTracingGeometry()), ::GetTypeHash(SectionGroup->GetRayTracingRevision()));
 	}
 #endif
 	
@@ -84,8 +120,8 @@ namespace RealtimeMesh
 		}
 
 		DrawMask = FRealtimeMeshDrawMask();
-		ActiveSectionGroupMask.SetNumUninitialized(SectionGroups.Num());
-		ActiveSectionGroupMask.SetRange(0, SectionGroups.Num(), false);
+		ActiveSectionGroupMask.SetNumUninitialized(SectionGroups.GetMaxIndex());
+		ActiveSectionGroupMask.SetRange(0, SectionGroups.GetMaxIndex(), false);
 		if (Config.bIsVisible && Config.ScreenSize >= 0)
 		{
 			uint32 RayTracingRelevantSectionGroupCount = 0;
@@ -113,10 +149,15 @@ namespace RealtimeMesh
 #if RHI_RAYTRACING
 		if (DrawMask.CanRenderInStaticRayTracing())
 		{
-			StaticRayTraceSectionGroup = Algo::IndexOfByPredicate(SectionGroups, [](const FRealtimeMeshSectionGroupProxyRef& SectionGroup)
+			StaticRayTraceSectionGroup = INDEX_NONE;
+			for (auto It = SectionGroups.CreateConstIterator(); It; ++It)
 			{
-				return SectionGroup->GetDrawMask().CanRenderInStaticRayTracing();
-			});		
+				if ((*It)->GetDrawMask().CanRenderInStaticRayTracing())
+				{
+					StaticRayTraceSectionGroup = It.GetIndex();
+					break;
+				}
+			}
 		}
 		else
 		{
@@ -125,15 +166,6 @@ namespace RealtimeMesh
 #endif
 	}
 
-	void FRealtimeMeshLODProxy::RebuildSectionGroupMap()
-	{
-		SectionGroupMap.Empty();
-		for (auto It = SectionGroups.CreateIterator(); It; ++It)
-		{
-			SectionGroupMap.Add((*It)->GetKey(), It.GetIndex());
-		}
-	}
-
 	void FRealtimeMeshLODProxy::Reset()
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshLODProxy::Reset);
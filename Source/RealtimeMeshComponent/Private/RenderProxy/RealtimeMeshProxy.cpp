@@ -8,6 +8,19 @@
 #include "Data/RealtimeMeshShared.h"
 #include "Mesh/RealtimeMeshNaniteResourcesInterface.h"
 #include "RenderProxy/RealtimeMeshLODProxy.h"
+#include "RealtimeMeshCore.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("RealtimeMeshProxy - Process Commands"), STAT_RealtimeMeshProxy_ProcessCommands, STATGROUP_RealtimeMesh);
+DECLARE_CYCLE_STAT(TEXT("RealtimeMeshProxy - Update Cached State"), STAT_RealtimeMeshProxy_UpdateCachedState, STATGROUP_RealtimeMesh);
+DECLARE_DWORD_COUNTER_STAT(TEXT("RealtimeMeshProxy - Coalesced Commands"), STAT_RealtimeMeshProxy_CoalescedCommands, STATGROUP_RealtimeMesh);
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshCoalesceProxyCommands(
+	TEXT("RealtimeMesh.Proxy.CoalesceCommands"),
+	1,
+	TEXT("Merge all pending proxy command batches before executing them, dropping stream uploads and section group work that a later command overwrites or removes.\n")
+	TEXT("0 = replay every batch as queued, 1 = coalesce (default)"),
+	ECVF_Default);
 
 namespace RealtimeMesh
 {
@@ -188,27 +201,61 @@ namespace RealtimeMesh
 	}
 #endif
 
-	void FRealtimeMeshProxy::EnqueueCommandBatch(TArray<FRealtimeMeshProxyUpdateBuilder::TaskFunctionType>&& InTasks, const TSharedPtr<FRealtimeMeshCommandBatchIntermediateFuture>& ThreadState)
+	void FRealtimeMeshProxy::EnqueueCommandBatch(TArray<FRealtimeMeshProxyCommand>&& InCommands, const TSharedPtr<FRealtimeMeshCommandBatchIntermediateFuture>& ThreadState)
 	{
-		CommandQueue.Enqueue(FCommandBatch { MoveTemp(InTasks), ThreadState });
+		CommandQueue.Enqueue(FCommandBatch { MoveTemp(InCommands), ThreadState });
 	}
 
 	void FRealtimeMeshProxy::ProcessCommands(FRHICommandListBase& RHICmdList)
 	{
-		FScopeLock Lock(&CommandQueueLock);
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshProxy::ProcessCommands);
+		SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshProxy_ProcessCommands);
+		CSV_SCOPED_TIMING_STAT(RealtimeMesh, ProcessCommands);
 		
-		bool bHadAnyUpdates = false;
+		FScopeLock Lock(&CommandQueueLock);
+
+		// Gather everything pending so the batches can be merged as one command list
+		TArray<FRealtimeMeshProxyCommand> Commands;
+		TArray<TSharedPtr<FRealtimeMeshCommandBatchIntermediateFuture>, TInlineAllocator<4>> ThreadStates;
 		while (!CommandQueue.IsEmpty())
 		{
 			auto Entry = CommandQueue.Dequeue();
-			for (const auto& Task : Entry->Tasks)
+			if (Commands.IsEmpty())
+			{
+				Commands = MoveTemp(Entry->Commands);
+			}
+			else
 			{
-				Task(RHICmdList, *this);
+				Commands.Append(MoveTemp(Entry->Commands));
 			}
-			Entry->ThreadState->FinalizeRenderThread(ERealtimeMeshProxyUpdateStatus::Updated);
-			bHadAnyUpdates = true;
+			ThreadStates.Add(Entry->ThreadState);
+		}
+
+		const bool bHadAnyUpdates = ThreadStates.Num() > 0;
+
+		if (CVarRealtimeMeshCoalesceProxyCommands.GetValueOnAnyThread() != 0 && Commands.Num() > 1)
+		{
+			const int32 NumCoalesced = FRealtimeMeshProxyCommand::Coalesce(Commands);
+			INC_DWORD_STAT_BY(STAT_RealtimeMeshProxy_CoalescedCommands, NumCoalesced);
+			FRealtimeMeshStatCounters::Get().ProxyCommandsCoalesced += NumCoalesced;
+		}
+
+		FRealtimeMeshProxyCommandContext Context(*this);
+		for (FRealtimeMeshProxyCommand& Command : Commands)
+		{
+			Command.Execute(RHICmdList, Context);
 		}
 
+		for (const auto& ThreadState : ThreadStates)
+		{
+			ThreadState->FinalizeRenderThread(ERealtimeMeshProxyUpdateStatus::Updated);
+		}
+
+		INC_DWORD_STAT_BY(STAT_RealtimeMesh_ProxyCommandBatches, ThreadStates.Num());
+		INC_DWORD_STAT_BY(STAT_RealtimeMesh_ProxyCommands, Commands.Num());
+		FRealtimeMeshStatCounters::Get().ProxyCommandBatches += ThreadStates.Num();
+		FRealtimeMeshStatCounters::Get().ProxyCommands += Commands.Num();
+
 		if (bHadAnyUpdates)
 		{
 			UpdatedCachedState(RHICmdList);
@@ -218,6 +265,8 @@ namespace RealtimeMesh
 	void FRealtimeMeshProxy::UpdatedCachedState(FRHICommandListBase& RHICmdList)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshProxy::UpdatedCachedState);
+		SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshProxy_UpdateCachedState);
+		CSV_SCOPED_TIMING_STAT(RealtimeMesh, UpdateCachedState);
 		
 		// Handle all LOD updates next
 		for (const auto& LOD : LODs)
@@ -256,6 +305,22 @@ namespace RealtimeMesh
 		}
 		
 		check(!DrawMask.HasAnyFlags() || ActiveLODMask.CountSetBits() > 0);
+
+		StateVersion++;
+
+#if RHI_RAYTRACING
+		uint32 NewStaticRayTracingSignature = ::GetTypeHash(DrawMask.CanRenderInStaticRayTracing());
+		for (const auto& LOD : LODs)
+		{
+			NewStaticRayTracingSignature = HashCombine(NewStaticRayTracingSignature, LOD->GetStaticRayTracingRevision());
+		}
+
+		if (NewStaticRayTracingSignature != StaticRayTracingSignature)
+		{
+			StaticRayTracingSignature = NewStaticRayTracingSignature;
+			StaticRayTracingChangedEvent.Broadcast();
+		}
+#endif
 	}
 
 	void FRealtimeMeshProxy::Reset()
@@ -270,5 +335,6 @@ namespace RealtimeMesh
 		ScreenPercentageNextLODMask.SetRange(0, REALTIME_MESH_MAX_LODS, false);
 		ActiveStaticLODMask.SetRange(0, REALTIME_MESH_MAX_LODS, false);
 		ActiveDynamicLODMask.SetRange(0, REALTIME_MESH_MAX_LODS, false);
+		StateVersion++;
 	}
 }
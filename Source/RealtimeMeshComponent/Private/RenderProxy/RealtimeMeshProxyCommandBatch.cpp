@@ -9,6 +9,12 @@
 #include "RenderProxy/RealtimeMeshLODProxy.h"
 #include "RenderProxy/RealtimeMeshProxy.h"
 #include "RenderProxy/RealtimeMeshSectionGroupProxy.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshIncrementalStaticUpdates(
+	TEXT("RealtimeMesh.Proxy.IncrementalStaticUpdates"),
+	1,
+	TEXT("Apply in place changes to static draw section groups by re-caching static mesh draw commands instead of recreating the scene proxy. (0 = always recreate)"));
 
 namespace RealtimeMesh
 {
@@ -51,49 +57,301 @@ namespace RealtimeMesh
 
 	
 	
-	void FRealtimeMeshProxyUpdateBuilder::AddMeshTask(TUniqueFunction<void(FRHICommandListBase&, FRealtimeMeshProxy&)>&& Function, bool bInRequiresProxyRecreate)
+	FRealtimeMeshLODProxy* FRealtimeMeshProxyCommandContext::FindLOD(const FRealtimeMeshLODKey& LODKey) const
+	{
+		return Proxy.GetLOD(LODKey).Get();
+	}
+
+	FRealtimeMeshSectionGroupProxy* FRealtimeMeshProxyCommandContext::FindSectionGroup(const FRealtimeMeshLODKey& LODKey, const FRealtimeMeshHandle& SectionGroupHandle) const
+	{
+		const FRealtimeMeshLODProxy* LOD = FindLOD(LODKey);
+		return LOD ? LOD->GetSectionGroup(SectionGroupHandle).Get() : nullptr;
+	}
+
+	FRealtimeMeshSectionProxy* FRealtimeMeshProxyCommandContext::FindSection(const FRealtimeMeshLODKey& LODKey, const FRealtimeMeshHandle& SectionGroupHandle,
+		const FRealtimeMeshHandle& SectionHandle) const
+	{
+		const FRealtimeMeshSectionGroupProxy* SectionGroup = FindSectionGroup(LODKey, SectionGroupHandle);
+		return SectionGroup ? SectionGroup->GetSection(SectionHandle).Get() : nullptr;
+	}
+
+
+	FRealtimeMeshProxyCommand FRealtimeMeshProxyCommand::MakeTask(FunctionType&& InFunction)
+	{
+		FRealtimeMeshProxyCommand Command;
+		Command.Target = ERealtimeMeshProxyCommandTarget::Mesh;
+		Command.Function = MoveTemp(InFunction);
+		return Command;
+	}
+
+	FRealtimeMeshProxyCommand FRealtimeMeshProxyCommand::MakeTask(const FRealtimeMeshLODKey& InLODKey, FunctionType&& InFunction)
+	{
+		FRealtimeMeshProxyCommand Command;
+		Command.Target = ERealtimeMeshProxyCommandTarget::LOD;
+		Command.LODKey = InLODKey;
+		Command.Function = MoveTemp(InFunction);
+		return Command;
+	}
+
+	FRealtimeMeshProxyCommand FRealtimeMeshProxyCommand::MakeTask(const FRealtimeMeshSectionGroupKey& InSectionGroupKey, const FRealtimeMeshHandle& InSectionGroupHandle,
+		FunctionType&& InFunction)
+	{
+		FRealtimeMeshProxyCommand Command;
+		Command.Target = ERealtimeMeshProxyCommandTarget::SectionGroup;
+		Command.LODKey = InSectionGroupKey.LOD();
+		Command.SectionGroupKey = InSectionGroupKey;
+		Command.SectionGroupHandle = InSectionGroupHandle;
+		Command.Function = MoveTemp(InFunction);
+		return Command;
+	}
+
+	FRealtimeMeshProxyCommand FRealtimeMeshProxyCommand::MakeTask(const FRealtimeMeshSectionKey& InSectionKey, const FRealtimeMeshHandle& InSectionGroupHandle,
+		const FRealtimeMeshHandle& InSectionHandle, FunctionType&& InFunction)
+	{
+		FRealtimeMeshProxyCommand Command;
+		Command.Target = ERealtimeMeshProxyCommandTarget::Section;
+		Command.LODKey = InSectionKey.LOD();
+		Command.SectionGroupKey = InSectionKey.SectionGroup();
+		Command.SectionKey = InSectionKey;
+		Command.SectionGroupHandle = InSectionGroupHandle;
+		Command.SectionHandle = InSectionHandle;
+		Command.Function = MoveTemp(InFunction);
+		return Command;
+	}
+
+	FRealtimeMeshProxyCommand FRealtimeMeshProxyCommand::MakeCreateSectionGroup(const FRealtimeMeshSectionGroupKey& InSectionGroupKey, const FRealtimeMeshHandle& InSectionGroupHandle)
+	{
+		FRealtimeMeshProxyCommand Command;
+		Command.Type = ERealtimeMeshProxyCommandType::CreateSectionGroup;
+		Command.Target = ERealtimeMeshProxyCommandTarget::LOD;
+		Command.LODKey = InSectionGroupKey.LOD();
+		Command.SectionGroupKey = InSectionGroupKey;
+		Command.SectionGroupHandle = InSectionGroupHandle;
+		return Command;
+	}
+
+	FRealtimeMeshProxyCommand FRealtimeMeshProxyCommand::MakeRemoveSectionGroup(const FRealtimeMeshSectionGroupKey& InSectionGroupKey, const FRealtimeMeshHandle& InSectionGroupHandle)
+	{
+		FRealtimeMeshProxyCommand Command;
+		Command.Type = ERealtimeMeshProxyCommandType::RemoveSectionGroup;
+		Command.Target = ERealtimeMeshProxyCommandTarget::LOD;
+		Command.LODKey = InSectionGroupKey.LOD();
+		Command.SectionGroupKey = InSectionGroupKey;
+		Command.SectionGroupHandle = InSectionGroupHandle;
+		return Command;
+	}
+
+	FRealtimeMeshProxyCommand FRealtimeMeshProxyCommand::MakeCreateOrUpdateStream(const FRealtimeMeshSectionGroupKey& InSectionGroupKey, const FRealtimeMeshHandle& InSectionGroupHandle,
+		const FRealtimeMeshSectionGroupStreamUpdateDataRef& InStreamData)
+	{
+		FRealtimeMeshProxyCommand Command;
+		Command.Type = ERealtimeMeshProxyCommandType::CreateOrUpdateStream;
+		Command.Target = ERealtimeMeshProxyCommandTarget::SectionGroup;
+		Command.LODKey = InSectionGroupKey.LOD();
+		Command.SectionGroupKey = InSectionGroupKey;
+		Command.SectionGroupHandle = InSectionGroupHandle;
+		Command.StreamKey = InStreamData->GetStreamKey();
+		Command.StreamData = InStreamData;
+		return Command;
+	}
+
+	FRealtimeMeshProxyCommand FRealtimeMeshProxyCommand::MakeRemoveStream(const FRealtimeMeshSectionGroupKey& InSectionGroupKey, const FRealtimeMeshHandle& InSectionGroupHandle,
+		const FRealtimeMeshStreamKey& InStreamKey)
+	{
+		FRealtimeMeshProxyCommand Command;
+		Command.Type = ERealtimeMeshProxyCommandType::RemoveStream;
+		Command.Target = ERealtimeMeshProxyCommandTarget::SectionGroup;
+		Command.LODKey = InSectionGroupKey.LOD();
+		Command.SectionGroupKey = InSectionGroupKey;
+		Command.SectionGroupHandle = InSectionGroupHandle;
+		Command.StreamKey = InStreamKey;
+		return Command;
+	}
+
+	void FRealtimeMeshProxyCommand::Execute(FRHICommandListBase& RHICmdList, FRealtimeMeshProxyCommandContext& Context)
+	{
+		switch (Type)
+		{
+		case ERealtimeMeshProxyCommandType::CreateSectionGroup:
+			if (FRealtimeMeshLODProxy* LOD = Context.FindLOD(LODKey); ensure(LOD))
+			{
+				LOD->CreateSectionGroupIfNotExists(SectionGroupKey, SectionGroupHandle);
+			}
+			break;
+
+		case ERealtimeMeshProxyCommandType::RemoveSectionGroup:
+			if (FRealtimeMeshLODProxy* LOD = Context.FindLOD(LODKey); ensure(LOD))
+			{
+				LOD->RemoveSectionGroup(SectionGroupHandle);
+			}
+			break;
+
+		case ERealtimeMeshProxyCommandType::CreateOrUpdateStream:
+			if (FRealtimeMeshSectionGroupProxy* SectionGroup = Context.FindSectionGroup(LODKey, SectionGroupHandle); ensure(SectionGroup))
+			{
+				SectionGroup->CreateOrUpdateStream(RHICmdList, StreamData.ToSharedRef());
+			}
+			break;
+
+		case ERealtimeMeshProxyCommandType::RemoveStream:
+			if (FRealtimeMeshSectionGroupProxy* SectionGroup = Context.FindSectionGroup(LODKey, SectionGroupHandle); ensure(SectionGroup))
+			{
+				SectionGroup->RemoveStream(StreamKey);
+			}
+			break;
+
+		default:
+			Function(RHICmdList, Context);
+			break;
+		}
+	}
+
+	int32 FRealtimeMeshProxyCommand::Coalesce(TArray<FRealtimeMeshProxyCommand>& Commands)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshProxyCommand::Coalesce);
+
+		// Walk backwards so that we always know what happens to each target later in the list.
+		// Section group handles are only unique within their LOD, and a recreated section group always gets a new one.
+		using FSectionGroupTarget = TPair<FRealtimeMeshLODKey, FRealtimeMeshHandle>;
+		TSet<TPair<FSectionGroupTarget, FRealtimeMeshStreamKey>> StreamsWrittenLater;
+		TSet<FSectionGroupTarget> SectionGroupsRemovedLater;
+		TBitArray<> CommandsToKeep(true, Commands.Num());
+		int32 NumRemoved = 0;
+
+		for (int32 Index = Commands.Num() - 1; Index >= 0; Index--)
+		{
+			const FRealtimeMeshProxyCommand& Command = Commands[Index];
+
+			if (Command.IsMergeBarrier())
+			{
+				StreamsWrittenLater.Reset();
+				SectionGroupsRemovedLater.Reset();
+				continue;
+			}
+
+			// Only section group/section level commands carry a section group handle, and they die with the section group
+			const FSectionGroupTarget SectionGroupTarget(Command.LODKey, Command.SectionGroupHandle);
+			if (SectionGroupsRemovedLater.Contains(SectionGroupTarget))
+			{
+				CommandsToKeep[Index] = false;
+				NumRemoved++;
+				continue;
+			}
+
+			if (Command.Type == ERealtimeMeshProxyCommandType::CreateOrUpdateStream || Command.Type == ERealtimeMeshProxyCommandType::RemoveStream)
+			{
+				bool bAlreadyWritten = false;
+				StreamsWrittenLater.Add(MakeTuple(SectionGroupTarget, Command.StreamKey), &bAlreadyWritten);
+				if (bAlreadyWritten)
+				{
+					CommandsToKeep[Index] = false;
+					NumRemoved++;
+				}
+			}
+			else if (Command.Type == ERealtimeMeshProxyCommandType::RemoveSectionGroup)
+			{
+				SectionGroupsRemovedLater.Add(SectionGroupTarget);
+			}
+		}
+
+		if (NumRemoved > 0)
+		{
+			TArray<FRealtimeMeshProxyCommand> Remaining;
+			Remaining.Reserve(Commands.Num() - NumRemoved);
+			for (int32 Index = 0; Index < Commands.Num(); Index++)
+			{
+				if (CommandsToKeep[Index])
+				{
+					Remaining.Add(MoveTemp(Commands[Index]));
+				}
+			}
+			Commands = MoveTemp(Remaining);
+		}
+
+		return NumRemoved;
+	}
+
+	
+	
+	void FRealtimeMeshProxyUpdateBuilder::AddCommand(FRealtimeMeshProxyCommand&& Command, bool bInRequiresProxyRecreate)
 	{
 		bRequiresProxyRecreate |= bInRequiresProxyRecreate;
-		Tasks.Add(MoveTemp(Function));
+		Commands.Add(MoveTemp(Command));
+	}
+
+	void FRealtimeMeshProxyUpdateBuilder::AddCreateSectionGroupCommand(const FRealtimeMeshSectionGroupKey& SectionGroupKey, const FRealtimeMeshHandle& SectionGroupHandle,
+		bool bInRequiresProxyRecreate)
+	{
+		AddCommand(FRealtimeMeshProxyCommand::MakeCreateSectionGroup(SectionGroupKey, SectionGroupHandle), bInRequiresProxyRecreate);
+	}
+
+	void FRealtimeMeshProxyUpdateBuilder::AddRemoveSectionGroupCommand(const FRealtimeMeshSectionGroupKey& SectionGroupKey, const FRealtimeMeshHandle& SectionGroupHandle,
+		bool bInRequiresProxyRecreate)
+	{
+		AddCommand(FRealtimeMeshProxyCommand::MakeRemoveSectionGroup(SectionGroupKey, SectionGroupHandle), bInRequiresProxyRecreate);
+	}
+
+	void FRealtimeMeshProxyUpdateBuilder::AddCreateOrUpdateStreamCommand(const FRealtimeMeshSectionGroupKey& SectionGroupKey, const FRealtimeMeshHandle& SectionGroupHandle,
+		const FRealtimeMeshSectionGroupStreamUpdateDataRef& StreamData, bool bInRequiresProxyRecreate)
+	{
+		AddCommand(FRealtimeMeshProxyCommand::MakeCreateOrUpdateStream(SectionGroupKey, SectionGroupHandle, StreamData), bInRequiresProxyRecreate);
+	}
+
+	void FRealtimeMeshProxyUpdateBuilder::AddRemoveStreamCommand(const FRealtimeMeshSectionGroupKey& SectionGroupKey, const FRealtimeMeshHandle& SectionGroupHandle,
+		const FRealtimeMeshStreamKey& StreamKey, bool bInRequiresProxyRecreate)
+	{
+		AddCommand(FRealtimeMeshProxyCommand::MakeRemoveStream(SectionGroupKey, SectionGroupHandle, StreamKey), bInRequiresProxyRecreate);
+	}
+	
+	void FRealtimeMeshProxyUpdateBuilder::AddMeshTask(TUniqueFunction<void(FRHICommandListBase&, FRealtimeMeshProxy&)>&& Function, bool bInRequiresProxyRecreate)
+	{
+		AddCommand(FRealtimeMeshProxyCommand::MakeTask([Func = MoveTemp(Function)](FRHICommandListBase& RHICmdList, FRealtimeMeshProxyCommandContext& Context)
+		{
+			Func(RHICmdList, Context.GetProxy());
+		}), bInRequiresProxyRecreate);
 	}
 
 	void FRealtimeMeshProxyUpdateBuilder::AddLODTask(const FRealtimeMeshLODKey& LODKey, TUniqueFunction<void(FRHICommandListBase&, FRealtimeMeshLODProxy&)>&& Function, bool bInRequiresProxyRecreate)
 	{
-		AddMeshTask([LODKey, Func = MoveTemp(Function)](FRHICommandListBase& RHICmdList, const FRealtimeMeshProxy& MeshProxy)
+		AddCommand(FRealtimeMeshProxyCommand::MakeTask(LODKey, [LODKey, Func = MoveTemp(Function)](FRHICommandListBase& RHICmdList, FRealtimeMeshProxyCommandContext& Context)
 		{
-			const FRealtimeMeshLODProxyPtr LOD = MeshProxy.GetLOD(LODKey);
+			FRealtimeMeshLODProxy* LOD = Context.FindLOD(LODKey);
 
-			if (ensure(LOD.IsValid()))
+			if (ensure(LOD))
 			{
-				Func(RHICmdList, *LOD.Get());
+				Func(RHICmdList, *LOD);
 			}
-		}, bInRequiresProxyRecreate);
+		}), bInRequiresProxyRecreate);
 	}
 
-	void FRealtimeMeshProxyUpdateBuilder::AddSectionGroupTask(const FRealtimeMeshSectionGroupKey& SectionGroupKey, TUniqueFunction<void(FRHICommandListBase&, FRealtimeMeshSectionGroupProxy&)>&& Function, bool bInRequiresProxyRecreate)
+	void FRealtimeMeshProxyUpdateBuilder::AddSectionGroupTask(const FRealtimeMeshSectionGroupKey& SectionGroupKey, const FRealtimeMeshHandle& SectionGroupHandle,
+		TUniqueFunction<void(FRHICommandListBase&, FRealtimeMeshSectionGroupProxy&)>&& Function, bool bInRequiresProxyRecreate)
 	{
-		AddLODTask(SectionGroupKey.LOD(), [SectionGroupKey, Func = MoveTemp(Function)](FRHICommandListBase& RHICmdList, const FRealtimeMeshLODProxy& LOD)
+		AddCommand(FRealtimeMeshProxyCommand::MakeTask(SectionGroupKey, SectionGroupHandle,
+			[LODKey = SectionGroupKey.LOD(), SectionGroupHandle, Func = MoveTemp(Function)](FRHICommandListBase& RHICmdList, FRealtimeMeshProxyCommandContext& Context)
 		{
-			const FRealtimeMeshSectionGroupProxyPtr SectionGroup = LOD.GetSectionGroup(SectionGroupKey);
+			FRealtimeMeshSectionGroupProxy* SectionGroup = Context.FindSectionGroup(LODKey, SectionGroupHandle);
 
-			if (ensure(SectionGroup.IsValid()))
+			if (ensure(SectionGroup))
 			{
-				Func(RHICmdList, *SectionGroup.Get());
+				Func(RHICmdList, *SectionGroup);
 			}
-		}, bInRequiresProxyRecreate);
+		}), bInRequiresProxyRecreate);
 	}
 
-	void FRealtimeMeshProxyUpdateBuilder::AddSectionTask(const FRealtimeMeshSectionKey& SectionKey, TUniqueFunction<void(FRHICommandListBase&, FRealtimeMeshSectionProxy&)>&& Function, bool bInRequiresProxyRecreate)
+	void FRealtimeMeshProxyUpdateBuilder::AddSectionTask(const FRealtimeMeshSectionKey& SectionKey, const FRealtimeMeshHandle& SectionGroupHandle, const FRealtimeMeshHandle& SectionHandle,
+		TUniqueFunction<void(FRHICommandListBase&, FRealtimeMeshSectionProxy&)>&& Function, bool bInRequiresProxyRecreate)
 	{
-		AddSectionGroupTask(SectionKey.SectionGroup(), [SectionKey, Func = MoveTemp(Function)](FRHICommandListBase& RHICmdList, const FRealtimeMeshSectionGroupProxy& SectionGroup)
+		AddCommand(FRealtimeMeshProxyCommand::MakeTask(SectionKey, SectionGroupHandle, SectionHandle,
+			[LODKey = SectionKey.LOD(), SectionGroupHandle, SectionHandle, Func = MoveTemp(Function)](FRHICommandListBase& RHICmdList, FRealtimeMeshProxyCommandContext& Context)
 		{
-			const FRealtimeMeshSectionProxyPtr Section = SectionGroup.GetSection(SectionKey);
+			FRealtimeMeshSectionProxy* Section = Context.FindSection(LODKey, SectionGroupHandle, SectionHandle);
 
-			if (ensure(Section.IsValid()))
+			if (ensure(Section))
 			{
-				Func(RHICmdList, *Section.Get());
+				Func(RHICmdList, *Section);
 			}
-		}, bInRequiresProxyRecreate);
+		}), bInRequiresProxyRecreate);
 	}
 
 
@@ -101,7 +359,7 @@ namespace RealtimeMesh
 	TFuture<ERealtimeMeshProxyUpdateStatus> FRealtimeMeshProxyUpdateBuilder::Commit(const TSharedRef<const FRealtimeMesh>& Mesh)
 	{
 		// Skip if no tasks
-		if (Tasks.IsEmpty())
+		if (Commands.IsEmpty())
 		{
 			return MakeFulfilledPromise<ERealtimeMeshProxyUpdateStatus>(ERealtimeMeshProxyUpdateStatus::NoUpdate).GetFuture();
 		}
@@ -121,17 +379,33 @@ namespace RealtimeMesh
 		{
 			Proxy->SetHasNaniteData_GT(bNewHasNaniteData.GetValue());
 		}
-		Proxy->EnqueueCommandBatch(MoveTemp(Tasks), ThreadState);
+		Proxy->EnqueueCommandBatch(MoveTemp(Commands), ThreadState);
+
+		const bool bRecreateProxies = bRequiresProxyRecreate || (bRequiresStaticMeshUpdate && CVarRealtimeMeshIncrementalStaticUpdates.GetValueOnAnyThread() == 0);
+		const bool bUpdateStaticMeshes = !bRecreateProxies && bRequiresStaticMeshUpdate;
+
+		if (bRecreateProxies)
+		{
+			FRealtimeMeshStatCounters::Get().ProxyRecreateRequests++;
+		}
+		else if (bUpdateStaticMeshes)
+		{
+			FRealtimeMeshStatCounters::Get().StaticMeshUpdateRequests++;
+		}
 
-		DoOnGameThread([ThreadState, MeshWeak = Mesh.ToWeakPtr(), bRecreateProxies = static_cast<bool>(bRequiresProxyRecreate)]()
+		DoOnGameThread([ThreadState, MeshWeak = Mesh.ToWeakPtr(), bRecreateProxies, bUpdateStaticMeshes]()
 		{
-			if (bRecreateProxies)
+			if (bRecreateProxies || bUpdateStaticMeshes)
 			{
 				if (const auto MeshToMarkDirty = MeshWeak.Pin())
 				{
-					if (MeshToMarkDirty->GetSharedResources()->OnRenderProxyRequiresUpdate().IsBound())
+					auto& Event = bRecreateProxies
+						? MeshToMarkDirty->GetSharedResources()->OnRenderProxyRequiresUpdate()
+						: MeshToMarkDirty->GetSharedResources()->OnRenderProxyRequiresStaticMeshUpdate();
+					
+					if (Event.IsBound())
 					{
-						MeshToMarkDirty->GetSharedResources()->OnRenderProxyRequiresUpdate().Broadcast();
+						Event.Broadcast();
 					}
 				}
 			}
@@ -139,8 +413,9 @@ namespace RealtimeMesh
 			ThreadState->FinalizeGameThread();
 		});
 
-		Tasks.Empty();
+		Commands.Empty();
 		bRequiresProxyRecreate = false;
+		bRequiresStaticMeshUpdate = false;
 
 		return ThreadState->FinalPromise->GetFuture();
 	}
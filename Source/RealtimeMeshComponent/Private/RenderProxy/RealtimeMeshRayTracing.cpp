@@ -0,0 +1,169 @@
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "RenderProxy/RealtimeMeshRayTracing.h"
+
+namespace RealtimeMesh
+{
+	ERealtimeMeshRayTracingUpdateAction FRealtimeMeshRayTracingUpdatePolicy::Decide(const FRealtimeMeshRayTracingBuildState& State, const FRealtimeMeshRayTracingUpdateRequest& Request)
+	{
+		if (!Request.bShouldHaveGeometry)
+		{
+			return State.bHasValidGeometry ? ERealtimeMeshRayTracingUpdateAction::Release : ERealtimeMeshRayTracingUpdateAction::None;
+		}
+
+		if (!State.bHasValidGeometry || Request.bTopologyChanged || Request.bBuildSettingsChanged)
+		{
+			return ERealtimeMeshRayTracingUpdateAction::Rebuild;
+		}
+
+		if (Request.bVerticesChanged)
+		{
+			const bool bWithinRefitBudget = Request.MaxRefitsBeforeRebuild <= 0 || State.NumRefitsSinceBuild < Request.MaxRefitsBeforeRebuild;
+			const bool bCanRefit = Request.bAllowRefit && State.bGeometryAllowsUpdate && bWithinRefitBudget;
+			return bCanRefit ? ERealtimeMeshRayTracingUpdateAction::Refit : ERealtimeMeshRayTracingUpdateAction::Rebuild;
+		}
+
+		return ERealtimeMeshRayTracingUpdateAction::None;
+	}
+
+	bool FRealtimeMeshRayTracingIndexCompactor::Update(const FRealtimeMeshStream& IndexStream, TConstArrayView<FRealtimeMeshStreamRange> Ranges, bool bSourceChanged)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshRayTracingIndexCompactor::Update);
+
+		NumIndicesGatheredLastUpdate = 0;
+
+		const int32 NumSourceIndices = IndexStream.Num() * IndexStream.GetNumElements();
+
+		TArray<FRealtimeMeshRayTracingIndexSpan> NewSpans;
+		NewSpans.Reserve(Ranges.Num());
+		int32 NewNumIndices = 0;
+		for (const FRealtimeMeshStreamRange& Range : Ranges)
+		{
+			const int32 FirstIndex = FMath::Clamp(Range.GetMinIndex(), 0, NumSourceIndices);
+			const int32 LastIndex = FMath::Clamp(Range.GetMaxIndex() + 1, FirstIndex, NumSourceIndices);
+			ensureMsgf(LastIndex == Range.GetMaxIndex() + 1, TEXT("Section range extends past the end of the index stream"));
+
+			// Keep whole triangles only
+			const int32 NumIndices = ((LastIndex - FirstIndex) / 3) * 3;
+			if (NumIndices > 0)
+			{
+				FRealtimeMeshRayTracingIndexSpan& Span = NewSpans.AddDefaulted_GetRef();
+				Span.SourceFirstIndex = FirstIndex;
+				Span.NumIndices = NumIndices;
+				Span.CompactedFirstIndex = NewNumIndices;
+				NewNumIndices += NumIndices;
+			}
+		}
+
+		if (bSourceChanged || Spans.Num() == 0 || NewSpans.Num() == 0)
+		{
+			const bool bChanged = bSourceChanged || Spans.Num() != NewSpans.Num();
+			Indices.SetNumUninitialized(NewNumIndices);
+			Spans = MoveTemp(NewSpans);
+			GatherSpans(IndexStream, Spans);
+			return bChanged;
+		}
+
+		// Find how much of the start and end of the span list survived, those only need moving, not gathering
+		const int32 MaxShared = FMath::Min(Spans.Num(), NewSpans.Num());
+		int32 NumPrefix = 0;
+		while (NumPrefix < MaxShared && Spans[NumPrefix].IsSameSource(NewSpans[NumPrefix]))
+		{
+			NumPrefix++;
+		}
+
+		if (NumPrefix == Spans.Num() && NumPrefix == NewSpans.Num())
+		{
+			return false;
+		}
+
+		int32 NumSuffix = 0;
+		while (NumSuffix < MaxShared - NumPrefix && Spans[Spans.Num() - 1 - NumSuffix].IsSameSource(NewSpans[NewSpans.Num() - 1 - NumSuffix]))
+		{
+			NumSuffix++;
+		}
+
+		const int32 OldNumIndices = Indices.Num();
+		const int32 OldSuffixStart = NumSuffix > 0 ? Spans[Spans.Num() - NumSuffix].CompactedFirstIndex : OldNumIndices;
+		const int32 NewSuffixStart = NumSuffix > 0 ? NewSpans[NewSpans.Num() - NumSuffix].CompactedFirstIndex : NewNumIndices;
+		const int32 NumSuffixIndices = OldNumIndices - OldSuffixStart;
+
+		if (NewNumIndices > OldNumIndices)
+		{
+			Indices.SetNumUninitialized(NewNumIndices);
+		}
+
+		if (NumSuffixIndices > 0 && OldSuffixStart != NewSuffixStart)
+		{
+			FMemory::Memmove(Indices.GetData() + NewSuffixStart, Indices.GetData() + OldSuffixStart, NumSuffixIndices * sizeof(uint32));
+		}
+
+		if (NewNumIndices < OldNumIndices)
+		{
+#if RMC_ENGINE_ABOVE_5_5
+			Indices.SetNum(NewNumIndices, EAllowShrinking::No);
+#else
+			Indices.SetNum(NewNumIndices, false);
+#endif
+		}
+
+		Spans = MoveTemp(NewSpans);
+		GatherSpans(IndexStream, TConstArrayView<FRealtimeMeshRayTracingIndexSpan>(Spans).Mid(NumPrefix, Spans.Num() - NumPrefix - NumSuffix));
+		return true;
+	}
+
+	void FRealtimeMeshRayTracingIndexCompactor::Reset()
+	{
+		Indices.Empty();
+		Spans.Empty();
+		NumIndicesGatheredLastUpdate = 0;
+	}
+
+	bool FRealtimeMeshRayTracingIndexCompactor::AreRangesContiguous(TConstArrayView<FRealtimeMeshStreamRange> Ranges)
+	{
+		TArray<TPair<int32, int32>, TInlineAllocator<8>> IndexRanges;
+		for (const FRealtimeMeshStreamRange& Range : Ranges)
+		{
+			if (Range.NumPrimitives(3) > 0)
+			{
+				IndexRanges.Emplace(Range.GetMinIndex(), Range.GetMaxIndex() + 1);
+			}
+		}
+		IndexRanges.Sort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B) { return A.Key < B.Key; });
+
+		int32 CoveredEnd = IndexRanges.Num() > 0 ? IndexRanges[0].Value : 0;
+		for (int32 Index = 1; Index < IndexRanges.Num(); Index++)
+		{
+			if (IndexRanges[Index].Key > CoveredEnd)
+			{
+				return false;
+			}
+			CoveredEnd = FMath::Max(CoveredEnd, IndexRanges[Index].Value);
+		}
+		return true;
+	}
+
+	void FRealtimeMeshRayTracingIndexCompactor::GatherSpans(const FRealtimeMeshStream& IndexStream, TConstArrayView<FRealtimeMeshRayTracingIndexSpan> SpansToGather)
+	{
+		const int32 IndexSize = IndexStream.GetElementStride();
+		check(IndexSize == sizeof(uint16) || IndexSize == sizeof(uint32));
+
+		for (const FRealtimeMeshRayTracingIndexSpan& Span : SpansToGather)
+		{
+			uint32* Dest = Indices.GetData() + Span.CompactedFirstIndex;
+			if (IndexSize == sizeof(uint32))
+			{
+				FMemory::Memcpy(Dest, IndexStream.GetData<uint32>() + Span.SourceFirstIndex, Span.NumIndices * sizeof(uint32));
+			}
+			else
+			{
+				const uint16* Source = IndexStream.GetData<uint16>() + Span.SourceFirstIndex;
+				for (int32 Index = 0; Index < Span.NumIndices; Index++)
+				{
+					Dest[Index] = Source[Index];
+				}
+			}
+			NumIndicesGatheredLastUpdate += Span.NumIndices;
+		}
+	}
+}
@@ -11,9 +11,71 @@
 #include "RenderProxy/RealtimeMeshSectionProxy.h"
 #include "RenderProxy/RealtimeMeshVertexFactory.h"
 #include "Materials/Material.h"
+#include "RealtimeMeshCore.h"
+
+DECLARE_CYCLE_STAT(TEXT("RealtimeMeshSectionGroupProxy - Create Or Update Stream"), STAT_RealtimeMeshSectionGroupProxy_CreateOrUpdateStream, STATGROUP_RealtimeMesh);
+DECLARE_CYCLE_STAT(TEXT("RealtimeMeshSectionGroupProxy - Remove Stream"), STAT_RealtimeMeshSectionGroupProxy_RemoveStream, STATGROUP_RealtimeMesh);
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshRayTracingMaxRefitsBeforeRebuild(
+	TEXT("RealtimeMesh.RayTracing.MaxRefitsBeforeRebuild"),
+	32,
+	TEXT("Number of consecutive BLAS refits a section group with refit enabled is allowed before the ray tracing geometry is fully rebuilt to restore trace quality. 0 refits forever"));
 
 namespace RealtimeMesh
 {
+#if RHI_RAYTRACING
+	static FBufferRHIRef CreateRayTracingIndexBuffer(FRHICommandListBase& RHICmdList, TConstArrayView<uint32> Indices)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(RealtimeMesh::CreateRayTracingIndexBuffer);
+
+		const uint32 SizeInBytes = Indices.Num() * sizeof(uint32);
+		
+#if RMC_ENGINE_ABOVE_5_6
+		const FRHIBufferCreateDesc BufferDesc = FRHIBufferCreateDesc::CreateVertex(TEXT("RealtimeMeshBuffer-RayTracingIndices"))
+			.SetSize(SizeInBytes)
+			.SetStride(sizeof(uint32))
+			.SetUsage(BUF_Static | BUF_IndexBuffer | BUF_ShaderResource)
+			.SetInitialState(ERHIAccess::VertexOrIndexBuffer | ERHIAccess::SRVMask);
+		FBufferRHIRef Buffer = RHICmdList.CreateBuffer(BufferDesc);
+#else
+		FRHIResourceCreateInfo CreateInfo(TEXT("RealtimeMeshBuffer-RayTracingIndices"));
+		FBufferRHIRef Buffer = RHICmdList.CreateIndexBuffer(sizeof(uint32), SizeInBytes, BUF_Static | BUF_IndexBuffer | BUF_ShaderResource, CreateInfo);
+#endif
+
+		void* Data = RHICmdList.LockBuffer(Buffer, 0, SizeInBytes, RLM_WriteOnly);
+		FMemory::Memcpy(Data, Indices.GetData(), SizeInBytes);
+		RHICmdList.UnlockBuffer(Buffer);
+
+		FRealtimeMeshStatCounters::Get().GPUBytesUploaded += SizeInBytes;
+		return Buffer;
+	}
+#endif
+
+	static FBufferRHIRef CreateMaskedIndexBuffer(FRHICommandListBase& RHICmdList, uint32 Stride, uint32 SizeInBytes)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(RealtimeMesh::CreateMaskedIndexBuffer);
+
+#if RMC_ENGINE_ABOVE_5_6
+		const FRHIBufferCreateDesc BufferDesc = FRHIBufferCreateDesc::CreateVertex(TEXT("RealtimeMeshBuffer-MaskedIndices"))
+			.SetSize(SizeInBytes)
+			.SetStride(Stride)
+			.SetUsage(BUF_Static | BUF_IndexBuffer | BUF_ShaderResource)
+			.SetInitialState(ERHIAccess::VertexOrIndexBuffer | ERHIAccess::SRVMask);
+		FBufferRHIRef Buffer = RHICmdList.CreateBuffer(BufferDesc);
+#else
+		FRHIResourceCreateInfo CreateInfo(TEXT("RealtimeMeshBuffer-MaskedIndices"));
+		FBufferRHIRef Buffer = RHICmdList.CreateIndexBuffer(Stride, SizeInBytes, BUF_Static | BUF_IndexBuffer | BUF_ShaderResource, CreateInfo);
+#endif
+
+		// Every index pointing at the same vertex makes every triangle degenerate, so nothing gets rasterized
+		void* Data = RHICmdList.LockBuffer(Buffer, 0, SizeInBytes, RLM_WriteOnly);
+		FMemory::Memzero(Data, SizeInBytes);
+		RHICmdList.UnlockBuffer(Buffer);
+
+		FRealtimeMeshStatCounters::Get().GPUBytesUploaded += SizeInBytes;
+		return Buffer;
+	}
+	
 	FRealtimeMeshSectionGroupProxy::FRealtimeMeshSectionGroupProxy(const FRealtimeMeshSharedResourcesRef& InSharedResources, const FRealtimeMeshSectionGroupKey& InKey)
 		: SharedResources(InSharedResources)
 		, Key(InKey)
@@ -32,13 +94,27 @@ namespace RealtimeMesh
 	{
 		check(SectionKey.IsPartOf(Key));
 
-		if (SectionMap.Contains(SectionKey))
+		if (const FRealtimeMeshHandle* SectionHandle = SectionMap.Find(SectionKey))
+		{
+			return GetSection(*SectionHandle);
+		}
+		return FRealtimeMeshSectionProxyPtr();
+	}
+
+	FRealtimeMeshSectionProxyPtr FRealtimeMeshSectionGroupProxy::GetSection(const FRealtimeMeshHandle& SectionHandle) const
+	{
+		if (const FRealtimeMeshSectionProxyRef* Section = Sections.Find(SectionHandle))
 		{
-			return Sections[SectionMap[SectionKey]];
+			return *Section;
 		}
 		return FRealtimeMeshSectionProxyPtr();
 	}
 
+	FRealtimeMeshHandle FRealtimeMeshSectionGroupProxy::FindSectionHandle(const FRealtimeMeshSectionKey& SectionKey) const
+	{
+		return SectionMap.FindRef(SectionKey);
+	}
+
 	TSharedPtr<FRealtimeMeshGPUBuffer> FRealtimeMeshSectionGroupProxy::GetStream(const FRealtimeMeshStreamKey& StreamKey) const
 	{
 		return Streams.FindRef(StreamKey);
@@ -62,35 +138,43 @@ namespace RealtimeMesh
 		}
 	}
 
-	void FRealtimeMeshSectionGroupProxy::CreateSectionIfNotExists(const FRealtimeMeshSectionKey& SectionKey)
+	void FRealtimeMeshSectionGroupProxy::CreateSectionIfNotExists(const FRealtimeMeshSectionKey& SectionKey, const FRealtimeMeshHandle& SectionHandle)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshSectionGroupProxy::CreateSectionIfNotExists);
 
 		check(SectionKey.IsPartOf(Key));
+		check(SectionHandle.IsSet());
 
 		// Does this section already exist
-		if (!SectionMap.Contains(SectionKey))
+		if (const FRealtimeMeshSectionProxyRef* Section = Sections.Find(SectionHandle))
 		{
-			const int32 SectionIndex = Sections.Add(SharedResources->CreateSectionProxy(SectionKey));
-			SectionMap.Add(SectionKey, SectionIndex);
+			(*Section)->Reset();
+			return;
 		}
-		else
+
+		// Anything still at this slot, or still under this key, was dropped on the game thread without the proxy hearing about it
+		if (Sections.IsAllocated(SectionHandle.Index))
 		{
-			Sections[SectionMap[SectionKey]]->Reset();
+			SectionMap.Remove(Sections[SectionHandle.Index]->GetKey());
 		}
+		FRealtimeMeshHandle StaleHandle;
+		if (SectionMap.RemoveAndCopyValue(SectionKey, StaleHandle))
+		{
+			Sections.Remove(StaleHandle);
+		}
+
+		Sections.EmplaceAt(SectionHandle, SharedResources->CreateSectionProxy(SectionKey));
+		SectionMap.Add(SectionKey, SectionHandle);
 	}
 
-	void FRealtimeMeshSectionGroupProxy::RemoveSection(const FRealtimeMeshSectionKey& SectionKey)
+	void FRealtimeMeshSectionGroupProxy::RemoveSection(const FRealtimeMeshHandle& SectionHandle)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshSectionGroupProxy::RemoveSection);
 
-		check(SectionKey.IsPartOf(Key));
-
-		if (SectionMap.Contains(SectionKey))
+		if (const FRealtimeMeshSectionProxyRef* Section = Sections.Find(SectionHandle))
 		{
-			const int32 SectionIndex = SectionMap[SectionKey];
-			Sections.RemoveAt(SectionIndex);
-			RebuildSectionMap();
+			SectionMap.Remove((*Section)->GetKey());
+			Sections.Remove(SectionHandle);
 			bVertexFactoryDirty = true;
 		}
 	}
@@ -98,6 +182,8 @@ namespace RealtimeMesh
 	void FRealtimeMeshSectionGroupProxy::CreateOrUpdateStream(FRHICommandListBase& RHICmdList, const FRealtimeMeshSectionGroupStreamUpdateDataRef& InStream)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshSectionGroupProxy::CreateOrUpdateStream);
+		SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshSectionGroupProxy_CreateOrUpdateStream);
+		CSV_SCOPED_TIMING_STAT(RealtimeMesh, CreateOrUpdateStream);
 
 		// If we didn't create the buffers async, create them now
 		InStream->FinalizeInitialization(RHICmdList);
@@ -119,6 +205,15 @@ namespace RealtimeMesh
 		GPUBuffer->InitializeResources(RHICmdList, InStream);
 		Streams.Add(InStream->GetStreamKey(), GPUBuffer);
 
+#if RHI_RAYTRACING
+		if (InStream->GetStreamKey() == FRealtimeMeshStreams::Triangles && IsRayTracingEnabled())
+		{
+			// Held until the next ray tracing update shows whether the sections need compacting
+			RayTracingIndexSource = TSharedPtr<const FRealtimeMeshStream>(InStream, &InStream->GetStream());
+			bRayTracingIndexSourceChanged = true;
+		}
+#endif
+
 		check(GPUBuffer);
 		check(GPUBuffer->IsResourceInitialized());
 
@@ -128,6 +223,7 @@ namespace RealtimeMesh
 	void FRealtimeMeshSectionGroupProxy::RemoveStream(const FRealtimeMeshStreamKey& StreamKey)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshSectionGroupProxy::RemoveStream);
+		SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshSectionGroupProxy_RemoveStream);
 
 		if (const auto* Stream = Streams.Find(StreamKey))
 		{
@@ -135,6 +231,25 @@ namespace RealtimeMesh
 			Streams.Remove(StreamKey);
 			bVertexFactoryDirty = true;
 		}
+
+#if RHI_RAYTRACING
+		if (StreamKey == FRealtimeMeshStreams::Triangles)
+		{
+			RayTracingIndexSource.Reset();
+			bRayTracingIndexSourceChanged = true;
+		}
+#endif
+	}
+
+	void FRealtimeMeshSectionGroupProxy::SetRayTracingIndexSource(const TSharedRef<const FRealtimeMeshStream>& InIndexSource)
+	{
+#if RHI_RAYTRACING
+		if (IsRayTracingEnabled())
+		{
+			RayTracingIndexSource = InIndexSource;
+			bRayTracingIndexSourceChanged = true;
+		}
+#endif
 	}
 
 	bool FRealtimeMeshSectionGroupProxy::InitializeMeshBatch(FMeshBatch& MeshBatch, FRealtimeMeshResourceReferenceList& Resources, bool bIsLocalToWorldDeterminantNegative, bool bWantsDepthOnly) const
@@ -222,8 +337,13 @@ namespace RealtimeMesh
 		}
 
 		DrawMask = FRealtimeMeshDrawMask();
-		ActiveSectionMask.SetNumUninitialized(Sections.Num());
-		ActiveSectionMask.SetRange(0, Sections.Num(), false);
+		ActiveSectionMask.SetNumUninitialized(Sections.GetMaxIndex());
+		ActiveSectionMask.SetRange(0, Sections.GetMaxIndex(), false);
+		DrawRanges.Reset();
+
+		// The scene caches static batches and only ever re-caches the ones it gathered, so a static group keeps the
+		// batches of hidden sections around with their passes masked off rather than changing which batches there are
+		const bool bIsStatic = Config.DrawType == ERealtimeMeshSectionDrawType::Static;
 		
 		for (auto It = Sections.CreateConstIterator(); It; ++It)
 		{
@@ -232,17 +352,101 @@ namespace RealtimeMesh
 			DrawMask |= SectionDrawMask;
 
 			ActiveSectionMask[It.GetIndex()] = SectionDrawMask.ShouldRender();
-		}		
+
+			if (SectionDrawMask.ShouldRender() || (bIsStatic && Section->HasValidMeshData()))
+			{
+				FRealtimeMeshSectionDrawRange& DrawRange = DrawRanges.AddDefaulted_GetRef();
+				DrawRange.SectionHandle = It.GetHandle();
+				DrawRange.StreamRange = Section->GetStreamRange();
+				DrawRange.DrawMask = SectionDrawMask;
+				DrawRange.MaterialSlot = Section->GetMaterialSlot();
+			}
+		}
+
+		if (Config.bMergeCompatibleSections)
+		{
+			MergeDrawRanges(DrawRanges);
+		}
+
+		if (bIsStatic)
+		{
+			// Stay on the static path while every section is hidden so the gathered batches survive until they're shown
+			if (DrawRanges.Num() > 0)
+			{
+				DrawMask.SetFlag(ERealtimeMeshDrawMask::DrawMainPass);
+			}
+			UpdatePassIndexBuffers(RHICmdList);
+		}
 
 		if (DrawMask.HasAnyFlags())
 		{
-			DrawMask.SetFlag(Config.DrawType == ERealtimeMeshSectionDrawType::Static ? ERealtimeMeshDrawMask::DrawStatic : ERealtimeMeshDrawMask::DrawDynamic);
+			DrawMask.SetFlag(bIsStatic ? ERealtimeMeshDrawMask::DrawStatic : ERealtimeMeshDrawMask::DrawDynamic);
 		}
 
-		if (bNeedsFactoryInitialization)
+		// Always run this, it decides for itself whether the geometry needs a refit, a full rebuild or nothing at all
+		if (UpdateRayTracingInfo(RHICmdList))
+		{
+			DrawMask.SetFlag(ERealtimeMeshDrawMask::RayTracing);
+
+			// Static ray tracing builds its material list from the cached static batches, so it needs one batch per segment
+#if RHI_RAYTRACING
+			const bool bCanUseStaticRayTracing = Config.DrawType == ERealtimeMeshSectionDrawType::Static && CanDrawRangesUseStaticRayTracing(DrawRanges, RayTracingSegmentSections);
+#else
+			const bool bCanUseStaticRayTracing = false;
+#endif
+			if (!bCanUseStaticRayTracing)
+			{
+				DrawMask.SetFlag(ERealtimeMeshDrawMask::DynamicRayTracing);
+			}
+		}
+	}
+
+	void FRealtimeMeshSectionGroupProxy::UpdatePassIndexBuffers(FRHICommandListBase& RHICmdList)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshSectionGroupProxy::UpdatePassIndexBuffers);
+
+		const TSharedPtr<FRealtimeMeshGPUBuffer> IndexStream = Streams.FindRef(FRealtimeMeshStreams::Triangles);
+		const FBufferRHIRef IndexBuffer = IndexStream.IsValid() ? StaticCastSharedPtr<FRealtimeMeshIndexBuffer>(IndexStream)->IndexBufferRHI : FBufferRHIRef();
+
+		const bool bAnyPassMasked = Algo::AnyOf(DrawRanges, [](const FRealtimeMeshSectionDrawRange& DrawRange)
+		{
+			return !DrawRange.DrawMask.ShouldRenderMainPass() || !DrawRange.DrawMask.ShouldRenderShadow();
+		});
+
+		if (!bAnyPassMasked || !IndexBuffer.IsValid())
+		{
+			MaskedIndexBuffer.SafeRelease();
+		}
+		else if (!MaskedIndexBuffer.IsValid() || MaskedIndexBuffer->GetSize() != IndexBuffer->GetSize() || MaskedIndexBuffer->GetStride() != IndexBuffer->GetStride())
+		{
+			// Masked batches keep the first index of their range, so this needs to cover the whole index stream
+			MaskedIndexBuffer = CreateMaskedIndexBuffer(RHICmdList, IndexBuffer->GetStride(), IndexBuffer->GetSize());
+		}
+
+		// Merged ranges share one draw mask, so the leading section's buffers stand in for the whole run
+		for (const FRealtimeMeshSectionDrawRange& DrawRange : DrawRanges)
+		{
+			const FRealtimeMeshSectionProxyPtr Section = GetSection(DrawRange.SectionHandle);
+			check(Section.IsValid());
+			Section->UpdatePassIndexBuffers(RHICmdList, DrawRange.DrawMask, IndexBuffer, MaskedIndexBuffer);
+		}
+	}
+
+	bool FRealtimeMeshSectionGroupProxy::CanDrawRangesUseStaticRayTracing(TConstArrayView<FRealtimeMeshSectionDrawRange> InDrawRanges, TConstArrayView<FRealtimeMeshHandle> InSegmentSections)
+	{
+		if (InDrawRanges.Num() != InSegmentSections.Num())
+		{
+			return false;
+		}
+
+		for (const FRealtimeMeshSectionDrawRange& DrawRange : InDrawRanges)
 		{
-			DrawMask.SetFlag(UpdateRayTracingInfo(RHICmdList)? ERealtimeMeshDrawMask::RayTracing : ERealtimeMeshDrawMask::None);
+			if (DrawRange.NumSections != 1 || !InSegmentSections.Contains(DrawRange.SectionHandle))
+			{
+				return false;
+			}
 		}
+		return true;
 	}
 
 	void FRealtimeMeshSectionGroupProxy::Reset()
@@ -251,6 +455,13 @@ namespace RealtimeMesh
 
 #if RHI_RAYTRACING
 		RayTracingGeometry.ReleaseResource();
+		RayTracingBuildState = FRealtimeMeshRayTracingBuildState();
+		RayTracingIndexSource.Reset();
+		RayTracingIndexCompactor.Reset();
+		RayTracingCompactedIndexBuffer.SafeRelease();
+		RayTracingSegmentSections.Empty();
+		bRayTracingIndexSourceChanged = false;
+		RayTracingRevision++;
 #endif
 		if (VertexFactory)
 		{
@@ -272,16 +483,57 @@ namespace RealtimeMesh
 		}
 		Sections.Empty();
 		SectionMap.Reset();
+		DrawRanges.Empty();
+		MaskedIndexBuffer.SafeRelease();
 
 		DrawMask = FRealtimeMeshDrawMask();
 	}
 
+	void FRealtimeMeshSectionGroupProxy::MergeDrawRanges(TArray<FRealtimeMeshSectionDrawRange>& InOutDrawRanges)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshSectionGroupProxy::MergeDrawRanges);
+
+		if (InOutDrawRanges.Num() < 2)
+		{
+			return;
+		}
+
+		InOutDrawRanges.Sort([](const FRealtimeMeshSectionDrawRange& A, const FRealtimeMeshSectionDrawRange& B)
+		{
+			return A.MaterialSlot != B.MaterialSlot ? A.MaterialSlot < B.MaterialSlot : A.StreamRange.GetMinIndex() < B.StreamRange.GetMinIndex();
+		});
+
+		TArray<FRealtimeMeshSectionDrawRange> MergedRanges;
+		MergedRanges.Reserve(InOutDrawRanges.Num());
+		MergedRanges.Add(InOutDrawRanges[0]);
+
+		for (int32 Index = 1; Index < InOutDrawRanges.Num(); Index++)
+		{
+			FRealtimeMeshSectionDrawRange& Current = MergedRanges.Last();
+			const FRealtimeMeshSectionDrawRange& Next = InOutDrawRanges[Index];
+
+			// Only ranges that directly follow each other can share a batch, anything else would draw the triangles in between
+			const bool bCanMerge = Current.MaterialSlot == Next.MaterialSlot && Current.DrawMask == Next.DrawMask &&
+				Current.StreamRange.GetMaxIndex() + 1 == Next.StreamRange.GetMinIndex();
+
+			if (bCanMerge)
+			{
+				Current.StreamRange = Current.StreamRange.Hull(Next.StreamRange);
+				Current.NumSections += Next.NumSections;
+			}
+			else
+			{
+				MergedRanges.Add(Next);
+			}
+		}
+
+		InOutDrawRanges = MoveTemp(MergedRanges);
+	}
+
 	bool FRealtimeMeshSectionGroupProxy::UpdateRayTracingInfo(FRHICommandListBase& RHICmdList)
 	{
 #if RHI_RAYTRACING
 		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshSectionGroupProxy::UpdateRayTracingInfo);
-		
-		RayTracingGeometry.ReleaseResource();
 
 		bool bShouldGenerateRayTracingGeometry = DrawMask.HasAnyFlags() && VertexFactory.IsValid() && IsRayTracingEnabled();
 
@@ -289,12 +541,21 @@ namespace RealtimeMesh
 		// If it is not then we weed to allocate a ray tracing index buffer and pack the active sections down into it.
 		// This is because the ray tracing geometry can't have gaps in the index buffer.
 
+		struct FRayTracedSection
+		{
+			FRealtimeMeshHandle SectionHandle;
+			FRealtimeMeshStreamRange StreamRange;
+		};
+
 		TRangeSet<int32> SectionIndexRanges;
-		for (const auto& Section : Sections)
+		TArray<FRayTracedSection, TInlineAllocator<8>> RayTracedSections;
+		for (auto It = Sections.CreateConstIterator(); It; ++It)
 		{
-			if (Section->GetDrawMask().ShouldRender() && Section->GetDrawMask().ShouldRenderMainPass())
+			const FRealtimeMeshSectionProxyRef& Section = *It;
+			if (Section->GetDrawMask().ShouldRender() && Section->GetDrawMask().ShouldRenderMainPass() && Section->GetStreamRange().NumPrimitives(3) > 0)
 			{
 				SectionIndexRanges.Add(TRange<int32>(Section->GetStreamRange().GetMinIndex(), Section->GetStreamRange().GetMaxIndex() + 1));
+				RayTracedSections.Add({ It.GetHandle(), Section->GetStreamRange() });
 			}
 		}
 
@@ -303,67 +564,217 @@ namespace RealtimeMesh
 
 		const bool bAreSectionsContiguous = !SectionIndexRanges.IsEmpty() && SectionIndexRanges.Contains(TRange<int32>(MinIndex, MaxIndex + 1));
 
-		if (!bAreSectionsContiguous)
+		// Without gaps to compact there's no use for the CPU copy of the indices, so don't keep a second copy of every index
+		// buffer around. FRealtimeMeshSectionGroupSimple sends a new one along with section changes that open up gaps.
+		if (SectionIndexRanges.IsEmpty() || bAreSectionsContiguous)
 		{
-			// TODO: Implement ray tracing index buffer creation
-			UE_LOG(LogRealtimeMesh, Warning, TEXT("Unable to create ray tracing accelleration structures. Some triangles in buffer are unaccounted for in sections."));
-			bShouldGenerateRayTracingGeometry = false;
-		}		
+			RayTracingIndexSource.Reset();
+			bRayTracingIndexSourceChanged = false;
+		}
 
-		if (bShouldGenerateRayTracingGeometry)
+		const TSharedPtr<FRealtimeMeshGPUBuffer> PositionBuffer = Streams.FindRef(FRealtimeMeshStreams::Position);
+		const TSharedPtr<FRealtimeMeshGPUBuffer> IndexBuffer = Streams.FindRef(FRealtimeMeshStreams::Triangles);
+		bShouldGenerateRayTracingGeometry &= PositionBuffer.IsValid() && IndexBuffer.IsValid();
+
+		const auto PositionStream = StaticCastSharedPtr<FRealtimeMeshVertexBuffer>(PositionBuffer);
+		const auto IndexStream = StaticCastSharedPtr<FRealtimeMeshIndexBuffer>(IndexBuffer);
+
+		FBufferRHIRef RayTracingIndexBuffer;
+		uint32 RayTracingIndexBufferOffset = 0;
+		uint32 RayTracingPrimitiveCount = 0;
+		TArray<FRayTracingGeometrySegment> Segments;
+		const TArray<FRealtimeMeshHandle> PreviousSegmentSections = MoveTemp(RayTracingSegmentSections);
+		RayTracingSegmentSections.Reset();
+
+		if (bShouldGenerateRayTracingGeometry && bAreSectionsContiguous)
 		{
-			check(VertexFactory->IsInitialized());
+			// Sections cover one block of the index buffer, so trace straight against it
+			RayTracingIndexCompactor.Reset();
+			RayTracingCompactedIndexBuffer.SafeRelease();
 
-			const auto PositionStream = StaticCastSharedPtr<FRealtimeMeshVertexBuffer>(Streams.FindChecked(FRealtimeMeshStreams::Position));
-			const auto IndexStream = StaticCastSharedPtr<FRealtimeMeshIndexBuffer>(Streams.FindChecked(FRealtimeMeshStreams::Triangles));
+			RayTracingIndexBuffer = IndexStream->IndexBufferRHI;
+			RayTracingIndexBufferOffset = IndexStream->IndexBufferRHI->GetStride() * MinIndex;
+			RayTracingPrimitiveCount = ((MaxIndex - MinIndex) + 1) / 3;
 
-			FRayTracingGeometryInitializer Initializer;
-			Initializer.DebugName = *(SharedResources->GetMeshName().ToString() + TEXT("_") + Key.ToString() + " RTGeometry");
-			Initializer.OwnerName = SharedResources->GetMeshName();
-			
-			Initializer.IndexBuffer = IndexStream->IndexBufferRHI;
-			Initializer.IndexBufferOffset = IndexStream->IndexBufferRHI->GetStride() * MinIndex;
-			Initializer.TotalPrimitiveCount = ((MaxIndex - MinIndex) + 1) / 3;
-			Initializer.GeometryType = RTGT_Triangles;
-			Initializer.bFastBuild = true;
-			Initializer.bAllowUpdate = false;
-
-			for (const auto& Section : Sections)
+			for (const FRayTracedSection& RayTracedSection : RayTracedSections)
+			{
+				FRayTracingGeometrySegment& Segment = Segments.AddDefaulted_GetRef();
+				Segment.VertexBuffer = PositionStream->VertexBufferRHI;
+				Segment.VertexBufferOffset = 0; 
+				Segment.MaxVertices = PositionStream->Num();
+				Segment.FirstPrimitive = RayTracedSection.StreamRange.GetMinIndex() / 3;
+				Segment.NumPrimitives = RayTracedSection.StreamRange.NumPrimitives(3);
+				check(Segment.NumPrimitives > 0);
+				RayTracingSegmentSections.Add(RayTracedSection.SectionHandle);
+			}
+		}
+		else if (bShouldGenerateRayTracingGeometry && RayTracingIndexSource.IsValid())
+		{
+			// There's gaps between the sections, so pack the visible ranges down into a ray tracing only index buffer
+			RayTracedSections.Sort([](const FRayTracedSection& A, const FRayTracedSection& B) { return A.StreamRange.GetMinIndex() < B.StreamRange.GetMinIndex(); });
+
+			TArray<FRealtimeMeshStreamRange, TInlineAllocator<8>> SectionStreamRanges;
+			for (const FRayTracedSection& RayTracedSection : RayTracedSections)
+			{
+				SectionStreamRanges.Add(RayTracedSection.StreamRange);
+			}
+
+			const bool bCompactedIndicesChanged = RayTracingIndexCompactor.Update(*RayTracingIndexSource, SectionStreamRanges, bRayTracingIndexSourceChanged);
+			bRayTracingIndexSourceChanged = false;
+
+			if (RayTracingIndexCompactor.Num() == 0)
+			{
+				bShouldGenerateRayTracingGeometry = false;
+			}
+			else
 			{
-				if (Section->GetDrawMask().ShouldRender() && Section->GetDrawMask().ShouldRenderMainPass())
+				if (bCompactedIndicesChanged || !RayTracingCompactedIndexBuffer.IsValid())
+				{
+					// Always a new buffer, the current geometry may still be tracing against the old one
+					RayTracingCompactedIndexBuffer = CreateRayTracingIndexBuffer(RHICmdList, RayTracingIndexCompactor.GetIndices());
+				}
+
+				RayTracingIndexBuffer = RayTracingCompactedIndexBuffer;
+				RayTracingPrimitiveCount = RayTracingIndexCompactor.Num() / 3;
+
+				const TConstArrayView<FRealtimeMeshRayTracingIndexSpan> Spans = RayTracingIndexCompactor.GetSpans();
+				for (int32 SpanIndex = 0; SpanIndex < Spans.Num(); SpanIndex++)
 				{
-					FRayTracingGeometrySegment Segment;
+					FRayTracingGeometrySegment& Segment = Segments.AddDefaulted_GetRef();
 					Segment.VertexBuffer = PositionStream->VertexBufferRHI;
 					Segment.VertexBufferOffset = 0; 
 					Segment.MaxVertices = PositionStream->Num();
-					Segment.FirstPrimitive = Section->GetStreamRange().GetMinIndex() / 3;
-					Segment.NumPrimitives = Section->GetStreamRange().NumPrimitives(3);
-					check(Segment.NumPrimitives > 0);
-					Initializer.Segments.Add(Segment);
+					Segment.FirstPrimitive = Spans[SpanIndex].CompactedFirstIndex / 3;
+					Segment.NumPrimitives = Spans[SpanIndex].NumIndices / 3;
+
+					// Spans only drop out when a range was clamped to the stream, which leaves no way to map them back
+					if (Spans.Num() == RayTracedSections.Num())
+					{
+						RayTracingSegmentSections.Add(RayTracedSections[SpanIndex].SectionHandle);
+					}
 				}
 			}
+		}
+		else
+		{
+			if (bShouldGenerateRayTracingGeometry && !SectionIndexRanges.IsEmpty())
+			{
+				UE_LOG(LogRealtimeMesh, Warning, TEXT("Unable to create ray tracing accelleration structures. Sections aren't contiguous in the index buffer and no CPU copy of the indices is available to compact them."));
+			}
+			bShouldGenerateRayTracingGeometry = false;
+			RayTracingIndexCompactor.Reset();
+			RayTracingCompactedIndexBuffer.SafeRelease();
+		}
 
-			RayTracingGeometry.SetInitializer(Initializer);
-			RayTracingGeometry.InitResource(RHICmdList);
-				
-#if RMC_ENGINE_ABOVE_5_5				
-			check(RayTracingGeometry.GetRHI()->IsValid());
+		// Work out what changed since the last build, a refit can only take new vertex positions
+		FRealtimeMeshRayTracingUpdateRequest Request;
+		Request.bShouldHaveGeometry = bShouldGenerateRayTracingGeometry;
+		Request.bAllowRefit = Config.bAllowRayTracingRefit;
+		Request.MaxRefitsBeforeRebuild = CVarRealtimeMeshRayTracingMaxRefitsBeforeRebuild.GetValueOnAnyThread();
+
+		if (bShouldGenerateRayTracingGeometry && RayTracingBuildState.bHasValidGeometry)
+		{
+			const FRayTracingGeometryInitializer& Current = RayTracingGeometry.Initializer;
+
+			Request.bBuildSettingsChanged = Current.bFastBuild != (Config.RayTracingBuildQuality == ERealtimeMeshRayTracingBuildQuality::FastBuild) ||
+				Current.bAllowUpdate != Config.bAllowRayTracingRefit;
+
+			bool bSameLayout = Current.IndexBuffer == RayTracingIndexBuffer &&
+				Current.IndexBufferOffset == RayTracingIndexBufferOffset &&
+				Current.Segments.Num() == Segments.Num();
+			for (int32 SegmentIndex = 0; bSameLayout && SegmentIndex < Segments.Num(); SegmentIndex++)
+			{
+				const FRayTracingGeometrySegment& Old = Current.Segments[SegmentIndex];
+				const FRayTracingGeometrySegment& New = Segments[SegmentIndex];
+				bSameLayout = Old.FirstPrimitive == New.FirstPrimitive && Old.NumPrimitives == New.NumPrimitives && Old.MaxVertices == New.MaxVertices;
+			}
+			Request.bTopologyChanged = !bSameLayout;
+			Request.bVerticesChanged = Segments.Num() > 0 && Current.Segments[0].VertexBuffer != PositionStream->VertexBufferRHI;
+		}
+
+		const ERealtimeMeshRayTracingUpdateAction UpdateAction = FRealtimeMeshRayTracingUpdatePolicy::Decide(RayTracingBuildState, Request);
+
+		// Anything caching this geometry, like the scene's static ray tracing instances, needs to know it changed
+		if (UpdateAction != ERealtimeMeshRayTracingUpdateAction::None || PreviousSegmentSections != RayTracingSegmentSections)
+		{
+			RayTracingRevision++;
+		}
+
+		switch (UpdateAction)
+		{
+		case ERealtimeMeshRayTracingUpdateAction::None:
+			break;
+			
+		case ERealtimeMeshRayTracingUpdateAction::Release:
+			RayTracingGeometry.ReleaseResource();
+			RayTracingBuildState = FRealtimeMeshRayTracingBuildState();
+			break;
+
+		case ERealtimeMeshRayTracingUpdateAction::Refit:
+			{
+				TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshSectionGroupProxy::RefitRayTracingGeometry);
+
+				// Same index buffer, segment count and primitive ranges, anything else is a topology change and rebuilds above.
+				// So only the vertex buffer the segments point at needs swapping. The RHI geometry keeps the segments it was
+				// created with, so the new ones go along with the update build instead of only through the initializer.
+				for (FRayTracingGeometrySegment& Segment : RayTracingGeometry.Initializer.Segments)
+				{
+					Segment.VertexBuffer = PositionStream->VertexBufferRHI;
+				}
+
+				FRayTracingGeometryBuildParams BuildParams;
+#if RMC_ENGINE_ABOVE_5_5
+				BuildParams.Geometry = RayTracingGeometry.GetRHI();
 #else
-			check(RayTracingGeometry.RayTracingGeometryRHI.IsValid());
+				BuildParams.Geometry = RayTracingGeometry.RayTracingGeometryRHI;
 #endif
+				BuildParams.BuildMode = EAccelerationStructureBuildMode::Update;
+				BuildParams.Segments = RayTracingGeometry.Initializer.Segments;
+				FRHIComputeCommandList::Get(RHICmdList).BuildAccelerationStructures(MakeArrayView(&BuildParams, 1));
+
+				RayTracingBuildState.NumRefitsSinceBuild++;
+				FRealtimeMeshStatCounters::Get().RayTracingGeometryRefits++;
+			}
+			break;
+
+		case ERealtimeMeshRayTracingUpdateAction::Rebuild:
+			{
+				check(VertexFactory->IsInitialized());
+
+				RayTracingGeometry.ReleaseResource();
 
-			return true;
-		}		
+				FRayTracingGeometryInitializer Initializer;
+				Initializer.DebugName = *(SharedResources->GetMeshName().ToString() + TEXT("_") + Key.ToString() + " RTGeometry");
+				Initializer.OwnerName = SharedResources->GetMeshName();
+				
+				Initializer.IndexBuffer = RayTracingIndexBuffer;
+				Initializer.IndexBufferOffset = RayTracingIndexBufferOffset;
+				Initializer.TotalPrimitiveCount = RayTracingPrimitiveCount;
+				Initializer.GeometryType = RTGT_Triangles;
+				Initializer.bFastBuild = Config.RayTracingBuildQuality == ERealtimeMeshRayTracingBuildQuality::FastBuild;
+				Initializer.bAllowUpdate = Config.bAllowRayTracingRefit;
+				Initializer.Segments = MoveTemp(Segments);
+
+				RayTracingGeometry.SetInitializer(Initializer);
+				RayTracingGeometry.InitResource(RHICmdList);
+					
+#if RMC_ENGINE_ABOVE_5_5				
+				check(RayTracingGeometry.GetRHI()->IsValid());
+#else
+				check(RayTracingGeometry.RayTracingGeometryRHI.IsValid());
 #endif
-		return false;
-	}
 
-	void FRealtimeMeshSectionGroupProxy::RebuildSectionMap()
-	{
-		SectionMap.Empty();
-		for (auto It = Sections.CreateIterator(); It; ++It)
-		{
-			SectionMap.Add((*It)->GetKey(), It.GetIndex());
+				RayTracingBuildState.bHasValidGeometry = true;
+				RayTracingBuildState.bGeometryAllowsUpdate = Initializer.bAllowUpdate;
+				RayTracingBuildState.NumRefitsSinceBuild = 0;
+				FRealtimeMeshStatCounters::Get().RayTracingGeometryBuilds++;
+			}
+			break;
 		}
+
+		return RayTracingBuildState.bHasValidGeometry;
+#else
+		return false;
+#endif
 	}
 }
@@ -10,6 +10,7 @@ namespace RealtimeMesh
 		: SharedResources(InSharedResources)
 		, Key(InKey)
 		, bRangeChanged(false)
+		, bHasValidMeshData(false)
 	{
 	}
 
@@ -36,6 +37,11 @@ namespace RealtimeMesh
 	}
 
 	bool FRealtimeMeshSectionProxy::InitializeMeshBatch(FMeshBatch& MeshBatch, FRHIUniformBuffer* PrimitiveUniformBuffer) const
+	{
+		return InitializeMeshBatchForRange(MeshBatch, PrimitiveUniformBuffer, StreamRange);
+	}
+
+	bool FRealtimeMeshSectionProxy::InitializeMeshBatchForRange(FMeshBatch& MeshBatch, FRHIUniformBuffer* PrimitiveUniformBuffer, const FRealtimeMeshStreamRange& DrawRange) const
 	{
 		FMeshBatchElement& BatchElement = MeshBatch.Elements[0];
 
@@ -49,13 +55,13 @@ namespace RealtimeMesh
 		//BatchElement.IndirectArgsBuffer = nullptr;
 		//BatchElement.IndirectArgsOffset = 0;
 
-		BatchElement.FirstIndex = StreamRange.GetMinIndex();
-		BatchElement.NumPrimitives = StreamRange.NumPrimitives(REALTIME_MESH_NUM_INDICES_PER_PRIMITIVE);
+		BatchElement.FirstIndex = DrawRange.GetMinIndex();
+		BatchElement.NumPrimitives = DrawRange.NumPrimitives(REALTIME_MESH_NUM_INDICES_PER_PRIMITIVE);
 		
 		//BatchElement.NumInstances = 1;
 		//BatchElement.BaseVertexIndex = 0;
-		BatchElement.MinVertexIndex = StreamRange.GetMinVertex();
-		BatchElement.MaxVertexIndex = StreamRange.GetMaxVertex();
+		BatchElement.MinVertexIndex = DrawRange.GetMinVertex();
+		BatchElement.MaxVertexIndex = DrawRange.GetMaxVertex();
 		//BatchElement.UserIndex = -1;
 		BatchElement.MinScreenSize = 0;
 		BatchElement.MaxScreenSize = 1;
@@ -76,8 +82,8 @@ namespace RealtimeMesh
 #endif
 
 		check(BatchElement.NumPrimitives <= (static_cast<const FRealtimeMeshIndexBuffer*>(BatchElement.IndexBuffer)->Num() - BatchElement.FirstIndex) / 3);
-		check((int32)BatchElement.NumPrimitives <= StreamRange.NumPrimitives(REALTIME_MESH_NUM_INDICES_PER_PRIMITIVE));
-		check((int32)BatchElement.MaxVertexIndex <= StreamRange.GetMaxVertex());
+		check((int32)BatchElement.NumPrimitives <= DrawRange.NumPrimitives(REALTIME_MESH_NUM_INDICES_PER_PRIMITIVE));
+		check((int32)BatchElement.MaxVertexIndex <= DrawRange.GetMaxVertex());
 
 		return true;
 	}
@@ -89,7 +95,7 @@ namespace RealtimeMesh
 		bRangeChanged = false;
 		
 		// First evaluate whether we have valid mesh data to render			
-		bool bHasValidMeshData = StreamRange.NumPrimitives(REALTIME_MESH_NUM_INDICES_PER_PRIMITIVE) > 0 &&
+		bHasValidMeshData = StreamRange.NumPrimitives(REALTIME_MESH_NUM_INDICES_PER_PRIMITIVE) > 0 &&
 			StreamRange.NumVertices() >= REALTIME_MESH_NUM_INDICES_PER_PRIMITIVE;
 
 		if (bHasValidMeshData)
@@ -118,10 +124,38 @@ namespace RealtimeMesh
 		}
 	}
 
+	void FRealtimeMeshSectionProxy::UpdatePassIndexBuffers(FRHICommandListBase& RHICmdList, const FRealtimeMeshDrawMask& PassMask, const FBufferRHIRef& IndexBuffer, const FBufferRHIRef& MaskedIndexBuffer)
+	{
+		// Cached batches keep referencing these after the section is gone, so whoever lets go last releases them
+		const auto CreatePassIndexBuffer = [&RHICmdList]()
+		{
+			TSharedPtr<FRealtimeMeshPassIndexBuffer> PassIndexBuffer = MakeShareable(new FRealtimeMeshPassIndexBuffer(), [](FRealtimeMeshPassIndexBuffer* Buffer)
+			{
+				check(IsInRenderingThread());
+				Buffer->ReleaseResource();
+				delete Buffer;
+			});
+			PassIndexBuffer->InitResource(RHICmdList);
+			return PassIndexBuffer;
+		};
+
+		if (!MainPassIndexBuffer.IsValid())
+		{
+			MainPassIndexBuffer = CreatePassIndexBuffer();
+			ShadowPassIndexBuffer = CreatePassIndexBuffer();
+		}
+
+		MainPassIndexBuffer->SetIndexBuffer(PassMask.ShouldRenderMainPass() ? IndexBuffer : MaskedIndexBuffer);
+		ShadowPassIndexBuffer->SetIndexBuffer(PassMask.ShouldRenderShadow() ? IndexBuffer : MaskedIndexBuffer);
+	}
+
 	void FRealtimeMeshSectionProxy::Reset()
 	{
 		Config = FRealtimeMeshSectionConfig();
 		StreamRange = FRealtimeMeshStreamRange();
 		DrawMask = FRealtimeMeshDrawMask();
+		bHasValidMeshData = false;
+		MainPassIndexBuffer.Reset();
+		ShadowPassIndexBuffer.Reset();
 	}
 }
@@ -0,0 +1,49 @@
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/RealtimeMeshFuture.h"
+
+namespace RealtimeMesh
+{
+	/*
+	 * Tracks the one collision cook a mesh is allowed to have in flight.
+	 * Requests that arrive while a cook is running collapse into a single pending request, which is started once the
+	 * running cook finishes. A new request also cancels the running cook, as its result is already stale, but only up to
+	 * a number of consecutive cancellations so a mesh that is edited every frame still gets its collision updated.
+	 */
+	class REALTIMEMESHCOMPONENT_API FRealtimeMeshCollisionCookScheduler
+	{
+	public:
+		struct FTicket
+		{
+			int32 Version = 0;
+			FRealtimeMeshCancellationToken CancellationToken;
+		};
+
+	private:
+		mutable FCriticalSection Lock;
+		TOptional<FTicket> InFlightCook;
+		bool bHasPendingRequest = false;
+		int32 NumConsecutiveCancels = 0;
+
+	public:
+		/*
+		 * Requests a cook of the given version. Returns the ticket to cook with if nothing was in flight,
+		 * otherwise the request is folded into the pending one and unset is returned.
+		 * MaxConsecutiveCancels of 0 never cancels a running cook.
+		 */
+		TOptional<FTicket> Request(int32 Version, int32 MaxConsecutiveCancels);
+
+		/*
+		 * Marks the cook with this version as done, whether it completed or bailed out after being cancelled.
+		 * Returns true when there's a pending request that should now be started by calling Request again.
+		 */
+		bool Finish(int32 Version, bool bWasCancelled);
+
+		bool IsCookInFlight() const;
+		bool HasPendingRequest() const;
+		int32 GetNumConsecutiveCancels() const;
+	};
+}
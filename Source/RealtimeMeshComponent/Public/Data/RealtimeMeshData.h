@@ -9,6 +9,7 @@
 #include "Data/RealtimeMeshShared.h"
 #include "Async/Async.h"
 #include "Core/RealtimeMeshConfig.h"
+#include "Core/RealtimeMeshFuture.h"
 #include "Core/RealtimeMeshLODConfig.h"
 #include "Core/RealtimeMeshMaterial.h"
 #include "Mesh/RealtimeMeshCardRepresentation.h"
@@ -37,6 +38,15 @@ namespace RealtimeMesh
 		
 		/* Counter for generating version identifier for collision updates */
 		FThreadSafeCounter CollisionUpdateVersionCounter;
+
+		/* Complex meshes from the last cook of a deformable mesh by index, refit rather than recooked while only their vertices move */
+		struct FDeformableCollisionCacheEntry
+		{
+			TSharedPtr<FRealtimeMeshCookedTriMeshData> Cooked;
+			uint32 TopologyHash;
+		};
+		FCriticalSection DeformableCollisionCacheLock;
+		TMap<int32, FDeformableCollisionCacheEntry> DeformableCollisionCache;
 	public:
 		FRealtimeMesh(const FRealtimeMeshSharedResourcesRef& InSharedResources);
 		virtual ~FRealtimeMesh();
@@ -197,6 +207,13 @@ namespace RealtimeMesh
 
 		TFuture<ERealtimeMeshCollisionUpdateResult> UpdateCollision(FRealtimeMeshCollisionInfo&& InCollisionData, int32 NewCollisionKey);
 
+		/* Cooks and applies the collision, bailing out with Ignored if the token is cancelled before cooking finishes */
+		TFuture<ERealtimeMeshCollisionUpdateResult> UpdateCollision(FRealtimeMeshCollisionInfo&& InCollisionData, int32 NewCollisionKey, const FRealtimeMeshCancellationToken& CancellationToken);
+
+		/* Refits every complex mesh whose topology matches the cached cook of the same index, returning the topology hash of every mesh needing a cook */
+		TMap<int32, uint32> RefitDeformableCollision(FRealtimeMeshCollisionInfo& CollisionData);
+		void CacheDeformableCollision(const FRealtimeMeshCollisionInfo& CollisionData, const TMap<int32, uint32>& TopologyHashes);
+
 		void MarkForEndOfFrameUpdate() const;
 		void MarkBoundsDirtyIfNotOverridden(FRealtimeMeshUpdateContext& UpdateContext);
 		virtual bool ShouldRecreateProxyOnChange(const FRealtimeMeshLockContext& LockContext) { return true; }
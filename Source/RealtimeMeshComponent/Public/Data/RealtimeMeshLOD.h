@@ -14,6 +14,8 @@ namespace RealtimeMesh
 		const FRealtimeMeshSharedResourcesRef SharedResources;
 		const FRealtimeMeshLODKey Key;
 		TSet<FRealtimeMeshSectionGroupRef, FRealtimeMeshSectionGroupRefKeyFuncs> SectionGroups;
+		// Hands out the section group handles the render proxy places its section groups at
+		TRealtimeMeshSlotArray<FRealtimeMeshSectionGroupKey> SectionGroupSlots;
 		FRealtimeMeshLODConfig Config;
 		FRealtimeMeshBounds Bounds;
 
@@ -78,6 +80,7 @@ namespace RealtimeMesh
 		virtual bool ShouldRecreateProxyOnChange(const FRealtimeMeshLockContext& LockContext) { return true; }
 
 	protected:
+		FRealtimeMeshSectionGroupRef AddSectionGroup(const FRealtimeMeshSectionGroupKey& SectionGroupKey);
 
 		void MarkBoundsDirtyIfNotOverridden(FRealtimeMeshUpdateContext& UpdateContext);
 	};
@@ -0,0 +1,120 @@
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/RealtimeMeshKeys.h"
+#include "Core/RealtimeMeshDataStream.h"
+
+namespace RealtimeMesh
+{
+	class FRealtimeMeshSimple;
+	struct FRealtimeMeshReplicationGroupUpdate;
+
+	struct FRealtimeMeshReplicationSettings
+	{
+		// Bytes of stream data per chunk. Chunks are the unit changes are found in and sent as, smaller chunks send less around small
+		// edits at the cost of more per chunk overhead.
+		int32 ChunkBytes = 16 * 1024;
+
+		// Bytes the encoder may send per second, 0 is unlimited
+		int64 BytesPerSecond = 0;
+
+		// Largest allowance that builds up while there is nothing to send, so a burst of edits can go out at once
+		int64 MaxBurstBytes = 64 * 1024;
+
+		/* Settings from the RealtimeMesh.Replication console variables */
+		static FRealtimeMeshReplicationSettings FromConsoleVariables();
+	};
+
+	/**
+	 * Server side of section group stream replication, one per client. It keeps a copy of the streams the client was last sent as the
+	 * baseline, and when a section group's stream version moves it splits every stream into fixed size chunks and only sends the
+	 * chunks that differ from the baseline, XOR'd against it so small edits compress to almost nothing. Chunks are Oodle compressed.
+	 *
+	 * Packets are sized to the byte allowance. Removals go first, then new section groups, coarser LODs ahead of detailed ones so the
+	 * client has something to draw, then changes to groups the client already holds in the order they were made, whatever their LOD. A section group is sent in full before the next one starts and
+	 * the client only applies it once all of it arrived, so it never draws a half updated group.
+	 *
+	 * Packets must be delivered reliably and in order, as each is a delta against the one before. Only streams are replicated, the
+	 * client creates missing LODs and section groups with default config and sections come from poly groups as usual. Not thread safe.
+	 */
+	class REALTIMEMESHCOMPONENT_API FRealtimeMeshReplicationEncoder
+	{
+		struct FBaselineGroup
+		{
+			uint32 StreamVersion = 0;
+			FRealtimeMeshStreamSet Streams;
+		};
+
+		FRealtimeMeshReplicationSettings Settings;
+		TMap<FRealtimeMeshSectionGroupKey, FBaselineGroup> Baseline;
+		// Section groups waiting to be sent, with the order they were found in
+		TMap<FRealtimeMeshSectionGroupKey, uint64> DirtyGroups;
+		TArray<FRealtimeMeshSectionGroupKey> RemovedGroups;
+		TUniquePtr<FRealtimeMeshReplicationGroupUpdate> InProgress;
+		uint64 NextDirtySerial = 0;
+		int64 AvailableBytes = 0;
+
+		void GatherChanges(const TSharedRef<FRealtimeMeshSimple>& Mesh);
+		bool PrepareNextUpdate(const TSharedRef<FRealtimeMeshSimple>& Mesh);
+		bool StartGroupUpdate(const TSharedRef<FRealtimeMeshSimple>& Mesh);
+		void DiffStream(const FRealtimeMeshStream& Stream, const FRealtimeMeshStream* BaselineStream, FRealtimeMeshReplicationGroupUpdate& Update) const;
+
+	public:
+		explicit FRealtimeMeshReplicationEncoder(const FRealtimeMeshReplicationSettings& InSettings = FRealtimeMeshReplicationSettings());
+		~FRealtimeMeshReplicationEncoder();
+
+		const FRealtimeMeshReplicationSettings& GetSettings() const { return Settings; }
+
+		/* Adds to the allowance for the time passed, up to MaxBurstBytes */
+		void Tick(float DeltaTime);
+		int64 GetAvailableBytes() const { return Settings.BytesPerSecond > 0 ? AvailableBytes : TNumericLimits<int64>::Max(); }
+
+		/*
+		 * @brief Writes the next packet within the allowance Tick built up, taking what it used from it
+		 * @return Bytes written, 0 if there was nothing to send or no allowance, in which case nothing is written
+		 */
+		int64 WritePacket(const TSharedRef<FRealtimeMeshSimple>& Mesh, FArchive& Ar);
+
+		/*
+		 * @brief Writes the next packet within ByteBudget, leaving the allowance alone. A packet always carries at least one record so
+		 * a chunk larger than the budget can't stall the stream, it just goes over.
+		 * @return Bytes written, 0 if there was nothing to send, in which case nothing is written
+		 */
+		int64 WritePacket(const TSharedRef<FRealtimeMeshSimple>& Mesh, FArchive& Ar, int64 ByteBudget);
+
+		/* Whether anything is waiting to be sent, as of the last packet */
+		bool HasPendingChanges() const { return InProgress.IsValid() || RemovedGroups.Num() > 0 || DirtyGroups.Num() > 0; }
+
+		/* Forgets the baseline, so everything is sent again from scratch. For a client that joined or lost its copy. */
+		void Reset();
+	};
+
+	/**
+	 * Client side of section group stream replication, applying the packets of a FRealtimeMeshReplicationEncoder to a mesh. Section
+	 * groups sent across several packets are staged until the last of them arrives. Not thread safe.
+	 */
+	class REALTIMEMESHCOMPONENT_API FRealtimeMeshReplicationDecoder
+	{
+		TUniquePtr<FRealtimeMeshReplicationGroupUpdate> Staged;
+
+		bool ApplyGroupUpdate(const TSharedRef<FRealtimeMeshSimple>& Mesh, FRealtimeMeshReplicationGroupUpdate& Update) const;
+		static bool RemoveGroup(const TSharedRef<FRealtimeMeshSimple>& Mesh, const FRealtimeMeshSectionGroupKey& SectionGroupKey);
+
+	public:
+		FRealtimeMeshReplicationDecoder();
+		~FRealtimeMeshReplicationDecoder();
+
+		/*
+		 * @brief Reads a packet and applies every section group it completes
+		 * @return False if the packet was malformed. The mesh may no longer match the server and should be resynced with a Reset on both ends.
+		 */
+		bool ReadPacket(const TSharedRef<FRealtimeMeshSimple>& Mesh, FArchive& Ar);
+
+		/* Whether a section group is partway through arriving */
+		bool HasStagedUpdate() const { return Staged.IsValid(); }
+
+		void Reset();
+	};
+}
@@ -0,0 +1,147 @@
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/RealtimeMeshSlotArray.h"
+#include "Containers/Ticker.h"
+
+namespace RealtimeMesh
+{
+	class FRealtimeMeshSimple;
+	struct FRealtimeMeshEvictedSectionGroup;
+
+	enum class ERealtimeMeshLODResidency : uint8
+	{
+		Resident,
+		Evicted,
+		// Evicted, with a load in flight. Counted against the budget already.
+		Loading,
+	};
+
+	struct FRealtimeMeshResidencySettings
+	{
+		// Evictable bytes allowed to stay resident across all managed meshes, 0 is unlimited
+		int64 BudgetBytes = 0;
+
+		// Frames a LOD can go unneeded before it is evicted even when under budget. Negative only evicts to stay within the budget.
+		int32 EvictAfterFrames = -1;
+
+		// Loads started per update, the rest are picked up by later updates
+		int32 MaxLoadsPerUpdate = TNumericLimits<int32>::Max();
+	};
+
+	struct FRealtimeMeshResidencyRequest
+	{
+		FRealtimeMeshHandle Mesh;
+		int32 LODIndex;
+	};
+
+	/**
+	 * Decides which LODs of the managed meshes stay resident. It only does the bookkeeping, FRealtimeMeshResidencyManager acts on
+	 * the decisions, so the policy is deterministic and can be driven by hand.
+	 * A LOD is needed on a frame when the mesh was drawn at a screen size that selects it or a more detailed LOD. LODs needed on the
+	 * current frame are never evicted, even when that leaves the budget exceeded, and neither is the least detailed LOD of a mesh so
+	 * there is always something to draw. Everything else goes least recently needed first, then largest first.
+	 */
+	class REALTIMEMESHCOMPONENT_API FRealtimeMeshResidencyPolicy
+	{
+		struct FLODState
+		{
+			int64 Bytes = 0;
+			uint64 LastNeededFrame = 0;
+			ERealtimeMeshLODResidency Residency = ERealtimeMeshLODResidency::Resident;
+		};
+
+		struct FMeshState
+		{
+			TFixedLODArray<FLODState> LODs;
+		};
+
+		TRealtimeMeshSlotArray<FMeshState> Meshes;
+		int64 ResidentBytes = 0;
+
+		void Evict(FLODState& LOD, const FRealtimeMeshHandle& Mesh, int32 LODIndex, TArray<FRealtimeMeshResidencyRequest>& OutEvictions);
+
+	public:
+		FRealtimeMeshHandle Register();
+		bool Unregister(const FRealtimeMeshHandle& Mesh);
+
+		/* Sets the LOD count and the size of the resident LODs. Evicted LODs keep the size they had when they were evicted. */
+		void SetLODSizes(const FRealtimeMeshHandle& Mesh, TConstArrayView<int64> LODSizes, uint64 Frame);
+
+		/* Marks FirstNeededLOD and every less detailed LOD as needed on this frame */
+		void SetNeededLODs(const FRealtimeMeshHandle& Mesh, int32 FirstNeededLOD, uint64 Frame);
+
+		/* Picks the LODs to evict and to load, updating their state. Loads stay Loading until MarkResident. */
+		void Update(const FRealtimeMeshResidencySettings& Settings, uint64 Frame, TArray<FRealtimeMeshResidencyRequest>& OutEvictions,
+			TArray<FRealtimeMeshResidencyRequest>& OutLoads);
+
+		/* Marks a LOD resident again, once its load finished or when evicting it turned out to have nothing to take */
+		void MarkResident(const FRealtimeMeshHandle& Mesh, int32 LODIndex);
+
+		/* Marks a resident LOD evicted outside of Update. False if it wasn't resident. */
+		bool MarkEvicted(const FRealtimeMeshHandle& Mesh, int32 LODIndex);
+
+		ERealtimeMeshLODResidency GetResidency(const FRealtimeMeshHandle& Mesh, int32 LODIndex) const;
+		int64 GetResidentBytes() const { return ResidentBytes; }
+		int32 Num() const { return Meshes.Num(); }
+
+		/* Finds the LOD a screen size selects, the same way the scene proxy picks it. LODs with a negative screen size are never picked. */
+		static int32 GetLODForScreenSize(TConstArrayView<float> LODScreenSizes, float ScreenSize);
+	};
+
+	/**
+	 * Streams the LODs of opted in meshes in and out following FRealtimeMeshResidencyPolicy. Once a frame it reads back the largest
+	 * screen size each mesh was drawn at, evicts the streams of the LODs the policy picks into a compressed cache, optionally spilled
+	 * to disk, and decompresses them on a worker when they are needed again. LOD sizes are only read again after the mesh
+	 * committed an update. Game thread only.
+	 */
+	class REALTIMEMESHCOMPONENT_API FRealtimeMeshResidencyManager
+	{
+		struct FCachedLOD;
+
+		struct FManagedMesh
+		{
+			TWeakPtr<FRealtimeMeshSimple> Mesh;
+			const FRealtimeMeshSimple* MeshKey = nullptr;
+			TFixedLODArray<TSharedPtr<FCachedLOD>> CachedLODs;
+			TFixedLODArray<float> ScreenSizes;
+			// FRealtimeMeshSimple::GetResidencyInfoVersion the sizes were last read at
+			uint32 ResidencyInfoVersion = 0;
+		};
+
+		FRealtimeMeshResidencyPolicy Policy;
+		TMap<FRealtimeMeshHandle, FManagedMesh> ManagedMeshes;
+		TMap<const FRealtimeMeshSimple*, FRealtimeMeshHandle> MeshHandles;
+		FTSTicker::FDelegateHandle TickHandle;
+
+		bool Tick(float DeltaTime);
+		void UpdateLODSizes(const FRealtimeMeshHandle& Handle, FManagedMesh& Managed, const FRealtimeMeshSimple& Mesh);
+		void EvictLOD(const FRealtimeMeshHandle& Handle, FManagedMesh& Managed, int32 LODIndex, bool bUseDiskCache);
+		void LoadLOD(const FRealtimeMeshHandle& Handle, FManagedMesh& Managed, int32 LODIndex);
+
+	public:
+		~FRealtimeMeshResidencyManager();
+
+		void Register(const TSharedRef<FRealtimeMeshSimple>& Mesh);
+
+		/* Stops managing the mesh, restoring every LOD it had evicted before returning */
+		void Unregister(const TSharedRef<FRealtimeMeshSimple>& Mesh);
+		bool IsRegistered(const FRealtimeMeshSimple& Mesh) const;
+
+		/* Evicts a LOD of a managed mesh straight away, outside of the policy. It loads back as usual once it is needed. */
+		bool EvictLOD(const TSharedRef<FRealtimeMeshSimple>& Mesh, int32 LODIndex);
+
+		/* Brings every evicted or loading LOD of the mesh back before returning, the mesh stays managed. Saving relies on this. */
+		void RestoreEvictedLODs(const TSharedRef<FRealtimeMeshSimple>& Mesh);
+
+		const FRealtimeMeshResidencyPolicy& GetPolicy() const { return Policy; }
+
+		/* Serializes and compresses evicted section groups into a cache blob, and back */
+		static bool CompressSectionGroups(TArray<FRealtimeMeshEvictedSectionGroup>& SectionGroups, TArray<uint8>& OutCompressed);
+		static bool DecompressSectionGroups(const TArray<uint8>& Compressed, TArray<FRealtimeMeshEvictedSectionGroup>& OutSectionGroups);
+
+		static FRealtimeMeshResidencyManager& Get();
+	};
+}
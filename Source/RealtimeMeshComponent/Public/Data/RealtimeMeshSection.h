@@ -4,6 +4,7 @@
 
 #include "RealtimeMeshCore.h"
 #include "Data/RealtimeMeshShared.h"
+#include "Core/RealtimeMeshSlotArray.h"
 #include "RenderProxy/RealtimeMeshProxy.h"
 
 
@@ -26,6 +27,10 @@ namespace RealtimeMesh
 		// Key used to identify this section
 		const FRealtimeMeshSectionKey Key;
 
+		// Slots of this section and its parent SectionGroup, shared with the render proxy so commands address it without going through the key
+		FRealtimeMeshHandle SectionGroupHandle;
+		FRealtimeMeshHandle Handle;
+
 	private:
 		// Current config of this section
 		FRealtimeMeshSectionConfig Config;
@@ -65,6 +70,12 @@ namespace RealtimeMesh
 		 */
 		const FRealtimeMeshSectionKey& GetKey(const FRealtimeMeshLockContext& LockContext) const { return Key; }
 
+		/**
+		 * @brief Gets the handle the render proxy addresses this section by, within its SectionGroup
+		 * @param LockContext Context object for access to the RMC data
+		 */
+		const FRealtimeMeshHandle& GetHandle(const FRealtimeMeshLockContext& LockContext) const { return Handle; }
+
 		/**
 		 * @brief Gets the Config for this section
 		 * @param LockContext Context object for access to the RMC data
@@ -180,6 +191,7 @@ namespace RealtimeMesh
 		virtual void FinalizeUpdate(FRealtimeMeshUpdateContext& UpdateContext);
 
 		virtual bool ShouldRecreateProxyOnChange(const FRealtimeMeshLockContext& LockContext) const;
+		virtual bool ShouldUpdateStaticMeshesOnChange(const FRealtimeMeshLockContext& LockContext) const;
 	protected:
 		const FRealtimeMeshSectionKey& GetKey_AssumesLocked() const { return Key; }
 		friend struct FRealtimeMeshSectionRefKeyFuncs;
@@ -8,6 +8,7 @@
 #include "Data/RealtimeMeshShared.h"
 #include "Core/RealtimeMeshKeys.h"
 #include "Core/RealtimeMeshSectionGroupConfig.h"
+#include "Core/RealtimeMeshSlotArray.h"
 
 namespace RealtimeMesh
 {
@@ -16,9 +17,12 @@ namespace RealtimeMesh
 	protected:
 		const FRealtimeMeshSharedResourcesRef SharedResources;
 		const FRealtimeMeshSectionGroupKey Key;
+		// Slot in the parent LOD, shared with the render proxy so commands address it without going through the key
+		FRealtimeMeshHandle Handle;
 
 		TSet<FRealtimeMeshStreamKey> Streams;
 		TSet<FRealtimeMeshSectionRef, FRealtimeMeshSectionRefKeyFuncs> Sections;
+		TRealtimeMeshSlotArray<FRealtimeMeshSectionKey> SectionSlots;
 		FRealtimeMeshSectionGroupConfig Config;
 		FRealtimeMeshBounds Bounds;
 
@@ -27,6 +31,7 @@ namespace RealtimeMesh
 		virtual ~FRealtimeMeshSectionGroup() = default;
 
 		const FRealtimeMeshSectionGroupKey& GetKey(const FRealtimeMeshLockContext& LockContext) const { return Key; }
+		const FRealtimeMeshHandle& GetHandle(const FRealtimeMeshLockContext& LockContext) const { return Handle; }
 		FRealtimeMeshStreamRange GetInUseRange(const FRealtimeMeshLockContext& LockContext) const;
 		TOptional<FBoxSphereBounds3f> GetLocalBounds(const FRealtimeMeshLockContext& LockContext) const;
 		bool HasSections(const FRealtimeMeshLockContext& LockContext) const;
@@ -103,10 +108,13 @@ namespace RealtimeMesh
 		virtual void FinalizeUpdate(FRealtimeMeshUpdateContext& UpdateContext);
 		
 		virtual bool ShouldRecreateProxyOnChange(const FRealtimeMeshLockContext& LockContext) const { return Config.DrawType == ERealtimeMeshSectionDrawType::Static; }
+		virtual bool ShouldUpdateStaticMeshesOnChange(const FRealtimeMeshLockContext& LockContext) const { return Config.DrawType == ERealtimeMeshSectionDrawType::Static; }
 	protected:
 		const FRealtimeMeshSectionGroupKey& GetKey_AssumesLocked() const { return Key; }
 		friend struct FRealtimeMeshSectionGroupRefKeyFuncs;
 		friend class FRealtimeMeshLOD;
+
+		FRealtimeMeshSectionRef AddSection(const FRealtimeMeshSectionKey& SectionKey);
 		
 		void MarkBoundsDirtyIfNotOverridden(FRealtimeMeshUpdateContext& UpdateContext);
 
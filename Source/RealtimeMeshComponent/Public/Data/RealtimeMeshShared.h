@@ -105,8 +105,14 @@ namespace RealtimeMesh
 		FRealtimeMeshProxyWeakPtr Proxy;
 
 		FRealtimeMeshSimpleEvent OnRenderProxyRequiresUpdateEvent;
+		FRealtimeMeshSimpleEvent OnRenderProxyRequiresStaticMeshUpdateEvent;
 		FRealtimeMeshSimpleEvent OnBoundsChangedEvent;
 
+		// Largest screen size any scene proxy computed for this mesh since the feedback was last consumed, as float bits.
+		// Only gathered while enabled, which LOD residency does for the meshes it manages.
+		std::atomic<bool> bWantsScreenSizeFeedback { false };
+		std::atomic<uint32> ScreenSizeFeedbackBits { 0 };
+
 	public:
 		virtual ~FRealtimeMeshSharedResources() = default;
 
@@ -153,7 +159,17 @@ namespace RealtimeMesh
 		}
 
 
+		void SetWantsScreenSizeFeedback(bool bNewValue) { bWantsScreenSizeFeedback = bNewValue; }
+		bool WantsScreenSizeFeedback() const { return bWantsScreenSizeFeedback.load(std::memory_order_relaxed); }
+
+		/* Called from the render thread with the screen size a view computed for this mesh while picking its LOD */
+		void ReportScreenSize(float ScreenSize);
+
+		/* Returns the largest screen size reported since the last call and resets it, 0 if the mesh wasn't drawn in between */
+		float ConsumeScreenSizeFeedback();
+
 		FRealtimeMeshSimpleEvent& OnRenderProxyRequiresUpdate() { return OnRenderProxyRequiresUpdateEvent; }
+		FRealtimeMeshSimpleEvent& OnRenderProxyRequiresStaticMeshUpdate() { return OnRenderProxyRequiresStaticMeshUpdateEvent; }
 		FRealtimeMeshSimpleEvent& OnBoundsChanged() { return OnBoundsChangedEvent; }
 
 		
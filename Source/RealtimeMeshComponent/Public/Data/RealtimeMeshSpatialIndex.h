@@ -0,0 +1,128 @@
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RealtimeMeshCore.h"
+#include "Mesh/RealtimeMeshTriangleBVH.h"
+
+namespace RealtimeMesh
+{
+	struct FRealtimeMeshSpatialHit : FRealtimeMeshTriangleHit
+	{
+		FRealtimeMeshSectionGroupKey SectionGroupKey;
+	};
+
+	class FRealtimeMeshSpatialIndexGroup;
+
+	/*
+	 * Copy of the render data of one section group, taken under the mesh lock so the spatial index can be built from
+	 * it on a worker thread while the mesh keeps changing.
+	 */
+	struct REALTIMEMESHCOMPONENT_API FRealtimeMeshSpatialIndexSource
+	{
+		FRealtimeMeshSectionGroupKey Key;
+		uint32 StreamVersion = 0;
+		uint32 TopologyVersion = 0;
+		TArray<FVector3f> Positions;
+		TArray<TIndex3<int32>> Triangles;
+		TArray<TArray<FVector2f>> TexCoords;
+
+		// Previous build of this group, when only its vertices have moved since. Its hierarchy is refit instead of rebuilt.
+		TSharedPtr<const FRealtimeMeshSpatialIndexGroup> RefitFrom;
+
+		/*
+		 * Copies positions, triangles and every UV channel out of the streams. Triangles are skipped when refitting,
+		 * and RefitFrom is dropped if the vertex count no longer matches. Returns false if there's nothing to index.
+		 */
+		bool Gather(const FRealtimeMeshStreamSet& Streams);
+	};
+
+	/* Hierarchy and UVs for one section group, immutable once built */
+	class REALTIMEMESHCOMPONENT_API FRealtimeMeshSpatialIndexGroup
+	{
+		FRealtimeMeshSectionGroupKey Key;
+		uint32 StreamVersion;
+		uint32 TopologyVersion;
+		FRealtimeMeshTriangleBVH BVH;
+		TArray<TArray<FVector2f>> TexCoords;
+		bool bWasRefit;
+
+	public:
+		explicit FRealtimeMeshSpatialIndexGroup(FRealtimeMeshSpatialIndexSource&& Source);
+
+		const FRealtimeMeshSectionGroupKey& GetKey() const { return Key; }
+		uint32 GetStreamVersion() const { return StreamVersion; }
+		uint32 GetTopologyVersion() const { return TopologyVersion; }
+		bool WasRefit() const { return bWasRefit; }
+		const FRealtimeMeshTriangleBVH& GetBVH() const { return BVH; }
+		int32 NumTexCoordChannels() const { return TexCoords.Num(); }
+
+		/* Interpolates the UV channel at the hit's barycentrics */
+		bool GetTexCoord(const FRealtimeMeshTriangleHit& Hit, int32 UVChannel, FVector2f& OutUV) const;
+
+		SIZE_T GetAllocatedSize() const;
+	};
+
+	using FRealtimeMeshSpatialIndexGroupRef = TSharedRef<const FRealtimeMeshSpatialIndexGroup>;
+
+	/*
+	 * Spatial index over the render data of every section group in a LOD, used for UV and geometry queries that don't
+	 * need a physics hit. An index is an immutable snapshot, so any number of threads can query it while a newer one
+	 * is being built. Building reuses the groups of the previous snapshot whose streams haven't changed since, and refits
+	 * the ones where only the vertices moved.
+	 */
+	class REALTIMEMESHCOMPONENT_API FRealtimeMeshSpatialIndex
+	{
+		FRealtimeMeshLODKey LODKey;
+		TArray<FRealtimeMeshSpatialIndexGroupRef> Groups;
+
+	public:
+		FRealtimeMeshSpatialIndex(FRealtimeMeshLODKey InLODKey, TArray<FRealtimeMeshSpatialIndexGroupRef>&& InGroups)
+			: LODKey(InLODKey), Groups(MoveTemp(InGroups))
+		{
+		}
+
+		/*
+		 * Builds the groups for the changed sources in parallel and combines them with the unchanged groups that were
+		 * carried over from the previous snapshot.
+		 */
+		static TSharedRef<const FRealtimeMeshSpatialIndex> Build(FRealtimeMeshLODKey LODKey, TArray<FRealtimeMeshSpatialIndexSource>&& ChangedSources,
+			TArray<FRealtimeMeshSpatialIndexGroupRef>&& UnchangedGroups);
+
+		FRealtimeMeshLODKey GetLODKey() const { return LODKey; }
+		TConstArrayView<FRealtimeMeshSpatialIndexGroupRef> GetGroups() const { return Groups; }
+		const FRealtimeMeshSpatialIndexGroup* FindGroup(const FRealtimeMeshSectionGroupKey& SectionGroupKey) const;
+
+		/* Whether this snapshot was built from exactly these section groups at these stream versions */
+		bool IsUpToDate(const TMap<FRealtimeMeshSectionGroupKey, uint32>& StreamVersions) const;
+
+		/* Nearest hit along the ray across all section groups. Direction must be normalized. */
+		bool Raycast(const FVector3f& Origin, const FVector3f& Direction, float MaxDistance, FRealtimeMeshSpatialHit& OutHit) const;
+		/* First triangle a sphere moving along the ray touches across all section groups. Direction must be normalized. */
+		bool SweepSphere(const FVector3f& Origin, const FVector3f& Direction, float Radius, float MaxDistance, FRealtimeMeshSpatialHit& OutHit) const;
+		bool FindClosestPoint(const FVector3f& Point, float MaxDistance, FRealtimeMeshSpatialHit& OutHit) const;
+
+		/*
+		 * Batched versions of the queries above, spread across the task graph for large batches. All the views must be
+		 * the same length, misses leave an invalid hit in OutHits. Return the number of queries that hit.
+		 */
+		int32 RaycastBatch(TConstArrayView<FVector3f> Origins, TConstArrayView<FVector3f> Directions, float MaxDistance, TArrayView<FRealtimeMeshSpatialHit> OutHits) const;
+		int32 SweepSphereBatch(TConstArrayView<FVector3f> Origins, TConstArrayView<FVector3f> Directions, float Radius, float MaxDistance, TArrayView<FRealtimeMeshSpatialHit> OutHits) const;
+		int32 FindClosestPointBatch(TConstArrayView<FVector3f> Points, float MaxDistance, TArrayView<FRealtimeMeshSpatialHit> OutHits) const;
+
+		bool GetTexCoord(const FRealtimeMeshSpatialHit& Hit, int32 UVChannel, FVector2f& OutUV) const;
+		bool FindTexCoordAtLocation(const FVector3f& Location, float MaxDistance, int32 UVChannel, FVector2f& OutUV) const;
+		bool FindTexCoordByRaycast(const FVector3f& Origin, const FVector3f& Direction, float MaxDistance, int32 UVChannel, FVector2f& OutUV) const;
+
+		/*
+		 * Closest point UV lookup for a whole batch of locations, spread across the task graph for large batches.
+		 * OutUVs and OutFound must be the same length as Locations. Returns the number of locations that found a UV.
+		 */
+		int32 FindTexCoordsAtLocations(TConstArrayView<FVector3f> Locations, float MaxDistance, int32 UVChannel, TArrayView<FVector2f> OutUVs, TArrayView<bool> OutFound) const;
+
+		SIZE_T GetAllocatedSize() const;
+	};
+
+	using FRealtimeMeshSpatialIndexPtr = TSharedPtr<const FRealtimeMeshSpatialIndex>;
+}
@@ -687,6 +687,108 @@ namespace RealtimeMesh
 
 
 
+	/*
+	 * Typed, contiguous span over one sub-element (or all elements) of every row in a stream. Meant for generators
+	 * that want tight loops over a whole stream without paying for the per element accessor/converter layers.
+	 *
+	 * If the stream already stores exactly ViewType (same element type and count, no element offset) the view aliases
+	 * the stream memory directly. Otherwise the stream is batch converted into a scratch array when the view is created
+	 * and, for writable views, batch converted back into the stream by Commit() or, if it was never committed, when the
+	 * view is destroyed. Writes made after a Commit() need another Commit(), or MarkDirty() to have the destructor do it.
+	 *
+	 * Concurrency: any number of threads may read the view, and multiple threads (e.g. ParallelFor) may write to it as
+	 * long as each index is only written by one of them. Until the view is committed the stream must not be resized,
+	 * moved, or written through any other accessor/view, and Commit() must only be called after all the writers have
+	 * finished.
+	 */
+	template <typename ViewType>
+	struct TRealtimeMeshStreamView
+	{
+	public:
+		using ElementType = std::remove_const_t<ViewType>;
+		static constexpr bool IsWritable = !std::is_const_v<ViewType>;
+		using StreamType = std::conditional_t<IsWritable, FRealtimeMeshStream, const FRealtimeMeshStream>;
+		using SizeType = FRealtimeMeshStream::SizeType;
+
+	private:
+		StreamType& Stream;
+		TArray<ElementType> ConvertedData;
+		TArrayView<ViewType> View;
+		int32 ElementOffset;
+		bool bIsDirect;
+		bool bNeedsCommit;
+
+	public:
+		TRealtimeMeshStreamView(StreamType& InStream, int32 InElementOffset = 0)
+			: Stream(InStream)
+			, ElementOffset(InElementOffset)
+		{
+			const FRealtimeMeshBufferLayout ViewLayout = GetRealtimeMeshBufferLayout<ElementType>();
+			checkf(ElementOffset >= 0 && ViewLayout.GetNumElements() + ElementOffset <= Stream.GetNumElements(),
+				TEXT("Substream section is outside of the supplied stream."));
+
+			bIsDirect = ElementOffset == 0 && Stream.GetLayout() == ViewLayout;
+			bNeedsCommit = IsWritable && !bIsDirect;
+			if (bIsDirect)
+			{
+				View = TArrayView<ViewType>(reinterpret_cast<ViewType*>(Stream.GetData()), Stream.Num());
+			}
+			else
+			{
+				ConvertedData.SetNumUninitialized(Stream.Num());
+				Stream.GetElementRange(0, ElementOffset, ViewLayout, reinterpret_cast<uint8*>(ConvertedData.GetData()), Stream.Num());
+				View = ConvertedData;
+			}
+		}
+
+		~TRealtimeMeshStreamView()
+		{
+			Commit();
+		}
+
+		// The view may point at its own scratch data, so it's neither copyable nor movable
+		TRealtimeMeshStreamView(const TRealtimeMeshStreamView&) = delete;
+		TRealtimeMeshStreamView& operator=(const TRealtimeMeshStreamView&) = delete;
+		TRealtimeMeshStreamView(TRealtimeMeshStreamView&&) = delete;
+		TRealtimeMeshStreamView& operator=(TRealtimeMeshStreamView&&) = delete;
+
+		/*
+		 * Writes converted data back into the stream, if there's anything left to write back. Does nothing for read only
+		 * views, views directly over the stream, or views already committed and not marked dirty since.
+		 */
+		void Commit()
+		{
+			if constexpr (IsWritable)
+			{
+				if (bNeedsCommit)
+				{
+					checkf(Stream.Num() == ConvertedData.Num(), TEXT("Stream was resized while a view was active."));
+					Stream.SetElementRange(0, ElementOffset, GetRealtimeMeshBufferLayout<ElementType>(), reinterpret_cast<const uint8*>(ConvertedData.GetData()), ConvertedData.Num());
+					bNeedsCommit = false;
+				}
+			}
+		}
+
+		/* Flags the view as written again after a Commit(), so the next Commit() or the destructor writes it back */
+		void MarkDirty()
+		{
+			bNeedsCommit = IsWritable && !bIsDirect;
+		}
+
+		/* Whether this view points straight at the stream memory, rather than at a converted copy */
+		FORCEINLINE bool IsDirect() const { return bIsDirect; }
+		
+		FORCEINLINE SizeType Num() const { return View.Num(); }
+		FORCEINLINE bool IsValidIndex(SizeType Index) const { return View.IsValidIndex(Index); }
+		FORCEINLINE ViewType* GetData() const { return View.GetData(); }
+		FORCEINLINE TArrayView<ViewType> GetView() const { return View; }
+		FORCEINLINE ViewType& operator[](SizeType Index) const { return View[Index]; }
+
+		FORCEINLINE auto begin() const { return View.begin(); }
+		FORCEINLINE auto end() const { return View.end(); }
+	};
+
+
 	template <typename InAccessType, typename InBufferType, bool bAllowSubstreamAccess>
 	struct TRealtimeMeshStreamBuilderBase
 	{
@@ -1442,6 +1544,51 @@ namespace RealtimeMesh
 			Triangles.Empty();
 		}
 
+		/*
+		 * Typed span views over the builder's streams. These alias the stream memory when the stored type matches
+		 * ViewType, and convert in bulk otherwise. See TRealtimeMeshStreamView for the threading rules.
+		 * The number of vertices/triangles must not change while a view is alive.
+		 */
+		template <typename ViewType = FVector3f>
+		TRealtimeMeshStreamView<ViewType> GetPositionView()
+		{
+			return TRealtimeMeshStreamView<ViewType>(Vertices.GetStream());
+		}
+
+		template <typename ViewType = TangentAccessType>
+		TRealtimeMeshStreamView<ViewType> GetTangentView()
+		{
+			checkf(HasTangents(), TEXT("Vertex tangents not enabled"));
+			return TRealtimeMeshStreamView<ViewType>(Tangents->GetStream());
+		}
+
+		template <typename ViewType = FVector2f>
+		TRealtimeMeshStreamView<ViewType> GetTexCoordView(int32 TexCoordIdx = 0)
+		{
+			checkf(HasTexCoords(), TEXT("Vertex texcoords not enabled"));
+			return TRealtimeMeshStreamView<ViewType>(TexCoords->GetStream(), TexCoordIdx);
+		}
+
+		template <typename ViewType = FColor>
+		TRealtimeMeshStreamView<ViewType> GetColorView()
+		{
+			checkf(HasVertexColors(), TEXT("Vertex colors not enabled"));
+			return TRealtimeMeshStreamView<ViewType>(Colors->GetStream());
+		}
+
+		template <typename ViewType = TriangleAccessType>
+		TRealtimeMeshStreamView<ViewType> GetTriangleView()
+		{
+			return TRealtimeMeshStreamView<ViewType>(Triangles.GetStream());
+		}
+
+		template <typename ViewType = uint32>
+		TRealtimeMeshStreamView<ViewType> GetPolyGroupView()
+		{
+			checkf(HasPolyGroups(), TEXT("Triangle material indices not enabled"));
+			return TRealtimeMeshStreamView<ViewType>(TrianglePolyGroups->GetStream());
+		}
+
 		SizeType NumDepthOnlyTriangles() const
 		{
 			return DepthOnlyTriangles.IsSet() ? DepthOnlyTriangles->Num() : 0;
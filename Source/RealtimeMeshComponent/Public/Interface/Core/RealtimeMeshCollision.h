@@ -28,6 +28,8 @@ struct FRealtimeMeshCollisionConfiguration
 	bool bFlipNormals;
 	bool bDeformableMesh;	
 	bool bMergeAllMeshes;
+	bool bCleanComplexMeshes;
+	float CleanWeldThreshold;
 	
 	FRealtimeMeshCollisionConfiguration()
 		: bUseComplexAsSimpleCollision(true)
@@ -36,6 +38,8 @@ struct FRealtimeMeshCollisionConfiguration
 		, bFlipNormals(false)
 		, bDeformableMesh(false)
 		, bMergeAllMeshes(false)
+		, bCleanComplexMeshes(false)
+		, CleanWeldThreshold(0.01f)
 	{ }
 
 	friend FArchive& operator<<(FArchive& Ar, FRealtimeMeshCollisionConfiguration& Config);
@@ -137,6 +141,7 @@ struct FRealtimeMeshCollisionConvex : public FRealtimeMeshCollisionShape
 private:
 	TArray<FVector> Vertices;	
 	FBox BoundingBox;
+	bool bGenerated = false;
 	
 	mutable TSharedPtr<FRealtimeMeshCookedConvexMeshData> Cooked;
 	
@@ -149,6 +154,10 @@ public:
 	const TArray<FVector>& GetVertices() const { return Vertices; }
 	void EditVertices(const TFunctionRef<void(TArray<FVector>&)>& ProcessFunc) { ProcessFunc(Vertices); ReleaseCooked(); }
 
+	// Set on hulls produced by a convex decomposition, so regenerating it never touches user hulls whatever their name
+	bool IsGenerated() const { return bGenerated; }
+	void SetGenerated(bool bInGenerated) { bGenerated = bInGenerated; }
+
 	bool NeedsCook() const { return !Cooked.IsValid(); }
 	bool HasCookedMesh() const { return Cooked.IsValid() && Cooked->HasNonMirrored(); }
 	TSharedPtr<FRealtimeMeshCookedConvexMeshData> GetCooked() const { return Cooked; }
@@ -220,6 +229,20 @@ public:
 		return NewIndex;
 	}
 
+	int32 Add(ShapeType&& NewShape)
+	{
+		const FName ShapeName = NewShape.Name;
+		const int32 NewIndex = Shapes.Add(MoveTemp(NewShape));
+		AddToNameMap(ShapeName, NewIndex);
+		return NewIndex;
+	}
+
+	void Reserve(int32 NumShapes)
+	{
+		Shapes.Reserve(NumShapes);
+		NameMap.Reserve(NumShapes);
+	}
+
 	bool Insert(int32 Index, const ShapeType& NewShape)
 	{
 		if (!Shapes.IsValidIndex(Index) && Index >= 0)
@@ -251,6 +274,23 @@ public:
 		return INDEX_NONE;
 	}
 
+	/** Same as GetIndexFromName but quietly returns INDEX_NONE for unknown names, for callers that expect misses */
+	int32 FindIndexByName(FName ShapeName) const
+	{
+		const int32* FoundEntry = NameMap.Find(ShapeName);
+		return FoundEntry ? *FoundEntry : INDEX_NONE;
+	}
+
+	bool Contains(FName ShapeName) const
+	{
+		return NameMap.Contains(ShapeName);
+	}
+
+	bool IsValidIndex(int32 Index) const
+	{
+		return Shapes.IsValidIndex(Index);
+	}
+
 	bool GetByName(FName ShapeName, ShapeType& OutShape) const
 	{
 		const int32 Index = GetIndexFromName(ShapeName);
@@ -296,6 +336,67 @@ public:
 		return false;
 	}
 
+	/*
+	 * Bulk operations. These keep the name map up to date one entry at a time rather than rebuilding it,
+	 * and since the shapes live in a sparse array the index of every shape not touched by the batch stays
+	 * the same, so indices handed out earlier remain valid.
+	 */
+
+	/** Adds all shapes, optionally returning the index of each one in the same order */
+	void Append(TConstArrayView<ShapeType> NewShapes, TArray<int32>* OutIndices = nullptr)
+	{
+		Reserve(Shapes.Num() + NewShapes.Num());
+		if (OutIndices)
+		{
+			OutIndices->Reset(NewShapes.Num());
+		}
+
+		for (const ShapeType& NewShape : NewShapes)
+		{
+			const int32 NewIndex = Add(NewShape);
+			if (OutIndices)
+			{
+				OutIndices->Add(NewIndex);
+			}
+		}
+	}
+
+	/** Updates Indices[i] to InShapes[i]. Invalid indices are skipped. Returns the number of shapes updated. */
+	int32 UpdateMany(TConstArrayView<int32> Indices, TConstArrayView<ShapeType> InShapes)
+	{
+		check(Indices.Num() == InShapes.Num());
+
+		int32 NumUpdated = 0;
+		for (int32 Index = 0; Index < Indices.Num(); Index++)
+		{
+			NumUpdated += Update(Indices[Index], InShapes[Index]) ? 1 : 0;
+		}
+		return NumUpdated;
+	}
+
+	/** Removes the shapes at the given indices. Invalid or repeated indices are skipped. Returns the number of shapes removed. */
+	int32 RemoveMany(TConstArrayView<int32> Indices)
+	{
+		int32 NumRemoved = 0;
+		for (const int32 Index : Indices)
+		{
+			NumRemoved += Remove(Index) ? 1 : 0;
+		}
+		return NumRemoved;
+	}
+
+	/** Removes the shapes with the given names. Unknown names are skipped without warning. Returns the number of shapes removed. */
+	int32 RemoveManyByName(TConstArrayView<FName> ShapeNames)
+	{
+		int32 NumRemoved = 0;
+		for (const FName ShapeName : ShapeNames)
+		{
+			const int32 Index = FindIndexByName(ShapeName);
+			NumRemoved += Index != INDEX_NONE && Remove(Index) ? 1 : 0;
+		}
+		return NumRemoved;
+	}
+
 	bool IsEmpty() const { return Shapes.Num() == 0; }
 	int32 Num() const { return Shapes.Num(); }
 	
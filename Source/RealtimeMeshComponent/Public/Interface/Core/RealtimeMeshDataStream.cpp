@@ -2,9 +2,22 @@
 
 
 #include "RealtimeMeshDataStream.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
 
 #include <string>
 
+static TAutoConsoleVariable<int32> CVarRealtimeMeshStreamParallelCopyThreshold(
+	TEXT("RealtimeMesh.Streams.ParallelCopyThreshold"),
+	1024 * 1024,
+	TEXT("Stream copies/conversions touching at least this many bytes are split into chunks and run across the task graph. 0 disables parallel copies"));
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshStreamParallelCopyChunkSize(
+	TEXT("RealtimeMesh.Streams.ParallelCopyChunkSize"),
+	256 * 1024,
+	TEXT("Approximate number of bytes copied/converted by each task when a stream copy is run in parallel"));
+
 
 namespace RealtimeMesh::NatVis
 {
@@ -304,3 +317,112 @@ void RealtimeMesh::FRealtimeMeshStreamLinkage::RemoveStream(const FRealtimeMeshS
 {
 	RemoveStream(&Stream);
 }
+
+
+// Runs Func(ChunkStart, ChunkCount) over row aligned chunks of [0, Count), spreading them across the task graph
+// when the copy is large enough to be worth it. Every stream copy walks rows linearly so chunks are independent.
+template <typename FuncType>
+static void ForEachStreamCopyChunk(uint32 Count, uint32 RowSize, FuncType&& Func)
+{
+	RowSize = FMath::Max(RowSize, 1u);
+	const int64 ParallelThreshold = CVarRealtimeMeshStreamParallelCopyThreshold.GetValueOnAnyThread();
+	if (ParallelThreshold <= 0 || static_cast<int64>(Count) * RowSize < ParallelThreshold)
+	{
+		Func(0, Count);
+		return;
+	}
+
+	const uint32 RowsPerChunk = FMath::Max<uint32>(1, static_cast<uint32>(FMath::Max(CVarRealtimeMeshStreamParallelCopyChunkSize.GetValueOnAnyThread(), 1)) / RowSize);
+	const int32 NumChunks = FMath::DivideAndRoundUp(Count, RowsPerChunk);
+
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const uint32 ChunkStart = static_cast<uint32>(ChunkIndex) * RowsPerChunk;
+		Func(ChunkStart, FMath::Min(RowsPerChunk, Count - ChunkStart));
+	});
+}
+
+void RealtimeMesh::FRealtimeMeshStream::CopyStreamDataIntoStream(const FRealtimeMeshBufferLayout& DestinationLayout, uint8* DestinationData, uint32 ElementOffset,
+	const FRealtimeMeshBufferLayout& SourceLayout, const uint8* const SourceData, uint32 SourceCount)
+{
+	const uint32 SourceStride = FRealtimeMeshBufferLayoutUtilities::GetElementStride(SourceLayout.GetElementType()) * SourceLayout.GetNumElements();
+	const uint32 DestinationStride = FRealtimeMeshBufferLayoutUtilities::GetElementStride(DestinationLayout.GetElementType()) * DestinationLayout.GetNumElements();
+
+	ForEachStreamCopyChunk(SourceCount, FMath::Max(SourceStride, DestinationStride), [&](uint32 ChunkStart, uint32 ChunkCount)
+	{
+		CopyStreamDataIntoStreamSerial(DestinationLayout, DestinationData + static_cast<SIZE_T>(ChunkStart) * DestinationStride, ElementOffset,
+			SourceLayout, SourceData + static_cast<SIZE_T>(ChunkStart) * SourceStride, ChunkCount);
+	});
+}
+
+void RealtimeMesh::FRealtimeMeshStream::GetElementRange(uint32 SourceIndex, uint32 ElementIndex, const FRealtimeMeshBufferLayout& DestinationLayout, uint8* DestinationData, uint32 Count) const
+{
+	if (Count == 0)
+	{
+		return;
+	}
+	
+	RangeCheck(SourceIndex + Count - 1);
+	
+	const FRealtimeMeshElementType FromType = Layout.GetElementType();
+	const FRealtimeMeshElementType ToType = DestinationLayout.GetElementType();
+	const uint32 NumElementsToCopy = DestinationLayout.GetNumElements();
+	check((ElementIndex + NumElementsToCopy) <= static_cast<uint32>(GetNumElements()));
+	check(FromType == ToType || FRealtimeMeshTypeConversionUtilities::CanConvert(FromType, ToType));
+
+	const uint32 SourceStride = GetStride();
+	const uint32 DestinationStride = FRealtimeMeshBufferLayoutUtilities::GetElementStride(ToType) * NumElementsToCopy;
+	const uint8* SourceData = GetDataRawAtVertex(SourceIndex, ElementIndex);
+	const FRealtimeMeshElementConverters* Converter = FromType != ToType ? &FRealtimeMeshTypeConversionUtilities::GetTypeConverter(FromType, ToType) : nullptr;
+
+	ForEachStreamCopyChunk(Count, FMath::Max(SourceStride, DestinationStride), [&](uint32 ChunkStart, uint32 ChunkCount)
+	{
+		const uint8* ChunkSource = SourceData + static_cast<SIZE_T>(ChunkStart) * SourceStride;
+		uint8* ChunkDestination = DestinationData + static_cast<SIZE_T>(ChunkStart) * DestinationStride;
+
+		if (!Converter && SourceStride == DestinationStride)
+		{
+			// Reading whole rows of the same type, so it's just a straight copy
+			FMemory::Memcpy(ChunkDestination, ChunkSource, static_cast<SIZE_T>(ChunkCount) * DestinationStride);
+		}
+		else if (!Converter)
+		{
+			for (uint32 Index = 0; Index < ChunkCount; Index++)
+			{
+				FMemory::Memcpy(ChunkDestination + DestinationStride * Index, ChunkSource + SourceStride * Index, DestinationStride);
+			}
+		}
+		else if (NumElementsToCopy > 1)
+		{
+			for (uint32 Index = 0; Index < ChunkCount; Index++)
+			{
+				Converter->ConvertContiguousArray(ChunkSource + SourceStride * Index, ChunkDestination + DestinationStride * Index, NumElementsToCopy);
+			}
+		}
+		else
+		{
+			for (uint32 Index = 0; Index < ChunkCount; Index++)
+			{
+				Converter->ConvertSingleElement(ChunkSource + SourceStride * Index, ChunkDestination + DestinationStride * Index);
+			}
+		}
+	});
+}
+
+TFuture<void> RealtimeMesh::FRealtimeMeshStream::SetRangeAsync(uint32 DestinationIndex, const FRealtimeMeshBufferLayout& SourceLayout, const uint8* const SourceData, uint32 SourceCount)
+{
+	if (SourceCount == 0)
+	{
+		return MakeFulfilledPromise<void>().GetFuture();
+	}
+
+	// Validate and resolve the destination up front, so the task only touches raw memory
+	RangeCheck(DestinationIndex + SourceCount - 1);
+	check(SourceLayout.GetElementType() == Layout.GetElementType() || FRealtimeMeshTypeConversionUtilities::CanConvert(SourceLayout.GetElementType(), Layout.GetElementType()));
+	uint8* DestinationData = GetDataRawAtVertex(DestinationIndex);
+
+	return Async(EAsyncExecution::TaskGraph, [DestinationLayout = Layout, DestinationData, SourceLayout, SourceData, SourceCount]()
+	{
+		CopyStreamDataIntoStream(DestinationLayout, DestinationData, 0, SourceLayout, SourceData, SourceCount);
+	});
+}
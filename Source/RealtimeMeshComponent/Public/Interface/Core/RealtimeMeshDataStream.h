@@ -7,6 +7,7 @@
 #include "RealtimeMeshDataConversion.h"
 #include "Containers/StridedView.h"
 #include "Templates/MakeUnsigned.h"
+#include "Async/Future.h"
 
 
 struct FRealtimeMeshStreamKey;
@@ -426,18 +427,15 @@ namespace RealtimeMesh
 			
 			if (FRealtimeMeshTypeConversionUtilities::CanConvert(FromType, ToType) && bSameNumElements)
 			{
-				const auto& Converter = FRealtimeMeshTypeConversionUtilities::GetTypeConverter(FromType, ToType);
-
 				// Move existing data to temp allocator
 				ElementAllocatorType OldData;				
 				OldData.MoveToEmpty(Allocator);
 
 				// Resize allocator to correct size for new data type
-				Allocator.ResizeAllocation(0, ArrayMax, GetStride());
+				Allocator.ResizeAllocation(0, ArrayMax, FRealtimeMeshBufferLayoutUtilities::GetElementStride(ToType) * NewLayout.GetNumElements());
 
 				// Now convert data from the temp array into the new allocation
-				const SIZE_T ElementCount = ArrayNum * GetNumElements();
-				Converter.ConvertContiguousArray(OldData.GetAllocation(), Allocator.GetAllocation(), ElementCount);
+				CopyStreamDataIntoStream(NewLayout, reinterpret_cast<uint8*>(Allocator.GetAllocation()), 0, Layout, reinterpret_cast<const uint8*>(OldData.GetAllocation()), ArrayNum);
 				Layout = NewLayout;
 				CacheStrides();
 				return true;
@@ -929,7 +927,53 @@ namespace RealtimeMesh
 		{
 			CopyStreamDataIntoStream(Layout, GetDataRawAtVertex(DestinationIndex), 0, SourceLayout, SourceData, SourceCount);
 		}
-		
+
+		template <typename SourceType>
+		TFuture<void> SetRangeAsync(int32 StartIndex, TArrayView<const SourceType> NewElements)
+		{
+			return SetRangeAsync(StartIndex, GetRealtimeMeshBufferLayout<SourceType>(), reinterpret_cast<const uint8*>(NewElements.GetData()), NewElements.Num());
+		}
+
+		/**
+		 * @brief Async version of SetRange, the copy/conversion is run on the task graph so the caller can overlap other work.
+		 * The destination rows must already exist. Neither the stream nor the source data may be resized, moved or freed
+		 * until the returned future completes.
+		 */
+		TFuture<void> SetRangeAsync(uint32 DestinationIndex, const FRealtimeMeshBufferLayout& SourceLayout, const uint8* const SourceData, uint32 SourceCount);
+
+		template <typename ElementType>
+		void SetElementRange(int32 StartIndex, int32 ElementIndex, TArrayView<const ElementType> NewElements)
+		{
+			SetElementRange(StartIndex, ElementIndex, GetRealtimeMeshBufferLayout<ElementType>(), reinterpret_cast<const uint8*>(NewElements.GetData()), NewElements.Num());
+		}
+
+		/**
+		 * @brief Writes a contiguous run of source rows into the rows of this stream, starting at ElementIndex within each row.
+		 * This allows a single tex coord channel, or any other sub-element of an interleaved stream, to be filled in one pass.
+		 * Data is converted through the type conversion registry if the element types differ.
+		 */
+		void SetElementRange(uint32 DestinationIndex, uint32 ElementIndex, const FRealtimeMeshBufferLayout& SourceLayout, const uint8* const SourceData, uint32 SourceCount)
+		{
+			if (SourceCount == 0)
+			{
+				return;
+			}
+			RangeCheck(DestinationIndex + SourceCount - 1);
+			CopyStreamDataIntoStream(Layout, GetDataRawAtVertex(DestinationIndex, ElementIndex), ElementIndex, SourceLayout, SourceData, SourceCount);
+		}
+
+		template <typename ElementType>
+		void GetElementRange(int32 StartIndex, int32 ElementIndex, TArrayView<ElementType> OutElements) const
+		{
+			GetElementRange(StartIndex, ElementIndex, GetRealtimeMeshBufferLayout<ElementType>(), reinterpret_cast<uint8*>(OutElements.GetData()), OutElements.Num());
+		}
+
+		/**
+		 * @brief Reads Count rows, starting at ElementIndex within each row, out into tightly packed rows of DestinationLayout.
+		 * This is the inverse of SetElementRange, and converts through the type conversion registry if the element types differ.
+		 */
+		void GetElementRange(uint32 SourceIndex, uint32 ElementIndex, const FRealtimeMeshBufferLayout& DestinationLayout, uint8* DestinationData, uint32 Count) const;
+
 		template <typename VertexType, typename GeneratorFunc>
 		void SetGenerated(int32 StartIndex, int32 Count, GeneratorFunc Generator)
 		{
@@ -1134,7 +1178,14 @@ namespace RealtimeMesh
 		}
 
 
-		static void CopyStreamDataIntoStream(const FRealtimeMeshBufferLayout& DestinationLayout, uint8* DestinationData, uint32 ElementOffset, const FRealtimeMeshBufferLayout& SourceLayout, const uint8* const SourceData, uint32 SourceCount)
+		/*
+		 * Copies/converts SourceCount rows into the destination. Large copies are split into row aligned chunks
+		 * and spread across the task graph (see RealtimeMesh.Streams.ParallelCopyThreshold), otherwise this runs
+		 * CopyStreamDataIntoStreamSerial on the calling thread.
+		 */
+		static void CopyStreamDataIntoStream(const FRealtimeMeshBufferLayout& DestinationLayout, uint8* DestinationData, uint32 ElementOffset, const FRealtimeMeshBufferLayout& SourceLayout, const uint8* const SourceData, uint32 SourceCount);
+
+		static void CopyStreamDataIntoStreamSerial(const FRealtimeMeshBufferLayout& DestinationLayout, uint8* DestinationData, uint32 ElementOffset, const FRealtimeMeshBufferLayout& SourceLayout, const uint8* const SourceData, uint32 SourceCount)
 		{
 			if (SourceCount == 0)
 			{
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "RealtimeMeshInterfaceFwd.h"
+#include <atomic>
 
 struct FRealtimeMeshLODKey
 {
@@ -95,8 +96,11 @@ public:
 		return FRealtimeMeshSectionGroupKey(LODKey, FName("Group_", GroupID));
 	}
 	static FRealtimeMeshSectionGroupKey CreateUnique(const FRealtimeMeshLODKey& LODKey)
-	{		
-		return FRealtimeMeshSectionGroupKey(LODKey, FName("Group_" + FGuid::NewGuid().ToString()));
+	{
+		// Unique names share one per-session base entry and only vary the FName number, so they don't grow the name table
+		static const FName SessionBaseName(TEXT("Group_") + FGuid::NewGuid().ToString(EGuidFormats::Base36Encoded));
+		static std::atomic<int32> NextUniqueID { 1 };
+		return FRealtimeMeshSectionGroupKey(LODKey, FName(SessionBaseName, NextUniqueID.fetch_add(1, std::memory_order_relaxed)));
 	}
 
 	friend struct FRealtimeMeshSectionKey;
@@ -180,7 +184,9 @@ public:
 	
 	static FRealtimeMeshSectionKey CreateUnique(const FRealtimeMeshSectionGroupKey& SectionGroupKey)
 	{
-		return FRealtimeMeshSectionKey(SectionGroupKey.LOD(), SectionGroupKey.GroupName, FName("Section_" + FGuid::NewGuid().ToString()));		
+		static const FName SessionBaseName(TEXT("Section_") + FGuid::NewGuid().ToString(EGuidFormats::Base36Encoded));
+		static std::atomic<int32> NextUniqueID { 1 };
+		return FRealtimeMeshSectionKey(SectionGroupKey.LOD(), SectionGroupKey.GroupName, FName(SessionBaseName, NextUniqueID.fetch_add(1, std::memory_order_relaxed)));
 	}
 	
 	static FRealtimeMeshSectionKey CreateForPolyGroup(const FRealtimeMeshSectionGroupKey& SectionGroupKey, int32 PolyGroup)
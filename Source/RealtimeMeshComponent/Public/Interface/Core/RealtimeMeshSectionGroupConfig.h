@@ -14,17 +14,44 @@ enum class ERealtimeMeshSectionDrawType : uint8
 	Dynamic,
 };
 
+/* How the ray tracing acceleration structure for a section group is built.
+ * FastBuild keeps rebuilds and refits cheap for meshes that change often
+ * FastTrace spends more time building for faster rays, better for meshes that rarely change
+ */
+enum class ERealtimeMeshRayTracingBuildQuality : uint8
+{
+	FastBuild,
+	FastTrace,
+};
+
 struct FRealtimeMeshSectionGroupConfig
 {
 	ERealtimeMeshSectionDrawType DrawType;
+
+	/* Draw adjacent sections that share a material slot and visibility settings as a single mesh batch.
+	 * Cuts draw calls for meshes with many polygroup sections over few materials, at the cost of
+	 * per-section batch setup no longer applying to anything but the first section of each run.
+	 */
+	bool bMergeCompatibleSections;
+
+	ERealtimeMeshRayTracingBuildQuality RayTracingBuildQuality;
+
+	/* Refit the ray tracing geometry in place when only vertex positions change, for meshes that deform
+	 * without changing topology. A full rebuild still happens periodically to keep trace quality up.
+	 */
+	bool bAllowRayTracingRefit;
 	
-	FRealtimeMeshSectionGroupConfig(ERealtimeMeshSectionDrawType InDrawType = ERealtimeMeshSectionDrawType::Static)
+	FRealtimeMeshSectionGroupConfig(ERealtimeMeshSectionDrawType InDrawType = ERealtimeMeshSectionDrawType::Static, bool bInMergeCompatibleSections = false)
 		: DrawType(InDrawType)
+		, bMergeCompatibleSections(bInMergeCompatibleSections)
+		, RayTracingBuildQuality(ERealtimeMeshRayTracingBuildQuality::FastBuild)
+		, bAllowRayTracingRefit(false)
 	{ }
 
 	bool operator==(const FRealtimeMeshSectionGroupConfig& Other) const
 	{
-		return DrawType == Other.DrawType;
+		return DrawType == Other.DrawType && bMergeCompatibleSections == Other.bMergeCompatibleSections &&
+			RayTracingBuildQuality == Other.RayTracingBuildQuality && bAllowRayTracingRefit == Other.bAllowRayTracingRefit;
 	}
 
 	bool operator!=(const FRealtimeMeshSectionGroupConfig& Other) const
@@ -0,0 +1,250 @@
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#pragma once
+
+#include "RealtimeMeshInterfaceFwd.h"
+#include "Misc/Optional.h"
+
+namespace RealtimeMesh
+{
+	/**
+	 * Compact generational handle into a TRealtimeMeshSlotArray.
+	 * The generation is bumped every time a slot is freed, so a handle kept past the removal of its
+	 * element will never resolve to whatever later reuses the slot. Generation 0 is never handed out.
+	 */
+	struct FRealtimeMeshHandle
+	{
+		uint32 Index;
+		uint32 Generation;
+
+		FRealtimeMeshHandle() : Index(0), Generation(0) { }
+		FRealtimeMeshHandle(uint32 InIndex, uint32 InGeneration) : Index(InIndex), Generation(InGeneration) { }
+
+		bool IsSet() const { return Generation != 0; }
+
+		FORCEINLINE bool operator==(const FRealtimeMeshHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+		FORCEINLINE bool operator!=(const FRealtimeMeshHandle& Other) const { return !(*this == Other); }
+
+		friend uint32 GetTypeHash(const FRealtimeMeshHandle& Handle)
+		{
+			return HashCombine(::GetTypeHash(Handle.Index), ::GetTypeHash(Handle.Generation));
+		}
+
+		FString ToString() const
+		{
+			return FString::Printf(TEXT("Handle:%u.%u"), Index, Generation);
+		}
+	};
+
+	/**
+	 * Dense array of slots addressed by FRealtimeMeshHandle.
+	 * Removal leaves a hole that is recycled by the next add, so the slot index of every other element is
+	 * stable for its whole lifetime. That lets callers key bitmasks and other side tables by slot index
+	 * without having to rebuild them whenever an element goes away.
+	 */
+	template<typename ElementType>
+	class TRealtimeMeshSlotArray
+	{
+	private:
+		struct FSlot
+		{
+			TOptional<ElementType> Value;
+			uint32 Generation = 1;
+		};
+
+		TArray<FSlot> Slots;
+		TArray<uint32> FreeSlots;
+		int32 NumElements = 0;
+
+	public:
+		template<bool bConst>
+		class TBaseIterator
+		{
+			using ArrayType = std::conditional_t<bConst, const TRealtimeMeshSlotArray, TRealtimeMeshSlotArray>;
+			using ReferenceType = std::conditional_t<bConst, const ElementType&, ElementType&>;
+
+			ArrayType& Array;
+			int32 SlotIndex;
+
+			void SkipFreeSlots()
+			{
+				while (Array.Slots.IsValidIndex(SlotIndex) && !Array.Slots[SlotIndex].Value.IsSet())
+				{
+					SlotIndex++;
+				}
+			}
+
+		public:
+			TBaseIterator(ArrayType& InArray, int32 InSlotIndex)
+				: Array(InArray), SlotIndex(InSlotIndex)
+			{
+				SkipFreeSlots();
+			}
+
+			FORCEINLINE TBaseIterator& operator++()
+			{
+				SlotIndex++;
+				SkipFreeSlots();
+				return *this;
+			}
+
+			FORCEINLINE explicit operator bool() const { return Array.Slots.IsValidIndex(SlotIndex); }
+			FORCEINLINE bool operator!=(const TBaseIterator& Other) const { return SlotIndex != Other.SlotIndex; }
+			FORCEINLINE bool operator==(const TBaseIterator& Other) const { return SlotIndex == Other.SlotIndex; }
+
+			FORCEINLINE ReferenceType operator*() const { return Array.Slots[SlotIndex].Value.GetValue(); }
+			FORCEINLINE auto* operator->() const { return &Array.Slots[SlotIndex].Value.GetValue(); }
+
+			/** Slot index of the current element, stable for the lifetime of the element. */
+			FORCEINLINE int32 GetIndex() const { return SlotIndex; }
+			FRealtimeMeshHandle GetHandle() const { return FRealtimeMeshHandle(SlotIndex, Array.Slots[SlotIndex].Generation); }
+		};
+
+		using TIterator = TBaseIterator<false>;
+		using TConstIterator = TBaseIterator<true>;
+
+		FRealtimeMeshHandle Add(ElementType&& Element)
+		{
+			int32 SlotIndex;
+			if (FreeSlots.Num() > 0)
+			{
+#if RMC_ENGINE_ABOVE_5_5
+				SlotIndex = FreeSlots.Pop(EAllowShrinking::No);
+#else
+				SlotIndex = FreeSlots.Pop(false);
+#endif
+			}
+			else
+			{
+				SlotIndex = Slots.AddDefaulted();
+			}
+
+			FSlot& Slot = Slots[SlotIndex];
+			check(!Slot.Value.IsSet());
+			Slot.Value.Emplace(MoveTemp(Element));
+			NumElements++;
+			return FRealtimeMeshHandle(SlotIndex, Slot.Generation);
+		}
+
+		FRealtimeMeshHandle Add(const ElementType& Element)
+		{
+			return Add(ElementType(Element));
+		}
+
+		/**
+		 * Places an element at the slot of a handle handed out by another slot array, so two arrays mirroring
+		 * each other can be addressed by the same handles. Whatever the slot held before is replaced.
+		 */
+		ElementType& EmplaceAt(const FRealtimeMeshHandle& Handle, ElementType&& Element)
+		{
+			check(Handle.IsSet());
+
+			while (Slots.Num() <= static_cast<int32>(Handle.Index))
+			{
+				FreeSlots.Add(Slots.AddDefaulted());
+			}
+
+			FSlot& Slot = Slots[Handle.Index];
+			if (Slot.Value.IsSet())
+			{
+				NumElements--;
+			}
+			else
+			{
+				FreeSlots.RemoveSingleSwap(Handle.Index);
+			}
+
+			Slot.Generation = Handle.Generation;
+			Slot.Value.Emplace(MoveTemp(Element));
+			NumElements++;
+			return Slot.Value.GetValue();
+		}
+
+		bool Remove(const FRealtimeMeshHandle& Handle)
+		{
+			if (!IsValidHandle(Handle))
+			{
+				return false;
+			}
+
+			FSlot& Slot = Slots[Handle.Index];
+			Slot.Value.Reset();
+			// Skip generation 0 on wrap so a default constructed handle can never match a slot
+			Slot.Generation = FMath::Max<uint32>(Slot.Generation + 1, 1);
+			FreeSlots.Add(Handle.Index);
+			NumElements--;
+			return true;
+		}
+
+		bool IsValidHandle(const FRealtimeMeshHandle& Handle) const
+		{
+			return Handle.IsSet() && Slots.IsValidIndex(Handle.Index) && Slots[Handle.Index].Generation == Handle.Generation && Slots[Handle.Index].Value.IsSet();
+		}
+
+		/** Whether the slot at this index currently holds an element */
+		bool IsAllocated(int32 SlotIndex) const
+		{
+			return Slots.IsValidIndex(SlotIndex) && Slots[SlotIndex].Value.IsSet();
+		}
+
+		ElementType* Find(const FRealtimeMeshHandle& Handle)
+		{
+			return IsValidHandle(Handle) ? &Slots[Handle.Index].Value.GetValue() : nullptr;
+		}
+
+		const ElementType* Find(const FRealtimeMeshHandle& Handle) const
+		{
+			return IsValidHandle(Handle) ? &Slots[Handle.Index].Value.GetValue() : nullptr;
+		}
+
+		FRealtimeMeshHandle GetHandle(int32 SlotIndex) const
+		{
+			return IsAllocated(SlotIndex) ? FRealtimeMeshHandle(SlotIndex, Slots[SlotIndex].Generation) : FRealtimeMeshHandle();
+		}
+
+		ElementType& operator[](int32 SlotIndex)
+		{
+			check(IsAllocated(SlotIndex));
+			return Slots[SlotIndex].Value.GetValue();
+		}
+
+		const ElementType& operator[](int32 SlotIndex) const
+		{
+			check(IsAllocated(SlotIndex));
+			return Slots[SlotIndex].Value.GetValue();
+		}
+
+		/** Number of live elements */
+		int32 Num() const { return NumElements; }
+
+		/** One past the highest slot index ever allocated, the size needed for side tables keyed by slot index */
+		int32 GetMaxIndex() const { return Slots.Num(); }
+
+		bool IsEmpty() const { return NumElements == 0; }
+
+		/** Removes all elements. Existing handles are invalidated, as slot generations are kept. */
+		void Empty()
+		{
+			FreeSlots.Reset();
+			for (int32 SlotIndex = Slots.Num() - 1; SlotIndex >= 0; SlotIndex--)
+			{
+				FSlot& Slot = Slots[SlotIndex];
+				if (Slot.Value.IsSet())
+				{
+					Slot.Value.Reset();
+					Slot.Generation = FMath::Max<uint32>(Slot.Generation + 1, 1);
+				}
+				FreeSlots.Add(SlotIndex);
+			}
+			NumElements = 0;
+		}
+
+		TIterator CreateIterator() { return TIterator(*this, 0); }
+		TConstIterator CreateConstIterator() const { return TConstIterator(*this, 0); }
+
+		TIterator begin() { return TIterator(*this, 0); }
+		TIterator end() { return TIterator(*this, Slots.Num()); }
+		TConstIterator begin() const { return TConstIterator(*this, 0); }
+		TConstIterator end() const { return TConstIterator(*this, Slots.Num()); }
+	};
+}
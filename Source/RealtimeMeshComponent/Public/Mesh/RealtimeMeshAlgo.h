@@ -6,6 +6,7 @@
 #include "Core/RealtimeMeshDataStream.h"
 #include "Core/RealtimeMeshDataTypes.h"
 #include "Algo/StableSort.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 struct FRealtimeMeshPolygonGroupRange;
 struct FRealtimeMeshStreamKey;
@@ -310,6 +311,8 @@ namespace RealtimeMeshAlgo
 	void GenerateTangents(TConstArrayView<const TriangleType> Triangles, TConstArrayView<const FVector3f> Vertices,
 	                      const TFunction<FVector2f(int32)>& UVGetter, const TFunctionRef<void(int32, FVector3f, FVector3f)>& TangentsSetter, bool bComputeSmoothNormals = true)
 	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(RealtimeMeshAlgo::GenerateTangents_Arrays);
+		
 		uint32 NumIndices = Triangles.Num();
 		uint32 NumVertices = Vertices.Num();
 
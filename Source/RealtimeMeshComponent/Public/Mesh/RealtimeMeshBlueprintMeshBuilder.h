@@ -200,6 +200,48 @@ public:
 	FVector GetVector3(URealtimeMeshStream*& Builder, FRealtimeMeshStreamRowPtr& Row, int32 Index);
 	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
 	FVector4 GetVector4(URealtimeMeshStream*& Builder, FRealtimeMeshStreamRowPtr& Row, int32 Index);
+
+
+	/*
+	 * Bulk accessors. These write/read a whole array against one element of consecutive rows,
+	 * converting to/from the stream's type in a single pass instead of once per call.
+	 * Set* grows the stream as needed so StartIndex may be anywhere in [0, Num], and returns
+	 * the index of the first row written or INDEX_NONE if the data couldn't be written.
+	 */
+
+	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
+	int32 AppendIntArray(URealtimeMeshStream*& Builder, const TArray<int32>& Values, int32 ElementIdx = 0);
+	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
+	int32 AppendFloatArray(URealtimeMeshStream*& Builder, const TArray<float>& Values, int32 ElementIdx = 0);
+	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
+	int32 AppendVector2Array(URealtimeMeshStream*& Builder, const TArray<FVector2D>& Values, int32 ElementIdx = 0);
+	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
+	int32 AppendVector3Array(URealtimeMeshStream*& Builder, const TArray<FVector>& Values, int32 ElementIdx = 0);
+	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
+	int32 AppendVector4Array(URealtimeMeshStream*& Builder, const TArray<FVector4>& Values, int32 ElementIdx = 0);
+
+	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
+	int32 SetIntArray(URealtimeMeshStream*& Builder, int32 StartIndex, const TArray<int32>& Values, int32 ElementIdx = 0);
+	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
+	int32 SetFloatArray(URealtimeMeshStream*& Builder, int32 StartIndex, const TArray<float>& Values, int32 ElementIdx = 0);
+	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
+	int32 SetVector2Array(URealtimeMeshStream*& Builder, int32 StartIndex, const TArray<FVector2D>& Values, int32 ElementIdx = 0);
+	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
+	int32 SetVector3Array(URealtimeMeshStream*& Builder, int32 StartIndex, const TArray<FVector>& Values, int32 ElementIdx = 0);
+	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
+	int32 SetVector4Array(URealtimeMeshStream*& Builder, int32 StartIndex, const TArray<FVector4>& Values, int32 ElementIdx = 0);
+
+	/* Reads Count rows starting at StartIndex. A negative Count reads to the end of the stream. */
+	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
+	TArray<int32> GetIntArray(URealtimeMeshStream*& Builder, int32 StartIndex = 0, int32 Count = -1, int32 ElementIdx = 0);
+	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
+	TArray<float> GetFloatArray(URealtimeMeshStream*& Builder, int32 StartIndex = 0, int32 Count = -1, int32 ElementIdx = 0);
+	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
+	TArray<FVector2D> GetVector2Array(URealtimeMeshStream*& Builder, int32 StartIndex = 0, int32 Count = -1, int32 ElementIdx = 0);
+	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
+	TArray<FVector> GetVector3Array(URealtimeMeshStream*& Builder, int32 StartIndex = 0, int32 Count = -1, int32 ElementIdx = 0);
+	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
+	TArray<FVector4> GetVector4Array(URealtimeMeshStream*& Builder, int32 StartIndex = 0, int32 Count = -1, int32 ElementIdx = 0);
 };
 
 // ReSharper disable UnrealHeaderToolError
@@ -343,6 +385,36 @@ public:
 	void GetVertex(URealtimeMeshLocalBuilder*& Builder, int32 Index, FVector& Position, FVector& Normal,
 		FVector& Tangent, FLinearColor& Color, FVector2D& UV0, FVector2D& UV1, FVector2D& UV2, FVector2D& UV3);
 
+
+	/*
+	 * Bulk vertex/triangle setters. Each call converts the whole array in one pass and grows the
+	 * mesh as needed, so StartIndex may be anywhere in [0, Num]. Other enabled streams are filled
+	 * with their default values when the mesh grows. Returns the first index written or INDEX_NONE.
+	 */
+
+	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
+	int32 AppendPositions(URealtimeMeshLocalBuilder*& Builder, const TArray<FVector>& Positions);
+
+	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
+	int32 SetPositions(URealtimeMeshLocalBuilder*& Builder, int32 StartIndex, const TArray<FVector>& Positions);
+
+	/* Sets normals and tangents for a run of vertices. Tangents may be empty in which case only the normals are written. */
+	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
+	int32 SetNormalsAndTangents(URealtimeMeshLocalBuilder*& Builder, int32 StartIndex, const TArray<FVector>& Normals, const TArray<FVector>& Tangents);
+
+	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
+	int32 SetColors(URealtimeMeshLocalBuilder*& Builder, int32 StartIndex, const TArray<FLinearColor>& Colors);
+
+	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
+	int32 SetTexCoords(URealtimeMeshLocalBuilder*& Builder, int32 StartIndex, const TArray<FVector2D>& TexCoords, int32 Channel = 0);
+
+	/* Appends triangles from a flat index list, 3 indices per triangle. PolyGroups is either empty or one entry per triangle. */
+	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
+	int32 AppendTriangles(URealtimeMeshLocalBuilder*& Builder, const TArray<int32>& Triangles, const TArray<int32>& PolyGroups);
+
+	UFUNCTION(BlueprintCallable, Category="RealtimeMesh|MeshData")
+	int32 SetTriangles(URealtimeMeshLocalBuilder*& Builder, int32 StartIndex, const TArray<int32>& Triangles, const TArray<int32>& PolyGroups);
+
 	friend class URealtimeMeshStreamSet;
 };
 
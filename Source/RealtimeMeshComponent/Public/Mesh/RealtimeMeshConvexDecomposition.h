@@ -0,0 +1,70 @@
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RealtimeMeshCore.h"
+#include "Core/RealtimeMeshCollision.h"
+#include "RealtimeMeshConvexDecomposition.generated.h"
+
+/**
+ * Controls for approximating a mesh with a set of convex hulls for simple collision.
+ */
+USTRUCT(BlueprintType)
+struct REALTIMEMESHCOMPONENT_API FRealtimeMeshConvexDecompositionSettings
+{
+	GENERATED_BODY()
+
+	/** Most hulls the mesh is split into */
+	UPROPERTY(Category="RealtimeMesh|Collision", EditAnywhere, BlueprintReadWrite, meta=(ClampMin=1, ClampMax=256))
+	int32 MaxHulls = 8;
+
+	/** Most vertices kept on each hull */
+	UPROPERTY(Category="RealtimeMesh|Collision", EditAnywhere, BlueprintReadWrite, meta=(ClampMin=4, ClampMax=255))
+	int32 MaxVerticesPerHull = 32;
+
+	/** Roughly how many voxels the mesh bounds are split into. Higher follows the surface more closely but takes longer */
+	UPROPERTY(Category="RealtimeMesh|Collision", EditAnywhere, BlueprintReadWrite, meta=(ClampMin=1000, ClampMax=10000000))
+	int32 VoxelResolution = 100000;
+
+	/**
+	 * Hulls stop being split once the space they cover beyond the mesh is below this fraction of the volume of the
+	 * whole mesh's hull, even if MaxHulls hasn't been reached.
+	 */
+	UPROPERTY(Category="RealtimeMesh|Collision", EditAnywhere, BlueprintReadWrite, meta=(ClampMin=0, ClampMax=1))
+	float MaxConcavity = 0.02f;
+};
+
+namespace RealtimeMesh
+{
+	/*
+	 * Approximate convex decomposition of a triangle mesh.
+	 *
+	 * The mesh is voxelized, with the interior of closed meshes filled in, and the voxels are then split along axis
+	 * aligned planes, always splitting the part whose hull covers the most space outside the mesh and choosing the plane
+	 * that reduces that the most. Candidate planes are evaluated in parallel. The hulls are built from the voxel corners,
+	 * so they enclose the mesh up to the vertex limit, at the cost of standing off the surface by up to one voxel.
+	 */
+	struct REALTIMEMESHCOMPONENT_API FRealtimeMeshConvexDecomposition
+	{
+		/*
+		 * Base name given to generated hulls. Each hull gets its own number. The name is only there for lookups, generated
+		 * hulls are recognized by their generated flag so a user hull with the same name is left alone.
+		 */
+		static FName GetHullBaseName();
+
+		/*
+		 * Computes hulls for the triangles, in the same space as Positions. Triangles that reference a vertex outside of
+		 * Positions are skipped. Returns an empty array if there's nothing to decompose.
+		 */
+		static TArray<FRealtimeMeshCollisionConvex> Compute(TConstArrayView<FVector3f> Positions, TConstArrayView<TIndex3<int32>> Triangles,
+			const FRealtimeMeshConvexDecompositionSettings& Settings);
+
+		/* Whether the hull was generated by a decomposition */
+		static bool IsGeneratedHull(const FRealtimeMeshCollisionConvex& Hull);
+
+		/* Replaces any previously generated hulls in the simple geometry with these, leaving everything else alone. The new
+		 * hulls are flagged as generated. */
+		static void ReplaceGeneratedHulls(FRealtimeMeshSimpleGeometry& SimpleGeometry, TArray<FRealtimeMeshCollisionConvex>&& Hulls);
+	};
+}
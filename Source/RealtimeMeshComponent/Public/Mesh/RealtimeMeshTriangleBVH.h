@@ -0,0 +1,113 @@
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RealtimeMeshCore.h"
+
+namespace RealtimeMesh
+{
+	struct FRealtimeMeshTriangleHit
+	{
+		// Index of the triangle in the source triangle array, INDEX_NONE if nothing was hit
+		int32 TriangleIndex = INDEX_NONE;
+
+		// Distance along the ray, or from the query point for closest point queries
+		float Distance = TNumericLimits<float>::Max();
+
+		FVector3f Location = FVector3f::ZeroVector;
+
+		// Face normal of the hit triangle. For sphere sweeps this is the impact normal instead, pointing from Location to the sphere's center.
+		FVector3f Normal = FVector3f::ZeroVector;
+
+		// Weights of the triangle's three corners at Location
+		FVector3f Barycentrics = FVector3f::ZeroVector;
+
+		// Vertex indices of the hit triangle
+		TIndex3<int32> Vertices;
+
+		bool IsValid() const { return TriangleIndex != INDEX_NONE; }
+	};
+
+	/*
+	 * Bounding volume hierarchy over a triangle soup, flattened into a single node array in depth first order.
+	 * The first child of an interior node always directly follows it, so traversal only ever touches a small stack of
+	 * indices and the nodes it visits are close together in memory. Triangles are stored in leaf order alongside their
+	 * source index, so a leaf's triangles are one contiguous run.
+	 *
+	 * Since every child comes after its parent, the bounds can be refit to moved vertices with one reverse pass over
+	 * the nodes, which is much cheaper than a rebuild as long as the triangles stay the same.
+	 *
+	 * The hierarchy is immutable once built and safe to query from any number of threads.
+	 */
+	class REALTIMEMESHCOMPONENT_API FRealtimeMeshTriangleBVH
+	{
+	public:
+		struct FNode
+		{
+			FVector3f BoundsMin;
+			// Leaf: first entry in the leaf ordered triangle arrays. Interior: index of the second child.
+			int32 FirstOrChild;
+			FVector3f BoundsMax;
+			// Number of triangles in a leaf, 0 for interior nodes
+			int32 NumTriangles;
+
+			bool IsLeaf() const { return NumTriangles > 0; }
+		};
+		static_assert(sizeof(FNode) == 32, "BVH nodes are expected to be 32 bytes so two fit a cache line");
+
+		static constexpr int32 MaxLeafTriangles = 4;
+
+	private:
+		TArray<FNode> Nodes;
+		TArray<FVector3f> Positions;
+		// Triangles in leaf order, and the index each had in the source array
+		TArray<TIndex3<int32>> Triangles;
+		TArray<int32> TriangleIndices;
+
+	public:
+		/*
+		 * Builds the hierarchy with a binned surface area heuristic. Triangles that reference a vertex outside of
+		 * InPositions are skipped. Any previous contents are discarded.
+		 */
+		void Build(TArray<FVector3f>&& InPositions, TConstArrayView<TIndex3<int32>> InTriangles);
+		void Reset();
+
+		bool IsEmpty() const { return Nodes.Num() == 0; }
+		int32 NumNodes() const { return Nodes.Num(); }
+		int32 NumTriangles() const { return Triangles.Num(); }
+		FBox3f GetBounds() const;
+
+		TConstArrayView<FNode> GetNodes() const { return Nodes; }
+		TConstArrayView<FVector3f> GetPositions() const { return Positions; }
+
+		/*
+		 * Finds the nearest triangle along the ray within MaxDistance. Direction must be normalized.
+		 * Triangles are treated as double sided.
+		 */
+		bool Raycast(const FVector3f& Origin, const FVector3f& Direction, float MaxDistance, FRealtimeMeshTriangleHit& OutHit) const;
+
+		/* Finds the closest point on any triangle that lies within MaxDistance of Point */
+		bool FindClosestPoint(const FVector3f& Point, float MaxDistance, FRealtimeMeshTriangleHit& OutHit) const;
+
+		/*
+		 * Finds the first triangle a sphere touches when moved along the ray, within MaxDistance. Direction must be normalized.
+		 * A sphere that already overlaps a triangle at the start hits it at distance 0.
+		 */
+		bool SweepSphere(const FVector3f& Origin, const FVector3f& Direction, float Radius, float MaxDistance, FRealtimeMeshTriangleHit& OutHit) const;
+
+		/*
+		 * Moves the vertices and refits the node bounds around them, keeping the tree structure.
+		 * NewPositions must have as many vertices as the hierarchy was built with, returns false and does nothing otherwise.
+		 */
+		bool Refit(TArray<FVector3f>&& NewPositions);
+
+		SIZE_T GetAllocatedSize() const
+		{
+			return Nodes.GetAllocatedSize() + Positions.GetAllocatedSize() + Triangles.GetAllocatedSize() + TriangleIndices.GetAllocatedSize();
+		}
+
+	private:
+		int32 BuildRecursive(TArray<FBox3f>& TriangleBounds, TArray<FVector3f>& Centroids, int32 First, int32 Count);
+	};
+}
@@ -265,6 +265,7 @@ public:
 protected:
 	virtual void HandleBoundsUpdated();
 	virtual void HandleRenderProxyRequiresUpdate();
+	virtual void HandleRenderProxyRequiresStaticMeshUpdate();
 
 protected: // Collision
 
@@ -6,6 +6,7 @@
 #include "Interface_CollisionDataProviderCore.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "Core/RealtimeMeshCollision.h"
+#include "Core/RealtimeMeshFuture.h"
 #include "RealtimeMeshCollisionLibrary.generated.h"
 
 
@@ -18,11 +19,51 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Collision")
 	static bool FindCollisionUVRealtimeMesh(const struct FHitResult& Hit, int32 UVChannel, FVector2D& UV);
 
+	/*
+	 * UV lookup for a whole batch of hits. Uses the cooked per face UVs where the physics settings keep them, and otherwise
+	 * falls back to a closest point lookup against the render data of LOD 0 of a URealtimeMeshSimple. That lookup doesn't wait
+	 * for the mesh's spatial index, so it finds nothing until the index has been built in the background.
+	 * Returns the number of hits a UV was found for.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Collision")
+	static int32 FindCollisionUVsRealtimeMesh(const TArray<FHitResult>& Hits, int32 UVChannel, TArray<FVector2D>& UVs, TArray<bool>& Found);
+
 	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Collision")
 	static void CookConvexHull(FRealtimeMeshCollisionConvex& ConvexHull);
 
 	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Collision")
 	static void CookComplexMesh(FRealtimeMeshCollisionMesh& CollisionMesh);
+	static void CookComplexMesh(FRealtimeMeshCollisionMesh& CollisionMesh, const FRealtimeMeshCollisionConfiguration& Configuration);
+
+	/*
+	 * Welds vertices that snap to the same cell of a WeldThreshold sized grid, then drops triangles that became degenerate
+	 * and triangles that use the same three vertices as an earlier one. OutVertexRemap and OutFaceRemap map every output
+	 * vertex and triangle back to its index in the input. Returns true if anything was removed.
+	 */
+	static bool CleanCollisionMesh(const TArray<FVector3f>& InVertices, const TArray<RealtimeMesh::TIndex3<int32>>& InTriangles, float WeldThreshold,
+		TArray<FVector3f>& OutVertices, TArray<RealtimeMesh::TIndex3<int32>>& OutTriangles, TArray<int32>& OutVertexRemap, TArray<int32>& OutFaceRemap);
+
+	/*
+	 * Fast path for deformable meshes. When a complex mesh only had its vertices move since PreviousCook was made, this
+	 * copies the cooked trimesh and moves its particles to the new positions instead of cooking from scratch, skipping
+	 * cleaning, triangle validation and the face sorting of a full cook. The vertex remap of the previous cook is reused,
+	 * so welds and dropped degenerate faces stay as they were at the last full cook.
+	 * The caller is responsible for the topology being unchanged, see GetComplexMeshTopologyHash.
+	 * Returns false, leaving the mesh uncooked, if the previous cook can't be mapped onto the current vertices.
+	 */
+	static bool RefitComplexMesh(FRealtimeMeshCollisionMesh& CollisionMesh, const FRealtimeMeshCookedTriMeshData& PreviousCook);
+
+	/* Hash of everything a cook of this mesh depends on other than the vertex positions */
+	static uint32 GetComplexMeshTopologyHash(const FRealtimeMeshCollisionMesh& CollisionMesh, const FRealtimeMeshCollisionConfiguration& Configuration);
+
+	/*
+	 * Cooks every convex hull and complex mesh in the collision info that needs it, spread across the task graph with
+	 * the most expensive elements started first. Each result is stored on its own element, so the output doesn't depend
+	 * on the order the work completes in. A MaxConcurrency of 0 or less uses every available worker.
+	 * Returns false if the token was cancelled before everything was cooked.
+	 */
+	static bool CookCollisionInfo(FRealtimeMeshCollisionInfo& CollisionInfo, int32 MaxConcurrency,
+		const RealtimeMesh::FRealtimeMeshCancellationToken& CancellationToken = RealtimeMesh::FRealtimeMeshCancellationToken());
 	
 	static void CopySimpleGeometryToBodySetup(const FRealtimeMeshSimpleGeometry& SimpleGeom, UBodySetup* BodySetup);
 	static void CopyComplexGeometryToBodySetup(const FRealtimeMeshComplexGeometry& ComplexGeom, UBodySetup* BodySetup, TArray<FRealtimeMeshCollisionMeshCookedUVData>& OutUVData);
@@ -40,6 +81,11 @@ class REALTIMEMESHCOMPONENT_API URealtimeMeshSimpleGeometryFunctionLibrary : pub
 	GENERATED_BODY()
 
 public:
+	/*
+	 * The array variants below edit many shapes in one call. They only touch the geometry struct, so to have collision
+	 * rebuild once for a whole batch, make all the edits on a copy and then hand it to SetSimpleGeometry.
+	 */
+	
 	// Sphere Functions
 	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Spheres")
 	static FRealtimeMeshSimpleGeometry& AddSphere(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, const FRealtimeMeshCollisionSphere& InSphere, int32& OutIndex);
@@ -53,6 +99,14 @@ public:
 	static FRealtimeMeshSimpleGeometry& RemoveSphere(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, int32 Index, bool& Success);
 	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Spheres")
 	static FRealtimeMeshSimpleGeometry& RemoveSphereByName(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, FName SphereName, bool& Success);
+	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Spheres")
+	static FRealtimeMeshSimpleGeometry& AddSpheres(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, const TArray<FRealtimeMeshCollisionSphere>& InSpheres, TArray<int32>& OutIndices);
+	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Spheres")
+	static FRealtimeMeshSimpleGeometry& UpdateSpheres(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, const TArray<int32>& Indices, const TArray<FRealtimeMeshCollisionSphere>& InSpheres, int32& NumUpdated);
+	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Spheres")
+	static FRealtimeMeshSimpleGeometry& RemoveSpheres(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, const TArray<int32>& Indices, int32& NumRemoved);
+	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Spheres")
+	static FRealtimeMeshSimpleGeometry& RemoveSpheresByName(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, const TArray<FName>& SphereNames, int32& NumRemoved);
 
 	// Box Functions
 	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Boxes")
@@ -67,6 +121,14 @@ public:
 	static FRealtimeMeshSimpleGeometry& RemoveBox(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, int32 Index, bool& Success);
 	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Boxes")
 	static FRealtimeMeshSimpleGeometry& RemoveBoxByName(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, FName BoxName, bool& Success);
+	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Boxes")
+	static FRealtimeMeshSimpleGeometry& AddBoxes(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, const TArray<FRealtimeMeshCollisionBox>& InBoxes, TArray<int32>& OutIndices);
+	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Boxes")
+	static FRealtimeMeshSimpleGeometry& UpdateBoxes(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, const TArray<int32>& Indices, const TArray<FRealtimeMeshCollisionBox>& InBoxes, int32& NumUpdated);
+	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Boxes")
+	static FRealtimeMeshSimpleGeometry& RemoveBoxes(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, const TArray<int32>& Indices, int32& NumRemoved);
+	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Boxes")
+	static FRealtimeMeshSimpleGeometry& RemoveBoxesByName(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, const TArray<FName>& BoxNames, int32& NumRemoved);
 
 	// Capsule Functions
 	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Capsules")
@@ -81,6 +143,14 @@ public:
 	static FRealtimeMeshSimpleGeometry& RemoveCapsule(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, int32 Index, bool& Success);
 	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Capsules")
 	static FRealtimeMeshSimpleGeometry& RemoveCapsuleByName(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, FName CapsuleName, bool& Success);
+	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Capsules")
+	static FRealtimeMeshSimpleGeometry& AddCapsules(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, const TArray<FRealtimeMeshCollisionCapsule>& InCapsules, TArray<int32>& OutIndices);
+	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Capsules")
+	static FRealtimeMeshSimpleGeometry& UpdateCapsules(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, const TArray<int32>& Indices, const TArray<FRealtimeMeshCollisionCapsule>& InCapsules, int32& NumUpdated);
+	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Capsules")
+	static FRealtimeMeshSimpleGeometry& RemoveCapsules(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, const TArray<int32>& Indices, int32& NumRemoved);
+	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Capsules")
+	static FRealtimeMeshSimpleGeometry& RemoveCapsulesByName(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, const TArray<FName>& CapsuleNames, int32& NumRemoved);
 
 	// Tapered Capsule Functions
 	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Tapered Capsules")
@@ -95,6 +165,14 @@ public:
 	static FRealtimeMeshSimpleGeometry& RemoveTaperedCapsule(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, int32 Index, bool& Success);
 	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Tapered Capsules")
 	static FRealtimeMeshSimpleGeometry& RemoveTaperedCapsuleByName(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, FName TaperedCapsuleName, bool& Success);
+	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Tapered Capsules")
+	static FRealtimeMeshSimpleGeometry& AddTaperedCapsules(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, const TArray<FRealtimeMeshCollisionTaperedCapsule>& InTaperedCapsules, TArray<int32>& OutIndices);
+	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Tapered Capsules")
+	static FRealtimeMeshSimpleGeometry& UpdateTaperedCapsules(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, const TArray<int32>& Indices, const TArray<FRealtimeMeshCollisionTaperedCapsule>& InTaperedCapsules, int32& NumUpdated);
+	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Tapered Capsules")
+	static FRealtimeMeshSimpleGeometry& RemoveTaperedCapsules(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, const TArray<int32>& Indices, int32& NumRemoved);
+	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Tapered Capsules")
+	static FRealtimeMeshSimpleGeometry& RemoveTaperedCapsulesByName(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, const TArray<FName>& TaperedCapsuleNames, int32& NumRemoved);
 
 	// Convex Hull Functions
 	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Convex Hulls")
@@ -109,6 +187,14 @@ public:
 	static FRealtimeMeshSimpleGeometry& RemoveConvex(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, int32 Index, bool& Success);
 	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Convex Hulls")
 	static FRealtimeMeshSimpleGeometry& RemoveConvexByName(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, FName ConvexHullName, bool& Success);
+	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Convex Hulls")
+	static FRealtimeMeshSimpleGeometry& AddConvexHulls(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, const TArray<FRealtimeMeshCollisionConvex>& InConvexHulls, TArray<int32>& OutIndices);
+	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Convex Hulls")
+	static FRealtimeMeshSimpleGeometry& UpdateConvexHulls(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, const TArray<int32>& Indices, const TArray<FRealtimeMeshCollisionConvex>& InConvexHulls, int32& NumUpdated);
+	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Convex Hulls")
+	static FRealtimeMeshSimpleGeometry& RemoveConvexHulls(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, const TArray<int32>& Indices, int32& NumRemoved);
+	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Convex Hulls")
+	static FRealtimeMeshSimpleGeometry& RemoveConvexHullsByName(UPARAM(ref) FRealtimeMeshSimpleGeometry& SimpleGeometry, const TArray<FName>& ConvexHullNames, int32& NumRemoved);
 
 };
 
@@ -29,6 +29,9 @@ private:
 	FDelegateHandle RenderDataChangedHandle;
 	FDelegateHandle CollisionBodyUpdatedHandle;
 
+	// Whether the current scene proxy came from the nanite module, those can't have their static draws refreshed in place
+	bool bSceneProxyUsesNanite = false;
+
 public:
 
 	URealtimeMeshComponent();
@@ -6,11 +6,57 @@
 #include "Runtime/Launch/Resources/Version.h"
 #include "StaticMeshResources.h"
 #include "Core/RealtimeMeshInterfaceFwd.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include <atomic>
 
 DECLARE_STATS_GROUP(TEXT("RealtimeMesh"), STATGROUP_RealtimeMesh, STATCAT_Advanced);
 
+DECLARE_MEMORY_STAT_EXTERN(TEXT("RealtimeMesh - CPU Stream Memory"), STAT_RealtimeMesh_CPUStreamMemory, STATGROUP_RealtimeMesh, REALTIMEMESHCOMPONENT_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("RealtimeMesh - GPU Buffer Memory"), STAT_RealtimeMesh_GPUBufferMemory, STATGROUP_RealtimeMesh, REALTIMEMESHCOMPONENT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("RealtimeMesh - GPU Buffers"), STAT_RealtimeMesh_NumGPUBuffers, STATGROUP_RealtimeMesh, REALTIMEMESHCOMPONENT_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("RealtimeMesh - GPU Bytes Uploaded"), STAT_RealtimeMesh_GPUBytesUploaded, STATGROUP_RealtimeMesh, REALTIMEMESHCOMPONENT_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("RealtimeMesh - Proxy Command Batches"), STAT_RealtimeMesh_ProxyCommandBatches, STATGROUP_RealtimeMesh, REALTIMEMESHCOMPONENT_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("RealtimeMesh - Proxy Commands"), STAT_RealtimeMesh_ProxyCommands, STATGROUP_RealtimeMesh, REALTIMEMESHCOMPONENT_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(REALTIMEMESHCOMPONENT_API, RealtimeMesh);
+
 namespace RealtimeMesh
 {
+	/*
+	 * Always-on mirror of the RealtimeMesh stat counters.
+	 * The engine stat system is compiled out of shipping/test builds and can't be read back synchronously,
+	 * so these are what automation tests and runtime tooling read. Values are cumulative since module start
+	 * except for the memory/buffer counts, which track what is currently alive.
+	 */
+	struct REALTIMEMESHCOMPONENT_API FRealtimeMeshStatCounters
+	{
+		std::atomic<int64> CPUStreamMemory { 0 };
+		std::atomic<int64> GPUBufferMemory { 0 };
+		std::atomic<int64> NumGPUBuffers { 0 };
+		std::atomic<int64> GPUBytesUploaded { 0 };
+		std::atomic<int64> ProxyCommandBatches { 0 };
+		std::atomic<int64> ProxyCommands { 0 };
+		std::atomic<int64> ProxyCommandsCoalesced { 0 };
+		std::atomic<int64> ComplexCollisionCooks { 0 };
+		std::atomic<int64> ComplexCollisionRefits { 0 };
+		std::atomic<int64> TangentGenerations { 0 };
+		std::atomic<int64> EndOfFrameUpdates { 0 };
+		std::atomic<int64> ProxyRecreateRequests { 0 };
+		std::atomic<int64> StaticMeshUpdateRequests { 0 };
+		std::atomic<int64> RayTracingGeometryBuilds { 0 };
+		std::atomic<int64> RayTracingGeometryRefits { 0 };
+		std::atomic<int64> CollisionCooksStarted { 0 };
+		std::atomic<int64> CollisionCooksCancelled { 0 };
+		std::atomic<int64> CollisionCooksCoalesced { 0 };
+		std::atomic<int64> ResidencyEvictions { 0 };
+		std::atomic<int64> ResidencyLoads { 0 };
+		std::atomic<int64> ResidencyCacheMemory { 0 };
+		std::atomic<int64> ReplicationBytesSent { 0 };
+		std::atomic<int64> ReplicationChunksSent { 0 };
+
+		static FRealtimeMeshStatCounters& Get();
+	};
+
 	// Custom version for runtime mesh serialization
 	namespace FRealtimeMeshVersion
 	{
@@ -30,6 +76,11 @@ namespace RealtimeMesh
 			CollisionOverhaul = 11,
 			DrawTypeMovedToSectionGroup = 12,
 			ActorSupportsOptionalConstructionDefer = 13,
+			SectionGroupSupportsSectionMerging = 14,
+			SectionGroupRayTracingSettings = 15,
+			CollisionMeshCleaning = 16,
+			StreamBulkDataStorage = 17,
+			ConvexHullGeneratedFlag = 18,
 
 			// -----<new versions can be added above this line>-------------------------------------------------
 			VersionPlusOne,
@@ -0,0 +1,68 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#pragma once
+
+#include "RealtimeMeshComponent.h"
+#include "RealtimeMeshInstancedComponent.generated.h"
+
+
+/**
+*	Component that draws one realtime mesh many times from a single scene proxy.
+*	Every instance shares the mesh's GPU buffers; instances are culled and assigned a LOD per view.
+*	Instances have no collision of their own, use a regular RealtimeMeshComponent for anything that needs it.
+*/
+UCLASS(ClassGroup=(Rendering, Common), HideCategories=(Object, Activation, "Components|Activation"), ShowCategories=(Mobility), Meta = (BlueprintSpawnableComponent))
+class REALTIMEMESHCOMPONENT_API URealtimeMeshInstancedComponent : public URealtimeMeshComponent
+{
+	GENERATED_BODY()
+
+private:
+	/** Transform of each instance, relative to the component */
+	UPROPERTY(EditAnywhere, Category = "RealtimeMesh|Instances", Meta = (AllowPrivateAccess = "true", MakeEditWidget = "true"))
+	TArray<FTransform> InstanceTransforms;
+
+public:
+	URealtimeMeshInstancedComponent();
+
+	/** Adds an instance with a transform relative to the component, returns its index */
+	UFUNCTION(BlueprintCallable, Category = "Components|RealtimeMeshInstancedComponent")
+	int32 AddInstance(const FTransform& InstanceTransform);
+
+	/** Adds many instances at once, only recreating render state a single time */
+	UFUNCTION(BlueprintCallable, Category = "Components|RealtimeMeshInstancedComponent")
+	void AddInstances(const TArray<FTransform>& NewInstanceTransforms);
+
+	UFUNCTION(BlueprintCallable, Category = "Components|RealtimeMeshInstancedComponent")
+	bool UpdateInstanceTransform(int32 InstanceIndex, const FTransform& NewInstanceTransform);
+
+	/** Removes an instance, shifting down the index of all following instances */
+	UFUNCTION(BlueprintCallable, Category = "Components|RealtimeMeshInstancedComponent")
+	bool RemoveInstance(int32 InstanceIndex);
+
+	UFUNCTION(BlueprintCallable, Category = "Components|RealtimeMeshInstancedComponent")
+	void ClearInstances();
+
+	UFUNCTION(BlueprintPure, Category = "Components|RealtimeMeshInstancedComponent")
+	int32 GetInstanceCount() const { return InstanceTransforms.Num(); }
+
+	UFUNCTION(BlueprintCallable, Category = "Components|RealtimeMeshInstancedComponent")
+	bool GetInstanceTransform(int32 InstanceIndex, FTransform& OutInstanceTransform) const;
+
+	const TArray<FTransform>& GetInstanceTransforms() const { return InstanceTransforms; }
+
+	//~ Begin USceneComponent Interface.
+	virtual FBoxSphereBounds CalcBounds(const FTransform& LocalToWorld) const override;
+	//~ End USceneComponent Interface.
+
+	//~ Begin UPrimitiveComponent Interface.
+	virtual FPrimitiveSceneProxy* CreateSceneProxy() override;
+	virtual class UBodySetup* GetBodySetup() override;
+	//~ End UPrimitiveComponent Interface.
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	void HandleInstancesChanged();
+};
@@ -87,6 +87,13 @@ enum class ERealtimeMeshSectionDrawType : uint8
 	Dynamic,
 };
 
+UENUM(BlueprintType)
+enum class ERealtimeMeshRayTracingBuildQuality : uint8
+{
+	FastBuild,
+	FastTrace,
+};
+
 USTRUCT(NoExport, BlueprintType)
 struct FRealtimeMeshSectionConfig
 {
@@ -113,6 +120,15 @@ struct FRealtimeMeshSectionGroupConfig
 {
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="RealtimeMesh|SectionGroup|Config", AdvancedDisplay)
 	ERealtimeMeshSectionDrawType DrawType = ERealtimeMeshSectionDrawType::Static;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="RealtimeMesh|SectionGroup|Config", AdvancedDisplay)
+	bool bMergeCompatibleSections = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="RealtimeMesh|SectionGroup|Config", AdvancedDisplay)
+	ERealtimeMeshRayTracingBuildQuality RayTracingBuildQuality = ERealtimeMeshRayTracingBuildQuality::FastBuild;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="RealtimeMesh|SectionGroup|Config", AdvancedDisplay)
+	bool bAllowRayTracingRefit = false;
 };
 
 USTRUCT(NoExport, BlueprintType)
@@ -214,11 +230,20 @@ struct FRealtimeMeshCollisionConfiguration
 	UPROPERTY(Category="RealtimeMesh|Collision", EditAnywhere, BlueprintReadWrite)
 	bool bFlipNormals = false;
 
+	/** Complex meshes whose triangles haven't changed since the last cook only get their vertices moved instead of a full recook */
 	UPROPERTY(Category="RealtimeMesh|Collision", EditAnywhere, BlueprintReadWrite)
 	bool bDeformableMesh = false;
 	
 	UPROPERTY(Category="RealtimeMesh|Collision", EditAnywhere, BlueprintReadWrite)
 	bool bMergeAllMeshes = false;
+
+	/** Weld coincident vertices and remove degenerate and duplicate faces from complex meshes before cooking */
+	UPROPERTY(Category="RealtimeMesh|Collision", EditAnywhere, BlueprintReadWrite)
+	bool bCleanComplexMeshes = false;
+
+	/** Vertices that snap to the same cell of a grid this size are welded when cleaning. 0 only welds exact matches */
+	UPROPERTY(Category="RealtimeMesh|Collision", EditAnywhere, BlueprintReadWrite, meta=(ClampMin=0, EditCondition="bCleanComplexMeshes"))
+	float CleanWeldThreshold = 0.01f;
 };
 
 
@@ -292,6 +317,7 @@ struct FRealtimeMeshCollisionConvex : public FRealtimeMeshCollisionShape
 private:
 	TArray<FVector> Vertices;
 	FBox BoundingBox;
+	bool bGenerated;
 	mutable TSharedPtr<FRealtimeMeshCookedConvexMeshData> Cooked;
 };
 
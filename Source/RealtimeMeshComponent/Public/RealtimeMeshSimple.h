@@ -7,11 +7,14 @@
 #include "Data/RealtimeMeshLOD.h"
 #include "Data/RealtimeMeshSection.h"
 #include "Data/RealtimeMeshSectionGroup.h"
+#include "Data/RealtimeMeshCollisionCookScheduler.h"
+#include "Data/RealtimeMeshSpatialIndex.h"
 #include "Interface_CollisionDataProviderCore.h"
 #include "Core/RealtimeMeshBuilder.h"
 #include "Core/RealtimeMeshDataStream.h"
 #include "Mesh/RealtimeMeshDistanceField.h"
 #include "Mesh/RealtimeMeshCardRepresentation.h"
+#include "Mesh/RealtimeMeshConvexDecomposition.h"
 #include "RealtimeMeshSimple.generated.h"
 
 
@@ -20,6 +23,17 @@
 class URealtimeMeshStreamSet;
 class URealtimeMeshSimple;
 
+UENUM(BlueprintType)
+enum class ERealtimeMeshStreamStorage : uint8
+{
+	/* Streams are serialized inline with the rest of the mesh */
+	Inline,
+	/* Stream payloads are serialized as bulk data, which cooked builds can memory map, and decoded per section group in parallel during load */
+	BulkData,
+	/* Like BulkData, but only section groups that feed collision are decoded during load. The rest are decoded on a worker afterwards and draw once they arrive. */
+	LazyBulkData,
+};
+
 
 namespace RealtimeMesh
 {
@@ -98,13 +112,32 @@ namespace RealtimeMesh
 		// Should we auto create sections for the poly groups
 		uint8 bAutoCreateSectionsForPolygonGroups : 1;
 
+		// Bytes of Streams currently accounted against STAT_RealtimeMesh_CPUStreamMemory
+		SIZE_T TrackedStreamMemory;
+
+		// Changes whenever Streams does. Values are unique across all section groups, so a recreated group never matches an old one.
+		uint32 StreamVersion;
+
+		// Like StreamVersion, but only changes along with the triangle stream
+		uint32 TopologyVersion;
+
+		// StreamVersion right after the streams were evicted, 0 if they never were. Any later edit moves StreamVersion past it.
+		uint32 EvictedStreamVersion;
+
 	public:
 		FRealtimeMeshSectionGroupSimple(const FRealtimeMeshSharedResourcesRef& InSharedResources, const FRealtimeMeshSectionGroupKey& InKey)
 			: FRealtimeMeshSectionGroup(InSharedResources, InKey)
 			, bAutoCreateSectionsForPolygonGroups(true)
+			, TrackedStreamMemory(0)
+			, StreamVersion(0)
+			, TopologyVersion(0)
+			, EvictedStreamVersion(0)
 		{
+			MarkStreamsChanged(true);
 		}
 
+		virtual ~FRealtimeMeshSectionGroupSimple() override;
+
 		/**
 		 * @brief Get the valid range of the contained streams. This is the maximal renderable region of the streams
 		 * @return 
@@ -121,6 +154,50 @@ namespace RealtimeMesh
 		 */
 		const FRealtimeMeshStream* GetStream(const FRealtimeMeshLockContext& LockContext, FRealtimeMeshStreamKey StreamKey) const;
 
+		/*
+		 * @brief Get the version of the stored stream data, this changes every time any stream is created, updated or removed
+		 */
+		uint32 GetStreamVersion(const FRealtimeMeshLockContext& LockContext) const { return StreamVersion; }
+
+		/*
+		 * @brief Get the version of the triangle stream. When only this is unchanged between two stream versions, just the vertices were edited.
+		 */
+		uint32 GetTopologyVersion(const FRealtimeMeshLockContext& LockContext) const { return TopologyVersion; }
+
+		/*
+		 * @brief Get the bytes currently held by the streams
+		 */
+		SIZE_T GetStreamMemory(const FRealtimeMeshLockContext& LockContext) const { return TrackedStreamMemory; }
+
+		/*
+		 * @brief Whether the streams are out on LOD residency's cache, or still waiting on a bulk data load. False again as soon as
+		 * anything edits the streams.
+		 */
+		bool AreStreamsEvicted(const FRealtimeMeshLockContext& LockContext) const { return EvictedStreamVersion != 0 && EvictedStreamVersion == StreamVersion; }
+
+		/*
+		 * @brief Whether any section of this group feeds complex collision
+		 */
+		bool HasCollisionSections(const FRealtimeMeshLockContext& LockContext) const;
+
+		/*
+		 * @brief Whether the streams can be evicted. Groups with sections that feed collision are kept, so a later cook still sees them.
+		 */
+		bool CanEvictStreams(const FRealtimeMeshLockContext& LockContext) const;
+
+		/*
+		 * @brief Moves the streams out and drops their GPU buffers. Sections, bounds and collision are left alone, so the group just
+		 * stops drawing until the streams are restored.
+		 * @return The evicted streams
+		 */
+		FRealtimeMeshStreamSet EvictStreams(FRealtimeMeshUpdateContext& UpdateContext);
+
+		/*
+		 * @brief Puts streams taken by EvictStreams back and re-uploads them
+		 * @return False if the streams were edited since being evicted, in which case InStreams is stale and is dropped
+		 */
+		bool RestoreStreams(FRealtimeMeshUpdateContext& UpdateContext, FRealtimeMeshStreamSet&& InStreams);
+
 		void SetPolyGroupSectionHandler(FRealtimeMeshUpdateContext& UpdateContext, const FRealtimeMeshPolyGroupConfigHandler& NewHandler);
 		void ClearPolyGroupSectionHandler(FRealtimeMeshUpdateContext& UpdateContext);
 
@@ -161,6 +238,11 @@ namespace RealtimeMesh
 		 */
 		virtual void InitializeProxy(FRealtimeMeshUpdateContext& UpdateContext) override;
 
+		/*
+		 * @brief Finish an update, sending the proxy a copy of the triangles for ray tracing if section changes left gaps between them
+		 */
+		virtual void FinalizeUpdate(FRealtimeMeshUpdateContext& UpdateContext) override;
+
 		/*
 		 * @brief Reset this section group, removing all streams, and config
 		 * @param ProxyBuilder Running command queue that we send RT commands too. This is used for command batching.
@@ -184,6 +266,9 @@ namespace RealtimeMesh
 		virtual FRealtimeMeshSectionConfig DefaultPolyGroupSectionHandler(int32 PolyGroupIndex) const;
 		
 		bool ShouldCreateSingularSection() const;
+
+		void UpdateStreamMemoryStats();
+		void MarkStreamsChanged(bool bTrianglesChanged);
 	};
 
 	/*
@@ -201,10 +286,32 @@ namespace RealtimeMesh
 		 * @brief Generate the collision mesh data for this LOD, used to setup PhysX/Chaos collision
 		 */
 		virtual bool GenerateComplexCollision(const FRealtimeMeshLockContext& LockContext, FRealtimeMeshComplexGeometry& ComplexGeometry) const;
+
+		/*
+		 * @brief Whether LOD residency can evict this LOD. It goes as a whole or not at all, since a LOD with any group left drawing
+		 * stays active and would show holes where the evicted groups were.
+		 */
+		bool CanEvictStreams(const FRealtimeMeshLockContext& LockContext) const;
 	};
 
 	DECLARE_MULTICAST_DELEGATE(FRealtimeMeshSimpleCollisionDataChangedEvent);
 
+	/*
+	 * @brief Streams of one section group taken out of the mesh by LOD residency
+	 */
+	struct FRealtimeMeshEvictedSectionGroup
+	{
+		FRealtimeMeshSectionGroupKey SectionGroupKey;
+		FRealtimeMeshStreamSet Streams;
+
+		friend FArchive& operator<<(FArchive& Ar, FRealtimeMeshEvictedSectionGroup& SectionGroup)
+		{
+			Ar << SectionGroup.SectionGroupKey;
+			Ar << SectionGroup.Streams;
+			return Ar;
+		}
+	};
+
 	struct FRealtimeMeshSimpleCollisionGroupDirtySet
 	{
 	private:
@@ -266,8 +373,22 @@ namespace RealtimeMesh
 
 		virtual FRealtimeMeshRef CreateRealtimeMesh() const override;
 		virtual FRealtimeMeshSharedResourcesRef CreateSharedResources() const override { return MakeShared<FRealtimeMeshSharedResourcesSimple>(); }
+
+		ERealtimeMeshStreamStorage GetStreamStorage() const { return StreamStorage; }
+		void SetStreamStorage(ERealtimeMeshStreamStorage NewStorage) { StreamStorage = NewStorage; }
+
+		/* Whether section groups leave their streams to FRealtimeMeshSimple's bulk data when serializing with this archive */
+		bool ShouldSerializeStreamsAsBulkData(const FArchive& Ar) const
+		{
+			return Ar.CustomVer(FRealtimeMeshVersion::GUID) >= FRealtimeMeshVersion::StreamBulkDataStorage && StreamStorage != ERealtimeMeshStreamStorage::Inline;
+		}
+
+	private:
+		ERealtimeMeshStreamStorage StreamStorage = ERealtimeMeshStreamStorage::Inline;
 	};
 
+	struct FRealtimeMeshStreamBulkLoad;
+
 	class REALTIMEMESHCOMPONENT_API FRealtimeMeshSimple : public FRealtimeMesh
 	{
 	protected:
@@ -283,6 +404,12 @@ namespace RealtimeMesh
 		// Pending collision update promise. Used to alert when the collision finishes updating
 		mutable TSharedPtr<TPromise<ERealtimeMeshCollisionUpdateResult>> PendingCollisionPromise;
 
+		// Keeps a single collision cook in flight, folding and cancelling requests that arrive while it runs
+		FRealtimeMeshCollisionCookScheduler CollisionCookScheduler;
+
+		// Promises of collision requests waiting on the next cook to start, guarded by the mesh lock
+		TArray<TSharedPtr<TPromise<ERealtimeMeshCollisionUpdateResult>>> WaitingCollisionPromises;
+
 		// Nanite representation of this mesh
 		FRealtimeMeshNaniteResourcesPtr NaniteResources;
 		
@@ -291,6 +418,28 @@ namespace RealtimeMesh
 
 		// Lumen card representation for this mesh
 		TUniquePtr<FRealtimeMeshCardRepresentation> CardRepresentation;
+
+		struct FSpatialIndexState
+		{
+			FRealtimeMeshSpatialIndexPtr Index;
+			// Serial of the build that produced Index, so a slower older build can't replace a newer result
+			uint32 IndexSerial = 0;
+			uint32 NextSerial = 0;
+			int32 NumBuildsInFlight = 0;
+		};
+
+		// Spatial index of each LOD that has been queried, built lazily from the render data on a worker thread
+		mutable FCriticalSection SpatialIndexLock;
+		mutable TMap<FRealtimeMeshLODKey, FSpatialIndexState> SpatialIndices;
+		// Bumped by Reset, builds started before it are dropped when they finish instead of restoring the old data
+		uint32 SpatialIndexGeneration = 0;
+
+		// Bulk data streams a LazyBulkData load left for a worker to decode
+		mutable FCriticalSection PendingStreamLoadLock;
+		TSharedPtr<FRealtimeMeshStreamBulkLoad> PendingStreamLoad;
+
+		// Bumped by every committed update, so LOD residency only reads the LOD sizes again after something changed
+		std::atomic<uint32> ResidencyInfoVersion { 1 };
 		
 	public:
 		FRealtimeMeshSimple(const FRealtimeMeshSharedResourcesRef& InSharedResources)
@@ -306,6 +455,10 @@ namespace RealtimeMesh
 			{
 				PendingCollisionPromise->SetValue(ERealtimeMeshCollisionUpdateResult::Ignored);
 			}
+			for (const auto& WaitingPromise : WaitingCollisionPromises)
+			{
+				WaitingPromise->SetValue(ERealtimeMeshCollisionUpdateResult::Ignored);
+			}
 		}
 
 		TFuture<ERealtimeMeshProxyUpdateStatus> CreateSectionGroup(const FRealtimeMeshSectionGroupKey& SectionGroupKey, const FRealtimeMeshSectionGroupConfig& InConfig = FRealtimeMeshSectionGroupConfig(), bool bShouldAutoCreateSectionsForPolyGroups = true);
@@ -319,6 +472,25 @@ namespace RealtimeMesh
 		TFuture<ERealtimeMeshCollisionUpdateResult> SetCollisionConfig(const FRealtimeMeshCollisionConfiguration& InCollisionConfig);
 		FRealtimeMeshSimpleGeometry GetSimpleGeometry() const;
 		TFuture<ERealtimeMeshCollisionUpdateResult> SetSimpleGeometry(const FRealtimeMeshSimpleGeometry& InSimpleGeometry);
+		void ProcessSimpleGeometry(TFunctionRef<void(const FRealtimeMeshSimpleGeometry&)> ProcessFunc) const;
+
+		/**
+		 * @brief Edits the simple geometry in place under the mesh lock, without copying it out and back in.
+		 * Collision is rebuilt once for everything the edit did, so this is the way to apply large batches of shape changes.
+		 * @param EditFunc Makes the changes, returning false if it ended up not changing anything, in which case no rebuild is queued
+		 * @return Future resolved once collision has been rebuilt, or immediately with Ignored if nothing was changed
+		 */
+		TFuture<ERealtimeMeshCollisionUpdateResult> EditSimpleGeometry(TFunctionRef<bool(FRealtimeMeshSimpleGeometry&)> EditFunc);
+
+		/**
+		 * @brief Approximates the render data of this LOD with convex hulls on a worker thread, then swaps them into the
+		 * simple geometry in place of any hulls an earlier decomposition generated. Everything else in the simple geometry
+		 * is left alone.
+		 * @param LODKey LOD whose section groups are decomposed
+		 * @param Settings Hull count, vertex count and resolution limits
+		 * @return Future that completes once the collision has been updated with the new hulls
+		 */
+		TFuture<ERealtimeMeshCollisionUpdateResult> GenerateConvexDecomposition(FRealtimeMeshLODKey LODKey, const FRealtimeMeshConvexDecompositionSettings& Settings);
 
 		bool HasCustomComplexMeshGeometry() const { return ComplexGeometry.NumMeshes() > 0; }
 		TFuture<ERealtimeMeshCollisionUpdateResult> ClearCustomComplexMeshGeometry();
@@ -340,6 +512,70 @@ namespace RealtimeMesh
 
 		virtual void SetCardRepresentation(FRealtimeMeshUpdateContext& UpdateContext, FRealtimeMeshCardRepresentation&& InCardRepresentation) override;
 		virtual void ClearCardRepresentation(FRealtimeMeshUpdateContext& UpdateContext) override;
+
+		/*
+		 * @brief Brings the spatial index of this LOD up to date with its render data. Only the section groups whose streams
+		 * changed since the last build are rebuilt, or just refit if only their vertices moved, and that happens on a worker thread.
+		 * @return Future resolving to the up to date index, or null if the LOD doesn't exist
+		 */
+		TFuture<FRealtimeMeshSpatialIndexPtr> UpdateSpatialIndex(FRealtimeMeshLODKey LODKey) const;
+
+		/*
+		 * @brief Get the spatial index of this LOD for querying the render data without collision.
+		 * @param bWaitForUpToDate If the render data changed since the last build, wait for the rebuild. Otherwise the previous
+		 * index is returned while a rebuild runs in the background, which is null before the first build finishes and after a Reset.
+		 */
+		FRealtimeMeshSpatialIndexPtr GetSpatialIndex(FRealtimeMeshLODKey LODKey, bool bWaitForUpToDate = false) const;
+
+		/*
+		 * @brief Opts this mesh into LOD residency, which evicts the streams of LODs it isn't drawn at to a compressed cache and
+		 * loads them back before they are needed, within RealtimeMesh.Residency.BudgetMB. Game thread only. Disabling it restores
+		 * every evicted LOD before returning.
+		 */
+		void SetLODResidencyEnabled(bool bEnabled);
+		bool IsLODResidencyEnabled() const;
+
+		/*
+		 * @brief Get the configured screen size and the evictable stream bytes of every LOD, in one pass under the mesh lock
+		 */
+		void GetLODResidencyInfo(TFixedLODArray<float>& OutScreenSizes, TFixedLODArray<int64>& OutEvictableMemory) const;
+
+		/*
+		 * @brief Changes whenever an update is committed, until then GetLODResidencyInfo returns the same as last time
+		 */
+		uint32 GetResidencyInfoVersion() const { return ResidencyInfoVersion.load(std::memory_order_acquire); }
+
+		/*
+		 * @brief Moves the streams of this LOD out of the mesh, dropping their GPU buffers. Sections and config stay, so the LOD just
+		 * stops drawing and its active neighbours cover its screen size range. Spatial queries against the LOD see it as empty
+		 * until it is restored. Nothing is evicted when FRealtimeMeshLODSimple::CanEvictStreams is false.
+		 * @return The streams of every section group that was evicted
+		 */
+		TArray<FRealtimeMeshEvictedSectionGroup> EvictLODStreams(FRealtimeMeshLODKey LODKey);
+
+		/*
+		 * @brief Puts streams taken by EvictLODStreams back. Section groups that were edited or removed since are skipped, as
+		 * whatever they hold now is newer than the evicted copy.
+		 * @return Number of section groups restored
+		 */
+		int32 RestoreLODStreams(TArray<FRealtimeMeshEvictedSectionGroup>&& SectionGroups);
+
+		/*
+		 * @brief Get how stream payloads are stored when this mesh is serialized
+		 */
+		ERealtimeMeshStreamStorage GetStreamStorage() const;
+		void SetStreamStorage(ERealtimeMeshStreamStorage NewStorage);
+
+		/*
+		 * @brief Whether a LazyBulkData load still has section groups waiting on their streams
+		 */
+		bool HasPendingStreamLoad() const;
+
+		/*
+		 * @brief Decodes whatever a LazyBulkData load left pending on the calling thread, returning once every section group has its
+		 * streams. Must not be called while holding the mesh lock.
+		 */
+		void FlushPendingStreamLoad();
 		
 		virtual bool GenerateComplexCollision(const FRealtimeMeshLockContext& LockContext, FRealtimeMeshComplexGeometry& ComplexGeometry) const;
 
@@ -352,11 +588,18 @@ namespace RealtimeMesh
 
 		virtual bool Serialize(FArchive& Ar, URealtimeMesh* Owner) override;
 	protected:
+		void SerializeStreamBulkData(FArchive& Ar, URealtimeMesh* Owner);
+		void FinishStreamLoad(const TSharedRef<FRealtimeMeshStreamBulkLoad>& Load);
+
 		void MarkCollisionDirtyNoCallback() const;
 		TFuture<ERealtimeMeshCollisionUpdateResult> MarkCollisionDirty() const;
 
 		virtual void ProcessEndOfFrameUpdates() override;
 
+		/* Starts a collision cook for the waiting promises, unless one is already running in which case it will start after */
+		void StartCollisionCook();
+		void FinishCollisionCook(const FRealtimeMeshCollisionCookScheduler::FTicket& Ticket, TArray<TSharedPtr<TPromise<ERealtimeMeshCollisionUpdateResult>>>&& Promises, ERealtimeMeshCollisionUpdateResult Result);
+
 		friend class ::URealtimeMeshSimple;
 	};
 }
@@ -483,6 +726,43 @@ public:
 	void SetCardRepresentation(const FRealtimeMeshCardRepresentation& CardRepresentation, const FRealtimeMeshSimpleCompletionCallback& OnComplete);
 	
 	TFuture<ERealtimeMeshProxyUpdateStatus> ClearCardRepresentation();
+
+	/*
+	 * The render data queries below never block the calling thread. They run against the spatial index last built for the LOD
+	 * and kick off a rebuild on a worker thread when the render data changed since. So they find nothing until the LOD's first
+	 * build finishes, and see the previous data for a short while after an edit. Wait on FRealtimeMeshSimple::UpdateSpatialIndex
+	 * from C++ when the results have to reflect the latest edit.
+	 */
+
+	/*
+	 * Finds the UV at the point on the LOD's render triangles closest to LocalLocation, within MaxDistance.
+	 * Unlike URealtimeMeshCollisionTools::FindCollisionUVRealtimeMesh this needs no physics hit or cooked collision.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Components|RealtimeMesh")
+	bool FindTexCoordAtLocation(const FRealtimeMeshLODKey& LODKey, const FVector& LocalLocation, int32 UVChannel, float MaxDistance, FVector2D& UV) const;
+
+	/* Finds the UV where a ray first hits the LOD's render triangles, LocalDirection doesn't need to be normalized */
+	UFUNCTION(BlueprintCallable, Category = "Components|RealtimeMesh")
+	bool FindTexCoordByRaycast(const FRealtimeMeshLODKey& LODKey, const FVector& LocalOrigin, const FVector& LocalDirection, int32 UVChannel, float MaxDistance, FVector2D& UV) const;
+
+	/* Closest point UV lookup for a batch of locations. Returns the number of locations a UV was found for. */
+	UFUNCTION(BlueprintCallable, Category = "Components|RealtimeMesh")
+	int32 FindTexCoordsAtLocations(const FRealtimeMeshLODKey& LODKey, const TArray<FVector>& LocalLocations, int32 UVChannel, float MaxDistance, TArray<FVector2D>& UVs, TArray<bool>& Found) const;
+
+	/*
+	 * Traces a line against the LOD's render triangles directly, so it works without any collision being cooked.
+	 * Everything is in the mesh's local space. For many queries at once use the batch functions on the spatial index.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Components|RealtimeMesh")
+	bool LineTraceRenderData(const FRealtimeMeshLODKey& LODKey, const FVector& Start, const FVector& End, FVector& HitLocation, FVector& HitNormal, FRealtimeMeshSectionGroupKey& HitSectionGroup) const;
+
+	/* Sweeps a sphere from Start to End against the LOD's render triangles, HitNormal is the impact normal */
+	UFUNCTION(BlueprintCallable, Category = "Components|RealtimeMesh")
+	bool SweepSphereRenderData(const FRealtimeMeshLODKey& LODKey, const FVector& Start, const FVector& End, float Radius, FVector& HitLocation, FVector& HitNormal, FRealtimeMeshSectionGroupKey& HitSectionGroup) const;
+
+	/* Finds the point on the LOD's render triangles closest to Point, within MaxDistance */
+	UFUNCTION(BlueprintCallable, Category = "Components|RealtimeMesh")
+	bool FindClosestPointOnRenderData(const FRealtimeMeshLODKey& LODKey, const FVector& Point, float MaxDistance, FVector& ClosestPoint, FVector& Normal, FRealtimeMeshSectionGroupKey& HitSectionGroup) const;
 	
 	UFUNCTION(BlueprintCallable, Category = "Components|RealtimeMesh")
 	FRealtimeMeshCollisionConfiguration GetCollisionConfig() const;
@@ -499,6 +779,29 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "Components|RealtimeMesh", DisplayName="SetSimpleGeometry", meta = (AutoCreateRefTerm = "OnComplete"))
 	void SetSimpleGeometry(const FRealtimeMeshSimpleGeometry& InSimpleGeometry, const FRealtimeMeshSimpleCollisionCompletionCallback& OnComplete);
+
+	void ProcessSimpleGeometry(TFunctionRef<void(const FRealtimeMeshSimpleGeometry&)> ProcessFunc) const;
+	TFuture<ERealtimeMeshCollisionUpdateResult> EditSimpleGeometry(TFunctionRef<bool(FRealtimeMeshSimpleGeometry&)> EditFunc);
+
+	TFuture<ERealtimeMeshCollisionUpdateResult> GenerateConvexDecomposition(const FRealtimeMeshLODKey& LODKey, const FRealtimeMeshConvexDecompositionSettings& Settings);
+
+	/* Builds convex hulls for simple collision from the LOD's render data in the background, replacing any generated earlier */
+	UFUNCTION(BlueprintCallable, Category = "Components|RealtimeMesh", DisplayName="GenerateConvexDecomposition", meta = (AutoCreateRefTerm = "OnComplete"))
+	void GenerateConvexDecomposition(const FRealtimeMeshLODKey& LODKey, const FRealtimeMeshConvexDecompositionSettings& Settings, const FRealtimeMeshSimpleCollisionCompletionCallback& OnComplete);
+
+	/* Lets the streams of LODs that aren't being drawn be evicted to a compressed cache and reloaded when they are needed again */
+	UFUNCTION(BlueprintCallable, Category = "Components|RealtimeMesh")
+	void SetLODResidencyEnabled(bool bEnabled);
+
+	UFUNCTION(BlueprintCallable, Category = "Components|RealtimeMesh")
+	bool IsLODResidencyEnabled() const;
+
+	/* Sets how stream payloads are stored when this mesh is saved. Bulk data loads faster and can be memory mapped in cooked builds. */
+	UFUNCTION(BlueprintCallable, Category = "Components|RealtimeMesh")
+	void SetStreamStorage(ERealtimeMeshStreamStorage NewStorage);
+
+	UFUNCTION(BlueprintCallable, Category = "Components|RealtimeMesh")
+	ERealtimeMeshStreamStorage GetStreamStorage() const;
 	
 	virtual void Reset() override;
 	
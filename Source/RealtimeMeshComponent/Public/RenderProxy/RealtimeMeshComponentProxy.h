@@ -29,14 +29,23 @@ namespace RealtimeMesh
 		// Static sections get new buffers on each update.
 		FRealtimeMeshResourceReferenceList StaticResources;
 
+		// Hash and count of the static batches last handed to the scene by DrawStaticElements
+		uint32 StaticDrawSignature;
+		int32 NumStaticMeshBatches;
+
 		// Reference to the body setup for rendering.
 		UBodySetup* BodySetup;
 
 		// Store the combined material relevance.
 		FMaterialRelevance MaterialRelevance;
 
+		// Handle to the mesh proxy event used to refresh the scene's cached static ray tracing state
+		FDelegateHandle StaticRayTracingChangedHandle;
+
 		uint32 bAnyMaterialUsesDithering : 1;
 		uint32 bSupportsRayTracing : 1;
+		// Whether the scene registered this proxy as static ray tracing relevant
+		uint32 bStaticRayTracingRelevant : 1;
 
 	public:
 		/*Constructor, copies the whole mesh data to feed to UE */
@@ -46,6 +55,8 @@ namespace RealtimeMesh
 
 		virtual void CreateRenderThreadResources(FRHICommandListBase& RHICmdList) override;
 
+		virtual void DestroyRenderThreadResources() override;
+
 		virtual bool CanBeOccluded() const override;
 
 		virtual int32 GetLOD(const FSceneView* View) const override;
@@ -59,6 +70,22 @@ namespace RealtimeMesh
 
 		virtual void DrawStaticElements(FStaticPrimitiveDrawInterface* PDI) override;
 
+		/* Number of static mesh batches the scene last gathered from this proxy */
+		int32 GetNumStaticMeshBatches() const { return NumStaticMeshBatches; }
+
+		/*
+		 *	Whether DrawStaticElements would now produce different batches than the ones the scene has cached.
+		 *	Cached draws can only be refreshed in place when this is false, otherwise the render state has to be
+		 *	recreated so the new batches are gathered. Render thread only.
+		 */
+		virtual bool HasStaticDrawLayoutChanged() const;
+
+	protected:
+		/* Re-caches the scene's static ray tracing instances after the mesh rebuilt or refit its geometry. Render thread only. */
+		void HandleStaticRayTracingChanged();
+
+	public:
+
 
 		virtual void GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap,
 		                                    FMeshElementCollector& Collector) const override;
@@ -88,12 +115,47 @@ namespace RealtimeMesh
 #endif // RHI_RAYTRACING
 
 	protected:
+		// Cleared by proxies that can't draw through the scene's cached static path at all
+		bool bAllowStaticRelevance = true;
+
 		SIZE_T GetAllocatedSize(void) const;
 
 		int8 GetCurrentFirstLOD() const;
 		
 		void DrawDebugVectors(FStaticPrimitiveDrawInterface* PDI) const;
+
+		/* Builds the static batches for all active static LODs and section groups, referencing their buffers in Resources */
+		void GatherStaticElements(FStaticPrimitiveDrawInterface* PDI, FRealtimeMeshResourceReferenceList& Resources) const;
 		void DrawDebugVectorsDynamic(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, FMeshElementCollector& Collector) const;
+
+		const FRealtimeMeshProxyRef& GetRealtimeMeshProxy() const { return RealtimeMeshProxy; }
+
+#if RHI_RAYTRACING
+		/** Transforms to instance the ray tracing geometry with, just the primitive transform unless instanced */
+		virtual void GatherRayTracingInstanceTransforms(TArray<FMatrix>& OutTransforms) const;
+#endif
+
+		// Prebuilt mesh batch for one section draw range, copied into the collector each frame by the dynamic path
+		struct FDynamicMeshBatchTemplate
+		{
+			FMeshBatch MeshBatch;
+			int32 LODIndex;
+			bool bIsDynamicPath;
+			bool bSupportsDitheredLODTransition;
+		};
+
+		// Batch templates are only rebuilt when the mesh proxy state, the winding or the primitive uniform buffer changes
+		mutable TArray<FDynamicMeshBatchTemplate> DynamicBatchTemplates;
+		mutable FRealtimeMeshResourceReferenceList DynamicBatchResources;
+		mutable FCriticalSection DynamicBatchTemplatesLock;
+		mutable TOptional<uint32> DynamicBatchTemplatesVersion;
+		mutable const FRHIUniformBuffer* DynamicBatchTemplatesUniformBuffer = nullptr;
+		mutable bool bDynamicBatchTemplatesDeterminantNegative = false;
+
+		void UpdateDynamicBatchTemplates() const;
+
+		/* Feeds the screen size a view picked a LOD at back to the mesh, when LOD residency is watching it */
+		void ReportScreenSize(float ScreenRadiusSquared) const;
 		
 	private:
 		// Cache debug vertex factories to avoid recreating them every frame
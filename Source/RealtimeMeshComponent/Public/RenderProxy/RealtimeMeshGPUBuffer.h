@@ -29,6 +29,7 @@ namespace RealtimeMesh
 		}
 
 		const FResourceArrayInterface* GetResource() const { return &Stream; }
+		const FRealtimeMeshStream& GetStream() const { return Stream; }
 		FRealtimeMeshBufferLayout GetBufferLayout() const { return Stream.GetLayout(); }
 		FRealtimeMeshStreamKey GetStreamKey() const { return Stream.GetStreamKey(); }
 		int32 GetNumElements() const { return Stream.Num(); }
@@ -52,6 +53,7 @@ namespace RealtimeMesh
 		FRealtimeMeshBufferMemoryLayout MemoryLayout;
 		uint32 BufferNum;
 		EBufferUsageFlags UsageFlags;
+		uint64 TrackedMemorySize;
 
 #if WITH_EDITOR
 		FString BufferName;
@@ -64,13 +66,17 @@ namespace RealtimeMesh
 			, MemoryLayout(FRealtimeMeshBufferLayoutUtilities::GetBufferLayoutMemoryLayout(InBufferLayout))
 			, BufferNum(0)
 			, UsageFlags(BUF_Static | BUF_ShaderResource)
+			, TrackedMemorySize(0)
 #if WITH_EDITOR
 			, BufferName(InBufferName)
 #endif
 		{
 		}
 
-		virtual ~FRealtimeMeshGPUBuffer() = default;
+		virtual ~FRealtimeMeshGPUBuffer()
+		{
+			UntrackBufferMemory();
+		}
 
 		FORCEINLINE FString GetBufferName() const
 		{
@@ -93,10 +99,17 @@ namespace RealtimeMesh
 		FORCEINLINE int32 Num() const { return BufferNum; }
 
 		FORCEINLINE int32 NumElements() const { return BufferLayout.GetNumElements(); }
+		FORCEINLINE uint64 GetTrackedMemorySize() const { return TrackedMemorySize; }
 
 
 		static constexpr int32 RHIUpdateBatchSize = 16;
 
+	protected:
+		// Accounts the bound RHI buffer against the GPU memory stats, replacing anything previously tracked
+		void TrackBufferMemory(const FBufferRHIRef& InBuffer);
+		void UntrackBufferMemory();
+	public:
+
 		/*virtual void ApplyBufferUpdate(FRHICommandListBase& RHICmdList, const FRealtimeMeshSectionGroupStreamUpdateDataRef& UpdateData)
 		{
 			check(BufferLayout == UpdateData->GetBufferLayout());
@@ -139,6 +152,7 @@ namespace RealtimeMesh
 			check(GetStride() > 0);
 			
 			VertexBufferRHI = UpdateData->GetBuffer();
+			TrackBufferMemory(VertexBufferRHI);
 			
 			if (VertexBufferRHI && RHISupportsManualVertexFetch(GMaxRHIShaderPlatform))
 			{
@@ -167,6 +181,7 @@ namespace RealtimeMesh
 		virtual void ReleaseRHI() override
 		{
 			FVertexBufferWithSRV::ReleaseRHI();
+			UntrackBufferMemory();
 			BufferLayout = FRealtimeMeshBufferLayout::Invalid;
 			BufferNum = 0;
 			UsageFlags = BUF_None;
@@ -236,6 +251,7 @@ namespace RealtimeMesh
 			// Adjust size by number of elements to handle structs containing 3 indices.
 			BufferNum *= BufferLayout.GetNumElements();
 			IndexBufferRHI = UpdateData->GetBuffer();
+			TrackBufferMemory(IndexBufferRHI);
 			//Batcher.QueueUpdateRequest(IndexBufferRHI, UpdateData->GetNumElements() > 0? UpdateData->GetBuffer() : nullptr);
 		}
 
@@ -253,6 +269,7 @@ namespace RealtimeMesh
 		virtual void ReleaseRHI() override
 		{
 			FIndexBuffer::ReleaseRHI();
+			UntrackBufferMemory();
 			BufferLayout = FRealtimeMeshBufferLayout::Invalid;
 			BufferNum = 0;
 			UsageFlags = BUF_None;
@@ -271,4 +288,20 @@ namespace RealtimeMesh
 			//Batcher.QueueUpdateRequest(IndexBufferRHI, UpdateData->GetNumElements() > 0? UpdateData->GetBuffer() : nullptr);
 		}*/
 	};
+
+	/*
+	 * Index buffer a cached static batch draws through. Points at the section group's indices while the batch's pass
+	 * draws the section, and at a same sized buffer of degenerate triangles while the pass is masked off, so the scene
+	 * only has to re-cache the batch to pick up a section being hidden or shown.
+	 */
+	class REALTIMEMESHCOMPONENT_API FRealtimeMeshPassIndexBuffer : public FIndexBuffer
+	{
+	public:
+		virtual FString GetFriendlyName() const override { return TEXT("RealtimeMesh-PassIndexBuffer"); }
+
+		// Never owns a buffer of its own, only ever points at one of the section group's
+		virtual void InitRHI(FRHICommandListBase& RHICmdList) override { }
+
+		void SetIndexBuffer(const FBufferRHIRef& InIndexBuffer) { IndexBufferRHI = InIndexBuffer; }
+	};
 }
@@ -0,0 +1,78 @@
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#pragma once
+
+#include "RealtimeMeshCore.h"
+#include "ConvexVolume.h"
+
+namespace RealtimeMesh
+{
+	struct FRealtimeMeshInstanceCullingParams
+	{
+		/* Bounds of the mesh in its own space, shared by every instance */
+		FBoxSphereBounds LocalBounds;
+
+		/* Frustum to test instances against, nullptr skips culling */
+		const FConvexVolume* ViewFrustum = nullptr;
+
+		FVector ViewOrigin = FVector::ZeroVector;
+		FMatrix ProjectionMatrix = FMatrix::Identity;
+
+		/* Combined scalability and view LOD distance scale */
+		float LODDistanceFactor = 1.0f;
+
+		/* Lower screen size bound of each LOD, as given by the proxy screen size ranges */
+		TFixedLODArray<float> LODScreenSizes;
+
+		/* Whether each LOD has render data, LODs without it are covered by their active neighbours. Empty means all do */
+		TFixedLODArray<bool> ActiveLODs;
+
+		/* First LOD with render data, where instances too large for any LOD's screen size end up */
+		int32 FirstLOD = 0;
+
+		int32 MinLOD = 0;
+	};
+
+	struct FRealtimeMeshInstanceCullingResult
+	{
+		/* Indices of the visible instances, bucketed by the LOD they should draw */
+		TFixedLODArray<TArray<int32>> InstancesPerLOD;
+		int32 NumVisible = 0;
+		int32 NumCulled = 0;
+
+		/* Largest squared screen radius of any visible instance, what the proxy reports as its screen size */
+		float MaxScreenRadiusSquared = 0.0f;
+
+		void Reset(int32 NumLODs)
+		{
+			InstancesPerLOD.SetNum(NumLODs);
+			for (TArray<int32>& Instances : InstancesPerLOD)
+			{
+				Instances.Reset();
+			}
+			NumVisible = 0;
+			NumCulled = 0;
+			MaxScreenRadiusSquared = 0.0f;
+		}
+	};
+
+	/*
+	 * CPU side instance culling and LOD assignment for instanced realtime meshes.
+	 * Uses the same screen size rule as the single instance proxy so an instance switches LOD exactly where
+	 * a standalone component with the same transform would.
+	 */
+	struct REALTIMEMESHCOMPONENT_API FRealtimeMeshInstanceCulling
+	{
+		static float ComputeScreenRadiusSquared(const FRealtimeMeshInstanceCullingParams& Params, const FBoxSphereBounds& WorldBounds);
+
+		static int32 SelectLOD(const FRealtimeMeshInstanceCullingParams& Params, float ScreenRadiusSquared);
+
+		static void CullAndSelectLODs(const FRealtimeMeshInstanceCullingParams& Params, TConstArrayView<FMatrix> InstanceToWorld, FRealtimeMeshInstanceCullingResult& OutResult);
+
+		/*
+		 * Collapses ascending instance indices into inclusive [First, Last] pairs of consecutive instances, the layout
+		 * FMeshBatchElement::InstanceRuns expects. OutRuns ends up holding two entries per run.
+		 */
+		static void BuildInstanceRuns(TConstArrayView<int32> SortedInstances, TArray<uint32>& OutRuns);
+	};
+}
@@ -0,0 +1,62 @@
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RealtimeMeshComponentProxy.h"
+#include "InstanceDataSceneProxy.h"
+
+class URealtimeMeshInstancedComponent;
+
+namespace RealtimeMesh
+{
+	/**
+	 * Scene proxy drawing many instances of one realtime mesh from a single primitive.
+	 * All instances share the section group buffers of the mesh proxy and the cached batch templates of the base
+	 * proxy. The instance transforms live in GPUScene as the primitive's instance data. Instances are culled against
+	 * each view and assigned a LOD on the CPU every frame, then each section draws all of a LOD's visible instances
+	 * from one instanced batch through instance runs. Without GPUScene every instance falls back to its own batch.
+	 */
+	class REALTIMEMESHCOMPONENT_API FRealtimeMeshInstancedSceneProxy : public FRealtimeMeshComponentSceneProxy
+	{
+	private:
+		// Instance transforms relative to the component
+		TArray<FMatrix> InstanceToPrimitive;
+
+		// Bounds of a single instance of the mesh
+		FBoxSphereBounds MeshLocalBounds;
+
+		// Instance transforms as handed to GPUScene, only set up when the platform uses it
+		FInstanceSceneDataBuffers InstanceSceneDataBuffers;
+		bool bUseGPUSceneInstancing;
+
+	public:
+		FRealtimeMeshInstancedSceneProxy(URealtimeMeshInstancedComponent* Component, const FRealtimeMeshProxyRef& InRealtimeMeshProxy);
+
+		virtual SIZE_T GetTypeHash() const override;
+
+		virtual uint32 GetMemoryFootprint(void) const override;
+
+		virtual void OnTransformChanged(FRHICommandListBase& RHICmdList) override;
+
+		virtual FPrimitiveViewRelevance GetViewRelevance(const FSceneView* View) const override;
+
+		virtual void DrawStaticElements(FStaticPrimitiveDrawInterface* PDI) override;
+		virtual bool HasStaticDrawLayoutChanged() const override { return false; }
+
+		virtual void GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap,
+		                                    FMeshElementCollector& Collector) const override;
+
+		virtual bool HasDistanceFieldRepresentation() const override { return false; }
+
+#if RHI_RAYTRACING
+		virtual bool IsRayTracingStaticRelevant() const override { return false; }
+
+	protected:
+		virtual void GatherRayTracingInstanceTransforms(TArray<FMatrix>& OutTransforms) const override;
+#endif
+
+	private:
+		void UpdateInstanceSceneDataBuffers(const FMatrix& PrimitiveLocalToWorld);
+	};
+}
@@ -6,6 +6,7 @@
 #include "RealtimeMeshProxyShared.h"
 #include "RealtimeMeshSectionGroupProxy.h"
 #include "Core/RealtimeMeshLODConfig.h"
+#include "Core/RealtimeMeshSlotArray.h"
 
 namespace RealtimeMesh
 {
@@ -65,8 +66,9 @@ namespace RealtimeMesh
 	private:
 		const FRealtimeMeshSharedResourcesRef SharedResources;
 		const FRealtimeMeshLODKey Key;
-		TArray<FRealtimeMeshSectionGroupProxyRef> SectionGroups;
-		TMap<FRealtimeMeshSectionGroupKey, uint32> SectionGroupMap;
+		// Section groups sit at the handles the game thread LOD gave them, the map only serves lookups by key
+		TRealtimeMeshSlotArray<FRealtimeMeshSectionGroupProxyRef> SectionGroups;
+		TMap<FRealtimeMeshSectionGroupKey, FRealtimeMeshHandle> SectionGroupMap;
 		FRealtimeMeshSectionGroupMask ActiveSectionGroupMask;
 
 		FRealtimeMeshLODConfig Config;
@@ -88,35 +90,38 @@ namespace RealtimeMesh
 		float GetScreenSize() const { return Config.ScreenSize; }
 
 		FRealtimeMeshSectionGroupProxyPtr GetSectionGroup(const FRealtimeMeshSectionGroupKey& SectionGroupKey) const;
+		FRealtimeMeshSectionGroupProxyPtr GetSectionGroup(const FRealtimeMeshHandle& SectionGroupHandle) const;
+		FRealtimeMeshHandle FindSectionGroupHandle(const FRealtimeMeshSectionGroupKey& SectionGroupKey) const;
 
 		virtual void UpdateConfig(const FRealtimeMeshLODConfig& NewConfig);
 
-		virtual void CreateSectionGroupIfNotExists(const FRealtimeMeshSectionGroupKey& SectionGroupKey);
-		virtual void RemoveSectionGroup(const FRealtimeMeshSectionGroupKey& SectionGroupKey);
+		virtual void CreateSectionGroupIfNotExists(const FRealtimeMeshSectionGroupKey& SectionGroupKey, const FRealtimeMeshHandle& SectionGroupHandle);
+		virtual void RemoveSectionGroup(const FRealtimeMeshHandle& SectionGroupHandle);
 
 #if RHI_RAYTRACING
 		virtual FRayTracingGeometry* GetStaticRayTracingGeometry() const;
+
+		/* Identifies the static ray tracing geometry and its revision, changes whenever it's swapped, rebuilt or refit */
+		uint32 GetStaticRayTracingRevision() const;
 #endif
 		
 		virtual void UpdateCachedState(FRHICommandListBase& RHICmdList);
 		virtual void Reset();
 
 	protected:
-		void RebuildSectionGroupMap();
-
 		friend class FRealtimeMeshActiveSectionGroupIterator;
 	};
 
 	
 	FORCEINLINE FRealtimeMeshSectionGroupProxy* FRealtimeMeshActiveSectionGroupIterator::operator*() const
 	{
-		check(Proxy.SectionGroups.IsValidIndex(Iterator.GetIndex()));
+		check(Proxy.SectionGroups.IsAllocated(Iterator.GetIndex()));
 		return &Proxy.SectionGroups[Iterator.GetIndex()].Get();
 	}
 
 	FORCEINLINE FRealtimeMeshSectionGroupProxy& FRealtimeMeshActiveSectionGroupIterator::operator->() const
 	{
-		check(Proxy.SectionGroups.IsValidIndex(Iterator.GetIndex()));
+		check(Proxy.SectionGroups.IsAllocated(Iterator.GetIndex()));
 		return Proxy.SectionGroups[Iterator.GetIndex()].Get();
 	}
 }
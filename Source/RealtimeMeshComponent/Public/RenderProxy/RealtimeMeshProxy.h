@@ -75,7 +75,7 @@ namespace RealtimeMesh
 	};
 
 
-	
+	DECLARE_MULTICAST_DELEGATE(FRealtimeMeshStaticRayTracingChangedEvent);
 	
 	class REALTIMEMESHCOMPONENT_API FRealtimeMeshProxy : public TSharedFromThis<FRealtimeMeshProxy>
 	{		
@@ -88,6 +88,15 @@ namespace RealtimeMesh
 		FRealtimeMeshLODMask ActiveStaticLODMask;
 		FRealtimeMeshLODMask ActiveDynamicLODMask;
 
+		/* Bumped every time the cached render state changes, so consumers can tell when anything they built from it is stale. */
+		uint32 StateVersion = 0;
+
+#if RHI_RAYTRACING
+		/* Hash of the per LOD static ray tracing geometry revisions, so scene proxies only re-cache it when it actually changed. */
+		uint32 StaticRayTracingSignature = 0;
+#endif
+		FRealtimeMeshStaticRayTracingChangedEvent StaticRayTracingChangedEvent;
+
 		TUniquePtr<FDistanceFieldVolumeData> DistanceField;
 		TUniquePtr<FCardRepresentationData> CardRepresentation;
 
@@ -95,7 +104,7 @@ namespace RealtimeMesh
 
 		struct FCommandBatch
 		{
-			TArray<FRealtimeMeshProxyUpdateBuilder::TaskFunctionType> Tasks;
+			TArray<FRealtimeMeshProxyCommand> Commands;
 			TSharedPtr<FRealtimeMeshCommandBatchIntermediateFuture> ThreadState;
 		};
 		TMpscQueue<FCommandBatch> CommandQueue;
@@ -128,8 +137,17 @@ namespace RealtimeMesh
 
 		virtual ERHIFeatureLevel::Type GetRHIFeatureLevel() const;
 		FRealtimeMeshDrawMask GetDrawMask() const { return DrawMask; }
+		uint32 GetStateVersion() const { return StateVersion; }
+
+		/*
+		 *	Broadcast on the render thread when processing commands rebuilt, refit or re-segmented any geometry used for
+		 *	static ray tracing, or changed whether static ray tracing can be used at all. The scene caches the static
+		 *	ray tracing instances of every primitive using this mesh, so they have to be refreshed when this fires.
+		 */
+		FRealtimeMeshStaticRayTracingChangedEvent& OnStaticRayTracingChanged() { return StaticRayTracingChangedEvent; }
 		int32 GetFirstLODIndex() const { return ActiveLODMask.Find(true); }
 		int32 GetLastLODIndex() const { return ActiveLODMask.FindLast(true); }
+		bool IsLODActive(int32 LODIndex) const { return ActiveLODMask.IsValidIndex(LODIndex) && ActiveLODMask[LODIndex]; }
 		FRealtimeMeshActiveLODIterator GetActiveLODMaskIter() const { return FRealtimeMeshActiveLODIterator(*this, ActiveLODMask); }
 		FRealtimeMeshActiveLODIterator GetActiveStaticLODMaskIter() const { return FRealtimeMeshActiveLODIterator(*this, ActiveStaticLODMask); }
 		FRealtimeMeshActiveLODIterator GetActiveDynamicLODMaskIter() const { return FRealtimeMeshActiveLODIterator(*this, ActiveDynamicLODMask); }
@@ -164,7 +182,7 @@ namespace RealtimeMesh
 		virtual void SetCollisionRenderData(const FKAggregateGeom& InAggGeom, ECollisionTraceFlag InCollisionTraceFlag, const FCollisionResponseContainer& InCollisionResponse);
 #endif
 
-		void EnqueueCommandBatch(TArray<FRealtimeMeshProxyUpdateBuilder::TaskFunctionType>&& InTasks, const TSharedPtr<FRealtimeMeshCommandBatchIntermediateFuture>& ThreadState);
+		void EnqueueCommandBatch(TArray<FRealtimeMeshProxyCommand>&& InCommands, const TSharedPtr<FRealtimeMeshCommandBatchIntermediateFuture>& ThreadState);
 		void ProcessCommands(FRHICommandListBase& RHICmdList);
 		
 		virtual void UpdatedCachedState(FRHICommandListBase& RHICmdList);
@@ -4,6 +4,8 @@
 
 #include "RealtimeMeshCore.h"
 #include "RealtimeMeshSectionProxy.h"
+#include "RealtimeMeshGPUBuffer.h"
+#include "Core/RealtimeMeshSlotArray.h"
 
 
 namespace RealtimeMesh
@@ -21,18 +23,111 @@ namespace RealtimeMesh
 		void FinalizeGameThread();
 	};
 
+	enum class ERealtimeMeshProxyCommandType : uint8
+	{
+		// Opaque task run against its target
+		Task,
+		CreateSectionGroup,
+		RemoveSectionGroup,
+		CreateOrUpdateStream,
+		RemoveStream,
+	};
+
+	enum class ERealtimeMeshProxyCommandTarget : uint8
+	{
+		Mesh,
+		LOD,
+		SectionGroup,
+		Section,
+	};
+
+	/*
+	 * Resolves command targets while a merged batch is executed on the render thread.
+	 * Section groups and sections are addressed by the slot handles their game thread counterparts were given, which
+	 * the proxies are placed at, so resolving a target is a slot array index and never touches the keys. A handle stops
+	 * resolving as soon as its section group or section is removed.
+	 */
+	struct REALTIMEMESHCOMPONENT_API FRealtimeMeshProxyCommandContext
+	{
+	private:
+		FRealtimeMeshProxy& Proxy;
+
+	public:
+		explicit FRealtimeMeshProxyCommandContext(FRealtimeMeshProxy& InProxy)
+			: Proxy(InProxy)
+		{ }
+
+		FRealtimeMeshProxy& GetProxy() const { return Proxy; }
+
+		FRealtimeMeshLODProxy* FindLOD(const FRealtimeMeshLODKey& LODKey) const;
+		FRealtimeMeshSectionGroupProxy* FindSectionGroup(const FRealtimeMeshLODKey& LODKey, const FRealtimeMeshHandle& SectionGroupHandle) const;
+		FRealtimeMeshSectionProxy* FindSection(const FRealtimeMeshLODKey& LODKey, const FRealtimeMeshHandle& SectionGroupHandle, const FRealtimeMeshHandle& SectionHandle) const;
+	};
+
+	/*
+	 * A single queued proxy mutation, addressed by the handles of the object it targets.
+	 * Keeping the target explicit lets pending batches be merged by Coalesce before anything runs on the render thread.
+	 * Keys are carried along only to create new proxies and for debugging.
+	 */
+	struct REALTIMEMESHCOMPONENT_API FRealtimeMeshProxyCommand
+	{
+		using FunctionType = TUniqueFunction<void(FRHICommandListBase&, FRealtimeMeshProxyCommandContext&)>;
+
+		ERealtimeMeshProxyCommandType Type = ERealtimeMeshProxyCommandType::Task;
+		ERealtimeMeshProxyCommandTarget Target = ERealtimeMeshProxyCommandTarget::Mesh;
+		FRealtimeMeshLODKey LODKey;
+		FRealtimeMeshSectionGroupKey SectionGroupKey;
+		FRealtimeMeshSectionKey SectionKey;
+		FRealtimeMeshHandle SectionGroupHandle;
+		FRealtimeMeshHandle SectionHandle;
+		FRealtimeMeshStreamKey StreamKey;
+		TSharedPtr<FRealtimeMeshSectionGroupStreamUpdateData> StreamData;
+		FunctionType Function;
+
+		static FRealtimeMeshProxyCommand MakeTask(FunctionType&& InFunction);
+		static FRealtimeMeshProxyCommand MakeTask(const FRealtimeMeshLODKey& InLODKey, FunctionType&& InFunction);
+		static FRealtimeMeshProxyCommand MakeTask(const FRealtimeMeshSectionGroupKey& InSectionGroupKey, const FRealtimeMeshHandle& InSectionGroupHandle, FunctionType&& InFunction);
+		static FRealtimeMeshProxyCommand MakeTask(const FRealtimeMeshSectionKey& InSectionKey, const FRealtimeMeshHandle& InSectionGroupHandle, const FRealtimeMeshHandle& InSectionHandle,
+		                                          FunctionType&& InFunction);
+		static FRealtimeMeshProxyCommand MakeCreateSectionGroup(const FRealtimeMeshSectionGroupKey& InSectionGroupKey, const FRealtimeMeshHandle& InSectionGroupHandle);
+		static FRealtimeMeshProxyCommand MakeRemoveSectionGroup(const FRealtimeMeshSectionGroupKey& InSectionGroupKey, const FRealtimeMeshHandle& InSectionGroupHandle);
+		static FRealtimeMeshProxyCommand MakeCreateOrUpdateStream(const FRealtimeMeshSectionGroupKey& InSectionGroupKey, const FRealtimeMeshHandle& InSectionGroupHandle,
+		                                                          const FRealtimeMeshSectionGroupStreamUpdateDataRef& InStreamData);
+		static FRealtimeMeshProxyCommand MakeRemoveStream(const FRealtimeMeshSectionGroupKey& InSectionGroupKey, const FRealtimeMeshHandle& InSectionGroupHandle,
+		                                                  const FRealtimeMeshStreamKey& InStreamKey);
+
+		/* Opaque mesh and LOD level tasks can touch anything, so nothing is merged across them */
+		bool IsMergeBarrier() const
+		{
+			return Type == ERealtimeMeshProxyCommandType::Task &&
+				(Target == ERealtimeMeshProxyCommandTarget::Mesh || Target == ERealtimeMeshProxyCommandTarget::LOD);
+		}
+
+		void Execute(FRHICommandListBase& RHICmdList, FRealtimeMeshProxyCommandContext& Context);
+
+		/*
+		 * Removes commands whose effect is fully overwritten by a later command in the same list, preserving the order of the rest.
+		 *  - Only the last create/update/remove of a given stream in a section group is kept
+		 *  - Everything targeting a section group (including its creation) before that section group is removed is dropped
+		 * Merging never crosses a merge barrier. Returns the number of commands removed.
+		 */
+		static int32 Coalesce(TArray<FRealtimeMeshProxyCommand>& Commands);
+	};
+
 	struct REALTIMEMESHCOMPONENT_API FRealtimeMeshProxyUpdateBuilder
 	{
 	public:
 		using TaskFunctionType = TUniqueFunction<void(FRHICommandListBase&, FRealtimeMeshProxy&)>;
 	private:
-		TArray<TaskFunctionType> Tasks;
+		TArray<FRealtimeMeshProxyCommand> Commands;
 		TOptional<bool> bNewHasNaniteData;
 		uint32 bRequiresProxyRecreate : 1;
+		uint32 bRequiresStaticMeshUpdate : 1;
 		uint32 bIsIgnoringCommands : 1;
 	public:
 		FRealtimeMeshProxyUpdateBuilder(bool bShouldIgnoreCommands = false)
 			: bRequiresProxyRecreate(false)
+			, bRequiresStaticMeshUpdate(false)
 			, bIsIgnoringCommands(bShouldIgnoreCommands)
 		{ }
 		UE_NONCOPYABLE(FRealtimeMeshProxyUpdateBuilder);
@@ -44,9 +139,26 @@ namespace RealtimeMesh
 
 		void MarkForProxyRecreate() { bRequiresProxyRecreate = true; }
 		void ClearProxyRecreate() { bRequiresProxyRecreate = false; }
+		bool RequiresProxyRecreate() const { return bRequiresProxyRecreate; }
+
+		/*
+		 * Marks that cached static mesh draw commands need to be rebuilt, without recreating the scene proxy.
+		 * Used for in place changes to Static draw type section groups, like visibility, shadow, material slot, or stream updates.
+		 */
+		void MarkForStaticMeshUpdate() { bRequiresStaticMeshUpdate = true; }
+		bool RequiresStaticMeshUpdate() const { return bRequiresStaticMeshUpdate; }
 
 		void SetHasNaniteData(bool bHasNaniteData) { bNewHasNaniteData = bHasNaniteData; }
 
+		void AddCommand(FRealtimeMeshProxyCommand&& Command, bool bInRequiresProxyRecreate = true);
+
+		void AddCreateSectionGroupCommand(const FRealtimeMeshSectionGroupKey& SectionGroupKey, const FRealtimeMeshHandle& SectionGroupHandle, bool bInRequiresProxyRecreate = true);
+		void AddRemoveSectionGroupCommand(const FRealtimeMeshSectionGroupKey& SectionGroupKey, const FRealtimeMeshHandle& SectionGroupHandle, bool bInRequiresProxyRecreate = true);
+		void AddCreateOrUpdateStreamCommand(const FRealtimeMeshSectionGroupKey& SectionGroupKey, const FRealtimeMeshHandle& SectionGroupHandle,
+		                                    const FRealtimeMeshSectionGroupStreamUpdateDataRef& StreamData, bool bInRequiresProxyRecreate = true);
+		void AddRemoveStreamCommand(const FRealtimeMeshSectionGroupKey& SectionGroupKey, const FRealtimeMeshHandle& SectionGroupHandle, const FRealtimeMeshStreamKey& StreamKey,
+		                            bool bInRequiresProxyRecreate = true);
+
 		void AddMeshTask(TUniqueFunction<void(FRHICommandListBase&, FRealtimeMeshProxy&)>&& Function, bool bInRequiresProxyRecreate = true);
 
 		template <typename MeshType>
@@ -69,25 +181,27 @@ namespace RealtimeMesh
 			}, bInRequiresProxyRecreate);
 		}
 
-		void AddSectionGroupTask(const FRealtimeMeshSectionGroupKey& SectionGroupKey, TUniqueFunction<void(FRHICommandListBase&, FRealtimeMeshSectionGroupProxy&)>&& Function,
-		                         bool bInRequiresProxyRecreate = true);
+		void AddSectionGroupTask(const FRealtimeMeshSectionGroupKey& SectionGroupKey, const FRealtimeMeshHandle& SectionGroupHandle,
+		                         TUniqueFunction<void(FRHICommandListBase&, FRealtimeMeshSectionGroupProxy&)>&& Function, bool bInRequiresProxyRecreate = true);
 
 		template <typename SectionGroupProxyType>
-		void AddSectionGroupTask(const FRealtimeMeshSectionGroupKey& SectionGroupKey, TUniqueFunction<void(FRHICommandListBase&, SectionGroupProxyType&)>&& Function,
-		                         bool bInRequiresProxyRecreate = true)
+		void AddSectionGroupTask(const FRealtimeMeshSectionGroupKey& SectionGroupKey, const FRealtimeMeshHandle& SectionGroupHandle,
+		                         TUniqueFunction<void(FRHICommandListBase&, SectionGroupProxyType&)>&& Function, bool bInRequiresProxyRecreate = true)
 		{
-			AddSectionGroupTask(SectionGroupKey, [Func = MoveTemp(Function)](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& SectionGroup)
+			AddSectionGroupTask(SectionGroupKey, SectionGroupHandle, [Func = MoveTemp(Function)](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& SectionGroup)
 			{
 				Func(RHICmdList, static_cast<SectionGroupProxyType&>(SectionGroup));
 			}, bInRequiresProxyRecreate);
 		}
 
-		void AddSectionTask(const FRealtimeMeshSectionKey& SectionKey, TUniqueFunction<void(FRHICommandListBase&, FRealtimeMeshSectionProxy&)>&& Function, bool bInRequiresProxyRecreate = true);
+		void AddSectionTask(const FRealtimeMeshSectionKey& SectionKey, const FRealtimeMeshHandle& SectionGroupHandle, const FRealtimeMeshHandle& SectionHandle,
+		                    TUniqueFunction<void(FRHICommandListBase&, FRealtimeMeshSectionProxy&)>&& Function, bool bInRequiresProxyRecreate = true);
 
 		template <typename SectionProxyType>
-		void AddSectionTask(const FRealtimeMeshSectionKey& SectionKey, TUniqueFunction<void(FRHICommandListBase&, SectionProxyType&)>&& Function, bool bInRequiresProxyRecreate = true)
+		void AddSectionTask(const FRealtimeMeshSectionKey& SectionKey, const FRealtimeMeshHandle& SectionGroupHandle, const FRealtimeMeshHandle& SectionHandle,
+		                    TUniqueFunction<void(FRHICommandListBase&, SectionProxyType&)>&& Function, bool bInRequiresProxyRecreate = true)
 		{
-			AddSectionTask(SectionKey, [Func = MoveTemp(Function)](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionProxy& Section)
+			AddSectionTask(SectionKey, SectionGroupHandle, SectionHandle, [Func = MoveTemp(Function)](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionProxy& Section)
 			{
 				Func(RHICmdList, static_cast<SectionProxyType&>(Section));
 			}, bInRequiresProxyRecreate);
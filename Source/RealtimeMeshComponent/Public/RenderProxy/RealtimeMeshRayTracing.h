@@ -0,0 +1,109 @@
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#pragma once
+
+#include "RealtimeMeshCore.h"
+#include "Core/RealtimeMeshDataStream.h"
+#include "Core/RealtimeMeshStreamRange.h"
+
+namespace RealtimeMesh
+{
+	enum class ERealtimeMeshRayTracingUpdateAction : uint8
+	{
+		/* Existing geometry, if any, is still correct */
+		None,
+		/* Update the existing acceleration structure in place for the new vertex positions */
+		Refit,
+		/* Release any existing geometry and build it from scratch */
+		Rebuild,
+		/* Release the existing geometry, nothing should be traced */
+		Release,
+	};
+
+	/* What is known about the currently built ray tracing geometry */
+	struct FRealtimeMeshRayTracingBuildState
+	{
+		bool bHasValidGeometry = false;
+		bool bGeometryAllowsUpdate = false;
+		int32 NumRefitsSinceBuild = 0;
+	};
+
+	/* What changed since the geometry was last built or refit */
+	struct FRealtimeMeshRayTracingUpdateRequest
+	{
+		bool bShouldHaveGeometry = false;
+
+		/* Index data, vertex count or segment layout changed, which a refit can't handle */
+		bool bTopologyChanged = false;
+
+		/* Vertex positions changed with the same vertex count */
+		bool bVerticesChanged = false;
+
+		/* Build quality or refit setting changed */
+		bool bBuildSettingsChanged = false;
+
+		bool bAllowRefit = false;
+
+		/* Refits allowed before forcing a full rebuild to restore trace quality, 0 or less for no limit */
+		int32 MaxRefitsBeforeRebuild = 0;
+	};
+
+	struct REALTIMEMESHCOMPONENT_API FRealtimeMeshRayTracingUpdatePolicy
+	{
+		static ERealtimeMeshRayTracingUpdateAction Decide(const FRealtimeMeshRayTracingBuildState& State, const FRealtimeMeshRayTracingUpdateRequest& Request);
+	};
+
+	/* One source range of indices and where it landed in the compacted index list */
+	struct FRealtimeMeshRayTracingIndexSpan
+	{
+		int32 SourceFirstIndex = 0;
+		int32 NumIndices = 0;
+		int32 CompactedFirstIndex = 0;
+
+		bool IsSameSource(const FRealtimeMeshRayTracingIndexSpan& Other) const
+		{
+			return SourceFirstIndex == Other.SourceFirstIndex && NumIndices == Other.NumIndices;
+		}
+	};
+
+	/*
+	 * Packs the index ranges of the visible sections of a section group into one gap free 32 bit index list.
+	 * Ray tracing geometry can't skip over triangles of hidden sections, so groups whose visible sections
+	 * don't cover one contiguous block of the index buffer trace against this instead.
+	 * Spans that are unchanged at the start and end of the list are kept between updates, so showing,
+	 * hiding or resizing one section only gathers the indices of the spans that actually changed.
+	 */
+	class REALTIMEMESHCOMPONENT_API FRealtimeMeshRayTracingIndexCompactor
+	{
+	private:
+		TArray<uint32> Indices;
+		TArray<FRealtimeMeshRayTracingIndexSpan> Spans;
+		int32 NumIndicesGatheredLastUpdate = 0;
+
+	public:
+		/*
+		 * Brings the compacted indices up to date with the given ranges, in the order given.
+		 * bSourceChanged must be set whenever the contents of the index stream changed since the last update.
+		 * Returns whether the compacted indices changed.
+		 */
+		bool Update(const FRealtimeMeshStream& IndexStream, TConstArrayView<FRealtimeMeshStreamRange> Ranges, bool bSourceChanged);
+
+		void Reset();
+
+		/*
+		 * Whether the ranges, taken as a set, cover one block of indices with no gaps, so there's nothing to compact.
+		 * Ranges without a whole triangle are ignored, and no ranges at all counts as contiguous.
+		 */
+		static bool AreRangesContiguous(TConstArrayView<FRealtimeMeshStreamRange> Ranges);
+
+		TConstArrayView<uint32> GetIndices() const { return Indices; }
+		TConstArrayView<FRealtimeMeshRayTracingIndexSpan> GetSpans() const { return Spans; }
+		int32 Num() const { return Indices.Num(); }
+
+		/* How many indices the last update had to read from the source stream, the rest were kept or moved */
+		int32 GetNumIndicesGatheredLastUpdate() const { return NumIndicesGatheredLastUpdate; }
+
+	private:
+		void GatherSpans(const FRealtimeMeshStream& IndexStream, TConstArrayView<FRealtimeMeshRayTracingIndexSpan> SpansToGather);
+	};
+}
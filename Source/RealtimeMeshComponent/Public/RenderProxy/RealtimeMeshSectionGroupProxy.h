@@ -7,11 +7,24 @@
 #include "RealtimeMeshVertexFactory.h"
 #include "RealtimeMeshSectionProxy.h"
 #include "Core/RealtimeMeshSectionGroupConfig.h"
+#include "Core/RealtimeMeshSlotArray.h"
+#include "RealtimeMeshRayTracing.h"
 
 namespace RealtimeMesh
 {
 	using FRealtimeMeshSectionMask = TBitArray<TInlineAllocator<1>>;
 
+	/* One mesh batch worth of a section group, either a single section or a run of merged adjacent sections */
+	struct FRealtimeMeshSectionDrawRange
+	{
+		/* Section that sets up the batch, the first of the run when merged */
+		FRealtimeMeshHandle SectionHandle;
+		FRealtimeMeshStreamRange StreamRange;
+		FRealtimeMeshDrawMask DrawMask;
+		int32 MaterialSlot = 0;
+		int32 NumSections = 1;
+	};
+
 	class FRealtimeMeshActiveSectionIterator
 	{
 	private:
@@ -67,12 +80,30 @@ namespace RealtimeMesh
 		const FRealtimeMeshSectionGroupKey Key;
 		FRealtimeMeshSectionGroupConfig Config;
 		TSharedPtr<FRealtimeMeshVertexFactory> VertexFactory;
-		TArray<FRealtimeMeshSectionProxyRef> Sections;
-		TMap<FRealtimeMeshSectionKey, uint32> SectionMap;
+		// Sections sit at the handles the game thread section group gave them, the map only serves lookups by key
+		TRealtimeMeshSlotArray<FRealtimeMeshSectionProxyRef> Sections;
+		TMap<FRealtimeMeshSectionKey, FRealtimeMeshHandle> SectionMap;
 		FRealtimeMeshSectionMask ActiveSectionMask;
+		TArray<FRealtimeMeshSectionDrawRange> DrawRanges;
 		FRealtimeMeshStreamProxyMap Streams;
+
+		// Degenerate triangles the size of the index stream, static batches of masked off passes draw these instead
+		FBufferRHIRef MaskedIndexBuffer;
 #if RHI_RAYTRACING
 		FRayTracingGeometry RayTracingGeometry;
+		FRealtimeMeshRayTracingBuildState RayTracingBuildState;
+
+		// CPU copy of the index stream, only kept while the sections aren't contiguous in it and need compacting for ray tracing
+		TSharedPtr<const FRealtimeMeshStream> RayTracingIndexSource;
+		FRealtimeMeshRayTracingIndexCompactor RayTracingIndexCompactor;
+		FBufferRHIRef RayTracingCompactedIndexBuffer;
+
+		// Section each ray tracing geometry segment was built from, in segment order
+		TArray<FRealtimeMeshHandle> RayTracingSegmentSections;
+		bool bRayTracingIndexSourceChanged = false;
+
+		// Bumped whenever the ray tracing geometry is built, refit, released or its segments map to different sections
+		uint32 RayTracingRevision = 0;
 #endif
 
 		FRealtimeMeshDrawMask DrawMask;
@@ -90,32 +121,64 @@ namespace RealtimeMesh
 		FRealtimeMeshDrawMask GetDrawMask() const { return DrawMask; }
 		FRealtimeMeshActiveSectionIterator GetActiveSectionMaskIter() const { return FRealtimeMeshActiveSectionIterator(*this, ActiveSectionMask); }
 
+		/*
+		 * Batches to draw for the active sections, merged where the config allows it. Static groups also keep a range for
+		 * each hidden section that has geometry, its DrawMask says which passes the section's pass index buffers mask off.
+		 */
+		TConstArrayView<FRealtimeMeshSectionDrawRange> GetDrawRanges() const { return DrawRanges; }
+
 		FRealtimeMeshSectionProxyPtr GetSection(const FRealtimeMeshSectionKey& SectionKey) const;
+		FRealtimeMeshSectionProxyPtr GetSection(const FRealtimeMeshHandle& SectionHandle) const;
+		FRealtimeMeshHandle FindSectionHandle(const FRealtimeMeshSectionKey& SectionKey) const;
 		TSharedPtr<FRealtimeMeshGPUBuffer> GetStream(const FRealtimeMeshStreamKey& StreamKey) const;
 
 #if RHI_RAYTRACING
 		const FRayTracingGeometry* GetRayTracingGeometry() const { return &RayTracingGeometry; }
+
+		/* Index of the ray tracing geometry segment built from this section, or INDEX_NONE */
+		int32 GetRayTracingSegmentIndex(const FRealtimeMeshHandle& SectionHandle) const { return RayTracingSegmentSections.IndexOfByKey(SectionHandle); }
+
+		/* Changes every time the ray tracing geometry, or the sections its segments came from, changes */
+		uint32 GetRayTracingRevision() const { return RayTracingRevision; }
 #endif
 		
 		FRayTracingGeometry* GetRayTracingGeometry();
 
 		virtual void UpdateConfig(const FRealtimeMeshSectionGroupConfig& NewConfig);
 		
-		virtual void CreateSectionIfNotExists(const FRealtimeMeshSectionKey& SectionKey);
-		virtual void RemoveSection(const FRealtimeMeshSectionKey& SectionKey);
+		virtual void CreateSectionIfNotExists(const FRealtimeMeshSectionKey& SectionKey, const FRealtimeMeshHandle& SectionHandle);
+		virtual void RemoveSection(const FRealtimeMeshHandle& SectionHandle);
 
 		virtual void CreateOrUpdateStream(FRHICommandListBase& RHICmdList, const FRealtimeMeshSectionGroupStreamUpdateDataRef& InStream);
 		virtual void RemoveStream(const FRealtimeMeshStreamKey& StreamKey);
 
+		/*
+		 * Gives the proxy a CPU copy of the index stream to compact for ray tracing. The copy that comes with a triangle
+		 * stream update is dropped while the sections are contiguous, so a section change that opens up gaps later sends one.
+		 */
+		void SetRayTracingIndexSource(const TSharedRef<const FRealtimeMeshStream>& InIndexSource);
+
 		virtual bool InitializeMeshBatch(FMeshBatch& MeshBatch, FRealtimeMeshResourceReferenceList& Resources, bool bIsLocalToWorldDeterminantNegative, bool bWantsDepthOnly) const;
 
 		virtual void UpdateCachedState(FRHICommandListBase& RHICmdList);
 		virtual void Reset();
 
+		/*
+		 * Collapses runs of ranges that share a material slot and draw mask and whose index ranges directly follow
+		 * each other into a single range. Output is ordered by material slot, then by first index.
+		 */
+		static void MergeDrawRanges(TArray<FRealtimeMeshSectionDrawRange>& InOutDrawRanges);
+
+		/*
+		 * Whether the static batches emitted for these draw ranges map 1:1 onto the ray tracing geometry segments
+		 * built from these sections, which the scene requires to cache the geometry as a static ray tracing instance.
+		 * Merged draw ranges, or sections that draw without being traced, need the dynamic ray tracing path instead.
+		 */
+		static bool CanDrawRangesUseStaticRayTracing(TConstArrayView<FRealtimeMeshSectionDrawRange> InDrawRanges, TConstArrayView<FRealtimeMeshHandle> InSegmentSections);
+
 	protected:
 		virtual bool UpdateRayTracingInfo(FRHICommandListBase& RHICmdList);
-
-		void RebuildSectionMap();
+		virtual void UpdatePassIndexBuffers(FRHICommandListBase& RHICmdList);
 
 		friend class FRealtimeMeshActiveSectionIterator;
 	};	
@@ -123,13 +186,13 @@ namespace RealtimeMesh
 	
 	FORCEINLINE FRealtimeMeshSectionProxy* FRealtimeMeshActiveSectionIterator::operator*() const
 	{
-		check(Proxy.Sections.IsValidIndex(Iterator.GetIndex()));
+		check(Proxy.Sections.IsAllocated(Iterator.GetIndex()));
 		return &Proxy.Sections[Iterator.GetIndex()].Get();
 	}
 
 	FORCEINLINE FRealtimeMeshSectionProxy& FRealtimeMeshActiveSectionIterator::operator->() const
 	{
-		check(Proxy.Sections.IsValidIndex(Iterator.GetIndex()));
+		check(Proxy.Sections.IsAllocated(Iterator.GetIndex()));
 		return Proxy.Sections[Iterator.GetIndex()].Get();
 	}
 }
@@ -4,6 +4,7 @@
 
 #include "RealtimeMeshCore.h"
 #include "RealtimeMeshProxyShared.h"
+#include "RealtimeMeshGPUBuffer.h"
 #include "Core/RealtimeMeshKeys.h"
 #include "Core/RealtimeMeshSectionConfig.h"
 #include "Core/RealtimeMeshStreamRange.h"
@@ -19,7 +20,12 @@ namespace RealtimeMesh
 		FRealtimeMeshStreamRange StreamRange;
 		FRealtimeMeshDrawMask DrawMask;
 
+		// What the static batches of a static section group draw through, so hiding the section only masks them
+		TSharedPtr<FRealtimeMeshPassIndexBuffer> MainPassIndexBuffer;
+		TSharedPtr<FRealtimeMeshPassIndexBuffer> ShadowPassIndexBuffer;
+
 		bool bRangeChanged;
+		bool bHasValidMeshData;
 
 	public:
 		FRealtimeMeshSectionProxy(const FRealtimeMeshSharedResourcesRef& InSharedResources, const FRealtimeMeshSectionKey InKey);
@@ -32,11 +38,26 @@ namespace RealtimeMesh
 		FRealtimeMeshDrawMask GetDrawMask() const { return DrawMask; }
 
 		bool IsRangeDirty() const { return bRangeChanged; }
+
+		/* Whether the range has geometry the vertex factory can draw, regardless of whether the section is visible */
+		bool HasValidMeshData() const { return bHasValidMeshData; }
+
+		TSharedPtr<FRealtimeMeshPassIndexBuffer> GetMainPassIndexBuffer() const { return MainPassIndexBuffer; }
+		TSharedPtr<FRealtimeMeshPassIndexBuffer> GetShadowPassIndexBuffer() const { return ShadowPassIndexBuffer; }
+
+		/*
+		 * Points the pass index buffers at the group's indices for the passes PassMask draws and at MaskedIndexBuffer
+		 * for the rest. PassMask is the mask of the draw range this section leads.
+		 */
+		virtual void UpdatePassIndexBuffers(FRHICommandListBase& RHICmdList, const FRealtimeMeshDrawMask& PassMask, const FBufferRHIRef& IndexBuffer, const FBufferRHIRef& MaskedIndexBuffer);
 		
 		virtual void UpdateConfig(const FRealtimeMeshSectionConfig& NewConfig);
 		virtual void UpdateStreamRange(const FRealtimeMeshStreamRange& NewStreamRange);
 		
 		virtual bool InitializeMeshBatch(FMeshBatch& MeshBatch, FRHIUniformBuffer* PrimitiveUniformBuffer) const;
+
+		/* Sets up the batch to draw DrawRange instead of this section's own range, used when adjacent sections are merged into one batch */
+		virtual bool InitializeMeshBatchForRange(FMeshBatch& MeshBatch, FRHIUniformBuffer* PrimitiveUniformBuffer, const FRealtimeMeshStreamRange& DrawRange) const;
 		
 		
 		virtual void UpdateCachedState(FRealtimeMeshSectionGroupProxy& ParentGroup);
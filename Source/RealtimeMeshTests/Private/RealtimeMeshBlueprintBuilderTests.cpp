@@ -0,0 +1,136 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Mesh/RealtimeMeshBlueprintMeshBuilder.h"
+#include "Interface/Core/RealtimeMeshDataStream.h"
+
+using namespace RealtimeMesh;
+
+// =====================================================================================================================
+// Blueprint Stream Bulk Array Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBlueprintStreamBulkArrayTest,
+	"RealtimeMeshComponent.BlueprintBuilder.Stream.BulkArrays",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FBlueprintStreamBulkArrayTest::RunTest(const FString& Parameters)
+{
+	URealtimeMeshStream* PerElement = NewObject<URealtimeMeshStream>();
+	PerElement->Initialize(FRealtimeMeshStreams::TexCoords, ERealtimeMeshSimpleStreamType::HalfVector2, 2);
+	URealtimeMeshStream* Bulk = NewObject<URealtimeMeshStream>();
+	Bulk->Initialize(FRealtimeMeshStreams::TexCoords, ERealtimeMeshSimpleStreamType::HalfVector2, 2);
+
+	TArray<FVector2D> Channel0;
+	TArray<FVector2D> Channel1;
+	for (int32 Index = 0; Index < 100; Index++)
+	{
+		Channel0.Add(FVector2D(Index * 0.25, 1.0 - Index * 0.5));
+		Channel1.Add(FVector2D(-Index * 0.125, Index));
+	}
+
+	URealtimeMeshStream* Builder = nullptr;
+	FRealtimeMeshStreamRowPtr Row;
+	for (int32 Index = 0; Index < Channel0.Num(); Index++)
+	{
+		PerElement->AddZeroed(Builder, Row, 1);
+		URealtimeMeshStreamUtils::SetVector2Element(Row, Index, 0, Channel0[Index]);
+		URealtimeMeshStreamUtils::SetVector2Element(Row, Index, 1, Channel1[Index]);
+	}
+
+	TestEqual(TEXT("Append returns first row"), Bulk->AppendVector2Array(Builder, Channel0, 0), 0);
+	TestEqual(TEXT("Set returns first row"), Bulk->SetVector2Array(Builder, 0, Channel1, 1), 0);
+	TestEqual(TEXT("Bulk stream has all rows"), Bulk->GetNum(Builder), Channel0.Num());
+
+	const TArray<FVector2D> Expected0 = PerElement->GetVector2Array(Builder, 0, -1, 0);
+	const TArray<FVector2D> Expected1 = PerElement->GetVector2Array(Builder, 0, -1, 1);
+	TestTrue(TEXT("Channel 0 matches per-element"), Expected0 == Bulk->GetVector2Array(Builder, 0, -1, 0));
+	TestTrue(TEXT("Channel 1 matches per-element"), Expected1 == Bulk->GetVector2Array(Builder, 0, -1, 1));
+	TestTrue(TEXT("Raw stream data matches per-element"),
+		FMemory::Memcmp(PerElement->GetStream().GetData(), Bulk->GetStream().GetData(), PerElement->GetStream().GetResourceDataSize()) == 0);
+
+	// Ranges
+	TestEqual(TEXT("Range read count"), Bulk->GetVector2Array(Builder, 90, 20, 0).Num(), 10);
+	TestEqual(TEXT("Out of range start fails"), Bulk->SetVector2Array(Builder, 101, Channel0, 0), INDEX_NONE);
+	TestEqual(TEXT("Out of range element fails"), Bulk->SetVector2Array(Builder, 0, Channel0, 2), INDEX_NONE);
+
+	return true;
+}
+
+// =====================================================================================================================
+// Blueprint Local Builder Bulk Array Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBlueprintLocalBuilderBulkArrayTest,
+	"RealtimeMeshComponent.BlueprintBuilder.LocalBuilder.BulkArrays",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FBlueprintLocalBuilderBulkArrayTest::RunTest(const FString& Parameters)
+{
+	// Large enough to be split across multiple batches by the parallel conversion
+	constexpr int32 NumVerts = 40000;
+
+	TArray<FVector> Positions;
+	TArray<FVector> Normals;
+	TArray<FVector> Tangents;
+	TArray<FLinearColor> Colors;
+	TArray<FVector2D> UV0;
+	TArray<int32> Triangles;
+	TArray<int32> PolyGroups;
+	for (int32 Index = 0; Index < NumVerts; Index++)
+	{
+		Positions.Add(FVector(Index, Index * 2.0, -Index));
+		Normals.Add(FVector::UnitZ());
+		Tangents.Add(FVector::UnitX());
+		Colors.Add(FLinearColor(Index % 7 / 7.0f, 0.5f, 1.0f, 1.0f));
+		UV0.Add(FVector2D(Index % 64 / 64.0, Index % 32 / 32.0));
+	}
+	for (int32 Index = 0; Index + 2 < NumVerts; Index += 3)
+	{
+		Triangles.Append({ Index, Index + 1, Index + 2 });
+		PolyGroups.Add(Index % 3);
+	}
+
+	URealtimeMeshLocalBuilder* PerElement = NewObject<URealtimeMeshStreamSet>()->MakeLocalMeshBuilder(
+		ERealtimeMeshSimpleStreamConfig::Normal, ERealtimeMeshSimpleStreamConfig::Normal, true, ERealtimeMeshSimpleStreamConfig::Normal);
+	URealtimeMeshLocalBuilder* Bulk = NewObject<URealtimeMeshStreamSet>()->MakeLocalMeshBuilder(
+		ERealtimeMeshSimpleStreamConfig::Normal, ERealtimeMeshSimpleStreamConfig::Normal, true, ERealtimeMeshSimpleStreamConfig::Normal);
+
+	URealtimeMeshLocalBuilder* Builder = nullptr;
+	for (int32 Index = 0; Index < NumVerts; Index++)
+	{
+		FRealtimeMeshBasicVertex Vertex;
+		Vertex.Position = Positions[Index];
+		Vertex.Normal = Normals[Index];
+		Vertex.Tangent = Tangents[Index];
+		Vertex.Binormal = FVector::ZeroVector;
+		Vertex.Color = Colors[Index];
+		Vertex.UV0 = UV0[Index];
+		PerElement->AddVertex(Builder, Vertex);
+	}
+	for (int32 Index = 0; Index < PolyGroups.Num(); Index++)
+	{
+		PerElement->AddTriangle(Builder, Triangles[Index * 3], Triangles[Index * 3 + 1], Triangles[Index * 3 + 2], PolyGroups[Index]);
+	}
+
+	TestEqual(TEXT("AppendPositions"), Bulk->AppendPositions(Builder, Positions), 0);
+	TestEqual(TEXT("SetNormalsAndTangents"), Bulk->SetNormalsAndTangents(Builder, 0, Normals, Tangents), 0);
+	TestEqual(TEXT("SetColors"), Bulk->SetColors(Builder, 0, Colors), 0);
+	TestEqual(TEXT("SetTexCoords"), Bulk->SetTexCoords(Builder, 0, UV0, 0), 0);
+	TestEqual(TEXT("AppendTriangles"), Bulk->AppendTriangles(Builder, Triangles, PolyGroups), 0);
+	TestEqual(TEXT("Mismatched triangle count fails"), Bulk->AppendTriangles(Builder, { 0, 1 }, {}), INDEX_NONE);
+
+	const FRealtimeMeshStreamSet& ExpectedStreams = PerElement->GetStreamSet();
+	const FRealtimeMeshStreamSet& ActualStreams = Bulk->GetStreamSet();
+	for (const FRealtimeMeshStreamKey& StreamKey : { FRealtimeMeshStreams::Position, FRealtimeMeshStreams::Tangents, FRealtimeMeshStreams::Color,
+		FRealtimeMeshStreams::TexCoords, FRealtimeMeshStreams::Triangles, FRealtimeMeshStreams::PolyGroups })
+	{
+		const FRealtimeMeshStream& Expected = ExpectedStreams.FindChecked(StreamKey);
+		const FRealtimeMeshStream& Actual = ActualStreams.FindChecked(StreamKey);
+		TestEqual(*FString::Printf(TEXT("%s num"), *StreamKey.ToString()), Actual.Num(), Expected.Num());
+		TestTrue(*FString::Printf(TEXT("%s matches per-element"), *StreamKey.ToString()),
+			Actual.Num() == Expected.Num() && FMemory::Memcmp(Actual.GetData(), Expected.GetData(), Expected.GetResourceDataSize()) == 0);
+	}
+
+	return true;
+}
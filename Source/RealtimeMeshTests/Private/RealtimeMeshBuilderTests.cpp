@@ -1,9 +1,10 @@
-// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
 
 #include "Misc/AutomationTest.h"
 #include "Interface/Core/RealtimeMeshBuilder.h"
 #include "Interface/Core/RealtimeMeshDataStream.h"
 #include "Interface/Core/RealtimeMeshDataTypes.h"
+#include "Async/ParallelFor.h"
 
 using namespace RealtimeMesh;
 
@@ -1045,3 +1046,102 @@ bool FVertexBuilderSetTangentsTest::RunTest(const FString& Parameters)
 
 	return true;
 }
+
+// =====================================================================================================================
+// Stream View Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamViewDirectTest,
+	"RealtimeMeshComponent.Builder.StreamView.Direct",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamViewDirectTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshStreamSet StreamSet;
+	TRealtimeMeshBuilderLocal<uint32> Builder(StreamSet);
+	Builder.EnableColors();
+	Builder.SetNumVertices(1000);
+
+	{
+		TRealtimeMeshStreamView<FVector3f> Positions = Builder.GetPositionView();
+		TestTrue(TEXT("Matching layout aliases the stream"), Positions.IsDirect());
+		TestEqual(TEXT("View covers every vertex"), Positions.Num(), 1000);
+		TestTrue(TEXT("View points at stream memory"), reinterpret_cast<const uint8*>(Positions.GetData()) == StreamSet.FindChecked(FRealtimeMeshStreams::Position).GetData());
+
+		ParallelFor(Positions.Num(), [&](int32 Index)
+		{
+			Positions[Index] = FVector3f(Index, Index * 2, Index * 3);
+		});
+	}
+
+	{
+		TRealtimeMeshStreamView<const FColor> Colors = Builder.GetColorView<const FColor>();
+		TestTrue(TEXT("Const view over matching layout aliases the stream"), Colors.IsDirect());
+	}
+
+	TestEqual(TEXT("Writes through the view land in the stream"), Builder.GetPosition(999), FVector3f(999, 1998, 2997));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamViewConvertedTest,
+	"RealtimeMeshComponent.Builder.StreamView.Converted",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamViewConvertedTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshStreamSet StreamSet;
+	TRealtimeMeshBuilderLocal<uint16, FPackedNormal, FVector2DHalf, 2> Builder(StreamSet);
+	Builder.EnableTexCoords();
+	Builder.SetNumVertices(1000);
+	Builder.SetNumTriangles(10);
+	for (int32 Index = 0; Index < 1000; Index++)
+	{
+		Builder.SetTexCoord(Index, 0, FVector2f(1.0f, 1.0f));
+	}
+
+	{
+		// Second channel of a half precision, two channel stream, viewed as full precision
+		TRealtimeMeshStreamView<FVector2f> TexCoords = Builder.GetTexCoordView(1);
+		TestFalse(TEXT("Mismatched layout goes through a converted copy"), TexCoords.IsDirect());
+		TestEqual(TEXT("View covers every vertex"), TexCoords.Num(), 1000);
+
+		ParallelFor(TexCoords.Num(), [&](int32 Index)
+		{
+			TexCoords[Index] = FVector2f(Index / 1024.0f, 0.5f);
+		});
+	}
+
+	for (int32 Index = 0; Index < 1000; Index += 97)
+	{
+		TestTrue(TEXT("Channel 1 written back on destruction"), Builder.GetTexCoord(Index, 1) == FVector2f(Index / 1024.0f, 0.5f));
+		TestTrue(TEXT("Channel 0 left untouched"), Builder.GetTexCoord(Index, 0) == FVector2f(1.0f, 1.0f));
+	}
+
+	{
+		TRealtimeMeshStreamView<TIndex3<uint32>> Triangles = Builder.GetTriangleView();
+		TestFalse(TEXT("16 bit triangles are widened"), Triangles.IsDirect());
+		for (int32 Index = 0; Index < Triangles.Num(); Index++)
+		{
+			Triangles[Index] = TIndex3<uint32>(Index * 3, Index * 3 + 1, Index * 3 + 2);
+		}
+		Triangles.Commit();
+		TestTrue(TEXT("Commit writes back before destruction"), Builder.GetTriangle(9) == TIndex3<uint32>(27, 28, 29));
+
+		// Once committed the view no longer holds the stream, so it can be resized and edited before the view goes away
+		Builder.SetNumTriangles(12);
+		Builder.SetTriangle(9, TIndex3<uint32>(1, 2, 3));
+	}
+	TestTrue(TEXT("A committed view isn't written back again on destruction"), Builder.GetTriangle(9) == TIndex3<uint32>(1, 2, 3));
+
+	{
+		TRealtimeMeshStreamView<TIndex3<uint32>> Triangles = Builder.GetTriangleView();
+		Triangles[0] = TIndex3<uint32>(4, 5, 6);
+		Triangles.Commit();
+		Triangles[0] = TIndex3<uint32>(7, 8, 9);
+		Triangles.MarkDirty();
+	}
+	TestTrue(TEXT("Writes after a commit land once the view is marked dirty"), Builder.GetTriangle(0) == TIndex3<uint32>(7, 8, 9));
+
+	return true;
+}
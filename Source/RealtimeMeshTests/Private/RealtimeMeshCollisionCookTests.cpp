@@ -0,0 +1,646 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "RealtimeMeshCore.h"
+#include "RealtimeMeshCollisionLibrary.h"
+#include "Data/RealtimeMeshCollisionCookScheduler.h"
+#include "Core/RealtimeMeshBuilder.h"
+#include "Chaos/Convex.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "PhysicsEngine/PhysicsSettings.h"
+
+using namespace RealtimeMesh;
+
+namespace
+{
+	// Grid with vertices 10 units apart and two triangles per cell, which every mesh in these tests is built from
+	void BuildCookTestGrid(TArray<FVector3f>& Vertices, TArray<TIndex3<int32>>& Triangles, int32 GridSize, TFunctionRef<float(int32 X, int32 Y)> GetHeight)
+	{
+		Vertices.Reset();
+		Triangles.Reset();
+		for (int32 Y = 0; Y <= GridSize; Y++)
+		{
+			for (int32 X = 0; X <= GridSize; X++)
+			{
+				Vertices.Add(FVector3f(X * 10.0f, Y * 10.0f, GetHeight(X, Y)));
+			}
+		}
+		for (int32 Y = 0; Y < GridSize; Y++)
+		{
+			for (int32 X = 0; X < GridSize; X++)
+			{
+				const int32 V0 = Y * (GridSize + 1) + X;
+				const int32 V1 = V0 + 1;
+				const int32 V2 = V0 + GridSize + 1;
+				const int32 V3 = V2 + 1;
+				Triangles.Add(TIndex3<int32>(V0, V2, V1));
+				Triangles.Add(TIndex3<int32>(V1, V2, V3));
+			}
+		}
+	}
+
+	FRealtimeMeshCollisionInfo BuildCookTestCollision(int32 NumConvexHulls, int32 NumMeshes)
+	{
+		FRealtimeMeshCollisionInfo CollisionInfo;
+		FRandomStream Random(1337);
+
+		for (int32 HullIndex = 0; HullIndex < NumConvexHulls; HullIndex++)
+		{
+			const FVector Offset(HullIndex * 200.0, 0.0, 0.0);
+			TArray<FVector> Points;
+			for (int32 PointIndex = 0; PointIndex < 64; PointIndex++)
+			{
+				Points.Add(Offset + Random.GetUnitVector() * 50.0);
+			}
+
+			FRealtimeMeshCollisionConvex Convex;
+			Convex.SetVertices(MoveTemp(Points));
+			CollisionInfo.SimpleGeometry.ConvexHulls.Add(Convex);
+		}
+
+		for (int32 MeshIndex = 0; MeshIndex < NumMeshes; MeshIndex++)
+		{
+			// Grids of different sizes so the work isn't uniform
+			const int32 GridSize = 16 + MeshIndex * 16;
+			TArray<FVector3f> Vertices;
+			TArray<TIndex3<int32>> Triangles;
+			BuildCookTestGrid(Vertices, Triangles, GridSize, [&Random](int32, int32) { return Random.FRandRange(0.0f, 5.0f); });
+
+			FRealtimeMeshCollisionMesh Mesh;
+			Mesh.SetVertices(MoveTemp(Vertices));
+			Mesh.SetTriangles(MoveTemp(Triangles));
+			CollisionInfo.ComplexGeometry.Add(MoveTemp(Mesh));
+		}
+
+		return CollisionInfo;
+	}
+
+	double GetRefitTestHeight(double X, double Y, double Phase)
+	{
+		return 20.0 * FMath::Sin(Phase + X * 0.04) * FMath::Cos(Phase + Y * 0.03);
+	}
+
+	void BuildRefitTestGrid(TArray<FVector3f>& Vertices, TArray<TIndex3<int32>>& Triangles, int32 GridSize, float Phase)
+	{
+		BuildCookTestGrid(Vertices, Triangles, GridSize, [Phase](int32 X, int32 Y) { return GetRefitTestHeight(X * 10.0, Y * 10.0, Phase); });
+	}
+
+	template<typename IndexType>
+	void BuildGatherTestStreams(FRealtimeMeshStreamSet& StreamSet, int32 GridSize, float Height)
+	{
+		TArray<FVector3f> Vertices;
+		TArray<TIndex3<int32>> Triangles;
+		BuildCookTestGrid(Vertices, Triangles, GridSize, [Height](int32, int32) { return Height; });
+
+		TRealtimeMeshBuilderLocal<IndexType, FPackedNormal, FVector2DHalf, 2> Builder(StreamSet);
+		Builder.EnableTexCoords(2);
+
+		for (int32 Index = 0; Index < Vertices.Num(); Index++)
+		{
+			const FVector2f UV((Index % (GridSize + 1)) / static_cast<float>(GridSize), (Index / (GridSize + 1)) / static_cast<float>(GridSize));
+			Builder.AddVertex(Vertices[Index])
+				.SetTexCoord(0, UV)
+				.SetTexCoord(1, FVector2f(1.0f) - UV);
+		}
+		for (const TIndex3<int32>& Triangle : Triangles)
+		{
+			Builder.AddTriangle(Triangle.V0, Triangle.V1, Triangle.V2);
+		}
+	}
+
+	// Reads the streams back one element at a time, the way collision used to be gathered
+	void AppendReferenceCollision(FRealtimeMeshCollisionMesh& Mesh, const FRealtimeMeshStreamSet& StreamSet, int32 MaterialIndex)
+	{
+		TArray<FVector3f> Vertices = Mesh.GetVertices();
+		TArray<TIndex3<int32>> Triangles = Mesh.GetTriangles();
+		TArray<uint16> Materials = Mesh.GetMaterials();
+		TArray<TArray<FVector2f>> TexCoords = Mesh.GetTexCoords();
+
+		const int32 StartVertex = Vertices.Num();
+		TRealtimeMeshStreamBuilder<const FVector3f, void> Positions(*StreamSet.Find(FRealtimeMeshStreams::Position));
+		for (int32 Index = 0; Index < Positions.Num(); Index++)
+		{
+			Vertices.Add(Positions[Index]);
+		}
+
+		const FRealtimeMeshStream& TexCoordStream = *StreamSet.Find(FRealtimeMeshStreams::TexCoords);
+		TexCoords.SetNum(FMath::Max(TexCoords.Num(), TexCoordStream.GetNumElements()));
+		for (int32 ChannelIndex = 0; ChannelIndex < TexCoords.Num(); ChannelIndex++)
+		{
+			TexCoords[ChannelIndex].SetNumZeroed(StartVertex);
+			TRealtimeMeshStridedStreamBuilder<const FVector2f, void> UVs(TexCoordStream, ChannelIndex);
+			for (int32 Index = 0; Index < UVs.Num(); Index++)
+			{
+				TexCoords[ChannelIndex].Add(UVs[Index]);
+			}
+		}
+
+		TRealtimeMeshStreamBuilder<const TIndex3<uint32>, void> Tris(*StreamSet.Find(FRealtimeMeshStreams::Triangles));
+		for (int32 Index = 0; Index < Tris.Num(); Index++)
+		{
+			Triangles.Add(TIndex3<int32>(
+				Tris[Index].GetElement(0).GetValue() + StartVertex,
+				Tris[Index].GetElement(1).GetValue() + StartVertex,
+				Tris[Index].GetElement(2).GetValue() + StartVertex));
+			Materials.Add(MaterialIndex);
+		}
+
+		Mesh.SetVertices(MoveTemp(Vertices));
+		Mesh.SetTriangles(MoveTemp(Triangles));
+		Mesh.SetMaterials(MoveTemp(Materials));
+		Mesh.SetTexCoords(MoveTemp(TexCoords));
+	}
+}
+
+// =====================================================================================================================
+// Cook Coalescing Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshCollisionCookCoalescingTest,
+	"RealtimeMeshComponent.Collision.CookCoalescing",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshCollisionCookCoalescingTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshStatCounters& Counters = FRealtimeMeshStatCounters::Get();
+	const int64 StartedBefore = Counters.CollisionCooksStarted;
+	const int64 CoalescedBefore = Counters.CollisionCooksCoalesced;
+	const int64 CancelledBefore = Counters.CollisionCooksCancelled;
+
+	FRealtimeMeshCollisionCookScheduler Scheduler;
+
+	const TOptional<FRealtimeMeshCollisionCookScheduler::FTicket> First = Scheduler.Request(1, 4);
+	TestTrue(TEXT("First request starts a cook"), First.IsSet() && First->Version == 1);
+	TestTrue(TEXT("Cook is in flight"), Scheduler.IsCookInFlight());
+	TestFalse(TEXT("Nothing pending yet"), Scheduler.HasPendingRequest());
+
+	// A newer request while cooking folds into a pending one and cancels the stale cook
+	TestFalse(TEXT("Second request does not start a cook"), Scheduler.Request(2, 4).IsSet());
+	TestTrue(TEXT("Second request is pending"), Scheduler.HasPendingRequest());
+	TestTrue(TEXT("Running cook is cancelled"), First->CancellationToken.IsCancelled());
+	TestEqual(TEXT("One cancellation so far"), Scheduler.GetNumConsecutiveCancels(), 1);
+
+	// Any further requests coalesce into the same pending one
+	TestFalse(TEXT("Third request does not start a cook"), Scheduler.Request(3, 4).IsSet());
+	TestFalse(TEXT("Fourth request does not start a cook"), Scheduler.Request(4, 4).IsSet());
+	TestEqual(TEXT("Already cancelled cook is not counted again"), Scheduler.GetNumConsecutiveCancels(), 1);
+
+	TestTrue(TEXT("Finishing the cancelled cook reports the pending request"), Scheduler.Finish(1, true));
+	TestFalse(TEXT("Nothing in flight after finishing"), Scheduler.IsCookInFlight());
+
+	const TOptional<FRealtimeMeshCollisionCookScheduler::FTicket> Second = Scheduler.Request(5, 4);
+	TestTrue(TEXT("Pending request starts with the latest version"), Second.IsSet() && Second->Version == 5);
+	TestFalse(TEXT("New cook has a fresh token"), Second->CancellationToken.IsCancelled());
+	TestFalse(TEXT("Pending request was consumed"), Scheduler.HasPendingRequest());
+
+	TestFalse(TEXT("Completing with nothing pending reports no follow up"), Scheduler.Finish(5, false));
+	TestEqual(TEXT("Completing resets the cancel count"), Scheduler.GetNumConsecutiveCancels(), 0);
+
+	TestEqual(TEXT("Two cooks started for five requests"), static_cast<int64>(Counters.CollisionCooksStarted) - StartedBefore, static_cast<int64>(2));
+	TestEqual(TEXT("Two requests were coalesced"), static_cast<int64>(Counters.CollisionCooksCoalesced) - CoalescedBefore, static_cast<int64>(2));
+	TestEqual(TEXT("One cook was cancelled"), static_cast<int64>(Counters.CollisionCooksCancelled) - CancelledBefore, static_cast<int64>(1));
+
+	return true;
+}
+
+// =====================================================================================================================
+// Cook Cancellation Limit Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshCollisionCookCancelLimitTest,
+	"RealtimeMeshComponent.Collision.CookCancelLimit",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshCollisionCookCancelLimitTest::RunTest(const FString& Parameters)
+{
+	// A limit of 0 never cancels, newer requests just wait
+	{
+		FRealtimeMeshCollisionCookScheduler Scheduler;
+		const TOptional<FRealtimeMeshCollisionCookScheduler::FTicket> Ticket = Scheduler.Request(1, 0);
+		Scheduler.Request(2, 0);
+		TestFalse(TEXT("Limit of 0 leaves the running cook alone"), Ticket->CancellationToken.IsCancelled());
+		TestTrue(TEXT("Request still pends"), Scheduler.HasPendingRequest());
+	}
+
+	// Once the limit is hit a cook is allowed to run to completion
+	{
+		constexpr int32 MaxCancels = 2;
+		FRealtimeMeshCollisionCookScheduler Scheduler;
+		int32 Version = 1;
+		TOptional<FRealtimeMeshCollisionCookScheduler::FTicket> Ticket = Scheduler.Request(Version++, MaxCancels);
+
+		for (int32 Index = 0; Index < MaxCancels; Index++)
+		{
+			Scheduler.Request(Version++, MaxCancels);
+			TestTrue(TEXT("Cook under the limit is cancelled"), Ticket->CancellationToken.IsCancelled());
+			TestTrue(TEXT("Cancelled cook hands over to the pending one"), Scheduler.Finish(Ticket->Version, true));
+			Ticket = Scheduler.Request(Version++, MaxCancels);
+			TestTrue(TEXT("Pending request restarts"), Ticket.IsSet());
+		}
+
+		Scheduler.Request(Version++, MaxCancels);
+		TestFalse(TEXT("Cook at the limit is not cancelled"), Ticket->CancellationToken.IsCancelled());
+		TestTrue(TEXT("Completed cook still reports the pending request"), Scheduler.Finish(Ticket->Version, false));
+		TestEqual(TEXT("Completion resets the cancel count"), Scheduler.GetNumConsecutiveCancels(), 0);
+	}
+
+	// Finishing a version that isn't the one in flight is ignored
+	{
+		FRealtimeMeshCollisionCookScheduler Scheduler;
+		Scheduler.Request(3, 4);
+		Scheduler.Request(4, 4);
+		TestFalse(TEXT("Stale version does not finish the running cook"), Scheduler.Finish(2, false));
+		TestTrue(TEXT("Cook remains in flight"), Scheduler.IsCookInFlight());
+	}
+
+	return true;
+}
+
+// =====================================================================================================================
+// Parallel Cook Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshCollisionParallelCookTest,
+	"RealtimeMeshComponent.Collision.ParallelCook",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshCollisionParallelCookTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumConvexHulls = 256;
+	constexpr int32 NumMeshes = 4;
+
+	FRealtimeMeshCollisionInfo Serial = BuildCookTestCollision(NumConvexHulls, NumMeshes);
+	FRealtimeMeshCollisionInfo Parallel = BuildCookTestCollision(NumConvexHulls, NumMeshes);
+
+	const double SerialStart = FPlatformTime::Seconds();
+	TestTrue(TEXT("Serial cook completes"), URealtimeMeshCollisionTools::CookCollisionInfo(Serial, 1));
+	const double SerialTime = FPlatformTime::Seconds() - SerialStart;
+
+	const double ParallelStart = FPlatformTime::Seconds();
+	TestTrue(TEXT("Parallel cook completes"), URealtimeMeshCollisionTools::CookCollisionInfo(Parallel, 0));
+	const double ParallelTime = FPlatformTime::Seconds() - ParallelStart;
+
+	TestEqual(TEXT("Nothing left to cook"), Parallel.SimpleGeometry.GetMeshIDsNeedingCook().Num() + Parallel.ComplexGeometry.GetMeshIDsNeedingCook().Num(), 0);
+
+	// Every element has to come out the same no matter how the work was spread
+	for (int32 HullIndex = 0; HullIndex < NumConvexHulls; HullIndex++)
+	{
+		const auto SerialConvex = Serial.SimpleGeometry.ConvexHulls.GetByIndex(HullIndex).GetCooked()->GetNonMirrored();
+		const auto ParallelConvex = Parallel.SimpleGeometry.ConvexHulls.GetByIndex(HullIndex).GetCooked()->GetNonMirrored();
+		if (!TestTrue(TEXT("Convex hull cooked"), SerialConvex.IsValid() && ParallelConvex.IsValid()))
+		{
+			break;
+		}
+		TestEqual(TEXT("Convex hull vertex count matches"), ParallelConvex->NumVertices(), SerialConvex->NumVertices());
+		TestEqual(TEXT("Convex hull plane count matches"), ParallelConvex->NumPlanes(), SerialConvex->NumPlanes());
+	}
+
+	for (int32 MeshIndex = 0; MeshIndex < NumMeshes; MeshIndex++)
+	{
+		const auto SerialMesh = Serial.ComplexGeometry.GetByIndex(MeshIndex).GetCooked()->GetMesh();
+		const auto ParallelMesh = Parallel.ComplexGeometry.GetByIndex(MeshIndex).GetCooked()->GetMesh();
+		if (!TestTrue(TEXT("Complex mesh cooked"), SerialMesh.IsValid() && ParallelMesh.IsValid()))
+		{
+			break;
+		}
+		TestEqual(TEXT("Complex mesh triangle count matches"), ParallelMesh->Elements().GetNumTriangles(), SerialMesh->Elements().GetNumTriangles());
+	}
+
+	AddInfo(FString::Printf(TEXT("%d hulls + %d meshes: serial %.3f ms, parallel %.3f ms"), NumConvexHulls, NumMeshes, SerialTime * 1000.0, ParallelTime * 1000.0));
+
+	// A cancelled cook reports it and leaves the rest uncooked
+	FRealtimeMeshCollisionInfo Cancelled = BuildCookTestCollision(16, 1);
+	FRealtimeMeshCancellationToken CancellationToken;
+	CancellationToken.Cancel();
+	TestFalse(TEXT("Cancelled cook reports failure"), URealtimeMeshCollisionTools::CookCollisionInfo(Cancelled, 2, CancellationToken));
+	TestEqual(TEXT("Cancelled cook skips all work"), Cancelled.SimpleGeometry.GetMeshIDsNeedingCook().Num(), 16);
+
+	return true;
+}
+
+// =====================================================================================================================
+// Stream Gather Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshCollisionGatherStreamsTest,
+	"RealtimeMeshComponent.Collision.GatherStreams",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshCollisionGatherStreamsTest::RunTest(const FString& Parameters)
+{
+	// 32 bit indices for the first block, 16 bit for the second so both the memcpy and converting paths are hit
+	FRealtimeMeshStreamSet FirstStreams;
+	BuildGatherTestStreams<uint32>(FirstStreams, 8, 0.0f);
+	FRealtimeMeshStreamSet SecondStreams;
+	BuildGatherTestStreams<uint16>(SecondStreams, 5, 50.0f);
+
+	FRealtimeMeshCollisionMesh Gathered;
+	TestTrue(TEXT("First append succeeds"), URealtimeMeshCollisionTools::AppendStreamsToCollisionMesh(Gathered, FirstStreams, 0));
+	TestTrue(TEXT("Second append succeeds"), URealtimeMeshCollisionTools::AppendStreamsToCollisionMesh(Gathered, SecondStreams, 3));
+
+	FRealtimeMeshCollisionMesh Reference;
+	AppendReferenceCollision(Reference, FirstStreams, 0);
+	AppendReferenceCollision(Reference, SecondStreams, 3);
+
+	TestTrue(TEXT("Vertices match the element-wise gather"), Gathered.GetVertices() == Reference.GetVertices());
+	TestTrue(TEXT("Triangles match the element-wise gather"), Gathered.GetTriangles() == Reference.GetTriangles());
+	TestTrue(TEXT("Materials match the element-wise gather"), Gathered.GetMaterials() == Reference.GetMaterials());
+	TestEqual(TEXT("One material per triangle"), Gathered.GetMaterials().Num(), Gathered.GetTriangles().Num());
+
+	if (UPhysicsSettings::Get()->bSupportUVFromHitResults)
+	{
+		TestTrue(TEXT("UV channels match the element-wise gather"), Gathered.GetTexCoords() == Reference.GetTexCoords());
+	}
+
+	// The cooked result has to be the same whichever way the mesh was gathered
+	URealtimeMeshCollisionTools::CookComplexMesh(Gathered);
+	URealtimeMeshCollisionTools::CookComplexMesh(Reference);
+	if (TestTrue(TEXT("Both meshes cook"), Gathered.HasCookedMesh() && Reference.HasCookedMesh()))
+	{
+		TestEqual(TEXT("Cooked triangle counts match"), Gathered.GetCooked()->GetMesh()->Elements().GetNumTriangles(), Reference.GetCooked()->GetMesh()->Elements().GetNumTriangles());
+		TestTrue(TEXT("Cooked face remaps match"), Gathered.GetCooked()->GetFaceRemap() == Reference.GetCooked()->GetFaceRemap());
+	}
+
+	return true;
+}
+
+// =====================================================================================================================
+// Mesh Cleaning Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshCollisionMeshCleaningTest,
+	"RealtimeMeshComponent.Collision.MeshCleaning",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshCollisionMeshCleaningTest::RunTest(const FString& Parameters)
+{
+	constexpr float WeldThreshold = 0.01f;
+
+	// Two quads sharing an edge through duplicated vertices, one of them slightly off, plus an unused vertex
+	const TArray<FVector3f> Vertices = {
+		FVector3f(0, 0, 0), FVector3f(10, 0, 0), FVector3f(10, 10, 0), FVector3f(0, 10, 0),
+		FVector3f(10, 0, 0), FVector3f(20, 0, 0), FVector3f(20, 10, 0), FVector3f(10, 10.001f, 0),
+		FVector3f(5, 5, 0),
+	};
+	const TArray<TIndex3<int32>> Triangles = {
+		TIndex3<int32>(0, 1, 2), TIndex3<int32>(0, 2, 3),
+		TIndex3<int32>(4, 5, 6), TIndex3<int32>(4, 6, 7),
+		TIndex3<int32>(0, 1, 1),	// Repeated index
+		TIndex3<int32>(2, 0, 1),	// Same face as the first, rotated
+		TIndex3<int32>(0, 1, 5),	// Zero area
+		TIndex3<int32>(1, 6, 5),	// Same face as the third once welded, opposite winding
+	};
+
+	TArray<FVector3f> CleanVertices;
+	TArray<TIndex3<int32>> CleanTriangles;
+	TArray<int32> VertexRemap;
+	TArray<int32> FaceRemap;
+	TestTrue(TEXT("Cleaning reports changes"), URealtimeMeshCollisionTools::CleanCollisionMesh(Vertices, Triangles, WeldThreshold, CleanVertices, CleanTriangles, VertexRemap, FaceRemap));
+
+	TestEqual(TEXT("Welded and unused vertices are removed"), CleanVertices.Num(), 6);
+	TestTrue(TEXT("Only the four real faces remain"), FaceRemap == TArray<int32>({ 0, 1, 2, 3 }));
+	TestEqual(TEXT("One vertex remap entry per vertex"), VertexRemap.Num(), CleanVertices.Num());
+	TestEqual(TEXT("One face remap entry per face"), FaceRemap.Num(), CleanTriangles.Num());
+
+	// Every output vertex and corner has to land back on the source data it was made from
+	for (int32 VertIndex = 0; VertIndex < CleanVertices.Num(); VertIndex++)
+	{
+		TestTrue(TEXT("Vertex remap points at the source vertex"), CleanVertices[VertIndex] == Vertices[VertexRemap[VertIndex]]);
+	}
+	for (int32 TriIndex = 0; TriIndex < CleanTriangles.Num(); TriIndex++)
+	{
+		const TIndex3<int32>& Source = Triangles[FaceRemap[TriIndex]];
+		for (int32 Corner = 0; Corner < 3; Corner++)
+		{
+			TestTrue(TEXT("Face remap corners match the source face"), CleanVertices[CleanTriangles[TriIndex][Corner]].Equals(Vertices[Source[Corner]], WeldThreshold));
+		}
+	}
+
+	{
+		TArray<FVector3f> RecleanedVertices;
+		TArray<TIndex3<int32>> RecleanedTriangles;
+		TArray<int32> RecleanedVertexRemap;
+		TArray<int32> RecleanedFaceRemap;
+		TestFalse(TEXT("A clean mesh is left alone"), URealtimeMeshCollisionTools::CleanCollisionMesh(CleanVertices, CleanTriangles, WeldThreshold,
+			RecleanedVertices, RecleanedTriangles, RecleanedVertexRemap, RecleanedFaceRemap));
+	}
+
+	// Cooking with cleaning on keeps the face remap pointing at the source faces, so face index lookups still work
+	FRealtimeMeshCollisionMesh Mesh;
+	Mesh.SetVertices(Vertices);
+	Mesh.SetTriangles(Triangles);
+	Mesh.SetMaterials(TArray<uint16>({ 0, 1, 2, 3, 4, 5, 6, 7 }));
+
+	FRealtimeMeshCollisionConfiguration Config;
+	Config.bCleanComplexMeshes = true;
+	Config.CleanWeldThreshold = WeldThreshold;
+	URealtimeMeshCollisionTools::CookComplexMesh(Mesh, Config);
+
+	if (TestTrue(TEXT("Cleaned mesh cooks"), Mesh.HasCookedMesh()))
+	{
+		const auto Cooked = Mesh.GetCooked();
+		TestEqual(TEXT("Cooked mesh has the cleaned face count"), Cooked->GetMesh()->Elements().GetNumTriangles(), 4);
+
+		TArray<int32> CookedFaceRemap = Cooked->GetFaceRemap();
+		CookedFaceRemap.Sort();
+		TestTrue(TEXT("Cooked face remap points at the source faces"), CookedFaceRemap == TArray<int32>({ 0, 1, 2, 3 }));
+	}
+
+	return true;
+}
+
+// =====================================================================================================================
+// Deformable Refit Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshCollisionDeformableRefitTest,
+	"RealtimeMeshComponent.Collision.DeformableRefit",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshCollisionDeformableRefitTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 GridSize = 32;
+	FRealtimeMeshStatCounters& Counters = FRealtimeMeshStatCounters::Get();
+
+	for (const bool bClean : { false, true })
+	{
+		FRealtimeMeshCollisionConfiguration Config;
+		Config.bDeformableMesh = true;
+		Config.bCleanComplexMeshes = bClean;
+
+		TArray<FVector3f> Vertices;
+		TArray<TIndex3<int32>> Triangles;
+		BuildRefitTestGrid(Vertices, Triangles, GridSize, 0.0f);
+
+		// Duplicate the first row so cleaning has something to weld, which gives the refit a real vertex remap to follow
+		const int32 NumOriginalVertices = Vertices.Num();
+		for (int32 X = 0; X <= GridSize; X++)
+		{
+			Vertices.Add(Vertices[X]);
+		}
+		for (int32 X = 0; X < GridSize; X++)
+		{
+			Triangles[X * 2] = TIndex3<int32>(NumOriginalVertices + X, Triangles[X * 2].V1, NumOriginalVertices + X + 1);
+		}
+
+		FRealtimeMeshCollisionMesh Original;
+		Original.SetVertices(Vertices);
+		Original.SetTriangles(Triangles);
+		URealtimeMeshCollisionTools::CookComplexMesh(Original, Config);
+		if (!TestTrue(TEXT("Original mesh cooks"), Original.HasCookedMesh()))
+		{
+			return false;
+		}
+		TestEqual(TEXT("Cleaning decides whether there is a vertex remap"), Original.GetCooked()->HasVertexRemap(), bClean);
+
+		// Move every vertex, keeping the duplicated row on top of the row it duplicates
+		TArray<FVector3f> Deformed;
+		TArray<TIndex3<int32>> Unused;
+		BuildRefitTestGrid(Deformed, Unused, GridSize, 1.3f);
+		for (int32 X = 0; X <= GridSize; X++)
+		{
+			Deformed.Add(Deformed[X]);
+		}
+
+		FRealtimeMeshCollisionMesh Refit;
+		Refit.SetVertices(Deformed);
+		Refit.SetTriangles(Triangles);
+		TestEqual(TEXT("Moving vertices keeps the topology hash"),
+			URealtimeMeshCollisionTools::GetComplexMeshTopologyHash(Refit, Config), URealtimeMeshCollisionTools::GetComplexMeshTopologyHash(Original, Config));
+
+		const int64 RefitsBefore = Counters.ComplexCollisionRefits;
+		const int64 CooksBefore = Counters.ComplexCollisionCooks;
+		TestTrue(TEXT("Refit succeeds"), URealtimeMeshCollisionTools::RefitComplexMesh(Refit, *Original.GetCooked()));
+		TestFalse(TEXT("Refit mesh doesn't need a cook"), Refit.NeedsCook());
+		TestEqual(TEXT("Refit is counted"), static_cast<int64>(Counters.ComplexCollisionRefits) - RefitsBefore, static_cast<int64>(1));
+		TestEqual(TEXT("Refit doesn't cook"), static_cast<int64>(Counters.ComplexCollisionCooks), CooksBefore);
+
+		FRealtimeMeshCollisionMesh Fresh;
+		Fresh.SetVertices(Deformed);
+		Fresh.SetTriangles(Triangles);
+		URealtimeMeshCollisionTools::CookComplexMesh(Fresh, Config);
+
+		const auto RefitMesh = Refit.GetCooked()->GetMesh();
+		const auto FreshMesh = Fresh.GetCooked()->GetMesh();
+		const auto OriginalMesh = Original.GetCooked()->GetMesh();
+		TestEqual(TEXT("Triangle counts match"), RefitMesh->Elements().GetNumTriangles(), FreshMesh->Elements().GetNumTriangles());
+		TestTrue(TEXT("Bounds match a fresh cook"), FVector(RefitMesh->BoundingBox().Min()).Equals(FVector(FreshMesh->BoundingBox().Min()), 0.01) &&
+			FVector(RefitMesh->BoundingBox().Max()).Equals(FVector(FreshMesh->BoundingBox().Max()), 0.01));
+
+		// Rays straight down over the whole grid have to see the same surface as the fresh cook, and the original
+		// cook has to be left as it was since the physics scene may still be using it
+		int32 NumMismatches = 0;
+		int32 NumOriginalMoved = 0;
+		for (int32 Y = 0; Y < GridSize * 2; Y++)
+		{
+			for (int32 X = 0; X < GridSize * 2; X++)
+			{
+				const Chaos::FVec3 Start(X * 5.0 + 2.5, Y * 5.0 + 2.5, 1000.0);
+				const Chaos::FVec3 Dir(0.0, 0.0, -1.0);
+
+				Chaos::FReal RefitTime = 0, FreshTime = 0, OriginalTime = 0;
+				Chaos::FVec3 Position, Normal;
+				int32 FaceIndex;
+				const bool bRefitHit = RefitMesh->Raycast(Start, Dir, 2000.0, 0.0, RefitTime, Position, Normal, FaceIndex);
+				const bool bFreshHit = FreshMesh->Raycast(Start, Dir, 2000.0, 0.0, FreshTime, Position, Normal, FaceIndex);
+				const bool bOriginalHit = OriginalMesh->Raycast(Start, Dir, 2000.0, 0.0, OriginalTime, Position, Normal, FaceIndex);
+
+				if (bRefitHit != bFreshHit || (bRefitHit && !FMath::IsNearlyEqual(RefitTime, FreshTime, 0.01)))
+				{
+					NumMismatches++;
+				}
+				if (!bOriginalHit || !FMath::IsNearlyEqual(OriginalTime, 1000.0 - GetRefitTestHeight(Start.X, Start.Y, 0.0), 2.0))
+				{
+					NumOriginalMoved++;
+				}
+			}
+		}
+		TestEqual(TEXT("Refit surface matches a fresh cook"), NumMismatches, 0);
+		TestEqual(TEXT("Original cook is untouched"), NumOriginalMoved, 0);
+
+		// Anything that changes the topology has to be caught before a refit is attempted
+		FRealtimeMeshCollisionMesh Changed;
+		Changed.SetVertices(Deformed);
+		TArray<TIndex3<int32>> ChangedTriangles = Triangles;
+		ChangedTriangles.Pop();
+		Changed.SetTriangles(ChangedTriangles);
+		TestNotEqual(TEXT("Changing triangles changes the topology hash"),
+			URealtimeMeshCollisionTools::GetComplexMeshTopologyHash(Changed, Config), URealtimeMeshCollisionTools::GetComplexMeshTopologyHash(Original, Config));
+
+		FRealtimeMeshCollisionMesh Shrunk;
+		Deformed.SetNum(bClean ? 4 : Deformed.Num() - 1);
+		Shrunk.SetVertices(Deformed);
+		Shrunk.SetTriangles(Triangles);
+		TestFalse(TEXT("Refit rejects vertices the previous cook can't map"), URealtimeMeshCollisionTools::RefitComplexMesh(Shrunk, *Original.GetCooked()));
+		TestTrue(TEXT("Rejected refit leaves the mesh uncooked"), Shrunk.NeedsCook());
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshCollisionDeformableRefitCostTest,
+	"RealtimeMeshComponent.Collision.DeformableRefitCost",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshCollisionDeformableRefitCostTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 GridSize = 128;
+	constexpr int32 NumFrames = 8;
+
+	FRealtimeMeshCollisionConfiguration Config;
+	Config.bDeformableMesh = true;
+	Config.bCleanComplexMeshes = true;
+
+	TArray<FVector3f> Vertices;
+	TArray<TIndex3<int32>> Triangles;
+	BuildRefitTestGrid(Vertices, Triangles, GridSize, 0.0f);
+
+	FRealtimeMeshCollisionMesh Original;
+	Original.SetVertices(Vertices);
+	Original.SetTriangles(Triangles);
+	URealtimeMeshCollisionTools::CookComplexMesh(Original, Config);
+	if (!TestTrue(TEXT("Original mesh cooks"), Original.HasCookedMesh()))
+	{
+		return false;
+	}
+
+	// Each frame moves every vertex and gets collision for it both ways, keeping the best time of each so a stall on
+	// the machine running the test doesn't decide the comparison
+	double BestCookTime = TNumericLimits<double>::Max();
+	double BestRefitTime = TNumericLimits<double>::Max();
+	for (int32 Frame = 1; Frame <= NumFrames; Frame++)
+	{
+		TArray<FVector3f> Deformed;
+		TArray<TIndex3<int32>> Unused;
+		BuildRefitTestGrid(Deformed, Unused, GridSize, Frame * 0.25f);
+
+		FRealtimeMeshCollisionMesh Cooked;
+		Cooked.SetVertices(Deformed);
+		Cooked.SetTriangles(Triangles);
+		const double CookStart = FPlatformTime::Seconds();
+		URealtimeMeshCollisionTools::CookComplexMesh(Cooked, Config);
+		BestCookTime = FMath::Min(BestCookTime, FPlatformTime::Seconds() - CookStart);
+
+		FRealtimeMeshCollisionMesh Refit;
+		Refit.SetVertices(Deformed);
+		Refit.SetTriangles(Triangles);
+		const double RefitStart = FPlatformTime::Seconds();
+		const bool bRefit = URealtimeMeshCollisionTools::RefitComplexMesh(Refit, *Original.GetCooked());
+		BestRefitTime = FMath::Min(BestRefitTime, FPlatformTime::Seconds() - RefitStart);
+
+		if (!TestTrue(TEXT("Refit succeeds"), bRefit) ||
+			!TestEqual(TEXT("Refit keeps every triangle"), Refit.GetCooked()->GetMesh()->Elements().GetNumTriangles(), Cooked.GetCooked()->GetMesh()->Elements().GetNumTriangles()))
+		{
+			return false;
+		}
+	}
+
+	AddInfo(FString::Printf(TEXT("%d triangles: cook %.3f ms, refit %.3f ms"), Triangles.Num(), BestCookTime * 1000.0, BestRefitTime * 1000.0));
+
+	// Refitting skips the welding, the degenerate/duplicate face removal and the triangle validation a cook does, which is
+	// what the feature is for, so it has to come out ahead of cooking the same deformed mesh
+	TestTrue(TEXT("Refit is cheaper than a cook"), BestRefitTime < BestCookTime);
+
+	return true;
+}
@@ -0,0 +1,362 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "RealtimeMeshCore.h"
+#include "RealtimeMeshSimple.h"
+#include "RealtimeMeshCollisionLibrary.h"
+#include "Core/RealtimeMeshBuilder.h"
+#include "Mesh/RealtimeMeshConvexDecomposition.h"
+#include "Chaos/Convex.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/NameAsStringProxyArchive.h"
+
+using namespace RealtimeMesh;
+
+namespace
+{
+	void AppendDecompositionTestBox(TArray<FVector3f>& Positions, TArray<TIndex3<int32>>& Triangles, const FVector3f& Min, const FVector3f& Max)
+	{
+		const int32 Base = Positions.Num();
+		for (int32 Corner = 0; Corner < 8; Corner++)
+		{
+			Positions.Add(FVector3f((Corner & 1) ? Max.X : Min.X, (Corner & 2) ? Max.Y : Min.Y, (Corner & 4) ? Max.Z : Min.Z));
+		}
+
+		const int32 Faces[6][4] = { { 0, 2, 3, 1 }, { 4, 5, 7, 6 }, { 0, 1, 5, 4 }, { 2, 6, 7, 3 }, { 0, 4, 6, 2 }, { 1, 3, 7, 5 } };
+		for (const auto& Face : Faces)
+		{
+			Triangles.Add(TIndex3<int32>(Base + Face[0], Base + Face[1], Base + Face[2]));
+			Triangles.Add(TIndex3<int32>(Base + Face[0], Base + Face[2], Base + Face[3]));
+		}
+	}
+
+	/* Two overlapping boxes making an L, with a big concave notch between the arms */
+	void BuildDecompositionTestL(TArray<FVector3f>& Positions, TArray<TIndex3<int32>>& Triangles)
+	{
+		AppendDecompositionTestBox(Positions, Triangles, FVector3f(0, 0, 0), FVector3f(100, 20, 20));
+		AppendDecompositionTestBox(Positions, Triangles, FVector3f(0, 0, 0), FVector3f(20, 100, 20));
+	}
+
+	void BuildDecompositionTestSphere(TArray<FVector3f>& Positions, TArray<TIndex3<int32>>& Triangles, float Radius, int32 NumRings, int32 NumSegments)
+	{
+		Positions.Add(FVector3f(0, 0, Radius));
+		for (int32 Ring = 1; Ring < NumRings; Ring++)
+		{
+			const float Theta = PI * Ring / NumRings;
+			for (int32 Segment = 0; Segment < NumSegments; Segment++)
+			{
+				const float Phi = 2.0f * PI * Segment / NumSegments;
+				Positions.Add(FVector3f(FMath::Sin(Theta) * FMath::Cos(Phi), FMath::Sin(Theta) * FMath::Sin(Phi), FMath::Cos(Theta)) * Radius);
+			}
+		}
+		const int32 Bottom = Positions.Add(FVector3f(0, 0, -Radius));
+
+		auto RingVertex = [NumSegments](int32 Ring, int32 Segment) { return 1 + (Ring - 1) * NumSegments + (Segment % NumSegments); };
+		for (int32 Segment = 0; Segment < NumSegments; Segment++)
+		{
+			Triangles.Add(TIndex3<int32>(0, RingVertex(1, Segment), RingVertex(1, Segment + 1)));
+			for (int32 Ring = 1; Ring < NumRings - 1; Ring++)
+			{
+				Triangles.Add(TIndex3<int32>(RingVertex(Ring, Segment), RingVertex(Ring + 1, Segment), RingVertex(Ring + 1, Segment + 1)));
+				Triangles.Add(TIndex3<int32>(RingVertex(Ring, Segment), RingVertex(Ring + 1, Segment + 1), RingVertex(Ring, Segment + 1)));
+			}
+			Triangles.Add(TIndex3<int32>(Bottom, RingVertex(NumRings - 1, Segment + 1), RingVertex(NumRings - 1, Segment)));
+		}
+	}
+
+	/* Signed distance to the nearest hull, negative inside */
+	double DistanceToHulls(const TArray<FRealtimeMeshCollisionConvex>& Hulls, const FVector& Point)
+	{
+		double Closest = TNumericLimits<double>::Max();
+		for (const FRealtimeMeshCollisionConvex& Hull : Hulls)
+		{
+			if (Hull.HasCookedMesh())
+			{
+				Closest = FMath::Min(Closest, static_cast<double>(Hull.GetCooked()->GetNonMirrored()->SignedDistance(Point)));
+			}
+		}
+		return Closest;
+	}
+
+	bool AreHullsValid(TArray<FRealtimeMeshCollisionConvex>& Hulls, int32 MaxVertices)
+	{
+		bool bValid = Hulls.Num() > 0;
+		for (FRealtimeMeshCollisionConvex& Hull : Hulls)
+		{
+			URealtimeMeshCollisionTools::CookConvexHull(Hull);
+			bValid &= Hull.GetVertices().Num() >= 4 && Hull.GetVertices().Num() <= MaxVertices && FRealtimeMeshConvexDecomposition::IsGeneratedHull(Hull);
+			bValid &= Hull.HasCookedMesh() && Hull.GetCooked()->GetNonMirrored()->GetVolume() > 0.0;
+		}
+		return bValid;
+	}
+}
+
+// =====================================================================================================================
+// Decomposition Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshConvexDecompositionBoxTest,
+	"RealtimeMeshComponent.ConvexDecomposition.Box",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshConvexDecompositionBoxTest::RunTest(const FString& Parameters)
+{
+	TArray<FVector3f> Positions;
+	TArray<TIndex3<int32>> Triangles;
+	AppendDecompositionTestBox(Positions, Triangles, FVector3f(-50, -30, -10), FVector3f(50, 30, 10));
+
+	FRealtimeMeshConvexDecompositionSettings Settings;
+	TArray<FRealtimeMeshCollisionConvex> Hulls = FRealtimeMeshConvexDecomposition::Compute(Positions, Triangles, Settings);
+	TestEqual(TEXT("A convex mesh stays in one piece"), Hulls.Num(), 1);
+	TestTrue(TEXT("Hull is valid"), AreHullsValid(Hulls, Settings.MaxVerticesPerHull));
+	if (Hulls.Num() != 1)
+	{
+		return false;
+	}
+
+	// The hull is built from voxel corners, so it may stand off the box by up to a voxel
+	const double VoxelSize = FMath::Pow(100.0 * 60.0 * 20.0 / Settings.VoxelResolution, 1.0 / 3.0) * 1.5;
+	const FBox HullBounds(Hulls[0].GetVertices());
+	TestTrue(TEXT("Hull encloses the box"), HullBounds.IsInside(FBox(FVector(-49.9, -29.9, -9.9), FVector(49.9, 29.9, 9.9))));
+	TestTrue(TEXT("Hull stays close to the box"), FBox(FVector(-50, -30, -10), FVector(50, 30, 10)).ExpandBy(VoxelSize).IsInside(HullBounds));
+
+	TestEqual(TEXT("Nothing to decompose gives no hulls"), FRealtimeMeshConvexDecomposition::Compute({}, {}, Settings).Num(), 0);
+	TestEqual(TEXT("Invalid triangles are skipped"), FRealtimeMeshConvexDecomposition::Compute(Positions, { TIndex3<int32>(0, 1, 99) }, Settings).Num(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshConvexDecompositionConcaveTest,
+	"RealtimeMeshComponent.ConvexDecomposition.Concave",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshConvexDecompositionConcaveTest::RunTest(const FString& Parameters)
+{
+	TArray<FVector3f> Positions;
+	TArray<TIndex3<int32>> Triangles;
+	BuildDecompositionTestL(Positions, Triangles);
+
+	const FVector NotchPoint(70, 70, 10);
+
+	FRealtimeMeshConvexDecompositionSettings Settings;
+	Settings.MaxHulls = 1;
+	TArray<FRealtimeMeshCollisionConvex> SingleHull = FRealtimeMeshConvexDecomposition::Compute(Positions, Triangles, Settings);
+	TestEqual(TEXT("Hull count is capped"), SingleHull.Num(), 1);
+	TestTrue(TEXT("Single hull is valid"), AreHullsValid(SingleHull, Settings.MaxVerticesPerHull));
+	TestTrue(TEXT("Single hull spans the notch"), DistanceToHulls(SingleHull, NotchPoint) < 0.0);
+
+	Settings.MaxHulls = 8;
+	TArray<FRealtimeMeshCollisionConvex> Hulls = FRealtimeMeshConvexDecomposition::Compute(Positions, Triangles, Settings);
+	TestTrue(TEXT("Concave mesh is split"), Hulls.Num() >= 2 && Hulls.Num() <= Settings.MaxHulls);
+	TestTrue(TEXT("Hulls are valid"), AreHullsValid(Hulls, Settings.MaxVerticesPerHull));
+	TestTrue(TEXT("Split hulls leave the notch open"), DistanceToHulls(Hulls, NotchPoint) > 10.0);
+
+	// Every part of the surface has to be covered by some hull
+	const double Tolerance = 0.5;
+	bool bCovered = true;
+	FRandomStream Random(12);
+	for (const TIndex3<int32>& Triangle : Triangles)
+	{
+		for (int32 Sample = 0; Sample < 32; Sample++)
+		{
+			float U = Random.FRand();
+			float V = Random.FRand();
+			if (U + V > 1.0f)
+			{
+				U = 1.0f - U;
+				V = 1.0f - V;
+			}
+			const FVector3f Point = Positions[Triangle.V0] + (Positions[Triangle.V1] - Positions[Triangle.V0]) * U + (Positions[Triangle.V2] - Positions[Triangle.V0]) * V;
+			bCovered &= DistanceToHulls(Hulls, FVector(Point)) <= Tolerance;
+		}
+	}
+	TestTrue(TEXT("Hulls cover the whole surface"), bCovered);
+
+	double TotalVolume = 0.0;
+	for (const FRealtimeMeshCollisionConvex& Hull : Hulls)
+	{
+		TotalVolume += Hull.GetCooked()->GetNonMirrored()->GetVolume();
+	}
+	const double MeshVolume = 100.0 * 20.0 * 20.0 * 2.0 - 20.0 * 20.0 * 20.0;
+	TestTrue(TEXT("Hulls hug the mesh"), TotalVolume < MeshVolume * 1.5);
+
+	// The same input always decomposes the same way
+	const TArray<FRealtimeMeshCollisionConvex> Repeat = FRealtimeMeshConvexDecomposition::Compute(Positions, Triangles, Settings);
+	bool bDeterministic = Repeat.Num() == Hulls.Num();
+	for (int32 HullIndex = 0; bDeterministic && HullIndex < Hulls.Num(); HullIndex++)
+	{
+		bDeterministic &= Repeat[HullIndex].GetVertices() == Hulls[HullIndex].GetVertices() && Repeat[HullIndex].Name == Hulls[HullIndex].Name;
+	}
+	TestTrue(TEXT("Decomposition is deterministic"), bDeterministic);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshConvexDecompositionVertexLimitTest,
+	"RealtimeMeshComponent.ConvexDecomposition.VertexLimit",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshConvexDecompositionVertexLimitTest::RunTest(const FString& Parameters)
+{
+	TArray<FVector3f> Positions;
+	TArray<TIndex3<int32>> Triangles;
+	BuildDecompositionTestSphere(Positions, Triangles, 50.0f, 24, 32);
+
+	FRealtimeMeshConvexDecompositionSettings Settings;
+	Settings.MaxHulls = 1;
+	Settings.MaxVerticesPerHull = 12;
+	Settings.VoxelResolution = 20000;
+	TArray<FRealtimeMeshCollisionConvex> Hulls = FRealtimeMeshConvexDecomposition::Compute(Positions, Triangles, Settings);
+	TestTrue(TEXT("Hull respects the vertex limit"), AreHullsValid(Hulls, Settings.MaxVerticesPerHull) && Hulls.Num() == 1);
+
+	// The kept vertices are corners of voxels on the surface
+	const double VoxelSize = FMath::Pow(100.0 * 100.0 * 100.0 / Settings.VoxelResolution, 1.0 / 3.0) * 1.5;
+	bool bOnSurface = Hulls.Num() == 1;
+	for (const FVector& Vertex : Hulls.Num() == 1 ? Hulls[0].GetVertices() : TArray<FVector>())
+	{
+		bOnSurface &= FMath::Abs(Vertex.Size() - 50.0) < VoxelSize * 2.0;
+	}
+	TestTrue(TEXT("Kept vertices lie on the surface"), bOnSurface);
+
+	// The sampled vertices should still be spread around the whole sphere
+	const FBox HullBounds = Hulls.Num() == 1 ? FBox(Hulls[0].GetVertices()) : FBox(ForceInit);
+	TestTrue(TEXT("Kept vertices span the sphere"), HullBounds.GetSize().GetMin() > 70.0);
+
+	return true;
+}
+
+// =====================================================================================================================
+// Simple Geometry Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshConvexDecompositionReplaceTest,
+	"RealtimeMeshComponent.ConvexDecomposition.ReplaceGeneratedHulls",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshConvexDecompositionReplaceTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshSimpleGeometry SimpleGeometry;
+
+	FRealtimeMeshCollisionConvex ManualHull;
+	ManualHull.Name = FName("Manual");
+	ManualHull.SetVertices({ FVector(0, 0, 0), FVector(10, 0, 0), FVector(0, 10, 0), FVector(0, 0, 10) });
+	SimpleGeometry.ConvexHulls.Add(ManualHull);
+	SimpleGeometry.Spheres.Add(FRealtimeMeshCollisionSphere());
+
+	// A user hull that happens to carry the generated base name is still a user hull
+	FRealtimeMeshCollisionConvex LookalikeHull;
+	LookalikeHull.Name = FRealtimeMeshConvexDecomposition::GetHullBaseName();
+	LookalikeHull.SetVertices({ FVector(0, 0, 0), FVector(20, 0, 0), FVector(0, 20, 0), FVector(0, 0, 20), FVector(20, 20, 20) });
+	SimpleGeometry.ConvexHulls.Add(LookalikeHull);
+	TestFalse(TEXT("User hull isn't seen as generated"), FRealtimeMeshConvexDecomposition::IsGeneratedHull(LookalikeHull));
+
+	TArray<FVector3f> Positions;
+	TArray<TIndex3<int32>> Triangles;
+	BuildDecompositionTestL(Positions, Triangles);
+
+	FRealtimeMeshConvexDecompositionSettings Settings;
+	TArray<FRealtimeMeshCollisionConvex> FirstHulls = FRealtimeMeshConvexDecomposition::Compute(Positions, Triangles, Settings);
+	const int32 NumFirstHulls = FirstHulls.Num();
+	FRealtimeMeshConvexDecomposition::ReplaceGeneratedHulls(SimpleGeometry, MoveTemp(FirstHulls));
+	TestEqual(TEXT("Generated hulls are added alongside the user ones"), SimpleGeometry.ConvexHulls.Num(), NumFirstHulls + 2);
+
+	// The generated flag has to survive a save and load, or the next decomposition would stack on top of the loaded one
+	URealtimeMeshSimple* RealtimeMesh = NewObject<URealtimeMeshSimple>();
+	RealtimeMesh->SetSimpleGeometry(SimpleGeometry);
+	TArray<uint8> Saved;
+	{
+		FMemoryWriter Writer(Saved);
+		Writer.SetCustomVersion(FRealtimeMeshVersion::GUID, FRealtimeMeshVersion::LatestVersion, TEXT("RealtimeMesh"));
+		FNameAsStringProxyArchive Ar(Writer);
+		RealtimeMesh->GetMesh()->Serialize(Ar, RealtimeMesh);
+	}
+	URealtimeMeshSimple* Loaded = NewObject<URealtimeMeshSimple>();
+	{
+		FMemoryReader Reader(Saved);
+		Reader.SetCustomVersion(FRealtimeMeshVersion::GUID, FRealtimeMeshVersion::LatestVersion, TEXT("RealtimeMesh"));
+		FNameAsStringProxyArchive Ar(Reader);
+		Loaded->GetMesh()->Serialize(Ar, Loaded);
+	}
+	SimpleGeometry = Loaded->GetSimpleGeometry();
+	int32 NumGeneratedLoaded = 0;
+	for (auto It = SimpleGeometry.ConvexHulls.CreateConstIterator(); It; ++It)
+	{
+		NumGeneratedLoaded += FRealtimeMeshConvexDecomposition::IsGeneratedHull(*It) ? 1 : 0;
+	}
+	TestEqual(TEXT("Generated hulls are still flagged after loading"), NumGeneratedLoaded, NumFirstHulls);
+
+	Settings.MaxHulls = 1;
+	FRealtimeMeshConvexDecomposition::ReplaceGeneratedHulls(SimpleGeometry, FRealtimeMeshConvexDecomposition::Compute(Positions, Triangles, Settings));
+	TestEqual(TEXT("A new decomposition replaces the old one"), SimpleGeometry.ConvexHulls.Num(), 3);
+
+	FRealtimeMeshCollisionConvex FoundHull;
+	TestTrue(TEXT("Manual hull is kept"), SimpleGeometry.ConvexHulls.GetByName(FName("Manual"), FoundHull) && FoundHull.GetVertices().Num() == 4);
+	TestTrue(TEXT("User hull with the generated base name is kept"),
+		SimpleGeometry.ConvexHulls.GetByName(FRealtimeMeshConvexDecomposition::GetHullBaseName(), FoundHull) && FoundHull.GetVertices().Num() == 5);
+	TestTrue(TEXT("Generated hull is reachable by name"), SimpleGeometry.ConvexHulls.GetByName(FName(FRealtimeMeshConvexDecomposition::GetHullBaseName(), 1), FoundHull));
+	TestEqual(TEXT("Other shapes are untouched"), SimpleGeometry.Spheres.Num(), 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshConvexDecompositionMeshTest,
+	"RealtimeMeshComponent.ConvexDecomposition.FromMesh",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshConvexDecompositionMeshTest::RunTest(const FString& Parameters)
+{
+	TArray<FVector3f> Positions;
+	TArray<TIndex3<int32>> Triangles;
+	BuildDecompositionTestL(Positions, Triangles);
+
+	// Each arm of the L goes in its own section group, the decomposition should see them as one mesh
+	URealtimeMeshSimple* RealtimeMesh = NewObject<URealtimeMeshSimple>();
+	const FRealtimeMeshLODKey LODKey(0);
+	for (int32 Arm = 0; Arm < 2; Arm++)
+	{
+		FRealtimeMeshStreamSet StreamSet;
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(StreamSet);
+		for (int32 Vertex = Arm * 8; Vertex < Arm * 8 + 8; Vertex++)
+		{
+			Builder.AddVertex(Positions[Vertex]);
+		}
+		for (int32 Triangle = Arm * 12; Triangle < Arm * 12 + 12; Triangle++)
+		{
+			Builder.AddTriangle(Triangles[Triangle].V0 - Arm * 8, Triangles[Triangle].V1 - Arm * 8, Triangles[Triangle].V2 - Arm * 8);
+		}
+		RealtimeMesh->CreateSectionGroup(FRealtimeMeshSectionGroupKey::Create(LODKey, Arm), StreamSet);
+	}
+
+	FRealtimeMeshSimpleGeometry SimpleGeometry;
+	FRealtimeMeshCollisionCapsule Capsule;
+	Capsule.Name = FName("Manual");
+	SimpleGeometry.Capsules.Add(Capsule);
+	RealtimeMesh->SetSimpleGeometry(SimpleGeometry);
+
+	FRealtimeMeshConvexDecompositionSettings Settings;
+	RealtimeMesh->GenerateConvexDecomposition(LODKey, Settings);
+
+	// The hulls are swapped in as soon as the decomposition finishes, the collision cook after that needs a tick
+	const double Timeout = FPlatformTime::Seconds() + 30.0;
+	FRealtimeMeshSimpleGeometry Result = RealtimeMesh->GetSimpleGeometry();
+	while (Result.ConvexHulls.Num() == 0 && FPlatformTime::Seconds() < Timeout)
+	{
+		FPlatformProcess::Sleep(0.01f);
+		Result = RealtimeMesh->GetSimpleGeometry();
+	}
+
+	TArray<FRealtimeMeshCollisionConvex> Hulls;
+	for (const FRealtimeMeshCollisionConvex& Hull : Result.ConvexHulls)
+	{
+		Hulls.Add(Hull);
+	}
+	TestTrue(TEXT("Decomposition reaches the simple geometry"), Hulls.Num() >= 2 && AreHullsValid(Hulls, Settings.MaxVerticesPerHull));
+	TestTrue(TEXT("Both section groups are covered"), DistanceToHulls(Hulls, FVector(90, 10, 10)) < 0.0 && DistanceToHulls(Hulls, FVector(10, 90, 10)) < 0.0);
+	TestEqual(TEXT("Existing shapes are kept"), Result.Capsules.Num(), 1);
+
+	return true;
+}
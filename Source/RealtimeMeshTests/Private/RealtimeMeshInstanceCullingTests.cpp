@@ -0,0 +1,157 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "RenderProxy/RealtimeMeshInstanceCulling.h"
+
+using namespace RealtimeMesh;
+
+namespace
+{
+	FRealtimeMeshInstanceCullingParams MakeTestCullingParams()
+	{
+		FRealtimeMeshInstanceCullingParams Params;
+		Params.LocalBounds = FBoxSphereBounds(FVector::ZeroVector, FVector(50.0), FVector(50.0).Size());
+		Params.ViewOrigin = FVector::ZeroVector;
+		Params.ProjectionMatrix = FPerspectiveMatrix(UE_PI / 4.0f, 1920.0f, 1080.0f, 10.0f);
+		Params.LODScreenSizes = { 1.0f, 0.5f, 0.1f };
+		return Params;
+	}
+}
+
+// =====================================================================================================================
+// Instance Culling Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshInstanceCullingFrustumTest,
+	"RealtimeMeshComponent.Instancing.FrustumCulling",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshInstanceCullingFrustumTest::RunTest(const FString& Parameters)
+{
+	// Axis aligned box volume from -1000 to 1000 on every axis, planes facing outwards
+	FConvexVolume::FPlaneArray Planes;
+	Planes.Add(FPlane(FVector(1, 0, 0), 1000));
+	Planes.Add(FPlane(FVector(-1, 0, 0), 1000));
+	Planes.Add(FPlane(FVector(0, 1, 0), 1000));
+	Planes.Add(FPlane(FVector(0, -1, 0), 1000));
+	Planes.Add(FPlane(FVector(0, 0, 1), 1000));
+	Planes.Add(FPlane(FVector(0, 0, -1), 1000));
+	const FConvexVolume Frustum(Planes);
+
+	FRealtimeMeshInstanceCullingParams Params = MakeTestCullingParams();
+	Params.ViewFrustum = &Frustum;
+
+	TArray<FMatrix> Instances;
+	Instances.Add(FTranslationMatrix(FVector(0, 0, 0)));
+	Instances.Add(FTranslationMatrix(FVector(5000, 0, 0)));
+	Instances.Add(FTranslationMatrix(FVector(1030, 0, 0)));
+	Instances.Add(FScaleMatrix(FVector(10.0)) * FTranslationMatrix(FVector(0, -1400, 0)));
+	Instances.Add(FTranslationMatrix(FVector(0, 0, -3000)));
+
+	FRealtimeMeshInstanceCullingResult Result;
+	FRealtimeMeshInstanceCulling::CullAndSelectLODs(Params, Instances, Result);
+
+	TestEqual(TEXT("Instances inside or straddling the frustum are kept"), Result.NumVisible, 3);
+	TestEqual(TEXT("Instances outside the frustum are culled"), Result.NumCulled, 2);
+
+	TArray<int32> Visible;
+	for (const TArray<int32>& LODInstances : Result.InstancesPerLOD)
+	{
+		Visible.Append(LODInstances);
+	}
+	Visible.Sort();
+	TestTrue(TEXT("Culling keeps the expected instances"), Visible == TArray<int32>({ 0, 2, 3 }));
+
+	// Without a frustum nothing is culled
+	Params.ViewFrustum = nullptr;
+	FRealtimeMeshInstanceCulling::CullAndSelectLODs(Params, Instances, Result);
+	TestEqual(TEXT("No frustum keeps every instance"), Result.NumVisible, Instances.Num());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshInstanceCullingLODTest,
+	"RealtimeMeshComponent.Instancing.LODSelection",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshInstanceCullingLODTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshInstanceCullingParams Params = MakeTestCullingParams();
+
+	TArray<FMatrix> Instances;
+	Instances.Add(FTranslationMatrix(FVector(100, 0, 0)));
+	Instances.Add(FTranslationMatrix(FVector(800, 0, 0)));
+	Instances.Add(FTranslationMatrix(FVector(100000, 0, 0)));
+
+	FRealtimeMeshInstanceCullingResult Result;
+	FRealtimeMeshInstanceCulling::CullAndSelectLODs(Params, Instances, Result);
+
+	TestEqual(TEXT("One bucket per LOD"), Result.InstancesPerLOD.Num(), 3);
+	TestTrue(TEXT("Near instance draws LOD 0"), Result.InstancesPerLOD[0] == TArray<int32>({ 0 }));
+	TestTrue(TEXT("Mid instance draws LOD 1"), Result.InstancesPerLOD[1] == TArray<int32>({ 1 }));
+	TestTrue(TEXT("Far instance draws LOD 2"), Result.InstancesPerLOD[2] == TArray<int32>({ 2 }));
+
+	// A larger distance factor pulls every instance towards more detail
+	Params.LODDistanceFactor = 100.0f;
+	FRealtimeMeshInstanceCulling::CullAndSelectLODs(Params, Instances, Result);
+	TestEqual(TEXT("Distance factor raises detail"), Result.InstancesPerLOD[0].Num(), 2);
+
+	// The minimum LOD clamps even the nearest instance
+	Params.LODDistanceFactor = 1.0f;
+	Params.MinLOD = 1;
+	FRealtimeMeshInstanceCulling::CullAndSelectLODs(Params, Instances, Result);
+	TestEqual(TEXT("Min LOD leaves LOD 0 empty"), Result.InstancesPerLOD[0].Num(), 0);
+	TestEqual(TEXT("Min LOD moves the near instance down"), Result.InstancesPerLOD[1].Num(), 2);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshInstanceCullingInactiveLODTest,
+	"RealtimeMeshComponent.Instancing.InactiveLODs",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshInstanceCullingInactiveLODTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshInstanceCullingParams Params = MakeTestCullingParams();
+
+	TArray<FMatrix> Instances;
+	Instances.Add(FTranslationMatrix(FVector(100, 0, 0)));
+	Instances.Add(FTranslationMatrix(FVector(800, 0, 0)));
+	Instances.Add(FTranslationMatrix(FVector(100000, 0, 0)));
+
+	// An inactive LOD is covered by the next more detailed active one
+	Params.ActiveLODs = { true, false, true };
+	FRealtimeMeshInstanceCullingResult Result;
+	FRealtimeMeshInstanceCulling::CullAndSelectLODs(Params, Instances, Result);
+	TestTrue(TEXT("Mid instance skips the inactive LOD 1"), Result.InstancesPerLOD[0] == TArray<int32>({ 0, 1 }));
+	TestEqual(TEXT("Inactive LOD draws nothing"), Result.InstancesPerLOD[1].Num(), 0);
+
+	// Instances larger than every active threshold fall back to the first resident LOD, not LOD 0
+	Params.ActiveLODs = { false, true, true };
+	Params.FirstLOD = 1;
+	FRealtimeMeshInstanceCulling::CullAndSelectLODs(Params, Instances, Result);
+	TestEqual(TEXT("Evicted LOD 0 draws nothing"), Result.InstancesPerLOD[0].Num(), 0);
+	TestTrue(TEXT("Near instance falls back to the first LOD"), Result.InstancesPerLOD[1] == TArray<int32>({ 0, 1 }));
+
+	// The largest visible instance is what gets reported for LOD residency
+	const float NearScreenRadiusSquared = FRealtimeMeshInstanceCulling::ComputeScreenRadiusSquared(Params, Params.LocalBounds.TransformBy(Instances[0]));
+	TestEqual(TEXT("Max screen size comes from the nearest instance"), Result.MaxScreenRadiusSquared, NearScreenRadiusSquared);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshInstanceCullingRunsTest,
+	"RealtimeMeshComponent.Instancing.InstanceRuns",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshInstanceCullingRunsTest::RunTest(const FString& Parameters)
+{
+	TArray<uint32> Runs;
+	FRealtimeMeshInstanceCulling::BuildInstanceRuns(TArray<int32>({ 0, 1, 2, 5, 7, 8 }), Runs);
+	TestTrue(TEXT("Contiguous instances collapse into inclusive runs"), Runs == TArray<uint32>({ 0, 2, 5, 5, 7, 8 }));
+
+	FRealtimeMeshInstanceCulling::BuildInstanceRuns(TArray<int32>(), Runs);
+	TestEqual(TEXT("No instances means no runs"), Runs.Num(), 0);
+
+	return true;
+}
@@ -0,0 +1,554 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "RenderProxy/RealtimeMeshProxyCommandBatch.h"
+#include "Core/RealtimeMeshDataStream.h"
+#include "Core/RealtimeMeshBuilder.h"
+#include "Data/RealtimeMeshData.h"
+#include "Data/RealtimeMeshUpdateBuilder.h"
+#include "RealtimeMeshCore.h"
+#include "RealtimeMeshSimple.h"
+#include "RenderingThread.h"
+#include "RenderProxy/RealtimeMeshProxy.h"
+#include "RenderProxy/RealtimeMeshComponentProxy.h"
+#include "RenderProxy/RealtimeMeshLODProxy.h"
+#include "RenderProxy/RealtimeMeshSectionGroupProxy.h"
+#include "RealtimeMeshComponent.h"
+#include "Engine/World.h"
+#include "Misc/App.h"
+#include "RenderUtils.h"
+#include "Async/TaskGraphInterfaces.h"
+
+using namespace RealtimeMesh;
+
+namespace
+{
+	FRealtimeMeshSectionGroupStreamUpdateDataRef MakeTestStreamUpdate(const FRealtimeMeshStreamKey& StreamKey, int32 NumElements)
+	{
+		FRealtimeMeshStream Stream(StreamKey, GetRealtimeMeshBufferLayout<FVector3f>());
+		Stream.SetNumZeroed(NumElements);
+		return MakeShared<FRealtimeMeshSectionGroupStreamUpdateData>(MoveTemp(Stream), EBufferUsageFlags::Static);
+	}
+
+	void ProcessProxyCommandsNow(const FRealtimeMeshProxyRef& Proxy)
+	{
+		ENQUEUE_RENDER_COMMAND(RealtimeMeshTestProcessCommands)([Proxy](FRHICommandListImmediate& RHICmdList)
+		{
+			Proxy->ProcessCommands(RHICmdList);
+		});
+		FlushRenderingCommands();
+	}
+
+	void FlushComponentRenderUpdates(UWorld* World)
+	{
+		// Static update notifications and render state recreation both bounce through the game thread
+		for (int32 Pass = 0; Pass < 3; Pass++)
+		{
+			FlushRenderingCommands();
+			FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+			World->SendAllEndOfFrameUpdates();
+		}
+		FlushRenderingCommands();
+	}
+
+	FRealtimeMeshProxyCommand MakeTestSectionGroupTask(const FRealtimeMeshSectionGroupKey& SectionGroupKey, const FRealtimeMeshHandle& SectionGroupHandle)
+	{
+		return FRealtimeMeshProxyCommand::MakeTask(SectionGroupKey, SectionGroupHandle, [](FRHICommandListBase&, FRealtimeMeshProxyCommandContext&) { });
+	}
+}
+
+// =====================================================================================================================
+// Stream Coalescing Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshProxyCommandCoalesceStreamsTest,
+	"RealtimeMeshComponent.ProxyCommands.Coalesce.Streams",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshProxyCommandCoalesceStreamsTest::RunTest(const FString& Parameters)
+{
+	const FRealtimeMeshSectionGroupKey GroupA = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("GroupA"));
+	const FRealtimeMeshSectionGroupKey GroupB = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("GroupB"));
+	const FRealtimeMeshHandle HandleA(0, 1);
+	const FRealtimeMeshHandle HandleB(1, 1);
+
+	// Last write per stream wins
+	{
+		const auto FinalPositions = MakeTestStreamUpdate(FRealtimeMeshStreams::Position, 3);
+
+		TArray<FRealtimeMeshProxyCommand> Commands;
+		Commands.Add(FRealtimeMeshProxyCommand::MakeCreateOrUpdateStream(GroupA, HandleA, MakeTestStreamUpdate(FRealtimeMeshStreams::Position, 1)));
+		Commands.Add(FRealtimeMeshProxyCommand::MakeCreateOrUpdateStream(GroupA, HandleA, MakeTestStreamUpdate(FRealtimeMeshStreams::Tangents, 1)));
+		Commands.Add(MakeTestSectionGroupTask(GroupA, HandleA));
+		Commands.Add(FRealtimeMeshProxyCommand::MakeCreateOrUpdateStream(GroupB, HandleB, MakeTestStreamUpdate(FRealtimeMeshStreams::Position, 2)));
+		Commands.Add(FRealtimeMeshProxyCommand::MakeCreateOrUpdateStream(GroupA, HandleA, FinalPositions));
+
+		TestEqual(TEXT("Overwritten upload is dropped"), FRealtimeMeshProxyCommand::Coalesce(Commands), 1);
+		TestEqual(TEXT("Remaining commands"), Commands.Num(), 4);
+		TestTrue(TEXT("Order of the rest is preserved"), Commands[0].StreamKey == FRealtimeMeshStreams::Tangents && Commands[1].Type == ERealtimeMeshProxyCommandType::Task);
+		TestTrue(TEXT("Other section groups are untouched"), Commands[2].SectionGroupHandle == HandleB);
+		TestTrue(TEXT("Final write is the one kept"), Commands[3].StreamData.Get() == &FinalPositions.Get());
+	}
+
+	// Add followed by remove cancels the upload
+	{
+		TArray<FRealtimeMeshProxyCommand> Commands;
+		Commands.Add(FRealtimeMeshProxyCommand::MakeCreateOrUpdateStream(GroupA, HandleA, MakeTestStreamUpdate(FRealtimeMeshStreams::Color, 4)));
+		Commands.Add(FRealtimeMeshProxyCommand::MakeRemoveStream(GroupA, HandleA, FRealtimeMeshStreams::Color));
+
+		TestEqual(TEXT("Upload before remove is dropped"), FRealtimeMeshProxyCommand::Coalesce(Commands), 1);
+		TestTrue(TEXT("Only the remove is left"), Commands.Num() == 1 && Commands[0].Type == ERealtimeMeshProxyCommandType::RemoveStream);
+	}
+
+	// Nothing merges across an opaque mesh level task
+	{
+		TArray<FRealtimeMeshProxyCommand> Commands;
+		Commands.Add(FRealtimeMeshProxyCommand::MakeCreateOrUpdateStream(GroupA, HandleA, MakeTestStreamUpdate(FRealtimeMeshStreams::Position, 1)));
+		Commands.Add(FRealtimeMeshProxyCommand::MakeTask([](FRHICommandListBase&, FRealtimeMeshProxyCommandContext&) { }));
+		Commands.Add(FRealtimeMeshProxyCommand::MakeCreateOrUpdateStream(GroupA, HandleA, MakeTestStreamUpdate(FRealtimeMeshStreams::Position, 1)));
+
+		TestEqual(TEXT("Barrier prevents merging"), FRealtimeMeshProxyCommand::Coalesce(Commands), 0);
+		TestEqual(TEXT("All commands kept"), Commands.Num(), 3);
+	}
+
+	return true;
+}
+
+// =====================================================================================================================
+// Section Group Coalescing Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshProxyCommandCoalesceSectionGroupsTest,
+	"RealtimeMeshComponent.ProxyCommands.Coalesce.SectionGroups",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshProxyCommandCoalesceSectionGroupsTest::RunTest(const FString& Parameters)
+{
+	const FRealtimeMeshSectionGroupKey GroupA = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("GroupA"));
+	const FRealtimeMeshSectionGroupKey GroupB = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("GroupB"));
+	const FRealtimeMeshSectionKey SectionA = FRealtimeMeshSectionKey::CreateForPolyGroup(GroupA, 0);
+	const FRealtimeMeshHandle HandleA(0, 1);
+	const FRealtimeMeshHandle HandleB(1, 1);
+	const FRealtimeMeshHandle SectionHandleA(0, 1);
+	// Recreating a section group always gives it a new handle
+	const FRealtimeMeshHandle RecreatedHandleA(0, 2);
+
+	// Create, fill and remove collapses to just the remove
+	{
+		TArray<FRealtimeMeshProxyCommand> Commands;
+		Commands.Add(FRealtimeMeshProxyCommand::MakeCreateSectionGroup(GroupA, HandleA));
+		Commands.Add(FRealtimeMeshProxyCommand::MakeCreateSectionGroup(GroupB, HandleB));
+		Commands.Add(FRealtimeMeshProxyCommand::MakeCreateOrUpdateStream(GroupA, HandleA, MakeTestStreamUpdate(FRealtimeMeshStreams::Position, 8)));
+		Commands.Add(MakeTestSectionGroupTask(GroupA, HandleA));
+		Commands.Add(FRealtimeMeshProxyCommand::MakeTask(SectionA, HandleA, SectionHandleA, [](FRHICommandListBase&, FRealtimeMeshProxyCommandContext&) { }));
+		Commands.Add(FRealtimeMeshProxyCommand::MakeRemoveSectionGroup(GroupA, HandleA));
+
+		TestEqual(TEXT("Everything before the remove is dropped"), FRealtimeMeshProxyCommand::Coalesce(Commands), 4);
+		TestEqual(TEXT("Remaining commands"), Commands.Num(), 2);
+		TestTrue(TEXT("Unrelated section group is kept"), Commands[0].Type == ERealtimeMeshProxyCommandType::CreateSectionGroup && Commands[0].SectionGroupHandle == HandleB);
+		TestTrue(TEXT("Remove is kept"), Commands[1].Type == ERealtimeMeshProxyCommandType::RemoveSectionGroup && Commands[1].SectionGroupHandle == HandleA);
+	}
+
+	// Recreating after a remove keeps the new contents
+	{
+		TArray<FRealtimeMeshProxyCommand> Commands;
+		Commands.Add(FRealtimeMeshProxyCommand::MakeCreateOrUpdateStream(GroupA, HandleA, MakeTestStreamUpdate(FRealtimeMeshStreams::Position, 8)));
+		Commands.Add(FRealtimeMeshProxyCommand::MakeRemoveSectionGroup(GroupA, HandleA));
+		Commands.Add(FRealtimeMeshProxyCommand::MakeCreateSectionGroup(GroupA, RecreatedHandleA));
+		Commands.Add(FRealtimeMeshProxyCommand::MakeCreateOrUpdateStream(GroupA, RecreatedHandleA, MakeTestStreamUpdate(FRealtimeMeshStreams::Position, 8)));
+
+		TestEqual(TEXT("Only the stale upload is dropped"), FRealtimeMeshProxyCommand::Coalesce(Commands), 1);
+		TestTrue(TEXT("Remove, create and upload remain in order"), Commands.Num() == 3 &&
+			Commands[0].Type == ERealtimeMeshProxyCommandType::RemoveSectionGroup &&
+			Commands[1].Type == ERealtimeMeshProxyCommandType::CreateSectionGroup &&
+			Commands[2].Type == ERealtimeMeshProxyCommandType::CreateOrUpdateStream);
+	}
+
+	return true;
+}
+
+// =====================================================================================================================
+// Command Context Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshProxyCommandContextHandlesTest,
+	"RealtimeMeshComponent.ProxyCommands.Context.Handles",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshProxyCommandContextHandlesTest::RunTest(const FString& Parameters)
+{
+	URealtimeMeshSimple* RealtimeMesh = NewObject<URealtimeMeshSimple>();
+	const FRealtimeMeshProxyPtr Proxy = RealtimeMesh->GetMesh()->GetRenderProxy(true);
+	if (!Proxy.IsValid())
+	{
+		AddInfo(TEXT("Rendering is unavailable, skipping command context checks."));
+		return true;
+	}
+	ProcessProxyCommandsNow(Proxy.ToSharedRef());
+
+	const FRealtimeMeshSectionGroupKey GroupA = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("ContextGroupA"));
+	const FRealtimeMeshSectionGroupKey GroupB = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("ContextGroupB"));
+
+	// Handles as the game thread LOD would hand them out, GroupB reuses the slot GroupA leaves behind
+	TRealtimeMeshSlotArray<FRealtimeMeshSectionGroupKey> GameSlots;
+	const FRealtimeMeshHandle HandleA = GameSlots.Add(GroupA);
+	GameSlots.Remove(HandleA);
+	const FRealtimeMeshHandle HandleB = GameSlots.Add(GroupB);
+	const FRealtimeMeshHandle RecreatedHandleA = GameSlots.Add(GroupA);
+
+	bool bHasLOD = false;
+	bool bFound = false;
+	bool bRemovedIsGone = false;
+	bool bReusedSlotResolvesToItsOwner = false;
+	bool bRecreatedIsFound = false;
+
+	// Removing and creating section groups mid batch never invalidates the context, stale handles must simply stop resolving
+	ENQUEUE_RENDER_COMMAND(RealtimeMeshTestCommandContext)([&](FRHICommandListImmediate& RHICmdList)
+	{
+		FRealtimeMeshProxyCommandContext Context(*Proxy);
+		FRealtimeMeshLODProxy* LOD = Context.FindLOD(FRealtimeMeshLODKey(0));
+		bHasLOD = LOD != nullptr;
+		if (!LOD)
+		{
+			return;
+		}
+
+		LOD->CreateSectionGroupIfNotExists(GroupA, HandleA);
+		const FRealtimeMeshSectionGroupProxy* First = Context.FindSectionGroup(GroupA.LOD(), HandleA);
+		bFound = First != nullptr && First->GetKey() == GroupA && LOD->FindSectionGroupHandle(GroupA) == HandleA;
+
+		LOD->RemoveSectionGroup(HandleA);
+		bRemovedIsGone = Context.FindSectionGroup(GroupA.LOD(), HandleA) == nullptr && !LOD->GetSectionGroup(GroupA).IsValid();
+
+		LOD->CreateSectionGroupIfNotExists(GroupB, HandleB);
+		const FRealtimeMeshSectionGroupProxy* Other = Context.FindSectionGroup(GroupB.LOD(), HandleB);
+		bReusedSlotResolvesToItsOwner = Other != nullptr && Other->GetKey() == GroupB && Context.FindSectionGroup(GroupA.LOD(), HandleA) == nullptr;
+
+		LOD->CreateSectionGroupIfNotExists(GroupA, RecreatedHandleA);
+		const FRealtimeMeshSectionGroupProxy* Recreated = Context.FindSectionGroup(GroupA.LOD(), RecreatedHandleA);
+		bRecreatedIsFound = Recreated != nullptr && Recreated->GetKey() == GroupA && Recreated != Other;
+
+		LOD->RemoveSectionGroup(RecreatedHandleA);
+		LOD->RemoveSectionGroup(HandleB);
+	});
+	FlushRenderingCommands();
+
+	if (!TestTrue(TEXT("The proxy has a first LOD"), bHasLOD))
+	{
+		return false;
+	}
+	TestTrue(TEXT("Section groups resolve by handle"), bFound);
+	TestTrue(TEXT("A removed section group no longer resolves"), bRemovedIsGone);
+	TestTrue(TEXT("A reused slot resolves only for the section group now in it"), bReusedSlotResolvesToItsOwner);
+	TestTrue(TEXT("A recreated section group is found again"), bRecreatedIsFound);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshProxyCommandMirroredHandlesTest,
+	"RealtimeMeshComponent.ProxyCommands.Context.MirroredHandles",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshProxyCommandMirroredHandlesTest::RunTest(const FString& Parameters)
+{
+	URealtimeMeshSimple* RealtimeMesh = NewObject<URealtimeMeshSimple>();
+	const FRealtimeMeshProxyPtr Proxy = RealtimeMesh->GetMesh()->GetRenderProxy(true);
+	if (!Proxy.IsValid())
+	{
+		AddInfo(TEXT("Rendering is unavailable, skipping mirrored handle checks."));
+		return true;
+	}
+
+	FRealtimeMeshStreamSet StreamSet;
+	{
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(StreamSet);
+		Builder.EnableTangents();
+		Builder.EnablePolyGroups();
+		Builder.AddVertex(FVector3f(0, 0, 0));
+		Builder.AddVertex(FVector3f(100, 0, 0));
+		Builder.AddVertex(FVector3f(100, 100, 0));
+		Builder.AddTriangle(0, 1, 2, 0);
+	}
+
+	const FRealtimeMeshSectionGroupKey RemovedKey = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("MirroredRemoved"));
+	const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("Mirrored"));
+	const FRealtimeMeshSectionKey SectionKey = FRealtimeMeshSectionKey::CreateForPolyGroup(GroupKey, 0);
+
+	// Leave a hole behind so the next section group reuses a slot
+	RealtimeMesh->CreateSectionGroup(RemovedKey, StreamSet);
+	RealtimeMesh->RemoveSectionGroup(RemovedKey);
+	RealtimeMesh->CreateSectionGroup(GroupKey, StreamSet);
+	ProcessProxyCommandsNow(Proxy.ToSharedRef());
+
+	FRealtimeMeshHandle GroupHandle;
+	FRealtimeMeshHandle SectionHandle;
+	{
+		FRealtimeMeshAccessContext AccessContext(RealtimeMesh->GetMesh());
+		const auto SectionGroup = RealtimeMesh->GetSectionGroup(GroupKey);
+		const auto Section = SectionGroup.IsValid() ? SectionGroup->GetSection(AccessContext, SectionKey) : FRealtimeMeshSectionPtr();
+		if (!TestTrue(TEXT("The section group and its section exist"), Section.IsValid()))
+		{
+			return false;
+		}
+		GroupHandle = SectionGroup->GetHandle(AccessContext);
+		SectionHandle = Section->GetHandle(AccessContext);
+	}
+
+	bool bGroupMirrored = false;
+	bool bSectionMirrored = false;
+	ENQUEUE_RENDER_COMMAND(RealtimeMeshTestMirroredHandles)([&](FRHICommandListImmediate& RHICmdList)
+	{
+		const FRealtimeMeshProxyCommandContext Context(*Proxy);
+		const FRealtimeMeshSectionGroupProxy* SectionGroup = Context.FindSectionGroup(GroupKey.LOD(), GroupHandle);
+		const FRealtimeMeshSectionProxy* Section = Context.FindSection(GroupKey.LOD(), GroupHandle, SectionHandle);
+		bGroupMirrored = SectionGroup != nullptr && SectionGroup->GetKey() == GroupKey;
+		bSectionMirrored = Section != nullptr && Section->GetKey() == SectionKey;
+	});
+	FlushRenderingCommands();
+
+	TestTrue(TEXT("The proxy section group sits at the game thread handle"), bGroupMirrored);
+	TestTrue(TEXT("The proxy section sits at the game thread handle"), bSectionMirrored);
+
+	return true;
+}
+
+// =====================================================================================================================
+// Static Draw Update Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshProxyStaticUpdateTest,
+	"RealtimeMeshComponent.ProxyCommands.StaticUpdates",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshProxyStaticUpdateTest::RunTest(const FString& Parameters)
+{
+	URealtimeMeshSimple* RealtimeMesh = NewObject<URealtimeMeshSimple>();
+
+	// Commands are only built once there is a render proxy to send them to
+	if (!RealtimeMesh->GetMesh()->GetRenderProxy(true).IsValid())
+	{
+		AddInfo(TEXT("Rendering is unavailable, skipping proxy update checks."));
+		return true;
+	}
+
+	FRealtimeMeshStreamSet StreamSet;
+	{
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(StreamSet);
+		Builder.EnableTangents();
+		Builder.EnablePolyGroups();
+		Builder.AddVertex(FVector3f(0, 0, 0));
+		Builder.AddVertex(FVector3f(100, 0, 0));
+		Builder.AddVertex(FVector3f(100, 100, 0));
+		Builder.AddVertex(FVector3f(0, 100, 0));
+		Builder.AddTriangle(0, 1, 2, 0);
+		Builder.AddTriangle(0, 2, 3, 1);
+	}
+
+	const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("StaticUpdates"));
+	const FRealtimeMeshSectionKey SectionKey = FRealtimeMeshSectionKey::CreateForPolyGroup(GroupKey, 0);
+	RealtimeMesh->CreateSectionGroup(GroupKey, StreamSet, FRealtimeMeshSectionGroupConfig(ERealtimeMeshSectionDrawType::Static));
+
+	FRealtimeMeshStatCounters& Counters = FRealtimeMeshStatCounters::Get();
+	const int64 RecreatesBefore = Counters.ProxyRecreateRequests;
+	const int64 StaticUpdatesBefore = Counters.StaticMeshUpdateRequests;
+
+	RealtimeMesh->SetSectionVisibility(SectionKey, false);
+	RealtimeMesh->SetSectionCastShadow(SectionKey, false);
+	RealtimeMesh->UpdateSectionGroup(GroupKey, StreamSet);
+
+	TestEqual(TEXT("In place static changes never recreate the proxy"), static_cast<int64>(Counters.ProxyRecreateRequests), RecreatesBefore);
+	TestEqual(TEXT("Each in place static change re-caches static meshes"), static_cast<int64>(Counters.StaticMeshUpdateRequests) - StaticUpdatesBefore, static_cast<int64>(3));
+
+	RealtimeMesh->RemoveSectionGroup(GroupKey);
+	TestEqual(TEXT("Removing a static section group still recreates the proxy"), static_cast<int64>(Counters.ProxyRecreateRequests) - RecreatesBefore, static_cast<int64>(1));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshProxyStaticSectionAddedTest,
+	"RealtimeMeshComponent.ProxyCommands.StaticSectionAdded",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshProxyStaticSectionAddedTest::RunTest(const FString& Parameters)
+{
+	if (!FApp::CanEverRender())
+	{
+		AddInfo(TEXT("Rendering is unavailable, skipping static section checks."));
+		return true;
+	}
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	URealtimeMeshComponent* Component = NewObject<URealtimeMeshComponent>(World);
+	URealtimeMeshSimple* RealtimeMesh = Component->InitializeRealtimeMesh<URealtimeMeshSimple>();
+
+	FRealtimeMeshStreamSet StreamSet;
+	{
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(StreamSet);
+		Builder.EnableTangents();
+		Builder.AddVertex(FVector3f(0, 0, 0));
+		Builder.AddVertex(FVector3f(100, 0, 0));
+		Builder.AddVertex(FVector3f(100, 100, 0));
+		Builder.AddVertex(FVector3f(0, 100, 0));
+		Builder.AddTriangle(0, 1, 2);
+		Builder.AddTriangle(0, 2, 3);
+	}
+
+	// Sections on different material slots so their draw ranges are never merged into one batch
+	const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("StaticSectionAdded"));
+	RealtimeMesh->CreateSectionGroup(GroupKey, StreamSet, FRealtimeMeshSectionGroupConfig(ERealtimeMeshSectionDrawType::Static), false);
+	RealtimeMesh->CreateSection(FRealtimeMeshSectionKey::Create(GroupKey, FName("First")), FRealtimeMeshSectionConfig(0), FRealtimeMeshStreamRange(0, 4, 0, 3));
+
+	// Shadow casting sections get a second, shadow only, batch each
+	Component->SetCastShadow(false);
+	Component->RegisterComponentWithWorld(World);
+	FlushComponentRenderUpdates(World);
+
+	const auto GetNumStaticBatches = [Component]()
+	{
+		const auto* SceneProxy = static_cast<const FRealtimeMeshComponentSceneProxy*>(Component->SceneProxy);
+		return SceneProxy ? SceneProxy->GetNumStaticMeshBatches() : 0;
+	};
+	TestEqual(TEXT("The section present at registration is drawn through the static path"), GetNumStaticBatches(), 1);
+
+	RealtimeMesh->CreateSection(FRealtimeMeshSectionKey::Create(GroupKey, FName("Second")), FRealtimeMeshSectionConfig(1), FRealtimeMeshStreamRange(0, 4, 3, 6));
+	FlushComponentRenderUpdates(World);
+	TestEqual(TEXT("A section added after registration is gathered into the static draws"), GetNumStaticBatches(), 2);
+
+	Component->UnregisterComponent();
+	World->DestroyWorld(false);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshProxyStaticTogglesTest,
+	"RealtimeMeshComponent.ProxyCommands.StaticToggles",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshProxyStaticTogglesTest::RunTest(const FString& Parameters)
+{
+	if (!FApp::CanEverRender())
+	{
+		AddInfo(TEXT("Rendering is unavailable, skipping static toggle checks."));
+		return true;
+	}
+
+	// The static ray tracing instance is built from the segments of the visible sections, so there a toggle still rebuilds
+	if (IsRayTracingEnabled())
+	{
+		AddInfo(TEXT("Ray tracing is enabled, skipping static toggle checks."));
+		return true;
+	}
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	URealtimeMeshComponent* Component = NewObject<URealtimeMeshComponent>(World);
+	URealtimeMeshSimple* RealtimeMesh = Component->InitializeRealtimeMesh<URealtimeMeshSimple>();
+
+	FRealtimeMeshStreamSet StreamSet;
+	{
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(StreamSet);
+		Builder.EnableTangents();
+		Builder.AddVertex(FVector3f(0, 0, 0));
+		Builder.AddVertex(FVector3f(100, 0, 0));
+		Builder.AddVertex(FVector3f(100, 100, 0));
+		Builder.AddVertex(FVector3f(0, 100, 0));
+		Builder.AddTriangle(0, 1, 2);
+		Builder.AddTriangle(0, 2, 3);
+	}
+
+	const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("StaticToggles"));
+	const FRealtimeMeshSectionKey FirstKey = FRealtimeMeshSectionKey::Create(GroupKey, FName("First"));
+	const FRealtimeMeshSectionKey SecondKey = FRealtimeMeshSectionKey::Create(GroupKey, FName("Second"));
+	RealtimeMesh->CreateSectionGroup(GroupKey, StreamSet, FRealtimeMeshSectionGroupConfig(ERealtimeMeshSectionDrawType::Static), false);
+	RealtimeMesh->CreateSection(FirstKey, FRealtimeMeshSectionConfig(0), FRealtimeMeshStreamRange(0, 4, 0, 3));
+	RealtimeMesh->CreateSection(SecondKey, FRealtimeMeshSectionConfig(1), FRealtimeMeshStreamRange(0, 4, 3, 6));
+
+	Component->RegisterComponentWithWorld(World);
+	FlushComponentRenderUpdates(World);
+
+	const FPrimitiveSceneProxy* InitialSceneProxy = Component->SceneProxy;
+	const auto GetNumStaticBatches = [Component]()
+	{
+		const auto* SceneProxy = static_cast<const FRealtimeMeshComponentSceneProxy*>(Component->SceneProxy);
+		return SceneProxy ? SceneProxy->GetNumStaticMeshBatches() : 0;
+	};
+	if (!TestNotNull(TEXT("The component has a scene proxy"), InitialSceneProxy))
+	{
+		World->DestroyWorld(false);
+		return false;
+	}
+	TestEqual(TEXT("Each shadow casting section has a main pass and a shadow batch"), GetNumStaticBatches(), 4);
+
+	FRealtimeMeshStatCounters& Counters = FRealtimeMeshStatCounters::Get();
+	const int64 RecreatesBefore = Counters.ProxyRecreateRequests;
+
+	// Every toggle goes through the render thread's layout check before it is refreshed in place
+	RealtimeMesh->SetSectionVisibility(FirstKey, false);
+	FlushComponentRenderUpdates(World);
+	RealtimeMesh->SetSectionCastShadow(SecondKey, false);
+	FlushComponentRenderUpdates(World);
+	RealtimeMesh->SetSectionVisibility(SecondKey, false);
+	FlushComponentRenderUpdates(World);
+	TestEqual(TEXT("Hiding every section keeps their batches gathered"), GetNumStaticBatches(), 4);
+
+	RealtimeMesh->SetSectionVisibility(FirstKey, true);
+	RealtimeMesh->SetSectionVisibility(SecondKey, true);
+	RealtimeMesh->SetSectionCastShadow(SecondKey, true);
+	FlushComponentRenderUpdates(World);
+
+	TestEqual(TEXT("Visibility and shadow toggles never recreate the proxy"), static_cast<int64>(Counters.ProxyRecreateRequests), RecreatesBefore);
+	TestTrue(TEXT("The scene proxy gathered at registration is still the one in use"), Component->SceneProxy == InitialSceneProxy);
+	TestEqual(TEXT("Showing the sections again keeps the same batches"), GetNumStaticBatches(), 4);
+
+	// Anything else that changes the gathered batches still falls back to a recreation, and is counted as one
+	RealtimeMesh->UpdateSectionRange(SecondKey, FRealtimeMeshStreamRange(0, 4, 0, 6));
+	FlushComponentRenderUpdates(World);
+	TestEqual(TEXT("A range change is counted as a proxy recreation"), static_cast<int64>(Counters.ProxyRecreateRequests) - RecreatesBefore, static_cast<int64>(1));
+
+	Component->UnregisterComponent();
+	World->DestroyWorld(false);
+	return true;
+}
+
+// =====================================================================================================================
+// Proxy State Version Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshProxyStateVersionTest,
+	"RealtimeMeshComponent.ProxyCommands.StateVersion",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshProxyStateVersionTest::RunTest(const FString& Parameters)
+{
+	URealtimeMeshSimple* RealtimeMesh = NewObject<URealtimeMeshSimple>();
+
+	const FRealtimeMeshProxyPtr Proxy = RealtimeMesh->GetMesh()->GetRenderProxy(true);
+	if (!Proxy.IsValid())
+	{
+		AddInfo(TEXT("Rendering is unavailable, skipping proxy state version checks."));
+		return true;
+	}
+
+	FRealtimeMeshStreamSet StreamSet;
+	{
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(StreamSet);
+		Builder.EnableTangents();
+		Builder.AddVertex(FVector3f(0, 0, 0));
+		Builder.AddVertex(FVector3f(100, 0, 0));
+		Builder.AddVertex(FVector3f(100, 100, 0));
+		Builder.AddTriangle(0, 1, 2);
+	}
+
+	const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("StateVersion"));
+	RealtimeMesh->CreateSectionGroup(GroupKey, StreamSet, FRealtimeMeshSectionGroupConfig(ERealtimeMeshSectionDrawType::Dynamic));
+	ProcessProxyCommandsNow(Proxy.ToSharedRef());
+
+	// Cached batch templates are keyed off this, so it must only move when the proxy state actually changes
+	const uint32 VersionAfterCreate = Proxy->GetStateVersion();
+	ProcessProxyCommandsNow(Proxy.ToSharedRef());
+	TestEqual(TEXT("Processing with nothing queued keeps the version"), Proxy->GetStateVersion(), VersionAfterCreate);
+
+	RealtimeMesh->SetSectionVisibility(FRealtimeMeshSectionKey::CreateForPolyGroup(GroupKey, 0), false);
+	ProcessProxyCommandsNow(Proxy.ToSharedRef());
+	TestNotEqual(TEXT("A section change bumps the version"), Proxy->GetStateVersion(), VersionAfterCreate);
+
+	return true;
+}
@@ -0,0 +1,214 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "RenderProxy/RealtimeMeshRayTracing.h"
+#include "RenderProxy/RealtimeMeshSectionGroupProxy.h"
+
+using namespace RealtimeMesh;
+
+namespace
+{
+	template<typename IndexType>
+	FRealtimeMeshStream MakeSequentialIndexStream(int32 NumTriangles)
+	{
+		FRealtimeMeshStream Stream = FRealtimeMeshStream::Create<TIndex3<IndexType>>(FRealtimeMeshStreams::Triangles);
+		Stream.SetNumUninitialized(NumTriangles);
+		IndexType* Indices = Stream.GetData<IndexType>();
+		for (int32 Index = 0; Index < NumTriangles * 3; Index++)
+		{
+			Indices[Index] = static_cast<IndexType>(Index);
+		}
+		return Stream;
+	}
+
+	FRealtimeMeshStreamRange MakeIndexRange(int32 FirstIndex, int32 NumIndices)
+	{
+		return FRealtimeMeshStreamRange(0, 0, FirstIndex, FirstIndex + NumIndices);
+	}
+
+	bool CompactedMatches(const FRealtimeMeshRayTracingIndexCompactor& Compactor, TConstArrayView<FRealtimeMeshStreamRange> Ranges)
+	{
+		TArray<uint32> Expected;
+		for (const FRealtimeMeshStreamRange& Range : Ranges)
+		{
+			for (int32 Index = Range.GetMinIndex(); Index <= Range.GetMaxIndex(); Index++)
+			{
+				Expected.Add(Index);
+			}
+		}
+		return TArray<uint32>(Compactor.GetIndices()) == Expected;
+	}
+}
+
+// =====================================================================================================================
+// Ray Tracing Update Policy Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshRayTracingUpdatePolicyTest,
+	"RealtimeMeshComponent.RayTracing.UpdatePolicy",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshRayTracingUpdatePolicyTest::RunTest(const FString& Parameters)
+{
+	using EAction = ERealtimeMeshRayTracingUpdateAction;
+
+	FRealtimeMeshRayTracingBuildState Empty;
+
+	FRealtimeMeshRayTracingBuildState Built;
+	Built.bHasValidGeometry = true;
+	Built.bGeometryAllowsUpdate = true;
+
+	FRealtimeMeshRayTracingUpdateRequest Request;
+	Request.bShouldHaveGeometry = true;
+	Request.bAllowRefit = true;
+	Request.MaxRefitsBeforeRebuild = 4;
+
+	TestTrue(TEXT("First build is a rebuild"), FRealtimeMeshRayTracingUpdatePolicy::Decide(Empty, Request) == EAction::Rebuild);
+	TestTrue(TEXT("Nothing changed does nothing"), FRealtimeMeshRayTracingUpdatePolicy::Decide(Built, Request) == EAction::None);
+
+	FRealtimeMeshRayTracingUpdateRequest VertexUpdate = Request;
+	VertexUpdate.bVerticesChanged = true;
+	TestTrue(TEXT("Vertex only change refits"), FRealtimeMeshRayTracingUpdatePolicy::Decide(Built, VertexUpdate) == EAction::Refit);
+
+	FRealtimeMeshRayTracingUpdateRequest TopologyUpdate = VertexUpdate;
+	TopologyUpdate.bTopologyChanged = true;
+	TestTrue(TEXT("Topology change rebuilds"), FRealtimeMeshRayTracingUpdatePolicy::Decide(Built, TopologyUpdate) == EAction::Rebuild);
+
+	FRealtimeMeshRayTracingUpdateRequest SettingsUpdate = Request;
+	SettingsUpdate.bBuildSettingsChanged = true;
+	TestTrue(TEXT("Build settings change rebuilds"), FRealtimeMeshRayTracingUpdatePolicy::Decide(Built, SettingsUpdate) == EAction::Rebuild);
+
+	FRealtimeMeshRayTracingUpdateRequest RefitDisabled = VertexUpdate;
+	RefitDisabled.bAllowRefit = false;
+	TestTrue(TEXT("Refit disabled rebuilds"), FRealtimeMeshRayTracingUpdatePolicy::Decide(Built, RefitDisabled) == EAction::Rebuild);
+
+	FRealtimeMeshRayTracingBuildState NotUpdatable = Built;
+	NotUpdatable.bGeometryAllowsUpdate = false;
+	TestTrue(TEXT("Geometry built without update support rebuilds"), FRealtimeMeshRayTracingUpdatePolicy::Decide(NotUpdatable, VertexUpdate) == EAction::Rebuild);
+
+	// Refit budget forces a periodic rebuild
+	FRealtimeMeshRayTracingBuildState Exhausted = Built;
+	Exhausted.NumRefitsSinceBuild = 3;
+	TestTrue(TEXT("Refit within budget"), FRealtimeMeshRayTracingUpdatePolicy::Decide(Exhausted, VertexUpdate) == EAction::Refit);
+	Exhausted.NumRefitsSinceBuild = 4;
+	TestTrue(TEXT("Refit budget exhausted rebuilds"), FRealtimeMeshRayTracingUpdatePolicy::Decide(Exhausted, VertexUpdate) == EAction::Rebuild);
+
+	FRealtimeMeshRayTracingUpdateRequest Unlimited = VertexUpdate;
+	Unlimited.MaxRefitsBeforeRebuild = 0;
+	TestTrue(TEXT("No budget refits forever"), FRealtimeMeshRayTracingUpdatePolicy::Decide(Exhausted, Unlimited) == EAction::Refit);
+
+	// Releasing
+	FRealtimeMeshRayTracingUpdateRequest NoGeometry;
+	TestTrue(TEXT("Existing geometry is released"), FRealtimeMeshRayTracingUpdatePolicy::Decide(Built, NoGeometry) == EAction::Release);
+	TestTrue(TEXT("Nothing to release"), FRealtimeMeshRayTracingUpdatePolicy::Decide(Empty, NoGeometry) == EAction::None);
+
+	return true;
+}
+
+// =====================================================================================================================
+// Ray Tracing Index Compaction Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshRayTracingIndexCompactionTest,
+	"RealtimeMeshComponent.RayTracing.IndexCompaction",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshRayTracingIndexCompactionTest::RunTest(const FString& Parameters)
+{
+	// Four sections of 2 triangles each, the second one hidden
+	const FRealtimeMeshStream IndexStream = MakeSequentialIndexStream<uint32>(8);
+
+	FRealtimeMeshRayTracingIndexCompactor Compactor;
+	TArray<FRealtimeMeshStreamRange> Ranges = { MakeIndexRange(0, 6), MakeIndexRange(12, 6), MakeIndexRange(18, 6) };
+
+	TestTrue(TEXT("First update changes"), Compactor.Update(IndexStream, Ranges, true));
+	TestTrue(TEXT("Visible ranges are packed without gaps"), CompactedMatches(Compactor, Ranges));
+	TestEqual(TEXT("Span count"), Compactor.GetSpans().Num(), 3);
+	TestEqual(TEXT("Last span is packed behind the others"), Compactor.GetSpans()[2].CompactedFirstIndex, 12);
+
+	TestFalse(TEXT("Same ranges don't change anything"), Compactor.Update(IndexStream, Ranges, false));
+	TestEqual(TEXT("Nothing gathered without changes"), Compactor.GetNumIndicesGatheredLastUpdate(), 0);
+
+	// Showing the hidden section only gathers that section, the rest is kept or moved
+	Ranges.Insert(MakeIndexRange(6, 6), 1);
+	TestTrue(TEXT("Showing a section changes"), Compactor.Update(IndexStream, Ranges, false));
+	TestTrue(TEXT("Shown section is packed in order"), CompactedMatches(Compactor, Ranges));
+	TestEqual(TEXT("Only the shown section is gathered"), Compactor.GetNumIndicesGatheredLastUpdate(), 6);
+
+	// Hiding one again gathers nothing, only moves the tail down
+	Ranges.RemoveAt(2);
+	TestTrue(TEXT("Hiding a section changes"), Compactor.Update(IndexStream, Ranges, false));
+	TestTrue(TEXT("Remaining sections are packed"), CompactedMatches(Compactor, Ranges));
+	TestEqual(TEXT("Hiding gathers nothing"), Compactor.GetNumIndicesGatheredLastUpdate(), 0);
+
+	// New index data always re-gathers everything
+	TestTrue(TEXT("Source change changes"), Compactor.Update(IndexStream, Ranges, true));
+	TestEqual(TEXT("Source change gathers everything"), Compactor.GetNumIndicesGatheredLastUpdate(), Compactor.Num());
+
+	// 16 bit sources widen to 32 bit
+	const FRealtimeMeshStream SmallIndexStream = MakeSequentialIndexStream<uint16>(8);
+	FRealtimeMeshRayTracingIndexCompactor SmallCompactor;
+	SmallCompactor.Update(SmallIndexStream, Ranges, true);
+	TestTrue(TEXT("16 bit indices are widened"), CompactedMatches(SmallCompactor, Ranges));
+
+	// Whether there's anything to compact, which decides if the proxy keeps its CPU copy of the indices
+	TestFalse(TEXT("A hidden section leaves a gap"), FRealtimeMeshRayTracingIndexCompactor::AreRangesContiguous(Ranges));
+	TestTrue(TEXT("Ranges out of order and overlapping still cover one block"),
+		FRealtimeMeshRayTracingIndexCompactor::AreRangesContiguous({ MakeIndexRange(12, 6), MakeIndexRange(0, 9), MakeIndexRange(6, 6) }));
+	TestFalse(TEXT("A range without a whole triangle doesn't fill a gap"),
+		FRealtimeMeshRayTracingIndexCompactor::AreRangesContiguous({ MakeIndexRange(0, 6), MakeIndexRange(6, 2), MakeIndexRange(12, 6) }));
+	TestTrue(TEXT("No ranges is nothing to compact"), FRealtimeMeshRayTracingIndexCompactor::AreRangesContiguous({}));
+
+	// Nothing visible
+	TestTrue(TEXT("Clearing ranges changes"), Compactor.Update(IndexStream, {}, false));
+	TestEqual(TEXT("Nothing left"), Compactor.Num(), 0);
+
+	return true;
+}
+
+// =====================================================================================================================
+// Static Ray Tracing Relevance Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshRayTracingStaticRelevanceTest,
+	"RealtimeMeshComponent.RayTracing.StaticRelevance",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshRayTracingStaticRelevanceTest::RunTest(const FString& Parameters)
+{
+	const FRealtimeMeshHandle SectionA(0, 1);
+	const FRealtimeMeshHandle SectionB(1, 1);
+
+	auto MakeDrawRange = [](const FRealtimeMeshHandle& Handle, int32 NumSections)
+	{
+		FRealtimeMeshSectionDrawRange DrawRange;
+		DrawRange.SectionHandle = Handle;
+		DrawRange.NumSections = NumSections;
+		return DrawRange;
+	};
+
+	const TArray<FRealtimeMeshHandle> Segments = { SectionB, SectionA };
+
+	TestTrue(TEXT("One batch per segment, in any order"), FRealtimeMeshSectionGroupProxy::CanDrawRangesUseStaticRayTracing(
+		{ MakeDrawRange(SectionA, 1), MakeDrawRange(SectionB, 1) }, Segments));
+	TestFalse(TEXT("Merged draw ranges can't map onto segments"), FRealtimeMeshSectionGroupProxy::CanDrawRangesUseStaticRayTracing(
+		{ MakeDrawRange(SectionA, 2) }, Segments));
+	TestFalse(TEXT("A batch without a segment needs the dynamic path"), FRealtimeMeshSectionGroupProxy::CanDrawRangesUseStaticRayTracing(
+		{ MakeDrawRange(SectionA, 1), MakeDrawRange(FRealtimeMeshHandle(2, 1), 1) }, Segments));
+	TestFalse(TEXT("Stale handles don't match"), FRealtimeMeshSectionGroupProxy::CanDrawRangesUseStaticRayTracing(
+		{ MakeDrawRange(SectionA, 1), MakeDrawRange(FRealtimeMeshHandle(1, 2), 1) }, Segments));
+	TestFalse(TEXT("No geometry, no static ray tracing"), FRealtimeMeshSectionGroupProxy::CanDrawRangesUseStaticRayTracing(
+		{ MakeDrawRange(SectionA, 1) }, {}));
+
+	// Mask level decision, as aggregated up through the LOD and mesh proxies
+	FRealtimeMeshDrawMask StaticMask(ERealtimeMeshDrawMask::DrawStatic | ERealtimeMeshDrawMask::DrawMainPass | ERealtimeMeshDrawMask::RayTracing);
+	TestTrue(TEXT("Static traced geometry is static relevant"), StaticMask.CanRenderInStaticRayTracing());
+
+	FRealtimeMeshDrawMask DynamicMask = StaticMask | FRealtimeMeshDrawMask(ERealtimeMeshDrawMask::DynamicRayTracing);
+	TestFalse(TEXT("Anything flagged for dynamic ray tracing isn't"), DynamicMask.CanRenderInStaticRayTracing());
+
+	FRealtimeMeshDrawMask UntracedMask(ERealtimeMeshDrawMask::DrawStatic | ERealtimeMeshDrawMask::DrawMainPass);
+	TestFalse(TEXT("Untraced geometry isn't"), UntracedMask.CanRenderInStaticRayTracing());
+
+	return true;
+}
@@ -0,0 +1,313 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "RealtimeMeshCore.h"
+#include "RealtimeMeshSimple.h"
+#include "RealtimeMeshTestHelpers.h"
+#include "Data/RealtimeMeshReplication.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+using namespace RealtimeMesh;
+using namespace RealtimeMeshTests;
+
+namespace
+{
+	bool ReplicationTestGroupsMatch(URealtimeMeshSimple* Server, URealtimeMeshSimple* Client, const FRealtimeMeshSectionGroupKey& GroupKey)
+	{
+		return Client->GetSectionGroups(GroupKey.LOD()).Contains(GroupKey) &&
+			GetTestStreamData(Client, GroupKey).OrderIndependentCompareEqual(GetTestStreamData(Server, GroupKey));
+	}
+
+	// Moves one vertex of the section group, giving it a change that fits in a single chunk
+	void NudgeReplicationTestVertex(URealtimeMeshSimple* RealtimeMesh, const FRealtimeMeshSectionGroupKey& GroupKey, int32 VertexIndex, float Offset)
+	{
+		FRealtimeMeshStreamSet Edited;
+		RealtimeMesh->ProcessMesh(GroupKey, [&](const FRealtimeMeshStreamSet& Streams)
+		{
+			Edited.CopyFrom(Streams);
+		});
+		Edited.Find(FRealtimeMeshStreams::Position)->GetArrayView<FVector3f>()[VertexIndex].Z += Offset;
+		RealtimeMesh->UpdateSectionGroup(GroupKey, MoveTemp(Edited));
+	}
+
+	// Sends one packet from the encoder to the decoder through a byte array, returning its size
+	int64 SendReplicationTestPacket(FRealtimeMeshReplicationEncoder& Encoder, URealtimeMeshSimple* Server,
+		FRealtimeMeshReplicationDecoder& Decoder, URealtimeMeshSimple* Client, int64 ByteBudget, bool& bOutDecoded)
+	{
+		TArray<uint8> Packet;
+		FMemoryWriter Writer(Packet);
+		const int64 Written = Encoder.WritePacket(Server->GetMeshAs<FRealtimeMeshSimple>(), Writer, ByteBudget);
+
+		bOutDecoded = true;
+		if (Written > 0)
+		{
+			FMemoryReader Reader(Packet);
+			bOutDecoded = Decoder.ReadPacket(Client->GetMeshAs<FRealtimeMeshSimple>(), Reader);
+		}
+		return Written;
+	}
+}
+
+// =====================================================================================================================
+// Loopback Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshReplicationLoopbackTest,
+	"RealtimeMeshComponent.Replication.Loopback",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshReplicationLoopbackTest::RunTest(const FString& Parameters)
+{
+	URealtimeMeshSimple* Server = NewObject<URealtimeMeshSimple>();
+	URealtimeMeshSimple* Client = NewObject<URealtimeMeshSimple>();
+
+	const FRealtimeMeshSectionGroupKey DetailedKey = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("Detailed"));
+	const FRealtimeMeshSectionGroupKey OtherKey = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("Other"));
+	const FRealtimeMeshSectionGroupKey CoarseKey = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(1), FName("Coarse"));
+	Server->CreateSectionGroup(DetailedKey, BuildTestGrid(64));
+	Server->CreateSectionGroup(OtherKey, BuildTestGrid(8));
+	Server->AddLOD(FRealtimeMeshLODConfig());
+	Server->CreateSectionGroup(CoarseKey, BuildTestGrid(16));
+
+	FRealtimeMeshReplicationSettings Settings;
+	Settings.ChunkBytes = 4 * 1024;
+	FRealtimeMeshReplicationEncoder Encoder(Settings);
+	FRealtimeMeshReplicationDecoder Decoder;
+
+	bool bDecoded = false;
+	const int64 InitialSize = SendReplicationTestPacket(Encoder, Server, Decoder, Client, TNumericLimits<int64>::Max(), bDecoded);
+	TestTrue(TEXT("Initial packet decodes"), bDecoded);
+	TestFalse(TEXT("An unlimited budget sends everything at once"), Encoder.HasPendingChanges());
+	TestEqual(TEXT("Missing LODs are created on the client"), Client->GetLODs().Num(), 2);
+	TestTrue(TEXT("Detailed group matches"), ReplicationTestGroupsMatch(Server, Client, DetailedKey));
+	TestTrue(TEXT("Other group matches"), ReplicationTestGroupsMatch(Server, Client, OtherKey));
+	TestTrue(TEXT("Coarse group matches"), ReplicationTestGroupsMatch(Server, Client, CoarseKey));
+	TestEqual(TEXT("Sections come from the poly groups"), Client->GetSectionsInGroup(DetailedKey).Num(), Server->GetSectionsInGroup(DetailedKey).Num());
+
+	TestEqual(TEXT("Nothing is sent while nothing changed"), SendReplicationTestPacket(Encoder, Server, Decoder, Client, TNumericLimits<int64>::Max(), bDecoded), int64(0));
+
+	// Nudge a single vertex, which should only resend the chunk it lives in
+	NudgeReplicationTestVertex(Server, DetailedKey, 100, 50.0f);
+
+	const int64 DeltaSize = SendReplicationTestPacket(Encoder, Server, Decoder, Client, TNumericLimits<int64>::Max(), bDecoded);
+	TestTrue(TEXT("Delta packet decodes"), bDecoded);
+	TestTrue(TEXT("Edited group matches"), ReplicationTestGroupsMatch(Server, Client, DetailedKey));
+	TestTrue(FString::Printf(TEXT("Delta (%lld bytes) is a small fraction of the initial send (%lld bytes)"), DeltaSize, InitialSize), DeltaSize > 0 && DeltaSize * 20 < InitialSize);
+
+	// Growing a group, dropping one of its streams and removing another group
+	FRealtimeMeshStreamSet Grown = BuildTestGrid(20);
+	Grown.Remove(FRealtimeMeshStreams::TexCoords);
+	Server->UpdateSectionGroup(CoarseKey, MoveTemp(Grown));
+	Server->RemoveSectionGroup(OtherKey);
+
+	SendReplicationTestPacket(Encoder, Server, Decoder, Client, TNumericLimits<int64>::Max(), bDecoded);
+	TestTrue(TEXT("Structural packet decodes"), bDecoded);
+	TestTrue(TEXT("Grown group matches"), ReplicationTestGroupsMatch(Server, Client, CoarseKey));
+	TestFalse(TEXT("Removed group is removed on the client"), Client->GetSectionGroups(FRealtimeMeshLODKey(0)).Contains(OtherKey));
+
+	// A garbled packet is rejected rather than applied
+	TArray<uint8> Garbage = { 1, 0x7F };
+	FMemoryReader GarbageReader(Garbage);
+	AddExpectedError(TEXT("malformed mesh replication packet"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse(TEXT("Malformed packets are rejected"), Decoder.ReadPacket(Client->GetMeshAs<FRealtimeMeshSimple>(), GarbageReader));
+	TestTrue(TEXT("Rejected packets leave the mesh alone"), ReplicationTestGroupsMatch(Server, Client, DetailedKey));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshReplicationDuplicateStreamTest,
+	"RealtimeMeshComponent.Replication.DuplicateStream",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshReplicationDuplicateStreamTest::RunTest(const FString& Parameters)
+{
+	URealtimeMeshSimple* Server = NewObject<URealtimeMeshSimple>();
+	URealtimeMeshSimple* Client = NewObject<URealtimeMeshSimple>();
+
+	// Two extra streams with names of the same length, so one can be renamed to the other in place in the packet
+	const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("Group"));
+	FRealtimeMeshStreamSet Streams = BuildTestGrid(8);
+	Streams.AddStream(ERealtimeMeshStreamType::Vertex, FName("ExtraA"), GetRealtimeMeshBufferLayout<FVector4f>()).SetNumZeroed(4096);
+	Streams.AddStream(ERealtimeMeshStreamType::Vertex, FName("ExtraB"), GetRealtimeMeshBufferLayout<FVector4f>()).SetNumZeroed(4);
+	Server->CreateSectionGroup(GroupKey, MoveTemp(Streams));
+
+	FRealtimeMeshReplicationEncoder Encoder;
+	TArray<uint8> Packet;
+	FMemoryWriter Writer(Packet);
+	Encoder.WritePacket(Server->GetMeshAs<FRealtimeMeshSimple>(), Writer, TNumericLimits<int64>::Max());
+
+	const auto FindName = [&Packet](const ANSICHAR* Name)
+	{
+		const int32 Length = FCStringAnsi::Strlen(Name);
+		for (int32 Index = 0; Index + Length <= Packet.Num(); Index++)
+		{
+			if (FMemory::Memcmp(Packet.GetData() + Index, Name, Length) == 0)
+			{
+				return Index;
+			}
+		}
+		return int32(INDEX_NONE);
+	};
+	const int32 OffsetA = FindName("ExtraA");
+	const int32 OffsetB = FindName("ExtraB");
+	if (!TestTrue(TEXT("Both stream headers are in the packet"), OffsetA != INDEX_NONE && OffsetB != INDEX_NONE))
+	{
+		return false;
+	}
+
+	// Give the second header the first one's key. With the large stream first, its chunks would land in the small one
+	FMemory::Memcpy(Packet.GetData() + FMath::Max(OffsetA, OffsetB), Packet.GetData() + FMath::Min(OffsetA, OffsetB), 6);
+
+	FRealtimeMeshReplicationDecoder Decoder;
+	FMemoryReader Reader(Packet);
+	AddExpectedError(TEXT("malformed mesh replication packet"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse(TEXT("A group sending the same stream twice is rejected"), Decoder.ReadPacket(Client->GetMeshAs<FRealtimeMeshSimple>(), Reader));
+	TestFalse(TEXT("Nothing is left staged"), Decoder.HasStagedUpdate());
+	TestFalse(TEXT("The group isn't created on the client"), Client->GetSectionGroups(FRealtimeMeshLODKey(0)).Contains(GroupKey));
+
+	// A fresh encoder resends everything, which the same decoder still takes
+	FRealtimeMeshReplicationEncoder FreshEncoder;
+	bool bDecoded = false;
+	SendReplicationTestPacket(FreshEncoder, Server, Decoder, Client, TNumericLimits<int64>::Max(), bDecoded);
+	TestTrue(TEXT("A well formed packet still decodes afterwards"), bDecoded);
+	TestTrue(TEXT("Group matches"), ReplicationTestGroupsMatch(Server, Client, GroupKey));
+
+	return true;
+}
+
+// =====================================================================================================================
+// Budget Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshReplicationBudgetTest,
+	"RealtimeMeshComponent.Replication.Budget",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshReplicationBudgetTest::RunTest(const FString& Parameters)
+{
+	URealtimeMeshSimple* Server = NewObject<URealtimeMeshSimple>();
+	URealtimeMeshSimple* Client = NewObject<URealtimeMeshSimple>();
+
+	const FRealtimeMeshSectionGroupKey DetailedKey = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("Detailed"));
+	const FRealtimeMeshSectionGroupKey CoarseKey = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(1), FName("Coarse"));
+	Server->CreateSectionGroup(DetailedKey, BuildTestGrid(48));
+	Server->AddLOD(FRealtimeMeshLODConfig());
+	Server->CreateSectionGroup(CoarseKey, BuildTestGrid(12));
+
+	FRealtimeMeshReplicationSettings Settings;
+	Settings.ChunkBytes = 1024;
+	FRealtimeMeshReplicationEncoder Encoder(Settings);
+	FRealtimeMeshReplicationDecoder Decoder;
+
+	// A chunk can compress badly, so allow for its own size on top of the budget
+	constexpr int64 ByteBudget = 2048;
+	const int64 MaxPacketSize = ByteBudget + Settings.ChunkBytes + 64;
+
+	int32 NumPackets = 0;
+	bool bAllDecoded = true;
+	bool bAllWithinBudget = true;
+	bool bCoarseFirst = true;
+	bool bNeverPartial = true;
+	while (Encoder.HasPendingChanges() || NumPackets == 0)
+	{
+		bool bDecoded = false;
+		const int64 Written = SendReplicationTestPacket(Encoder, Server, Decoder, Client, ByteBudget, bDecoded);
+		if (Written == 0)
+		{
+			break;
+		}
+		NumPackets++;
+		bAllDecoded &= bDecoded;
+		bAllWithinBudget &= Written <= MaxPacketSize;
+
+		// The detailed group can't show up until the coarse one has, and only ever in full
+		const bool bHasDetailed = Client->GetSectionGroups(FRealtimeMeshLODKey(0)).Contains(DetailedKey);
+		const bool bHasCoarse = Client->GetLODs().Num() > 1 && Client->GetSectionGroups(FRealtimeMeshLODKey(1)).Contains(CoarseKey);
+		bCoarseFirst &= !bHasDetailed || bHasCoarse;
+		bNeverPartial &= !bHasDetailed || ReplicationTestGroupsMatch(Server, Client, DetailedKey);
+		if (!TestTrue(TEXT("Packets keep coming until everything is sent"), NumPackets < 1000))
+		{
+			return false;
+		}
+	}
+
+	TestTrue(TEXT("Every packet decodes"), bAllDecoded);
+	TestTrue(TEXT("Packets stay within the budget"), bAllWithinBudget);
+	TestTrue(TEXT("The budget splits the mesh over several packets"), NumPackets > 2);
+	TestTrue(TEXT("Coarse LODs are sent ahead of detailed ones"), bCoarseFirst);
+	TestTrue(TEXT("Section groups are only applied once complete"), bNeverPartial);
+	TestFalse(TEXT("Nothing is left staged"), Decoder.HasStagedUpdate());
+	TestTrue(TEXT("Detailed group matches"), ReplicationTestGroupsMatch(Server, Client, DetailedKey));
+	TestTrue(TEXT("Coarse group matches"), ReplicationTestGroupsMatch(Server, Client, CoarseKey));
+
+	// The rate limited allowance builds up with time and caps at the burst size
+	FRealtimeMeshReplicationSettings RateSettings;
+	RateSettings.BytesPerSecond = 1000;
+	RateSettings.MaxBurstBytes = 1500;
+	FRealtimeMeshReplicationEncoder RateEncoder(RateSettings);
+	TestEqual(TEXT("No allowance before any time passed"), RateEncoder.GetAvailableBytes(), int64(0));
+
+	TArray<uint8> Packet;
+	FMemoryWriter Writer(Packet);
+	TestEqual(TEXT("Nothing is sent without allowance"), RateEncoder.WritePacket(Server->GetMeshAs<FRealtimeMeshSimple>(), Writer), int64(0));
+
+	RateEncoder.Tick(0.5f);
+	TestEqual(TEXT("Allowance accrues with time"), RateEncoder.GetAvailableBytes(), int64(500));
+	RateEncoder.Tick(10.0f);
+	TestEqual(TEXT("Allowance caps at the burst size"), RateEncoder.GetAvailableBytes(), int64(1500));
+
+	const int64 Written = RateEncoder.WritePacket(Server->GetMeshAs<FRealtimeMeshSimple>(), Writer);
+	TestTrue(TEXT("Sending uses up the allowance"), Written > 0 && RateEncoder.GetAvailableBytes() == 1500 - Written);
+
+	return true;
+}
+
+// =====================================================================================================================
+// Ordering Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshReplicationStarvationTest,
+	"RealtimeMeshComponent.Replication.Starvation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshReplicationStarvationTest::RunTest(const FString& Parameters)
+{
+	const FRealtimeMeshSectionGroupKey DetailedKey = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("Detailed"));
+	const FRealtimeMeshSectionGroupKey CoarseKey = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(1), FName("Coarse"));
+
+	// One LOD is edited every tick while the other changes once, the single change still has to get through
+	auto RunScenario = [&](const TCHAR* Name, const FRealtimeMeshSectionGroupKey& HotKey, const FRealtimeMeshSectionGroupKey& ColdKey)
+	{
+		URealtimeMeshSimple* Server = NewObject<URealtimeMeshSimple>();
+		URealtimeMeshSimple* Client = NewObject<URealtimeMeshSimple>();
+		Server->CreateSectionGroup(DetailedKey, BuildTestGrid(16));
+		Server->AddLOD(FRealtimeMeshLODConfig());
+		Server->CreateSectionGroup(CoarseKey, BuildTestGrid(8));
+
+		FRealtimeMeshReplicationEncoder Encoder;
+		FRealtimeMeshReplicationDecoder Decoder;
+
+		bool bDecoded = false;
+		SendReplicationTestPacket(Encoder, Server, Decoder, Client, TNumericLimits<int64>::Max(), bDecoded);
+		TestTrue(FString::Printf(TEXT("%s: initial packet decodes"), Name), bDecoded && !Encoder.HasPendingChanges());
+
+		NudgeReplicationTestVertex(Server, ColdKey, 10, 50.0f);
+
+		// Each single vertex edit is one chunk, so a minimal budget sends one section group per packet
+		bool bColdSent = false;
+		for (int32 Tick = 0; Tick < 8 && !bColdSent; Tick++)
+		{
+			NudgeReplicationTestVertex(Server, HotKey, Tick, 5.0f);
+			SendReplicationTestPacket(Encoder, Server, Decoder, Client, 1, bDecoded);
+			TestTrue(FString::Printf(TEXT("%s: packet %d decodes"), Name, Tick), bDecoded);
+			bColdSent = ReplicationTestGroupsMatch(Server, Client, ColdKey);
+		}
+		TestTrue(FString::Printf(TEXT("%s: the once changed group is sent while the other keeps changing"), Name), bColdSent);
+	};
+
+	RunScenario(TEXT("Detailed LOD edited every tick"), DetailedKey, CoarseKey);
+	RunScenario(TEXT("Coarse LOD edited every tick"), CoarseKey, DetailedKey);
+
+	return true;
+}
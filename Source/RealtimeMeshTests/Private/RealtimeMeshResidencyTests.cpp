@@ -0,0 +1,342 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "RealtimeMeshCore.h"
+#include "RealtimeMeshSimple.h"
+#include "RealtimeMeshTestHelpers.h"
+#include "Data/RealtimeMeshResidency.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/NameAsStringProxyArchive.h"
+
+using namespace RealtimeMesh;
+using namespace RealtimeMeshTests;
+
+namespace
+{
+	FRealtimeMeshHandle RegisterResidencyTestMesh(FRealtimeMeshResidencyPolicy& Policy, TConstArrayView<int64> LODSizes, uint64 Frame)
+	{
+		const FRealtimeMeshHandle Handle = Policy.Register();
+		Policy.SetLODSizes(Handle, LODSizes, Frame);
+		return Handle;
+	}
+}
+
+// =====================================================================================================================
+// Policy Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshResidencyBudgetTest,
+	"RealtimeMeshComponent.Residency.Budget",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshResidencyBudgetTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshResidencyPolicy Policy;
+	const FRealtimeMeshHandle A = RegisterResidencyTestMesh(Policy, { 400, 100, 10 }, 1);
+	const FRealtimeMeshHandle B = RegisterResidencyTestMesh(Policy, { 300, 10 }, 1);
+	TestEqual(TEXT("Every LOD starts resident"), Policy.GetResidentBytes(), static_cast<int64>(820));
+
+	// A was last drawn on frame 5 and B on frame 8, neither is drawn now
+	Policy.SetNeededLODs(A, 0, 5);
+	Policy.SetNeededLODs(B, 0, 8);
+
+	FRealtimeMeshResidencySettings Settings;
+	Settings.BudgetBytes = 400;
+
+	TArray<FRealtimeMeshResidencyRequest> Evictions;
+	TArray<FRealtimeMeshResidencyRequest> Loads;
+	Policy.Update(Settings, 10, Evictions, Loads);
+
+	// A's LODs are older, so they go first, largest first, then B's until the budget is met
+	TestEqual(TEXT("Evicts until within budget"), Evictions.Num(), 3);
+	if (Evictions.Num() == 3)
+	{
+		TestTrue(TEXT("Least recently needed, largest first"), Evictions[0].Mesh == A && Evictions[0].LODIndex == 0);
+		TestTrue(TEXT("Then the rest of the older mesh"), Evictions[1].Mesh == A && Evictions[1].LODIndex == 1);
+		TestTrue(TEXT("Then the newer mesh"), Evictions[2].Mesh == B && Evictions[2].LODIndex == 0);
+	}
+	TestEqual(TEXT("Resident bytes are within budget"), Policy.GetResidentBytes(), static_cast<int64>(20));
+	TestEqual(TEXT("Last LODs stay resident"), Policy.GetResidency(A, 2), ERealtimeMeshLODResidency::Resident);
+	TestTrue(TEXT("Nothing is loaded"), Loads.IsEmpty());
+
+	// Without a budget or an age limit nothing more happens
+	Policy.Update(FRealtimeMeshResidencySettings(), 11, Evictions, Loads);
+	TestTrue(TEXT("Stable without pressure"), Evictions.IsEmpty() && Loads.IsEmpty());
+
+	TestTrue(TEXT("Unregister succeeds"), Policy.Unregister(A));
+	TestEqual(TEXT("Unregistering drops the mesh's resident bytes"), Policy.GetResidentBytes(), static_cast<int64>(10));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshResidencyNeededNeverEvictedTest,
+	"RealtimeMeshComponent.Residency.NeededNeverEvicted",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshResidencyNeededNeverEvictedTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshResidencyPolicy Policy;
+	const FRealtimeMeshHandle Mesh = RegisterResidencyTestMesh(Policy, { 1000, 500, 100 }, 1);
+
+	// Drawn at LOD 1 this frame, which needs LOD 1 and 2 but not LOD 0
+	Policy.SetNeededLODs(Mesh, 1, 10);
+
+	FRealtimeMeshResidencySettings Settings;
+	Settings.BudgetBytes = 1;
+	Settings.EvictAfterFrames = 0;
+
+	TArray<FRealtimeMeshResidencyRequest> Evictions;
+	TArray<FRealtimeMeshResidencyRequest> Loads;
+	Policy.Update(Settings, 10, Evictions, Loads);
+
+	TestEqual(TEXT("Only the unneeded LOD is evicted"), Evictions.Num(), 1);
+	TestEqual(TEXT("Detailed LOD is evicted"), Policy.GetResidency(Mesh, 0), ERealtimeMeshLODResidency::Evicted);
+	TestEqual(TEXT("Needed LOD stays even over budget"), Policy.GetResidency(Mesh, 1), ERealtimeMeshLODResidency::Resident);
+	TestEqual(TEXT("Resident bytes may exceed the budget"), Policy.GetResidentBytes(), static_cast<int64>(600));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshResidencyAgeEvictionTest,
+	"RealtimeMeshComponent.Residency.AgeEviction",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshResidencyAgeEvictionTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshResidencyPolicy Policy;
+	const FRealtimeMeshHandle Mesh = RegisterResidencyTestMesh(Policy, { 100, 50, 10 }, 0);
+	Policy.SetNeededLODs(Mesh, 0, 10);
+	Policy.SetNeededLODs(Mesh, 1, 20);
+
+	FRealtimeMeshResidencySettings Settings;
+	Settings.EvictAfterFrames = 15;
+
+	TArray<FRealtimeMeshResidencyRequest> Evictions;
+	TArray<FRealtimeMeshResidencyRequest> Loads;
+
+	Policy.Update(Settings, 25, Evictions, Loads);
+	TestTrue(TEXT("Nothing is old enough yet"), Evictions.IsEmpty());
+
+	Policy.Update(Settings, 26, Evictions, Loads);
+	TestEqual(TEXT("LOD 0 ages out first"), Evictions.Num(), 1);
+	TestEqual(TEXT("LOD 0 is evicted"), Policy.GetResidency(Mesh, 0), ERealtimeMeshLODResidency::Evicted);
+
+	Policy.Update(Settings, 100, Evictions, Loads);
+	TestEqual(TEXT("LOD 1 ages out later"), Policy.GetResidency(Mesh, 1), ERealtimeMeshLODResidency::Evicted);
+	TestEqual(TEXT("Last LOD is never evicted"), Policy.GetResidency(Mesh, 2), ERealtimeMeshLODResidency::Resident);
+	TestEqual(TEXT("Only the last LOD is counted"), Policy.GetResidentBytes(), static_cast<int64>(10));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshResidencyReloadTest,
+	"RealtimeMeshComponent.Residency.Reload",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshResidencyReloadTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshResidencyPolicy Policy;
+	const FRealtimeMeshHandle Mesh = RegisterResidencyTestMesh(Policy, { 100, 50, 10 }, 0);
+
+	FRealtimeMeshResidencySettings Settings;
+	Settings.EvictAfterFrames = 0;
+
+	TArray<FRealtimeMeshResidencyRequest> Evictions;
+	TArray<FRealtimeMeshResidencyRequest> Loads;
+	Policy.Update(Settings, 5, Evictions, Loads);
+	TestEqual(TEXT("Unneeded LODs are evicted"), Evictions.Num(), 2);
+
+	// Evicted LODs keep their size while the reported size drops to nothing
+	Policy.SetLODSizes(Mesh, { 0, 0, 10 }, 6);
+	TestEqual(TEXT("Evicted sizes are kept"), Policy.GetResidentBytes(), static_cast<int64>(10));
+
+	// Drawing at LOD 0 needs both evicted LODs, but only one load is allowed per update
+	Settings.MaxLoadsPerUpdate = 1;
+	Policy.SetNeededLODs(Mesh, 0, 6);
+	Policy.Update(Settings, 6, Evictions, Loads);
+	TestTrue(TEXT("Nothing needed is evicted"), Evictions.IsEmpty());
+	TestEqual(TEXT("Loads are capped"), Loads.Num(), 1);
+	TestEqual(TEXT("Loading LOD is counted already"), Policy.GetResidentBytes(), static_cast<int64>(110));
+	TestEqual(TEXT("LOD 0 is loading"), Policy.GetResidency(Mesh, 0), ERealtimeMeshLODResidency::Loading);
+
+	Policy.SetNeededLODs(Mesh, 0, 7);
+	Policy.Update(Settings, 7, Evictions, Loads);
+	TestTrue(TEXT("The remaining load is picked up next update"), Loads.Num() == 1 && Loads[0].LODIndex == 1);
+
+	Policy.MarkResident(Mesh, 0);
+	Policy.MarkResident(Mesh, 1);
+	TestEqual(TEXT("Loaded LOD is resident"), Policy.GetResidency(Mesh, 0), ERealtimeMeshLODResidency::Resident);
+	TestEqual(TEXT("Loaded bytes are only counted once"), Policy.GetResidentBytes(), static_cast<int64>(160));
+
+	// An eviction that had nothing to take is put straight back
+	Policy.Update(Settings, 20, Evictions, Loads);
+	Policy.MarkResident(Mesh, 0);
+	TestEqual(TEXT("Marking an evicted LOD resident counts it again"), Policy.GetResidentBytes(), static_cast<int64>(110));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshResidencyScreenSizeSelectionTest,
+	"RealtimeMeshComponent.Residency.ScreenSizeSelection",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshResidencyScreenSizeSelectionTest::RunTest(const FString& Parameters)
+{
+	const TArray<float> ScreenSizes = { 1.0f, 0.5f, 0.25f };
+
+	TestEqual(TEXT("Large screen size picks LOD 0"), FRealtimeMeshResidencyPolicy::GetLODForScreenSize(ScreenSizes, 2.0f), 0);
+	TestEqual(TEXT("Between thresholds picks the coarser LOD"), FRealtimeMeshResidencyPolicy::GetLODForScreenSize(ScreenSizes, 0.75f), 0);
+	TestEqual(TEXT("Below LOD 1 threshold"), FRealtimeMeshResidencyPolicy::GetLODForScreenSize(ScreenSizes, 0.4f), 1);
+	TestEqual(TEXT("Tiny screen size picks the last LOD"), FRealtimeMeshResidencyPolicy::GetLODForScreenSize(ScreenSizes, 0.01f), 2);
+
+	// Hidden LODs are skipped
+	const TArray<float> WithHidden = { 1.0f, 0.5f, -1.0f };
+	TestEqual(TEXT("Hidden LOD is never picked"), FRealtimeMeshResidencyPolicy::GetLODForScreenSize(WithHidden, 0.01f), 1);
+
+	return true;
+}
+
+// =====================================================================================================================
+// Eviction Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshResidencyEvictAndRestoreTest,
+	"RealtimeMeshComponent.Residency.EvictAndRestore",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshResidencyEvictAndRestoreTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshStatCounters& Counters = FRealtimeMeshStatCounters::Get();
+
+	URealtimeMeshSimple* RealtimeMesh = NewObject<URealtimeMeshSimple>();
+	const TSharedRef<FRealtimeMeshSimple> Mesh = RealtimeMesh->GetMeshAs<FRealtimeMeshSimple>();
+
+	// Static draws report their screen size from the view relevance, so they're evicted along with the dynamic ones
+	const FRealtimeMeshSectionGroupConfig DynamicConfig(ERealtimeMeshSectionDrawType::Dynamic);
+	const FRealtimeMeshSectionGroupKey Group0Key = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("Detailed"));
+	RealtimeMesh->CreateSectionGroup(Group0Key, BuildTestGrid(16), DynamicConfig);
+	const FRealtimeMeshSectionGroupKey StaticGroupKey = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("Static"));
+	RealtimeMesh->CreateSectionGroup(StaticGroupKey, BuildTestGrid(8), FRealtimeMeshSectionGroupConfig(ERealtimeMeshSectionDrawType::Static));
+	RealtimeMesh->AddLOD(FRealtimeMeshLODConfig());
+	const FRealtimeMeshSectionGroupKey Group1Key = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(1), FName("Coarse"));
+	RealtimeMesh->CreateSectionGroup(Group1Key, BuildTestGrid(2), DynamicConfig);
+
+	TFixedLODArray<float> ScreenSizes;
+	TFixedLODArray<int64> EvictableMemory;
+	const uint32 InfoVersion = Mesh->GetResidencyInfoVersion();
+	Mesh->GetLODResidencyInfo(ScreenSizes, EvictableMemory);
+	TestEqual(TEXT("One entry per LOD"), EvictableMemory.Num(), 2);
+	TestTrue(TEXT("Detailed LOD holds more"), EvictableMemory.Num() == 2 && EvictableMemory[0] > EvictableMemory[1]);
+	TestEqual(TEXT("Reading the info doesn't change its version"), Mesh->GetResidencyInfoVersion(), InfoVersion);
+
+	int32 NumVerticesBefore = 0;
+	RealtimeMesh->ProcessMesh(Group0Key, [&](const FRealtimeMeshStreamSet& Streams)
+	{
+		NumVerticesBefore = Streams.Find(FRealtimeMeshStreams::Position)->Num();
+	});
+
+	const int64 MemoryBefore = Counters.CPUStreamMemory;
+	TArray<FRealtimeMeshEvictedSectionGroup> Evicted = Mesh->EvictLODStreams(FRealtimeMeshLODKey(0));
+	TestTrue(TEXT("Every section group of the LOD is evicted"), Evicted.Num() == 2 &&
+		Evicted.ContainsByPredicate([&](const FRealtimeMeshEvictedSectionGroup& Group) { return Group.SectionGroupKey == Group0Key; }) &&
+		Evicted.ContainsByPredicate([&](const FRealtimeMeshEvictedSectionGroup& Group) { return Group.SectionGroupKey == StaticGroupKey; }));
+	TestNotEqual(TEXT("Evicting changes the info version"), Mesh->GetResidencyInfoVersion(), InfoVersion);
+	TestEqual(TEXT("Evicting releases the CPU streams"), static_cast<int64>(Counters.CPUStreamMemory), MemoryBefore - EvictableMemory[0]);
+	TestTrue(TEXT("Evicted LOD has nothing left to evict"), Mesh->EvictLODStreams(FRealtimeMeshLODKey(0)).IsEmpty());
+	TestEqual(TEXT("Sections are kept"), RealtimeMesh->GetSectionsInGroup(Group0Key).Num(), 1);
+
+	// Round trip through the cache format
+	TArray<uint8> Compressed;
+	TestTrue(TEXT("Compresses"), FRealtimeMeshResidencyManager::CompressSectionGroups(Evicted, Compressed));
+	TArray<FRealtimeMeshEvictedSectionGroup> Decompressed;
+	TestTrue(TEXT("Decompresses"), FRealtimeMeshResidencyManager::DecompressSectionGroups(Compressed, Decompressed));
+	TestTrue(TEXT("Cached groups keep their keys"), Decompressed.Num() == 2 && Decompressed[0].SectionGroupKey == Evicted[0].SectionGroupKey &&
+		Decompressed[1].SectionGroupKey == Evicted[1].SectionGroupKey);
+
+	TestEqual(TEXT("Restores the section groups"), Mesh->RestoreLODStreams(MoveTemp(Decompressed)), 2);
+	TestEqual(TEXT("Restoring accounts the streams again"), static_cast<int64>(Counters.CPUStreamMemory), MemoryBefore);
+
+	int32 NumVerticesAfter = 0;
+	RealtimeMesh->ProcessMesh(Group0Key, [&](const FRealtimeMeshStreamSet& Streams)
+	{
+		NumVerticesAfter = Streams.Find(FRealtimeMeshStreams::Position)->Num();
+	});
+	TestEqual(TEXT("Restored data matches"), NumVerticesAfter, NumVerticesBefore);
+
+	// Anything written after the eviction wins over the cached copy
+	Evicted = Mesh->EvictLODStreams(FRealtimeMeshLODKey(0));
+	RealtimeMesh->UpdateSectionGroup(Group0Key, BuildTestGrid(4));
+	TestEqual(TEXT("Only the untouched group is restored"), Mesh->RestoreLODStreams(MoveTemp(Evicted)), 1);
+	RealtimeMesh->ProcessMesh(Group0Key, [&](const FRealtimeMeshStreamSet& Streams)
+	{
+		NumVerticesAfter = Streams.Find(FRealtimeMeshStreams::Position)->Num();
+	});
+	TestEqual(TEXT("Edited data is kept"), NumVerticesAfter, 25);
+
+	// A group that has to stay keeps the whole LOD, evicting the rest would leave holes in a LOD that still draws
+	const TArray<FRealtimeMeshSectionKey> StaticSections = RealtimeMesh->GetSectionsInGroup(StaticGroupKey);
+	if (TestEqual(TEXT("Static group has a section"), StaticSections.Num(), 1))
+	{
+		RealtimeMesh->UpdateSectionConfig(StaticSections[0], FRealtimeMeshSectionConfig(), true);
+		Mesh->GetLODResidencyInfo(ScreenSizes, EvictableMemory);
+		TestEqual(TEXT("LOD with a collision group has nothing to evict"), EvictableMemory[0], static_cast<int64>(0));
+		TestTrue(TEXT("LOD with a collision group isn't evicted"), Mesh->EvictLODStreams(FRealtimeMeshLODKey(0)).IsEmpty());
+		TestTrue(TEXT("Other LODs are still evictable"), EvictableMemory[1] > 0);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshResidencySaveEvictedTest,
+	"RealtimeMeshComponent.Residency.SaveEvicted",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshResidencySaveEvictedTest::RunTest(const FString& Parameters)
+{
+	URealtimeMeshSimple* RealtimeMesh = NewObject<URealtimeMeshSimple>();
+	const TSharedRef<FRealtimeMeshSimple> Mesh = RealtimeMesh->GetMeshAs<FRealtimeMeshSimple>();
+
+	const FRealtimeMeshSectionGroupConfig DynamicConfig(ERealtimeMeshSectionDrawType::Dynamic);
+	const FRealtimeMeshSectionGroupKey Group0Key = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("Detailed"));
+	RealtimeMesh->CreateSectionGroup(Group0Key, BuildTestGrid(16), DynamicConfig);
+	RealtimeMesh->AddLOD(FRealtimeMeshLODConfig());
+	RealtimeMesh->CreateSectionGroup(FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(1), FName("Coarse")), BuildTestGrid(2), DynamicConfig);
+
+	int32 NumVerticesBefore = 0;
+	RealtimeMesh->ProcessMesh(Group0Key, [&](const FRealtimeMeshStreamSet& Streams)
+	{
+		NumVerticesBefore = Streams.Find(FRealtimeMeshStreams::Position)->Num();
+	});
+
+	FRealtimeMeshResidencyManager& Manager = FRealtimeMeshResidencyManager::Get();
+	Manager.Register(Mesh);
+	TestTrue(TEXT("The detailed LOD is evicted"), Manager.EvictLOD(Mesh, 0));
+
+	TArray<uint8> Saved;
+	{
+		FMemoryWriter Writer(Saved);
+		Writer.SetCustomVersion(FRealtimeMeshVersion::GUID, FRealtimeMeshVersion::LatestVersion, TEXT("RealtimeMesh"));
+		FNameAsStringProxyArchive Ar(Writer);
+		Mesh->Serialize(Ar, RealtimeMesh);
+	}
+	Manager.Unregister(Mesh);
+
+	URealtimeMeshSimple* Loaded = NewObject<URealtimeMeshSimple>();
+	{
+		FMemoryReader Reader(Saved);
+		Reader.SetCustomVersion(FRealtimeMeshVersion::GUID, FRealtimeMeshVersion::LatestVersion, TEXT("RealtimeMesh"));
+		FNameAsStringProxyArchive Ar(Reader);
+		Loaded->GetMesh()->Serialize(Ar, Loaded);
+	}
+
+	int32 NumVerticesLoaded = 0;
+	Loaded->ProcessMesh(Group0Key, [&](const FRealtimeMeshStreamSet& Streams)
+	{
+		const FRealtimeMeshStream* Positions = Streams.Find(FRealtimeMeshStreams::Position);
+		NumVerticesLoaded = Positions ? Positions->Num() : 0;
+	});
+	TestEqual(TEXT("The evicted group's streams are saved"), NumVerticesLoaded, NumVerticesBefore);
+
+	return true;
+}
@@ -0,0 +1,90 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "RenderProxy/RealtimeMeshSectionGroupProxy.h"
+
+using namespace RealtimeMesh;
+
+namespace
+{
+	FRealtimeMeshSectionDrawRange MakeTestDrawRange(uint32 SectionIndex, int32 MaterialSlot, int32 FirstTriangle, int32 NumTriangles, bool bCastsShadow = true)
+	{
+		FRealtimeMeshSectionDrawRange DrawRange;
+		DrawRange.SectionHandle = FRealtimeMeshHandle(SectionIndex, 1);
+		DrawRange.StreamRange = FRealtimeMeshStreamRange(FirstTriangle * 3, (FirstTriangle + NumTriangles) * 3, FirstTriangle * 3, (FirstTriangle + NumTriangles) * 3);
+		DrawRange.DrawMask.SetFlag(ERealtimeMeshDrawMask::DrawMainPass);
+		if (bCastsShadow)
+		{
+			DrawRange.DrawMask.SetFlag(ERealtimeMeshDrawMask::DrawShadowPass);
+		}
+		DrawRange.MaterialSlot = MaterialSlot;
+		return DrawRange;
+	}
+}
+
+// =====================================================================================================================
+// Section Merge Planning Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshSectionMergingAdjacentTest,
+	"RealtimeMeshComponent.SectionMerging.Adjacent",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshSectionMergingAdjacentTest::RunTest(const FString& Parameters)
+{
+	// Four polygroups laid out back to back, alternating between two materials after the first pair
+	TArray<FRealtimeMeshSectionDrawRange> DrawRanges;
+	DrawRanges.Add(MakeTestDrawRange(0, 0, 0, 10));
+	DrawRanges.Add(MakeTestDrawRange(1, 0, 10, 5));
+	DrawRanges.Add(MakeTestDrawRange(2, 1, 15, 5));
+	DrawRanges.Add(MakeTestDrawRange(3, 0, 20, 5));
+
+	FRealtimeMeshSectionGroupProxy::MergeDrawRanges(DrawRanges);
+
+	TestEqual(TEXT("Only the adjacent same material pair is merged"), DrawRanges.Num(), 3);
+	if (DrawRanges.Num() == 3)
+	{
+		TestEqual(TEXT("Merged run starts at the first section"), DrawRanges[0].StreamRange.GetMinIndex(), 0);
+		TestEqual(TEXT("Merged run covers both sections"), DrawRanges[0].StreamRange.NumPrimitives(3), 15);
+		TestEqual(TEXT("Merged run counts its sections"), DrawRanges[0].NumSections, 2);
+		TestTrue(TEXT("Merged run is set up by its first section"), DrawRanges[0].SectionHandle == FRealtimeMeshHandle(0, 1));
+
+		TestEqual(TEXT("Gapped section with the same material stays separate"), DrawRanges[1].StreamRange.GetMinIndex(), 60);
+		TestEqual(TEXT("Other material comes last"), DrawRanges[2].MaterialSlot, 1);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshSectionMergingCompatibilityTest,
+	"RealtimeMeshComponent.SectionMerging.Compatibility",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshSectionMergingCompatibilityTest::RunTest(const FString& Parameters)
+{
+	// Out of order input with a shadow mismatch in the middle
+	TArray<FRealtimeMeshSectionDrawRange> DrawRanges;
+	DrawRanges.Add(MakeTestDrawRange(2, 3, 8, 4));
+	DrawRanges.Add(MakeTestDrawRange(0, 3, 0, 4));
+	DrawRanges.Add(MakeTestDrawRange(1, 3, 4, 4, false));
+	DrawRanges.Add(MakeTestDrawRange(3, 3, 12, 4));
+
+	FRealtimeMeshSectionGroupProxy::MergeDrawRanges(DrawRanges);
+
+	TestEqual(TEXT("Draw mask mismatch splits the run"), DrawRanges.Num(), 3);
+	if (DrawRanges.Num() == 3)
+	{
+		TestEqual(TEXT("Ranges are ordered by first index"), DrawRanges[0].StreamRange.GetMinIndex(), 0);
+		TestEqual(TEXT("Shadowless section stays on its own"), DrawRanges[1].NumSections, 1);
+		TestEqual(TEXT("Trailing sections merge after sorting"), DrawRanges[2].NumSections, 2);
+		TestEqual(TEXT("Trailing run covers both sections"), DrawRanges[2].StreamRange.NumPrimitives(3), 8);
+	}
+
+	// Merging never changes the number of triangles drawn
+	TArray<FRealtimeMeshSectionDrawRange> Single;
+	Single.Add(MakeTestDrawRange(0, 0, 0, 7));
+	FRealtimeMeshSectionGroupProxy::MergeDrawRanges(Single);
+	TestTrue(TEXT("Single range is untouched"), Single.Num() == 1 && Single[0].StreamRange.NumPrimitives(3) == 7);
+
+	return true;
+}
@@ -0,0 +1,234 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "RealtimeMeshCore.h"
+#include "RealtimeMeshSimple.h"
+#include "RealtimeMeshTestHelpers.h"
+#include "HAL/FileManager.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Serialization/NameAsStringProxyArchive.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#include "UObject/UObjectHash.h"
+
+using namespace RealtimeMesh;
+using namespace RealtimeMeshTests;
+
+namespace
+{
+	bool SaveSerializationTestMesh(URealtimeMeshSimple* RealtimeMesh, const FString& Path)
+	{
+		const TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*Path));
+		if (!FileWriter)
+		{
+			return false;
+		}
+		FileWriter->SetCustomVersion(FRealtimeMeshVersion::GUID, FRealtimeMeshVersion::LatestVersion, TEXT("RealtimeMesh"));
+
+		FNameAsStringProxyArchive Ar(*FileWriter);
+		RealtimeMesh->GetMesh()->Serialize(Ar, RealtimeMesh);
+		return FileWriter->Close();
+	}
+
+	URealtimeMeshSimple* LoadSerializationTestMesh(const FString& Path)
+	{
+		const TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*Path));
+		if (!FileReader)
+		{
+			return nullptr;
+		}
+		FileReader->SetCustomVersion(FRealtimeMeshVersion::GUID, FRealtimeMeshVersion::LatestVersion, TEXT("RealtimeMesh"));
+
+		URealtimeMeshSimple* RealtimeMesh = NewObject<URealtimeMeshSimple>();
+		FNameAsStringProxyArchive Ar(*FileReader);
+		RealtimeMesh->GetMesh()->Serialize(Ar, RealtimeMesh);
+		return FileReader->IsError() ? nullptr : RealtimeMesh;
+	}
+
+	// Drops a package and everything in it, so the next load has to go through the linker
+	void UnloadSerializationTestPackage(UPackage* Package)
+	{
+		ForEachObjectWithPackage(Package, [](UObject* Object)
+		{
+			Object->ClearFlags(RF_Public | RF_Standalone);
+			Object->MarkAsGarbage();
+			return true;
+		});
+		ResetLoaders(Package);
+		Package->MarkAsGarbage();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+}
+
+// =====================================================================================================================
+// Bulk Data Storage Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshSerializationBulkDataRoundTripTest,
+	"RealtimeMeshComponent.Serialization.BulkDataRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshSerializationBulkDataRoundTripTest::RunTest(const FString& Parameters)
+{
+	URealtimeMeshSimple* Source = NewObject<URealtimeMeshSimple>();
+	const FRealtimeMeshSectionGroupKey Group0Key = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("Detailed"));
+	Source->CreateSectionGroup(Group0Key, BuildTestGrid(12));
+	Source->AddLOD(FRealtimeMeshLODConfig());
+	const FRealtimeMeshSectionGroupKey Group1Key = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(1), FName("Coarse"));
+	Source->CreateSectionGroup(Group1Key, BuildTestGrid(3));
+
+	for (const ERealtimeMeshStreamStorage Storage : { ERealtimeMeshStreamStorage::Inline, ERealtimeMeshStreamStorage::BulkData })
+	{
+		const FString StorageName = StaticEnum<ERealtimeMeshStreamStorage>()->GetNameStringByValue(static_cast<int64>(Storage));
+		Source->SetStreamStorage(Storage);
+
+		const FString Path = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("RealtimeMeshSerialization"), StorageName + TEXT(".bin"));
+		if (!TestTrue(StorageName + TEXT(": saves"), SaveSerializationTestMesh(Source, Path)))
+		{
+			continue;
+		}
+
+		URealtimeMeshSimple* Loaded = LoadSerializationTestMesh(Path);
+		if (TestNotNull(StorageName + TEXT(": loads"), Loaded))
+		{
+			const TSharedRef<FRealtimeMeshSimple> LoadedMesh = Loaded->GetMeshAs<FRealtimeMeshSimple>();
+			TestEqual(StorageName + TEXT(": storage mode is kept"), Loaded->GetStreamStorage(), Storage);
+			TestFalse(StorageName + TEXT(": nothing is left pending"), LoadedMesh->HasPendingStreamLoad());
+			TestEqual(StorageName + TEXT(": LODs are kept"), Loaded->GetLODs().Num(), 2);
+			TestTrue(StorageName + TEXT(": detailed streams match"), GetTestStreamData(Loaded, Group0Key).OrderIndependentCompareEqual(GetTestStreamData(Source, Group0Key)));
+			TestTrue(StorageName + TEXT(": coarse streams match"), GetTestStreamData(Loaded, Group1Key).OrderIndependentCompareEqual(GetTestStreamData(Source, Group1Key)));
+		}
+
+		IFileManager::Get().Delete(*Path);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshSerializationLazyBulkDataTest,
+	"RealtimeMeshComponent.Serialization.LazyBulkData",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshSerializationLazyBulkDataTest::RunTest(const FString& Parameters)
+{
+	URealtimeMeshSimple* Source = NewObject<URealtimeMeshSimple>();
+	Source->SetStreamStorage(ERealtimeMeshStreamStorage::LazyBulkData);
+
+	// One group feeds collision, so it has to be there as soon as the load returns
+	const FRealtimeMeshSectionGroupKey CollisionGroupKey = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("Collision"));
+	Source->CreateSectionGroup(CollisionGroupKey, BuildTestGrid(4));
+	for (const FRealtimeMeshSectionKey& SectionKey : Source->GetSectionsInGroup(CollisionGroupKey))
+	{
+		Source->UpdateSectionConfig(SectionKey, FRealtimeMeshSectionConfig(), true);
+	}
+
+	TArray<FRealtimeMeshSectionGroupKey> RenderGroupKeys;
+	for (int32 Index = 0; Index < 16; Index++)
+	{
+		RenderGroupKeys.Add(FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName(TEXT("Render"), Index + 1)));
+		Source->CreateSectionGroup(RenderGroupKeys.Last(), BuildTestGrid(4 + Index));
+	}
+
+	const FString Path = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("RealtimeMeshSerialization"), TEXT("Lazy.bin"));
+	if (!TestTrue(TEXT("Saves"), SaveSerializationTestMesh(Source, Path)))
+	{
+		return false;
+	}
+
+	URealtimeMeshSimple* Loaded = LoadSerializationTestMesh(Path);
+	if (TestNotNull(TEXT("Loads"), Loaded))
+	{
+		const TSharedRef<FRealtimeMeshSimple> LoadedMesh = Loaded->GetMeshAs<FRealtimeMeshSimple>();
+		TestTrue(TEXT("Collision group is decoded during the load"),
+			GetTestStreamData(Loaded, CollisionGroupKey).OrderIndependentCompareEqual(GetTestStreamData(Source, CollisionGroupKey)));
+		TestEqual(TEXT("Sections are there before their streams"), Loaded->GetSectionsInGroup(RenderGroupKeys.Last()).Num(), 1);
+
+		LoadedMesh->FlushPendingStreamLoad();
+		TestFalse(TEXT("Flush leaves nothing pending"), LoadedMesh->HasPendingStreamLoad());
+
+		bool bAllMatch = true;
+		for (const FRealtimeMeshSectionGroupKey& GroupKey : RenderGroupKeys)
+		{
+			bAllMatch &= GetTestStreamData(Loaded, GroupKey).OrderIndependentCompareEqual(GetTestStreamData(Source, GroupKey));
+		}
+		TestTrue(TEXT("Deferred groups are decoded"), bAllMatch);
+
+		// A flushed mesh saves everything it loaded
+		const FString ResavePath = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("RealtimeMeshSerialization"), TEXT("LazyResave.bin"));
+		if (TestTrue(TEXT("Resaves"), SaveSerializationTestMesh(Loaded, ResavePath)))
+		{
+			URealtimeMeshSimple* Reloaded = LoadSerializationTestMesh(ResavePath);
+			if (TestNotNull(TEXT("Reloads"), Reloaded))
+			{
+				Reloaded->GetMeshAs<FRealtimeMeshSimple>()->FlushPendingStreamLoad();
+				TestTrue(TEXT("Resaved data matches"),
+					GetTestStreamData(Reloaded, RenderGroupKeys[3]).OrderIndependentCompareEqual(GetTestStreamData(Source, RenderGroupKeys[3])));
+			}
+			IFileManager::Get().Delete(*ResavePath);
+		}
+	}
+
+	IFileManager::Get().Delete(*Path);
+	return true;
+}
+
+#if WITH_EDITOR
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshSerializationPackageBulkDataTest,
+	"RealtimeMeshComponent.Serialization.PackageBulkData",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshSerializationPackageBulkDataTest::RunTest(const FString& Parameters)
+{
+	// A real package puts the payload out of line behind the linker, so the load reads it from disk instead of finding it inline
+	const FString PackageName = TEXT("/Temp/RealtimeMeshSerialization/PackageBulkData");
+	const FString PackageFilename = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
+	const FRealtimeMeshSectionGroupKey Group0Key = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("Detailed"));
+	const FRealtimeMeshSectionGroupKey Group1Key = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(1), FName("Coarse"));
+
+	for (const ERealtimeMeshStreamStorage Storage : { ERealtimeMeshStreamStorage::BulkData, ERealtimeMeshStreamStorage::LazyBulkData })
+	{
+		const FString StorageName = StaticEnum<ERealtimeMeshStreamStorage>()->GetNameStringByValue(static_cast<int64>(Storage));
+
+		UPackage* Package = CreatePackage(*PackageName);
+		URealtimeMeshSimple* Source = NewObject<URealtimeMeshSimple>(Package, TEXT("Mesh"), RF_Public | RF_Standalone);
+		Source->SetStreamStorage(Storage);
+		Source->CreateSectionGroup(Group0Key, BuildTestGrid(12));
+		Source->AddLOD(FRealtimeMeshLODConfig());
+		Source->CreateSectionGroup(Group1Key, BuildTestGrid(3));
+
+		// The source is gone by the time the package loads back
+		const TMap<FRealtimeMeshStreamKey, TArray<uint8>> ExpectedGroup0 = GetTestStreamData(Source, Group0Key);
+		const TMap<FRealtimeMeshStreamKey, TArray<uint8>> ExpectedGroup1 = GetTestStreamData(Source, Group1Key);
+
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		const bool bSaved = UPackage::SavePackage(Package, Source, *PackageFilename, SaveArgs);
+		UnloadSerializationTestPackage(Package);
+		if (!TestTrue(StorageName + TEXT(": package saves"), bSaved))
+		{
+			continue;
+		}
+
+		UPackage* LoadedPackage = LoadPackage(nullptr, *PackageName, LOAD_None);
+		URealtimeMeshSimple* Loaded = LoadedPackage ? FindObject<URealtimeMeshSimple>(LoadedPackage, TEXT("Mesh")) : nullptr;
+		if (TestNotNull(StorageName + TEXT(": package loads"), Loaded))
+		{
+			const TSharedRef<FRealtimeMeshSimple> LoadedMesh = Loaded->GetMeshAs<FRealtimeMeshSimple>();
+			LoadedMesh->FlushPendingStreamLoad();
+			TestEqual(StorageName + TEXT(": storage mode is kept"), Loaded->GetStreamStorage(), Storage);
+			TestFalse(StorageName + TEXT(": nothing is left pending"), LoadedMesh->HasPendingStreamLoad());
+			TestTrue(StorageName + TEXT(": detailed streams match"), GetTestStreamData(Loaded, Group0Key).OrderIndependentCompareEqual(ExpectedGroup0));
+			TestTrue(StorageName + TEXT(": coarse streams match"), GetTestStreamData(Loaded, Group1Key).OrderIndependentCompareEqual(ExpectedGroup1));
+		}
+		if (LoadedPackage)
+		{
+			UnloadSerializationTestPackage(LoadedPackage);
+		}
+
+		IFileManager::Get().Delete(*PackageFilename);
+	}
+
+	return true;
+}
+#endif
@@ -0,0 +1,203 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "RealtimeMeshCore.h"
+#include "RealtimeMeshSimple.h"
+#include "RealtimeMeshCollisionLibrary.h"
+
+using namespace RealtimeMesh;
+
+namespace
+{
+	TArray<FRealtimeMeshCollisionSphere> MakeSimpleGeometryTestSpheres(int32 Count, const TCHAR* Prefix)
+	{
+		TArray<FRealtimeMeshCollisionSphere> Spheres;
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			FRealtimeMeshCollisionSphere Sphere;
+			Sphere.Name = FName(Prefix, Index + 1);
+			Sphere.Center = FVector(Index * 100.0, 0.0, 0.0);
+			Sphere.Radius = 10.0f + Index;
+			Spheres.Add(Sphere);
+		}
+		return Spheres;
+	}
+}
+
+// =====================================================================================================================
+// Shape Set Batch Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshSimpleGeometryBatchAddTest,
+	"RealtimeMeshComponent.SimpleGeometry.BatchAdd",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshSimpleGeometryBatchAddTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshSimpleGeometry Geometry;
+	const TArray<FRealtimeMeshCollisionSphere> Spheres = MakeSimpleGeometryTestSpheres(64, TEXT("Sphere"));
+
+	TArray<int32> Indices;
+	URealtimeMeshSimpleGeometryFunctionLibrary::AddSpheres(Geometry, Spheres, Indices);
+
+	TestEqual(TEXT("All spheres are added"), Geometry.Spheres.Num(), Spheres.Num());
+	TestEqual(TEXT("One index per sphere"), Indices.Num(), Spheres.Num());
+
+	bool bAllMatch = true;
+	for (int32 Index = 0; Index < Spheres.Num(); Index++)
+	{
+		const FRealtimeMeshCollisionSphere& Stored = Geometry.Spheres.GetByIndex(Indices[Index]);
+		bAllMatch &= Stored.Name == Spheres[Index].Name && Stored.Radius == Spheres[Index].Radius;
+		bAllMatch &= Geometry.Spheres.FindIndexByName(Spheres[Index].Name) == Indices[Index];
+	}
+	TestTrue(TEXT("Indices are returned in input order and names resolve to them"), bAllMatch);
+
+	// A second batch appends after the first without disturbing it
+	const TArray<FRealtimeMeshCollisionSphere> MoreSpheres = MakeSimpleGeometryTestSpheres(8, TEXT("Extra"));
+	TArray<int32> MoreIndices;
+	URealtimeMeshSimpleGeometryFunctionLibrary::AddSpheres(Geometry, MoreSpheres, MoreIndices);
+	TestEqual(TEXT("Second batch is appended"), Geometry.Spheres.Num(), Spheres.Num() + MoreSpheres.Num());
+	TestEqual(TEXT("Earlier names still resolve"), Geometry.Spheres.FindIndexByName(Spheres[10].Name), Indices[10]);
+	TestFalse(TEXT("Unknown names are a quiet miss"), Geometry.Spheres.Contains(FName("Missing")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshSimpleGeometryBatchUpdateTest,
+	"RealtimeMeshComponent.SimpleGeometry.BatchUpdate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshSimpleGeometryBatchUpdateTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshSimpleGeometry Geometry;
+	TArray<int32> Indices;
+	URealtimeMeshSimpleGeometryFunctionLibrary::AddBoxes(Geometry, { FRealtimeMeshCollisionBox(), FRealtimeMeshCollisionBox(), FRealtimeMeshCollisionBox() }, Indices);
+
+	// Name the boxes so renames can be checked
+	TArray<FRealtimeMeshCollisionBox> Named;
+	for (int32 Index = 0; Index < 3; Index++)
+	{
+		FRealtimeMeshCollisionBox Box(FVector(10.0 * (Index + 1)));
+		Box.Name = FName(TEXT("Box"), Index + 1);
+		Named.Add(Box);
+	}
+	int32 NumUpdated = 0;
+	URealtimeMeshSimpleGeometryFunctionLibrary::UpdateBoxes(Geometry, Indices, Named, NumUpdated);
+	TestEqual(TEXT("Every valid index is updated"), NumUpdated, 3);
+	TestEqual(TEXT("Updated names resolve"), Geometry.Boxes.FindIndexByName(FName(TEXT("Box"), 2)), Indices[1]);
+
+	// Rename one box, and include an invalid index that should be skipped
+	FRealtimeMeshCollisionBox Renamed = Named[1];
+	Renamed.Name = FName("Renamed");
+	Renamed.Extents = FVector(99.0);
+	URealtimeMeshSimpleGeometryFunctionLibrary::UpdateBoxes(Geometry, { Indices[1], 1000 }, { Renamed, Renamed }, NumUpdated);
+	TestEqual(TEXT("Invalid indices are skipped"), NumUpdated, 1);
+	TestFalse(TEXT("Old name no longer resolves"), Geometry.Boxes.Contains(FName(TEXT("Box"), 2)));
+	TestEqual(TEXT("New name resolves to the same index"), Geometry.Boxes.FindIndexByName(FName("Renamed")), Indices[1]);
+	TestEqual(TEXT("Shape data is updated"), Geometry.Boxes.GetByIndex(Indices[1]).Extents, FVector(99.0));
+	TestEqual(TEXT("Shape count is unchanged"), Geometry.Boxes.Num(), 3);
+
+	// Mismatched arrays do nothing
+	URealtimeMeshSimpleGeometryFunctionLibrary::UpdateBoxes(Geometry, { Indices[0] }, { }, NumUpdated);
+	TestEqual(TEXT("Mismatched arrays update nothing"), NumUpdated, 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshSimpleGeometryBatchRemoveTest,
+	"RealtimeMeshComponent.SimpleGeometry.BatchRemove",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshSimpleGeometryBatchRemoveTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshSimpleGeometry Geometry;
+	const TArray<FRealtimeMeshCollisionSphere> Spheres = MakeSimpleGeometryTestSpheres(10, TEXT("Sphere"));
+	TArray<int32> Indices;
+	URealtimeMeshSimpleGeometryFunctionLibrary::AddSpheres(Geometry, Spheres, Indices);
+
+	// Remove by index, with a repeat and an invalid index mixed in
+	int32 NumRemoved = 0;
+	URealtimeMeshSimpleGeometryFunctionLibrary::RemoveSpheres(Geometry, { Indices[1], Indices[3], Indices[3], -1, 500 }, NumRemoved);
+	TestEqual(TEXT("Only valid, distinct indices are removed"), NumRemoved, 2);
+	TestEqual(TEXT("Remaining count"), Geometry.Spheres.Num(), 8);
+	TestFalse(TEXT("Removed names no longer resolve"), Geometry.Spheres.Contains(Spheres[1].Name) || Geometry.Spheres.Contains(Spheres[3].Name));
+
+	// Indices of the untouched shapes don't shift
+	bool bStable = true;
+	for (int32 Index = 0; Index < Spheres.Num(); Index++)
+	{
+		if (Index != 1 && Index != 3)
+		{
+			bStable &= Geometry.Spheres.IsValidIndex(Indices[Index]) && Geometry.Spheres.GetByIndex(Indices[Index]).Name == Spheres[Index].Name;
+			bStable &= Geometry.Spheres.FindIndexByName(Spheres[Index].Name) == Indices[Index];
+		}
+	}
+	TestTrue(TEXT("Surviving shapes keep their index"), bStable);
+
+	// Remove by name, with a name that was already removed and one that never existed
+	URealtimeMeshSimpleGeometryFunctionLibrary::RemoveSpheresByName(Geometry, { Spheres[0].Name, Spheres[1].Name, FName("Missing"), Spheres[9].Name }, NumRemoved);
+	TestEqual(TEXT("Unknown names are skipped"), NumRemoved, 2);
+	TestEqual(TEXT("Remaining count after removing by name"), Geometry.Spheres.Num(), 6);
+	TestEqual(TEXT("Remaining names still resolve"), Geometry.Spheres.FindIndexByName(Spheres[5].Name), Indices[5]);
+
+	// Freed slots are reused by later adds without disturbing the survivors
+	TArray<int32> NewIndices;
+	URealtimeMeshSimpleGeometryFunctionLibrary::AddSpheres(Geometry, MakeSimpleGeometryTestSpheres(2, TEXT("Refill")), NewIndices);
+	TestEqual(TEXT("Refill count"), Geometry.Spheres.Num(), 8);
+	TestEqual(TEXT("Survivors are untouched by refill"), Geometry.Spheres.FindIndexByName(Spheres[5].Name), Indices[5]);
+	TestEqual(TEXT("Refilled names resolve"), Geometry.Spheres.FindIndexByName(FName(TEXT("Refill"), 2)), NewIndices[1]);
+
+	return true;
+}
+
+// =====================================================================================================================
+// Mesh Edit Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshSimpleGeometryEditInPlaceTest,
+	"RealtimeMeshComponent.SimpleGeometry.EditInPlace",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshSimpleGeometryEditInPlaceTest::RunTest(const FString& Parameters)
+{
+	URealtimeMeshSimple* RealtimeMesh = NewObject<URealtimeMeshSimple>();
+
+	const TArray<FRealtimeMeshCollisionSphere> Spheres = MakeSimpleGeometryTestSpheres(200, TEXT("Sphere"));
+	RealtimeMesh->EditSimpleGeometry([&](FRealtimeMeshSimpleGeometry& Geometry)
+	{
+		Geometry.Spheres.Append(Spheres);
+		return true;
+	});
+
+	const FRealtimeMeshSimpleGeometry AfterAdd = RealtimeMesh->GetSimpleGeometry();
+	TestEqual(TEXT("Edit is visible immediately"), AfterAdd.Spheres.Num(), Spheres.Num());
+	TestTrue(TEXT("Copied geometry keeps its name lookups"), AfterAdd.Spheres.Contains(Spheres[150].Name));
+
+	RealtimeMesh->EditSimpleGeometry([&](FRealtimeMeshSimpleGeometry& Geometry)
+	{
+		TArray<FName> Names;
+		for (int32 Index = 0; Index < 100; Index++)
+		{
+			Names.Add(Spheres[Index].Name);
+		}
+		return Geometry.Spheres.RemoveManyByName(Names) > 0;
+	});
+	TestEqual(TEXT("Batch removal is applied to the mesh"), RealtimeMesh->GetSimpleGeometry().Spheres.Num(), 100);
+
+	int32 NumSeen = 0;
+	RealtimeMesh->ProcessSimpleGeometry([&](const FRealtimeMeshSimpleGeometry& Geometry)
+	{
+		NumSeen = Geometry.Spheres.Num();
+	});
+	TestEqual(TEXT("Process sees the same geometry"), NumSeen, 100);
+
+	// An edit that reports no change skips the collision rebuild altogether
+	TFuture<ERealtimeMeshCollisionUpdateResult> NoChange = RealtimeMesh->EditSimpleGeometry([&](FRealtimeMeshSimpleGeometry& Geometry)
+	{
+		return Geometry.Spheres.RemoveManyByName({ FName("Missing") }) > 0;
+	});
+	TestTrue(TEXT("Unchanged edit resolves immediately"), NoChange.IsReady());
+	TestEqual(TEXT("Unchanged edit is ignored"), NoChange.Get(), ERealtimeMeshCollisionUpdateResult::Ignored);
+
+	return true;
+}
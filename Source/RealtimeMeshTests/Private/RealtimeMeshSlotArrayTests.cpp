@@ -0,0 +1,182 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Core/RealtimeMeshSlotArray.h"
+#include "Core/RealtimeMeshKeys.h"
+#include "HAL/PlatformTime.h"
+
+using namespace RealtimeMesh;
+
+// =====================================================================================================================
+// Slot Array Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshSlotArrayHandlesTest,
+	"RealtimeMeshComponent.SlotArray.Handles",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshSlotArrayHandlesTest::RunTest(const FString& Parameters)
+{
+	TRealtimeMeshSlotArray<int32> Slots;
+
+	const FRealtimeMeshHandle A = Slots.Add(10);
+	const FRealtimeMeshHandle B = Slots.Add(20);
+	const FRealtimeMeshHandle C = Slots.Add(30);
+
+	TestEqual(TEXT("Num after adds"), Slots.Num(), 3);
+	TestTrue(TEXT("Handles resolve"), Slots.Find(A) && *Slots.Find(A) == 10 && *Slots.Find(C) == 30);
+	TestFalse(TEXT("Default handle never resolves"), Slots.IsValidHandle(FRealtimeMeshHandle()));
+
+	// Removing from the middle leaves the rest where they were
+	TestTrue(TEXT("Remove succeeds"), Slots.Remove(B));
+	TestFalse(TEXT("Double remove fails"), Slots.Remove(B));
+	TestNull(TEXT("Removed handle no longer resolves"), Slots.Find(B));
+	TestEqual(TEXT("Other slot index is stable"), static_cast<int32>(C.Index), 2);
+	TestEqual(TEXT("Other handle still resolves"), *Slots.Find(C), 30);
+	TestEqual(TEXT("Max index is unchanged"), Slots.GetMaxIndex(), 3);
+
+	// The freed slot is reused with a new generation
+	const FRealtimeMeshHandle D = Slots.Add(40);
+	TestEqual(TEXT("Freed slot is reused"), static_cast<int32>(D.Index), static_cast<int32>(B.Index));
+	TestTrue(TEXT("Generation is bumped"), D.Generation != B.Generation);
+	TestNull(TEXT("Stale handle does not alias the new element"), Slots.Find(B));
+	TestEqual(TEXT("New handle resolves"), *Slots.Find(D), 40);
+
+	// Iteration skips free slots and reports slot indices
+	Slots.Remove(A);
+	TArray<int32> Seen;
+	for (auto It = Slots.CreateConstIterator(); It; ++It)
+	{
+		Seen.Add(*It);
+		TestTrue(TEXT("Iterator handle matches slot"), Slots.IsValidHandle(It.GetHandle()));
+	}
+	TestTrue(TEXT("Iteration visits only live elements in slot order"), Seen == TArray<int32>({ 40, 30 }));
+
+	Slots.Empty();
+	TestTrue(TEXT("Empty clears everything"), Slots.IsEmpty() && Slots.Find(C) == nullptr && Slots.Find(D) == nullptr);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshSlotArrayMirrorTest,
+	"RealtimeMeshComponent.SlotArray.Mirror",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshSlotArrayMirrorTest::RunTest(const FString& Parameters)
+{
+	TRealtimeMeshSlotArray<FName> Source;
+	TRealtimeMeshSlotArray<int32> Mirror;
+
+	const FRealtimeMeshHandle A = Source.Add(FName("A"));
+	const FRealtimeMeshHandle B = Source.Add(FName("B"));
+	const FRealtimeMeshHandle C = Source.Add(FName("C"));
+
+	// Out of order placement grows the mirror and leaves the gaps free
+	Mirror.EmplaceAt(C, 30);
+	TestEqual(TEXT("Num after placing past the end"), Mirror.Num(), 1);
+	TestEqual(TEXT("Mirror grows to the placed slot"), Mirror.GetMaxIndex(), Source.GetMaxIndex());
+	TestEqual(TEXT("Source handle resolves in the mirror"), *Mirror.Find(C), 30);
+	TestNull(TEXT("Gaps are free"), Mirror.Find(A));
+
+	Mirror.EmplaceAt(A, 10);
+	Mirror.EmplaceAt(B, 20);
+	TestEqual(TEXT("Num after filling the gaps"), Mirror.Num(), 3);
+
+	// A recycled source slot replaces the stale mirror element, and its old handle stops resolving
+	Source.Remove(B);
+	const FRealtimeMeshHandle D = Source.Add(FName("D"));
+	Mirror.EmplaceAt(D, 40);
+	TestEqual(TEXT("Replacing keeps the count"), Mirror.Num(), 3);
+	TestNull(TEXT("Replaced handle no longer resolves"), Mirror.Find(B));
+	TestEqual(TEXT("New handle resolves"), *Mirror.Find(D), 40);
+
+	// Gap slots are still handed out by Add
+	TRealtimeMeshSlotArray<int32> Sparse;
+	Sparse.EmplaceAt(FRealtimeMeshHandle(2, 1), 30);
+	const FRealtimeMeshHandle Filled = Sparse.Add(10);
+	TestTrue(TEXT("Add reuses a gap left by placement"), Filled.Index < 2);
+	TestEqual(TEXT("Num counts both"), Sparse.Num(), 2);
+
+	return true;
+}
+
+// =====================================================================================================================
+// Unique Key Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshSlotArrayUniqueKeysTest,
+	"RealtimeMeshComponent.SlotArray.UniqueKeys",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshSlotArrayUniqueKeysTest::RunTest(const FString& Parameters)
+{
+	const FRealtimeMeshLODKey LODKey(0);
+
+	TSet<FRealtimeMeshSectionGroupKey> GroupKeys;
+	TSet<FRealtimeMeshSectionKey> SectionKeys;
+	for (int32 Index = 0; Index < 1000; Index++)
+	{
+		const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::CreateUnique(LODKey);
+		GroupKeys.Add(GroupKey);
+		SectionKeys.Add(FRealtimeMeshSectionKey::CreateUnique(GroupKey));
+	}
+
+	TestEqual(TEXT("Unique group keys never collide"), GroupKeys.Num(), 1000);
+	TestEqual(TEXT("Unique section keys never collide"), SectionKeys.Num(), 1000);
+
+	return true;
+}
+
+// =====================================================================================================================
+// Lookup Benchmark
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshSlotArrayLookupBenchmarkTest,
+	"RealtimeMeshComponent.SlotArray.LookupBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshSlotArrayLookupBenchmarkTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumElements = 4096;
+	constexpr int32 NumPasses = 64;
+
+	TRealtimeMeshSlotArray<int32> Slots;
+	TMap<FRealtimeMeshSectionGroupKey, int32> KeyMap;
+	TArray<FRealtimeMeshHandle> Handles;
+	TArray<FRealtimeMeshSectionGroupKey> Keys;
+
+	for (int32 Index = 0; Index < NumElements; Index++)
+	{
+		const FRealtimeMeshSectionGroupKey Key = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), Index);
+		Keys.Add(Key);
+		KeyMap.Add(Key, Index);
+		Handles.Add(Slots.Add(Index));
+	}
+
+	int64 MapSum = 0;
+	const double MapStart = FPlatformTime::Seconds();
+	for (int32 Pass = 0; Pass < NumPasses; Pass++)
+	{
+		for (const FRealtimeMeshSectionGroupKey& Key : Keys)
+		{
+			MapSum += KeyMap.FindChecked(Key);
+		}
+	}
+	const double MapTime = FPlatformTime::Seconds() - MapStart;
+
+	int64 HandleSum = 0;
+	const double HandleStart = FPlatformTime::Seconds();
+	for (int32 Pass = 0; Pass < NumPasses; Pass++)
+	{
+		for (const FRealtimeMeshHandle& Handle : Handles)
+		{
+			HandleSum += *Slots.Find(Handle);
+		}
+	}
+	const double HandleTime = FPlatformTime::Seconds() - HandleStart;
+
+	TestEqual(TEXT("Both lookups see the same elements"), HandleSum, MapSum);
+	AddInfo(FString::Printf(TEXT("%d lookups: key map %.3f ms, handle %.3f ms"), NumElements * NumPasses, MapTime * 1000.0, HandleTime * 1000.0));
+
+	return true;
+}
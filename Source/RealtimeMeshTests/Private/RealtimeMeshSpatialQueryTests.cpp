@@ -0,0 +1,544 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "RealtimeMeshCore.h"
+#include "RealtimeMeshSimple.h"
+#include "Core/RealtimeMeshBuilder.h"
+#include "Data/RealtimeMeshSpatialIndex.h"
+#include "Mesh/RealtimeMeshTriangleBVH.h"
+#include "Math/RandomStream.h"
+
+using namespace RealtimeMesh;
+
+namespace
+{
+	/* Bumpy height field with a handful of loose triangles floating above it */
+	void BuildSpatialTestSoup(TArray<FVector3f>& OutPositions, TArray<TIndex3<int32>>& OutTriangles, int32 GridSize)
+	{
+		FRandomStream Random(4242);
+
+		for (int32 Y = 0; Y <= GridSize; Y++)
+		{
+			for (int32 X = 0; X <= GridSize; X++)
+			{
+				OutPositions.Add(FVector3f(X * 10.0f, Y * 10.0f, Random.FRandRange(-5.0f, 5.0f)));
+			}
+		}
+		for (int32 Y = 0; Y < GridSize; Y++)
+		{
+			for (int32 X = 0; X < GridSize; X++)
+			{
+				const int32 V0 = Y * (GridSize + 1) + X;
+				const int32 V1 = V0 + 1;
+				const int32 V2 = V0 + GridSize + 1;
+				const int32 V3 = V2 + 1;
+				OutTriangles.Add(TIndex3<int32>(V0, V2, V1));
+				OutTriangles.Add(TIndex3<int32>(V1, V2, V3));
+			}
+		}
+
+		const float Extent = GridSize * 10.0f;
+		for (int32 Index = 0; Index < 64; Index++)
+		{
+			const FVector3f Center(Random.FRandRange(0.0f, Extent), Random.FRandRange(0.0f, Extent), Random.FRandRange(10.0f, 60.0f));
+			const int32 First = OutPositions.Num();
+			for (int32 Corner = 0; Corner < 3; Corner++)
+			{
+				OutPositions.Add(Center + FVector3f(Random.GetUnitVector()) * 8.0f);
+			}
+			OutTriangles.Add(TIndex3<int32>(First, First + 1, First + 2));
+		}
+	}
+
+	bool BruteForceRaycast(const TArray<FVector3f>& Positions, const TArray<TIndex3<int32>>& Triangles, const FVector& Start, const FVector& End, float& OutDistance)
+	{
+		bool bHit = false;
+		OutDistance = TNumericLimits<float>::Max();
+		for (const TIndex3<int32>& Triangle : Triangles)
+		{
+			FVector HitPoint, HitNormal;
+			if (FMath::SegmentTriangleIntersection(Start, End, FVector(Positions[Triangle.V0]), FVector(Positions[Triangle.V1]), FVector(Positions[Triangle.V2]), HitPoint, HitNormal))
+			{
+				OutDistance = FMath::Min(OutDistance, static_cast<float>(FVector::Distance(Start, HitPoint)));
+				bHit = true;
+			}
+		}
+		return bHit;
+	}
+
+	float BruteForceClosestDistance(const TArray<FVector3f>& Positions, const TArray<TIndex3<int32>>& Triangles, const FVector& Point)
+	{
+		float ClosestDistance = TNumericLimits<float>::Max();
+		for (const TIndex3<int32>& Triangle : Triangles)
+		{
+			const FVector Closest = FMath::ClosestPointOnTriangleToPoint(Point, FVector(Positions[Triangle.V0]), FVector(Positions[Triangle.V1]), FVector(Positions[Triangle.V2]));
+			ClosestDistance = FMath::Min(ClosestDistance, static_cast<float>(FVector::Distance(Point, Closest)));
+		}
+		return ClosestDistance;
+	}
+
+	/* Flat quad from Offset to Offset + (Size, Size) with UV0 running 0-1 across it and UV1 = UV0 * 2 */
+	void BuildSpatialTestQuad(FRealtimeMeshStreamSet& StreamSet, const FVector3f& Offset, float Size)
+	{
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2f, 2> Builder(StreamSet);
+		Builder.EnableTexCoords(2);
+
+		Builder.AddVertex(Offset + FVector3f(0, 0, 0)).SetTexCoord(0, FVector2f(0, 0)).SetTexCoord(1, FVector2f(0, 0));
+		Builder.AddVertex(Offset + FVector3f(Size, 0, 0)).SetTexCoord(0, FVector2f(1, 0)).SetTexCoord(1, FVector2f(2, 0));
+		Builder.AddVertex(Offset + FVector3f(Size, Size, 0)).SetTexCoord(0, FVector2f(1, 1)).SetTexCoord(1, FVector2f(2, 2));
+		Builder.AddVertex(Offset + FVector3f(0, Size, 0)).SetTexCoord(0, FVector2f(0, 1)).SetTexCoord(1, FVector2f(0, 2));
+		Builder.AddTriangle(0, 1, 2);
+		Builder.AddTriangle(0, 2, 3);
+	}
+}
+
+// =====================================================================================================================
+// BVH Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshSpatialBVHBruteForceTest,
+	"RealtimeMeshComponent.SpatialQuery.BVHMatchesBruteForce",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshSpatialBVHBruteForceTest::RunTest(const FString& Parameters)
+{
+	TArray<FVector3f> Positions;
+	TArray<TIndex3<int32>> Triangles;
+	BuildSpatialTestSoup(Positions, Triangles, 24);
+
+	FRealtimeMeshTriangleBVH BVH;
+	BVH.Build(TArray<FVector3f>(Positions), Triangles);
+	TestEqual(TEXT("Every triangle is indexed"), BVH.NumTriangles(), Triangles.Num());
+
+	int32 MaxLeafSize = 0;
+	for (const FRealtimeMeshTriangleBVH::FNode& Node : BVH.GetNodes())
+	{
+		MaxLeafSize = FMath::Max(MaxLeafSize, Node.NumTriangles);
+	}
+	TestTrue(TEXT("Leaves respect the size limit"), MaxLeafSize <= FRealtimeMeshTriangleBVH::MaxLeafTriangles);
+
+	FRandomStream Random(99);
+	const float Extent = 240.0f;
+	int32 NumRayHits = 0;
+	int32 NumDisagreements = 0;
+	bool bRaysMatch = true;
+	for (int32 RayIndex = 0; RayIndex < 500; RayIndex++)
+	{
+		const FVector Start(Random.FRandRange(-20.0f, Extent + 20.0f), Random.FRandRange(-20.0f, Extent + 20.0f), Random.FRandRange(-40.0f, 100.0f));
+		const FVector Direction = Random.GetUnitVector();
+		const float Length = 300.0f;
+
+		float ExpectedDistance;
+		const bool bExpectedHit = BruteForceRaycast(Positions, Triangles, Start, Start + Direction * Length, ExpectedDistance);
+
+		FRealtimeMeshTriangleHit Hit;
+		const bool bHit = BVH.Raycast(FVector3f(Start), FVector3f(Direction), Length, Hit);
+
+		// Rays grazing a shared edge can legitimately go either way between the two implementations
+		if (bHit != bExpectedHit)
+		{
+			NumDisagreements++;
+			continue;
+		}
+		if (bHit)
+		{
+			NumRayHits++;
+			bRaysMatch &= FMath::IsNearlyEqual(Hit.Distance, ExpectedDistance, 0.01f);
+			bRaysMatch &= Hit.Location.Equals(FVector3f(Start + Direction * Hit.Distance), 0.01f);
+		}
+	}
+	TestTrue(TEXT("Raycasts match brute force"), bRaysMatch);
+	TestTrue(TEXT("Hit or miss agrees with brute force"), NumDisagreements <= 5);
+	TestTrue(TEXT("Enough rays hit to be meaningful"), NumRayHits > 100);
+
+	bool bClosestMatch = true;
+	for (int32 PointIndex = 0; PointIndex < 500; PointIndex++)
+	{
+		const FVector Point(Random.FRandRange(-50.0f, Extent + 50.0f), Random.FRandRange(-50.0f, Extent + 50.0f), Random.FRandRange(-50.0f, 100.0f));
+		const float ExpectedDistance = BruteForceClosestDistance(Positions, Triangles, Point);
+
+		FRealtimeMeshTriangleHit Hit;
+		const bool bFound = BVH.FindClosestPoint(FVector3f(Point), 1000.0f, Hit);
+		bClosestMatch &= bFound && FMath::IsNearlyEqual(Hit.Distance, ExpectedDistance, 0.01f);
+		if (!bFound)
+		{
+			continue;
+		}
+
+		// The reported location and barycentrics have to agree with each other
+		const TIndex3<int32>& Triangle = Triangles[Hit.TriangleIndex];
+		const FVector3f FromBarycentrics = Positions[Triangle.V0] * Hit.Barycentrics.X + Positions[Triangle.V1] * Hit.Barycentrics.Y + Positions[Triangle.V2] * Hit.Barycentrics.Z;
+		bClosestMatch &= FromBarycentrics.Equals(Hit.Location, 0.01f);
+	}
+	TestTrue(TEXT("Closest point queries match brute force"), bClosestMatch);
+
+	FRealtimeMeshTriangleHit FarHit;
+	TestFalse(TEXT("Closest point respects the max distance"), BVH.FindClosestPoint(FVector3f(0, 0, 5000), 100.0f, FarHit));
+
+	// Out of range indices are dropped rather than read
+	TArray<TIndex3<int32>> BrokenTriangles = { TIndex3<int32>(0, 1, 2), TIndex3<int32>(0, 1, 99) };
+	FRealtimeMeshTriangleBVH BrokenBVH;
+	BrokenBVH.Build({ FVector3f(0, 0, 0), FVector3f(10, 0, 0), FVector3f(0, 10, 0) }, BrokenTriangles);
+	TestEqual(TEXT("Invalid triangles are skipped"), BrokenBVH.NumTriangles(), 1);
+
+	FRealtimeMeshTriangleBVH EmptyBVH;
+	EmptyBVH.Build({}, {});
+	FRealtimeMeshTriangleHit EmptyHit;
+	TestTrue(TEXT("Empty hierarchy finds nothing"), EmptyBVH.IsEmpty() && !EmptyBVH.Raycast(FVector3f::ZeroVector, FVector3f::UnitZ(), 100.0f, EmptyHit));
+
+	return true;
+}
+
+// =====================================================================================================================
+// UV Lookup Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshSpatialUVLookupTest,
+	"RealtimeMeshComponent.SpatialQuery.UVLookup",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshSpatialUVLookupTest::RunTest(const FString& Parameters)
+{
+	URealtimeMeshSimple* RealtimeMesh = NewObject<URealtimeMeshSimple>();
+	const FRealtimeMeshLODKey LODKey(0);
+
+	FRealtimeMeshStreamSet StreamSet;
+	BuildSpatialTestQuad(StreamSet, FVector3f::ZeroVector, 100.0f);
+	RealtimeMesh->CreateSectionGroup(FRealtimeMeshSectionGroupKey::Create(LODKey, FName("UVTest")), StreamSet);
+
+	// The queries never wait for the index, so they find nothing until its first build lands
+	FVector2D UV;
+	TestFalse(TEXT("Nothing is found before the index is built"), RealtimeMesh->FindTexCoordAtLocation(LODKey, FVector(25, 50, 10), 0, 20.0f, UV));
+	RealtimeMesh->GetMeshData()->UpdateSpatialIndex(LODKey).Wait();
+
+	TestTrue(TEXT("Closest point lookup finds the quad"), RealtimeMesh->FindTexCoordAtLocation(LODKey, FVector(25, 50, 10), 0, 20.0f, UV));
+	TestTrue(TEXT("Closest point UV is interpolated"), UV.Equals(FVector2D(0.25, 0.5), 1e-4));
+
+	TestTrue(TEXT("Second channel is available"), RealtimeMesh->FindTexCoordAtLocation(LODKey, FVector(25, 50, 10), 1, 20.0f, UV));
+	TestTrue(TEXT("Second channel UV is interpolated"), UV.Equals(FVector2D(0.5, 1.0), 1e-4));
+
+	TestFalse(TEXT("Lookup respects the max distance"), RealtimeMesh->FindTexCoordAtLocation(LODKey, FVector(25, 50, 10), 0, 5.0f, UV));
+	TestFalse(TEXT("Missing channel fails"), RealtimeMesh->FindTexCoordAtLocation(LODKey, FVector(25, 50, 10), 3, 20.0f, UV));
+	TestFalse(TEXT("Missing LOD fails"), RealtimeMesh->FindTexCoordAtLocation(FRealtimeMeshLODKey(3), FVector(25, 50, 10), 0, 20.0f, UV));
+
+	TestTrue(TEXT("Raycast lookup hits the quad"), RealtimeMesh->FindTexCoordByRaycast(LODKey, FVector(75, 10, 50), FVector(0, 0, -2), 0, 100.0f, UV));
+	TestTrue(TEXT("Raycast UV is interpolated"), UV.Equals(FVector2D(0.75, 0.1), 1e-4));
+	TestFalse(TEXT("Raycast that misses finds nothing"), RealtimeMesh->FindTexCoordByRaycast(LODKey, FVector(175, 10, 50), FVector(0, 0, -1), 0, 100.0f, UV));
+
+	TArray<FVector> Locations;
+	for (int32 Index = 0; Index < 1000; Index++)
+	{
+		Locations.Add(FVector((Index % 100) + 0.5, (Index / 10) + 0.5, 1.0));
+	}
+	Locations.Add(FVector(500, 500, 500));
+
+	TArray<FVector2D> UVs;
+	TArray<bool> Found;
+	const int32 NumFound = RealtimeMesh->FindTexCoordsAtLocations(LODKey, Locations, 0, 10.0f, UVs, Found);
+	TestEqual(TEXT("Batch finds every location on the quad"), NumFound, 1000);
+	TestFalse(TEXT("Batch reports the miss"), Found.Last());
+
+	bool bBatchMatches = true;
+	for (int32 Index = 0; Index < 1000; Index++)
+	{
+		bBatchMatches &= Found[Index] && UVs[Index].Equals(FVector2D(Locations[Index].X / 100.0, Locations[Index].Y / 100.0), 1e-4);
+	}
+	TestTrue(TEXT("Batch UVs match the single lookups"), bBatchMatches);
+
+	return true;
+}
+
+// =====================================================================================================================
+// Incremental Rebuild Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshSpatialIncrementalTest,
+	"RealtimeMeshComponent.SpatialQuery.IncrementalRebuild",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshSpatialIncrementalTest::RunTest(const FString& Parameters)
+{
+	URealtimeMeshSimple* RealtimeMesh = NewObject<URealtimeMeshSimple>();
+	const TSharedRef<FRealtimeMeshSimple> MeshData = RealtimeMesh->GetMeshData();
+	const FRealtimeMeshLODKey LODKey(0);
+	const FRealtimeMeshSectionGroupKey GroupA = FRealtimeMeshSectionGroupKey::Create(LODKey, FName("A"));
+	const FRealtimeMeshSectionGroupKey GroupB = FRealtimeMeshSectionGroupKey::Create(LODKey, FName("B"));
+
+	FRealtimeMeshStreamSet StreamsA, StreamsB;
+	BuildSpatialTestQuad(StreamsA, FVector3f::ZeroVector, 100.0f);
+	BuildSpatialTestQuad(StreamsB, FVector3f(200, 0, 0), 100.0f);
+	RealtimeMesh->CreateSectionGroup(GroupA, StreamsA);
+	RealtimeMesh->CreateSectionGroup(GroupB, StreamsB);
+
+	const FRealtimeMeshSpatialIndexPtr First = MeshData->UpdateSpatialIndex(LODKey).Get();
+	TestTrue(TEXT("Index covers both groups"), First.IsValid() && First->GetGroups().Num() == 2);
+
+	const FRealtimeMeshSpatialIndexPtr Unchanged = MeshData->UpdateSpatialIndex(LODKey).Get();
+	TestTrue(TEXT("Unchanged mesh reuses the index"), Unchanged == First);
+	TestTrue(TEXT("Non blocking get returns the built index"), MeshData->GetSpatialIndex(LODKey, false) == First);
+
+	// Move group B up, only it should be rebuilt
+	FRealtimeMeshStreamSet MovedStreamsB;
+	BuildSpatialTestQuad(MovedStreamsB, FVector3f(200, 0, 50), 100.0f);
+	RealtimeMesh->UpdateSectionGroup(GroupB, MovedStreamsB);
+
+	const FRealtimeMeshSpatialIndexPtr Second = MeshData->UpdateSpatialIndex(LODKey).Get();
+	TestTrue(TEXT("Edited mesh gets a new index"), Second.IsValid() && Second != First);
+	TestTrue(TEXT("Untouched group is carried over"), Second->FindGroup(GroupA) == First->FindGroup(GroupA));
+	TestTrue(TEXT("Edited group is rebuilt"), Second->FindGroup(GroupB) != First->FindGroup(GroupB));
+
+	FRealtimeMeshSpatialHit Hit;
+	TestTrue(TEXT("Rebuilt group reflects the edit"), Second->FindClosestPoint(FVector3f(250, 50, 60), 20.0f, Hit) && Hit.SectionGroupKey == GroupB &&
+		FMath::IsNearlyEqual(Hit.Distance, 10.0f, 1e-3f));
+
+	RealtimeMesh->RemoveSectionGroup(GroupA);
+	const FRealtimeMeshSpatialIndexPtr Third = MeshData->UpdateSpatialIndex(LODKey).Get();
+	TestTrue(TEXT("Removed group leaves the index"), Third.IsValid() && Third->GetGroups().Num() == 1 && Third->FindGroup(GroupA) == nullptr);
+
+	// A build still running when the mesh is reset must not bring the old triangles back
+	RealtimeMesh->UpdateSectionGroup(GroupB, StreamsB);
+	TFuture<FRealtimeMeshSpatialIndexPtr> PendingBuild = MeshData->UpdateSpatialIndex(LODKey);
+	RealtimeMesh->Reset();
+	PendingBuild.Wait();
+	TestFalse(TEXT("Reset drops the index along with any build in flight"), MeshData->GetSpatialIndex(LODKey).IsValid());
+
+	return true;
+}
+
+// =====================================================================================================================
+// Sphere Sweep Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshSpatialSweepTest,
+	"RealtimeMeshComponent.SpatialQuery.SweepSphere",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshSpatialSweepTest::RunTest(const FString& Parameters)
+{
+	TArray<FVector3f> Positions;
+	TArray<TIndex3<int32>> Triangles;
+	BuildSpatialTestSoup(Positions, Triangles, 16);
+
+	FRealtimeMeshTriangleBVH BVH;
+	BVH.Build(TArray<FVector3f>(Positions), Triangles);
+
+	// Sample each sweep along its path: the sphere must clear the mesh up to the hit, and be touching it at the hit
+	FRandomStream Random(7);
+	const float Radius = 4.0f;
+	const float Length = 200.0f;
+	constexpr int32 NumSamples = 64;
+	int32 NumHits = 0;
+	bool bSweepsMatch = true;
+	for (int32 SweepIndex = 0; SweepIndex < 200; SweepIndex++)
+	{
+		const FVector Start(Random.FRandRange(0.0f, 160.0f), Random.FRandRange(0.0f, 160.0f), Random.FRandRange(80.0f, 120.0f));
+		const FVector Direction = (FVector(Random.FRandRange(-0.5f, 0.5f), Random.FRandRange(-0.5f, 0.5f), -1.0f)).GetSafeNormal();
+
+		FRealtimeMeshTriangleHit Hit;
+		const bool bHit = BVH.SweepSphere(FVector3f(Start), FVector3f(Direction), Radius, Length, Hit);
+		const float ClearDistance = bHit ? Hit.Distance : Length;
+
+		for (int32 Sample = 0; Sample < NumSamples; Sample++)
+		{
+			const FVector Center = Start + Direction * (ClearDistance * Sample / NumSamples);
+			bSweepsMatch &= BruteForceClosestDistance(Positions, Triangles, Center) >= Radius - 0.01f;
+		}
+
+		if (bHit)
+		{
+			NumHits++;
+			const FVector Center = Start + Direction * Hit.Distance;
+			bSweepsMatch &= FMath::IsNearlyEqual(BruteForceClosestDistance(Positions, Triangles, Center), Radius, 0.01f);
+			bSweepsMatch &= FMath::IsNearlyEqual(FVector::Distance(Center, FVector(Hit.Location)), static_cast<double>(Radius), 0.01);
+			bSweepsMatch &= Hit.Normal.IsNormalized() && (FVector3f(Center) - Hit.Location).GetSafeNormal().Equals(Hit.Normal, 1e-3f);
+		}
+	}
+	TestTrue(TEXT("Sweeps stop where the sphere first touches the mesh"), bSweepsMatch);
+	TestTrue(TEXT("Enough sweeps hit to be meaningful"), NumHits > 100);
+
+	// A sphere that starts out overlapping hits at zero
+	FRealtimeMeshTriangleHit StartHit;
+	TestTrue(TEXT("Initial overlap hits at distance 0"), BVH.SweepSphere(FVector3f(Positions[0]) + FVector3f(0, 0, 1), FVector3f::UnitZ(), Radius, 100.0f, StartHit) &&
+		StartHit.Distance == 0.0f);
+
+	// The sphere should catch an edge a plain ray would slip past
+	FRealtimeMeshTriangleBVH SingleBVH;
+	SingleBVH.Build({ FVector3f(0, 0, 0), FVector3f(10, 0, 0), FVector3f(0, 10, 0) }, { TIndex3<int32>(0, 1, 2) });
+	FRealtimeMeshTriangleHit EdgeHit;
+	TestFalse(TEXT("Ray passes beside the triangle"), SingleBVH.Raycast(FVector3f(-1, 5, 10), -FVector3f::UnitZ(), 20.0f, EdgeHit));
+	TestTrue(TEXT("Sweep catches the edge"), SingleBVH.SweepSphere(FVector3f(-1, 5, 10), -FVector3f::UnitZ(), 2.0f, 20.0f, EdgeHit) &&
+		FMath::IsNearlyEqual(EdgeHit.Distance, 10.0f - FMath::Sqrt(3.0f), 1e-3f) && EdgeHit.Location.Equals(FVector3f(0, 5, 0), 1e-3f));
+
+	return true;
+}
+
+// =====================================================================================================================
+// Refit Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshSpatialRefitTest,
+	"RealtimeMeshComponent.SpatialQuery.Refit",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshSpatialRefitTest::RunTest(const FString& Parameters)
+{
+	TArray<FVector3f> Positions;
+	TArray<TIndex3<int32>> Triangles;
+	BuildSpatialTestSoup(Positions, Triangles, 16);
+
+	FRealtimeMeshTriangleBVH BVH;
+	BVH.Build(TArray<FVector3f>(Positions), Triangles);
+	const int32 NumNodes = BVH.NumNodes();
+
+	// Ripple the surface and push it up, then compare against a hierarchy built from scratch
+	TArray<FVector3f> MovedPositions = Positions;
+	for (FVector3f& Position : MovedPositions)
+	{
+		Position.Z += 20.0f + 8.0f * FMath::Sin(Position.X * 0.05f) * FMath::Cos(Position.Y * 0.05f);
+	}
+
+	TestFalse(TEXT("Refit rejects a different vertex count"), BVH.Refit(TArray<FVector3f>(Positions.GetData(), Positions.Num() - 1)));
+	TestTrue(TEXT("Refit accepts the moved vertices"), BVH.Refit(TArray<FVector3f>(MovedPositions)));
+	TestEqual(TEXT("Refit keeps the tree structure"), BVH.NumNodes(), NumNodes);
+
+	FRealtimeMeshTriangleBVH FreshBVH;
+	FreshBVH.Build(TArray<FVector3f>(MovedPositions), Triangles);
+	TestTrue(TEXT("Refit bounds match a rebuild"), BVH.GetBounds().Equals(FreshBVH.GetBounds(), 1e-3f));
+
+	FRandomStream Random(31);
+	bool bQueriesMatch = true;
+	for (int32 QueryIndex = 0; QueryIndex < 300; QueryIndex++)
+	{
+		const FVector3f Point(Random.FRandRange(-20.0f, 180.0f), Random.FRandRange(-20.0f, 180.0f), Random.FRandRange(-20.0f, 120.0f));
+		const FVector3f Direction = FVector3f(Random.GetUnitVector());
+
+		FRealtimeMeshTriangleHit RefitHit, FreshHit;
+		const bool bRefitHit = BVH.Raycast(Point, Direction, 300.0f, RefitHit);
+		bQueriesMatch &= bRefitHit == FreshBVH.Raycast(Point, Direction, 300.0f, FreshHit);
+		bQueriesMatch &= !bRefitHit || FMath::IsNearlyEqual(RefitHit.Distance, FreshHit.Distance, 1e-3f);
+
+		bQueriesMatch &= BVH.FindClosestPoint(Point, 1000.0f, RefitHit) && FreshBVH.FindClosestPoint(Point, 1000.0f, FreshHit) &&
+			FMath::IsNearlyEqual(RefitHit.Distance, FreshHit.Distance, 1e-3f);
+	}
+	TestTrue(TEXT("Refit hierarchy answers queries like a rebuilt one"), bQueriesMatch);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshSpatialMeshRefitTest,
+	"RealtimeMeshComponent.SpatialQuery.MeshRefit",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshSpatialMeshRefitTest::RunTest(const FString& Parameters)
+{
+	URealtimeMeshSimple* RealtimeMesh = NewObject<URealtimeMeshSimple>();
+	const TSharedRef<FRealtimeMeshSimple> MeshData = RealtimeMesh->GetMeshData();
+	const FRealtimeMeshLODKey LODKey(0);
+	const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(LODKey, FName("Refit"));
+
+	FRealtimeMeshStreamSet StreamSet;
+	BuildSpatialTestQuad(StreamSet, FVector3f::ZeroVector, 100.0f);
+	RealtimeMesh->CreateSectionGroup(GroupKey, StreamSet);
+
+	const FRealtimeMeshSpatialIndexPtr First = MeshData->UpdateSpatialIndex(LODKey).Get();
+	TestTrue(TEXT("Fresh group is built"), First.IsValid() && First->FindGroup(GroupKey) && !First->FindGroup(GroupKey)->WasRefit());
+
+	// Moving only the vertices refits the existing hierarchy
+	RealtimeMesh->EditMeshInPlace(GroupKey, [](FRealtimeMeshStreamSet& Streams) -> TSet<FRealtimeMeshStreamKey>
+	{
+		FRealtimeMeshStream* PositionStream = Streams.Find(FRealtimeMeshStreams::Position);
+		for (FVector3f& Position : PositionStream->GetArrayView<FVector3f>())
+		{
+			Position.Z += 30.0f;
+		}
+		return { FRealtimeMeshStreams::Position };
+	}).Wait();
+
+	const FRealtimeMeshSpatialIndexPtr Second = MeshData->UpdateSpatialIndex(LODKey).Get();
+	TestTrue(TEXT("Position only edit refits"), Second.IsValid() && Second != First && Second->FindGroup(GroupKey)->WasRefit());
+
+	FVector HitLocation, HitNormal;
+	FRealtimeMeshSectionGroupKey HitGroup;
+	TestTrue(TEXT("Line trace sees the moved quad"), RealtimeMesh->LineTraceRenderData(LODKey, FVector(40, 60, 100), FVector(40, 60, -100), HitLocation, HitNormal, HitGroup) &&
+		HitLocation.Equals(FVector(40, 60, 30), 1e-3) && FMath::IsNearlyEqual(FMath::Abs(HitNormal.Z), 1.0, 1e-4) && HitGroup == GroupKey);
+	TestTrue(TEXT("Sphere sweep stops a radius above the quad"), RealtimeMesh->SweepSphereRenderData(LODKey, FVector(40, 60, 100), FVector(40, 60, -100), 5.0f, HitLocation, HitNormal, HitGroup) &&
+		HitLocation.Equals(FVector(40, 60, 30), 1e-3) && HitNormal.Equals(FVector::UpVector, 1e-4));
+	TestTrue(TEXT("Closest point finds the moved quad"), RealtimeMesh->FindClosestPointOnRenderData(LODKey, FVector(150, 50, 30), 60.0f, HitLocation, HitNormal, HitGroup) &&
+		HitLocation.Equals(FVector(100, 50, 30), 1e-3));
+	TestFalse(TEXT("Line trace that misses finds nothing"), RealtimeMesh->LineTraceRenderData(LODKey, FVector(140, 60, 100), FVector(140, 60, -100), HitLocation, HitNormal, HitGroup));
+
+	// Resending the triangles forces a full rebuild
+	FRealtimeMeshStreamSet UpdatedStreamSet;
+	BuildSpatialTestQuad(UpdatedStreamSet, FVector3f(0, 0, 10), 100.0f);
+	RealtimeMesh->UpdateSectionGroup(GroupKey, UpdatedStreamSet);
+
+	const FRealtimeMeshSpatialIndexPtr Third = MeshData->UpdateSpatialIndex(LODKey).Get();
+	TestTrue(TEXT("Topology change rebuilds"), Third.IsValid() && !Third->FindGroup(GroupKey)->WasRefit());
+
+	return true;
+}
+
+// =====================================================================================================================
+// Batch Query Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshSpatialBatchTest,
+	"RealtimeMeshComponent.SpatialQuery.Batch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshSpatialBatchTest::RunTest(const FString& Parameters)
+{
+	URealtimeMeshSimple* RealtimeMesh = NewObject<URealtimeMeshSimple>();
+	const FRealtimeMeshLODKey LODKey(0);
+
+	FRealtimeMeshStreamSet StreamsA, StreamsB;
+	BuildSpatialTestQuad(StreamsA, FVector3f::ZeroVector, 100.0f);
+	BuildSpatialTestQuad(StreamsB, FVector3f(50, 50, 20), 100.0f);
+	RealtimeMesh->CreateSectionGroup(FRealtimeMeshSectionGroupKey::Create(LODKey, FName("A")), StreamsA);
+	RealtimeMesh->CreateSectionGroup(FRealtimeMeshSectionGroupKey::Create(LODKey, FName("B")), StreamsB);
+
+	const FRealtimeMeshSpatialIndexPtr SpatialIndex = RealtimeMesh->GetMeshData()->GetSpatialIndex(LODKey, true);
+	TestTrue(TEXT("Index is available"), SpatialIndex.IsValid());
+	if (!SpatialIndex)
+	{
+		return false;
+	}
+
+	// Enough queries to go wide, with some that miss everything
+	FRandomStream Random(5);
+	TArray<FVector3f> Origins, Directions;
+	for (int32 Index = 0; Index < 2000; Index++)
+	{
+		Origins.Add(FVector3f(Random.FRandRange(-30.0f, 180.0f), Random.FRandRange(-30.0f, 180.0f), Random.FRandRange(40.0f, 60.0f)));
+		Directions.Add(FVector3f(Random.FRandRange(-0.3f, 0.3f), Random.FRandRange(-0.3f, 0.3f), -1.0f).GetSafeNormal());
+	}
+
+	TArray<FRealtimeMeshSpatialHit> RayHits, SweepHits, ClosestHits;
+	RayHits.SetNum(Origins.Num());
+	SweepHits.SetNum(Origins.Num());
+	ClosestHits.SetNum(Origins.Num());
+	const int32 NumRayHits = SpatialIndex->RaycastBatch(Origins, Directions, 100.0f, RayHits);
+	const int32 NumSweepHits = SpatialIndex->SweepSphereBatch(Origins, Directions, 3.0f, 100.0f, SweepHits);
+	const int32 NumClosestHits = SpatialIndex->FindClosestPointBatch(Origins, 45.0f, ClosestHits);
+	TestTrue(TEXT("Batches hit and miss"), NumRayHits > 0 && NumRayHits < Origins.Num() && NumSweepHits >= NumRayHits && NumClosestHits > 0);
+
+	bool bBatchesMatch = true;
+	int32 NumCounted = 0;
+	for (int32 Index = 0; Index < Origins.Num(); Index++)
+	{
+		FRealtimeMeshSpatialHit Hit;
+		const bool bRayHit = SpatialIndex->Raycast(Origins[Index], Directions[Index], 100.0f, Hit);
+		bBatchesMatch &= bRayHit == RayHits[Index].IsValid() && (!bRayHit || (Hit.Distance == RayHits[Index].Distance && Hit.SectionGroupKey == RayHits[Index].SectionGroupKey));
+		NumCounted += bRayHit ? 1 : 0;
+
+		const bool bSweepHit = SpatialIndex->SweepSphere(Origins[Index], Directions[Index], 3.0f, 100.0f, Hit);
+		bBatchesMatch &= bSweepHit == SweepHits[Index].IsValid() && (!bSweepHit || Hit.Distance == SweepHits[Index].Distance);
+
+		const bool bClosestHit = SpatialIndex->FindClosestPoint(Origins[Index], 45.0f, Hit);
+		bBatchesMatch &= bClosestHit == ClosestHits[Index].IsValid() && (!bClosestHit || Hit.Distance == ClosestHits[Index].Distance);
+	}
+	TestTrue(TEXT("Batch results match single queries"), bBatchesMatch);
+	TestEqual(TEXT("Batch hit count matches"), NumRayHits, NumCounted);
+
+	return true;
+}
@@ -0,0 +1,85 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "RealtimeMeshCore.h"
+#include "RealtimeMeshSimple.h"
+#include "Core/RealtimeMeshBuilder.h"
+#include "Mesh/RealtimeMeshAlgo.h"
+
+using namespace RealtimeMesh;
+
+namespace
+{
+	void BuildStatsTestQuad(FRealtimeMeshStreamSet& StreamSet)
+	{
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(StreamSet);
+		Builder.EnableTangents();
+		Builder.EnableTexCoords();
+
+		Builder.AddVertex(FVector3f(0, 0, 0)).SetTexCoord(FVector2f(0, 0));
+		Builder.AddVertex(FVector3f(100, 0, 0)).SetTexCoord(FVector2f(1, 0));
+		Builder.AddVertex(FVector3f(100, 100, 0)).SetTexCoord(FVector2f(1, 1));
+		Builder.AddVertex(FVector3f(0, 100, 0)).SetTexCoord(FVector2f(0, 1));
+		Builder.AddTriangle(0, 1, 2);
+		Builder.AddTriangle(0, 2, 3);
+	}
+}
+
+// =====================================================================================================================
+// CPU Stream Memory Counter Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshStatsCPUStreamMemoryTest,
+	"RealtimeMeshComponent.Stats.CPUStreamMemory",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshStatsCPUStreamMemoryTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshStatCounters& Counters = FRealtimeMeshStatCounters::Get();
+
+	FRealtimeMeshStreamSet StreamSet;
+	BuildStatsTestQuad(StreamSet);
+
+	SIZE_T ExpectedMemory = 0;
+	StreamSet.ForEach([&](const FRealtimeMeshStream& Stream)
+	{
+		ExpectedMemory += Stream.GetResourceDataSize();
+	});
+
+	URealtimeMeshSimple* RealtimeMesh = NewObject<URealtimeMeshSimple>();
+	const int64 MemoryBefore = Counters.CPUStreamMemory;
+
+	const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(FRealtimeMeshLODKey(0), FName("StatsTest"));
+	RealtimeMesh->CreateSectionGroup(GroupKey, StreamSet);
+
+	const int64 MemoryAfterCreate = Counters.CPUStreamMemory;
+	TestTrue(TEXT("Creating a section group accounts its streams"), MemoryAfterCreate - MemoryBefore >= static_cast<int64>(ExpectedMemory));
+
+	RealtimeMesh->RemoveSectionGroup(GroupKey);
+	TestEqual(TEXT("Removing the section group releases its streams"), static_cast<int64>(Counters.CPUStreamMemory), MemoryBefore);
+
+	return true;
+}
+
+// =====================================================================================================================
+// Pipeline Counter Tests
+// =====================================================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshStatsTangentCounterTest,
+	"RealtimeMeshComponent.Stats.GenerateTangents",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshStatsTangentCounterTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshStatCounters& Counters = FRealtimeMeshStatCounters::Get();
+
+	FRealtimeMeshStreamSet StreamSet;
+	BuildStatsTestQuad(StreamSet);
+
+	const int64 GenerationsBefore = Counters.TangentGenerations;
+	RealtimeMeshAlgo::GenerateTangents(StreamSet);
+	RealtimeMeshAlgo::GenerateTangents(StreamSet);
+	TestEqual(TEXT("Each tangent generation is counted"), static_cast<int64>(Counters.TangentGenerations) - GenerationsBefore, static_cast<int64>(2));
+
+	return true;
+}
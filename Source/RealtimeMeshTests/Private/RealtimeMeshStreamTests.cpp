@@ -1,7 +1,8 @@
-// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
 
 #include "Misc/AutomationTest.h"
 #include "Interface/Core/RealtimeMeshDataStream.h"
+#include "HAL/IConsoleManager.h"
 
 using namespace RealtimeMesh;
 
@@ -1081,3 +1082,127 @@ bool FRealtimeMeshStreamSetGetStreamKeysTest::RunTest(const FString& Parameters)
 
 	return true;
 }
+
+// ===========================================================================================
+// Parallel Copy Tests
+// ===========================================================================================
+
+namespace
+{
+	// Overrides the parallel copy cvars for the lifetime of the scope
+	struct FScopedParallelStreamCopySettings
+	{
+		IConsoleVariable* ThresholdVar;
+		IConsoleVariable* ChunkSizeVar;
+		int32 OldThreshold;
+		int32 OldChunkSize;
+
+		FScopedParallelStreamCopySettings(int32 Threshold, int32 ChunkSize)
+			: ThresholdVar(IConsoleManager::Get().FindConsoleVariable(TEXT("RealtimeMesh.Streams.ParallelCopyThreshold")))
+			, ChunkSizeVar(IConsoleManager::Get().FindConsoleVariable(TEXT("RealtimeMesh.Streams.ParallelCopyChunkSize")))
+			, OldThreshold(ThresholdVar->GetInt())
+			, OldChunkSize(ChunkSizeVar->GetInt())
+		{
+			ThresholdVar->Set(Threshold, ECVF_SetByCode);
+			ChunkSizeVar->Set(ChunkSize, ECVF_SetByCode);
+		}
+
+		~FScopedParallelStreamCopySettings()
+		{
+			ThresholdVar->Set(OldThreshold, ECVF_SetByCode);
+			ChunkSizeVar->Set(OldChunkSize, ECVF_SetByCode);
+		}
+	};
+
+	bool StreamsAreBitIdentical(const FRealtimeMeshStream& A, const FRealtimeMeshStream& B)
+	{
+		return A.GetLayout() == B.GetLayout() && A.Num() == B.Num() &&
+			FMemory::Memcmp(A.GetData(), B.GetData(), A.GetResourceDataSize()) == 0;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshStreamParallelCopyTest,
+	"RealtimeMeshComponent.Streams.Stream.ParallelCopy",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshStreamParallelCopyTest::RunTest(const FString& Parameters)
+{
+	const FRealtimeMeshStreamKey PositionKey(ERealtimeMeshStreamType::Vertex, FName("Position"));
+	const FRealtimeMeshStreamKey TexCoordKey(ERealtimeMeshStreamType::Vertex, FName("TexCoords"));
+
+	TArray<FVector3d> Positions;
+	TArray<FVector2d> TexCoords;
+	for (int32 Index = 0; Index < 100003; Index++)
+	{
+		Positions.Add(FVector3d(Index * 0.1, -Index * 1.7, FMath::Sin(Index * 0.01)));
+		TexCoords.Add(FVector2d(Index / 1024.0, FMath::Frac(Index * 0.37)));
+	}
+
+	auto BuildStreams = [&](FRealtimeMeshStream& OutPositions, FRealtimeMeshStream& OutTexCoords, FRealtimeMeshStream& OutConverted)
+	{
+		// Conversion path
+		OutPositions = FRealtimeMeshStream::Create<FVector3f>(PositionKey);
+		OutPositions.Append(Positions);
+
+		// Interleaved conversion path into a single channel
+		OutTexCoords = FRealtimeMeshStream(TexCoordKey, GetRealtimeMeshBufferLayout<FVector2DHalf>(2));
+		OutTexCoords.SetNumZeroed(TexCoords.Num());
+		OutTexCoords.SetElementRange<FVector2d>(0, 1, TexCoords);
+
+		// In-place conversion of an existing stream
+		OutConverted = FRealtimeMeshStream::Create<FVector3d>(PositionKey);
+		OutConverted.Append(Positions);
+		OutConverted.ConvertTo<FVector3f>();
+	};
+
+	FRealtimeMeshStream SerialPositions, SerialTexCoords, SerialConverted;
+	{
+		FScopedParallelStreamCopySettings Settings(0, 0);
+		BuildStreams(SerialPositions, SerialTexCoords, SerialConverted);
+	}
+
+	FRealtimeMeshStream ParallelPositions, ParallelTexCoords, ParallelConverted;
+	{
+		// Odd chunk size so chunks don't line up with the row count
+		FScopedParallelStreamCopySettings Settings(1024, 4099);
+		BuildStreams(ParallelPositions, ParallelTexCoords, ParallelConverted);
+	}
+
+	TestTrue(TEXT("Parallel conversion matches serial"), StreamsAreBitIdentical(SerialPositions, ParallelPositions));
+	TestTrue(TEXT("Parallel interleaved conversion matches serial"), StreamsAreBitIdentical(SerialTexCoords, ParallelTexCoords));
+	TestTrue(TEXT("Parallel ConvertTo matches serial"), StreamsAreBitIdentical(SerialConverted, ParallelConverted));
+	TestTrue(TEXT("ConvertTo matches Append conversion"), StreamsAreBitIdentical(SerialPositions, SerialConverted));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshStreamSetRangeAsyncTest,
+	"RealtimeMeshComponent.Streams.Stream.SetRangeAsync",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshStreamSetRangeAsyncTest::RunTest(const FString& Parameters)
+{
+	const FRealtimeMeshStreamKey PositionKey(ERealtimeMeshStreamType::Vertex, FName("Position"));
+
+	TArray<FVector3d> Positions;
+	for (int32 Index = 0; Index < 50000; Index++)
+	{
+		Positions.Add(FVector3d(Index, Index * 0.5, -Index * 0.25));
+	}
+
+	FRealtimeMeshStream Expected = FRealtimeMeshStream::Create<FVector3f>(PositionKey);
+	Expected.Append(Positions);
+
+	FRealtimeMeshStream Actual = FRealtimeMeshStream::Create<FVector3f>(PositionKey);
+	Actual.SetNumUninitialized(Positions.Num());
+	TFuture<void> Future = Actual.SetRangeAsync<FVector3d>(0, Positions);
+	Future.Wait();
+
+	TestTrue(TEXT("Async future completed"), Future.IsReady());
+	TestTrue(TEXT("Async copy matches synchronous copy"), StreamsAreBitIdentical(Expected, Actual));
+
+	TFuture<void> EmptyFuture = Actual.SetRangeAsync<FVector3d>(0, TArrayView<const FVector3d>());
+	TestTrue(TEXT("Empty async copy is immediately ready"), EmptyFuture.IsReady());
+
+	return true;
+}
@@ -0,0 +1,56 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RealtimeMeshSimple.h"
+#include "Core/RealtimeMeshBuilder.h"
+
+/*
+ * Mesh data shared by the automation tests
+ */
+namespace RealtimeMeshTests
+{
+	using namespace RealtimeMesh;
+
+	// Resolution x Resolution quads on a gently rolling surface, with tangents and texcoords, so every stream has varied content
+	inline FRealtimeMeshStreamSet BuildTestGrid(int32 Resolution)
+	{
+		FRealtimeMeshStreamSet StreamSet;
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(StreamSet);
+		Builder.EnableTangents();
+		Builder.EnableTexCoords();
+
+		for (int32 Y = 0; Y <= Resolution; Y++)
+		{
+			for (int32 X = 0; X <= Resolution; X++)
+			{
+				Builder.AddVertex(FVector3f(X * 10.0f, Y * 10.0f, FMath::Sin(X * 0.3f) * 25.0f)).SetTexCoord(FVector2f(X, Y) / static_cast<float>(Resolution));
+			}
+		}
+		for (int32 Y = 0; Y < Resolution; Y++)
+		{
+			for (int32 X = 0; X < Resolution; X++)
+			{
+				const int32 Corner = Y * (Resolution + 1) + X;
+				Builder.AddTriangle(Corner, Corner + 1, Corner + Resolution + 2);
+				Builder.AddTriangle(Corner, Corner + Resolution + 2, Corner + Resolution + 1);
+			}
+		}
+		return StreamSet;
+	}
+
+	// Raw bytes of every stream in the section group, keyed by stream
+	inline TMap<FRealtimeMeshStreamKey, TArray<uint8>> GetTestStreamData(URealtimeMeshSimple* RealtimeMesh, const FRealtimeMeshSectionGroupKey& GroupKey)
+	{
+		TMap<FRealtimeMeshStreamKey, TArray<uint8>> Data;
+		RealtimeMesh->ProcessMesh(GroupKey, [&](const FRealtimeMeshStreamSet& Streams)
+		{
+			Streams.ForEach([&](const FRealtimeMeshStream& Stream)
+			{
+				Data.Add(Stream.GetStreamKey(), TArray<uint8>(Stream.GetData(), Stream.GetResourceDataSize()));
+			});
+		});
+		return Data;
+	}
+}